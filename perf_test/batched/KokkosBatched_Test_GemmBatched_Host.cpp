@@ -0,0 +1,249 @@
+#include <iomanip>
+
+#include "Kokkos_Core.hpp"
+#include "impl/Kokkos_Timer.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Serial_Impl.hpp"
+#include "KokkosBatched_GemmBatched_Decl.hpp"
+#include "KokkosBatched_GemmBatched_Impl.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    namespace PerfTest {
+
+      template<typename ValueType>
+      double FlopCountGemmBatched(int mm, int nn, int kk) {
+        const double flop_mul = Kokkos::Details::ArithTraits<ValueType>::is_complex ? 6.0 : 1.0;
+        const double flop_add = Kokkos::Details::ArithTraits<ValueType>::is_complex ? 2.0 : 1.0;
+        double m = (double)mm;    double n = (double)nn;    double k = (double)kk;
+        return (flop_mul*(m*n*k) +
+                flop_add*(m*n*k));
+      }
+
+      // baseline: a user written loop of SerialGemm over scalar views
+      template<typename ViewType>
+      struct Functor_GemmBatchedBaseline {
+        ViewType _a, _b, _c;
+        Functor_GemmBatchedBaseline(const ViewType &a, const ViewType &b, const ViewType &c)
+          : _a(a), _b(b), _c(c) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int k) const {
+          auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+          auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+          auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+
+          SerialGemm<Trans::NoTranspose,Trans::NoTranspose,Algo::Gemm::Blocked>::
+            invoke(1.0, aa, bb, 1.0, cc);
+        }
+      };
+
+      template<typename ValueType, typename HostSpaceType>
+      void GemmBatchedUniform(const int N, const int BlkSize) {
+        typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,HostSpaceType> view_type;
+        typedef GemmBatched<Trans::NoTranspose,Trans::NoTranspose> gemm_batched_type;
+
+        const double flop = N*FlopCountGemmBatched<ValueType>(BlkSize,BlkSize,BlkSize);
+        const double tmax = 1.0e15;
+
+        const int iter_begin = -10, iter_end = 100;
+        Kokkos::Impl::Timer timer;
+
+        view_type
+          amat("amat", N, BlkSize, BlkSize),
+          bmat("bmat", N, BlkSize, BlkSize),
+          a("a", N, BlkSize, BlkSize),
+          b("b", N, BlkSize, BlkSize),
+          c("c", N, BlkSize, BlkSize),
+          cref("cref", N, BlkSize, BlkSize);
+
+        Kokkos::Random_XorShift64_Pool<HostSpaceType> random(13718);
+        Kokkos::fill_random(amat, random, ValueType(1.0));
+        Kokkos::fill_random(bmat, random, ValueType(1.0));
+
+        // for KNL (1MB per tile)
+        constexpr size_t LLC_CAPACITY = 34*1024*1024;
+        Flush<LLC_CAPACITY> flush;
+
+        const int auto_mode = gemm_batched_type::template select<ValueType,HostSpaceType>(N, BlkSize, BlkSize, BlkSize);
+        const int modes[5] = { -1,
+                               GemmBatchedMode::Serial,
+                               GemmBatchedMode::Team,
+                               GemmBatchedMode::SerialSIMD,
+                               GemmBatchedMode::Auto };
+
+        for (int p=0;p<5;++p) {
+          const int mode = modes[p];
+          double tavg = 0, tmin = tmax;
+          int r_val = 0;
+          for (int iter=iter_begin;iter<iter_end;++iter) {
+            // flush
+            flush.run();
+
+            // initialize matrices
+            Kokkos::deep_copy(a, amat);
+            Kokkos::deep_copy(b, bmat);
+            Kokkos::deep_copy(c, 0);
+
+            HostSpaceType::fence();
+            timer.reset();
+
+            if (mode < 0) {
+              const Kokkos::RangePolicy<HostSpaceType,Kokkos::Schedule<Kokkos::Static> > policy(0, N);
+              Kokkos::parallel_for(policy, Functor_GemmBatchedBaseline<view_type>(a, b, c));
+            } else {
+              r_val = gemm_batched_type::invoke(1.0, a, b, 1.0, c, mode);
+            }
+
+            HostSpaceType::fence();
+            const double t = timer.seconds();
+            tmin = std::min(tmin, t);
+            tavg += (iter >= 0)*t;
+          }
+          tavg /= iter_end;
+
+          std::string label;
+          if (mode < 0) {
+            label = "KK Loop";
+            Kokkos::deep_copy(cref, c);
+          } else {
+            label = GemmBatchedMode::name(mode);
+            if (mode == GemmBatchedMode::Auto)
+              label = std::string("Auto:") + GemmBatchedMode::name(auto_mode);
+          }
+          if (r_val != 0) {
+            std::cout << std::setw(16) << label
+                      << " BlkSize = " << std::setw(3) << BlkSize
+                      << " is not available"
+                      << std::endl;
+            continue;
+          }
+
+          double diff = 0;
+          for (int k=0;k<N;++k)
+            for (int i=0;i<BlkSize;++i)
+              for (int j=0;j<BlkSize;++j)
+                diff += std::abs(cref(k,i,j) - c(k,i,j));
+
+          std::cout << std::setw(16) << label
+                    << " BlkSize = " << std::setw(3) << BlkSize
+                    << " time = " << std::scientific << tmin
+                    << " avg flop/s = " << (flop/tavg)
+                    << " max flop/s = " << (flop/tmin)
+                    << " diff to ref = " << diff
+                    << std::endl;
+        }
+        std::cout << std::endl;
+      }
+
+      template<typename ValueType, typename HostSpaceType>
+      void GemmBatchedVariable(const int N, const int MaxBlkSize) {
+        typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,HostSpaceType> view_type;
+        typedef GemmBatched<Trans::NoTranspose,Trans::NoTranspose> gemm_batched_type;
+
+        const double tmax = 1.0e15;
+        const int iter_begin = -10, iter_end = 100;
+        Kokkos::Impl::Timer timer;
+
+        view_type
+          amat("amat", N, MaxBlkSize, MaxBlkSize),
+          bmat("bmat", N, MaxBlkSize, MaxBlkSize),
+          a("a", N, MaxBlkSize, MaxBlkSize),
+          b("b", N, MaxBlkSize, MaxBlkSize),
+          c("c", N, MaxBlkSize, MaxBlkSize);
+        Kokkos::View<int**,Kokkos::LayoutRight,HostSpaceType> sizes("sizes", N, 3);
+
+        Kokkos::Random_XorShift64_Pool<HostSpaceType> random(13718);
+        Kokkos::fill_random(amat, random, ValueType(1.0));
+        Kokkos::fill_random(bmat, random, ValueType(1.0));
+
+        // three block sizes mixed in one batch
+        const int blks[3] = { MaxBlkSize/3, (2*MaxBlkSize)/3, MaxBlkSize };
+        double flop = 0;
+        for (int k=0;k<N;++k) {
+          const int blk = blks[k%3];
+          sizes(k,0) = blk; sizes(k,1) = blk; sizes(k,2) = blk;
+          flop += FlopCountGemmBatched<ValueType>(blk,blk,blk);
+        }
+
+        const int modes[2] = { GemmBatchedMode::Serial,
+                               GemmBatchedMode::Team };
+        for (int p=0;p<2;++p) {
+          double tavg = 0, tmin = tmax;
+          for (int iter=iter_begin;iter<iter_end;++iter) {
+            Kokkos::deep_copy(a, amat);
+            Kokkos::deep_copy(b, bmat);
+            Kokkos::deep_copy(c, 0);
+
+            HostSpaceType::fence();
+            timer.reset();
+
+            gemm_batched_type::invoke(1.0, a, b, 1.0, c, sizes, modes[p]);
+
+            HostSpaceType::fence();
+            const double t = timer.seconds();
+            tmin = std::min(tmin, t);
+            tavg += (iter >= 0)*t;
+          }
+          tavg /= iter_end;
+
+          std::cout << std::setw(16) << (std::string("Var:") + GemmBatchedMode::name(modes[p]))
+                    << " BlkSize <= " << std::setw(3) << MaxBlkSize
+                    << " time = " << std::scientific << tmin
+                    << " avg flop/s = " << (flop/tavg)
+                    << " max flop/s = " << (flop/tmin)
+                    << std::endl;
+        }
+        std::cout << std::endl;
+      }
+
+    } // end perftest
+  } // end experimental
+} // end batched
+
+using namespace KokkosBatched::Experimental;
+
+template<typename ValueType>
+void run(const int N) {
+  typedef Kokkos::DefaultHostExecutionSpace HostSpaceType;
+
+  PerfTest::GemmBatchedUniform<ValueType,HostSpaceType>(N,  3);
+  PerfTest::GemmBatchedUniform<ValueType,HostSpaceType>(N,  5);
+  PerfTest::GemmBatchedUniform<ValueType,HostSpaceType>(N, 10);
+  PerfTest::GemmBatchedUniform<ValueType,HostSpaceType>(N, 15);
+  PerfTest::GemmBatchedUniform<ValueType,HostSpaceType>(N/64, 64);
+
+  PerfTest::GemmBatchedVariable<ValueType,HostSpaceType>(N, 15);
+}
+
+int main(int argc, char *argv[]) {
+
+  Kokkos::initialize(argc, argv);
+
+  int N = 128*128;
+  for (int i=1;i<argc;++i) {
+    const std::string& token = argv[i];
+    if (token == std::string("-N")) N = std::atoi(argv[++i]);
+  }
+
+  {
+    Kokkos::print_configuration(std::cout);
+
+    std::cout << " N = " << N << std::endl;
+
+    std::cout << "\n Testing double\n";
+    run<double>(N);
+
+    std::cout << "\n Testing Kokkos::complex<double>\n";
+    run<Kokkos::complex<double> >(N);
+  }
+
+  Kokkos::finalize();
+
+  return 0;
+}
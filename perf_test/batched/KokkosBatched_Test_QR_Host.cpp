@@ -0,0 +1,230 @@
+#include <iomanip>
+
+#include "Kokkos_Core.hpp"
+#include "impl/Kokkos_Timer.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+#include "KokkosBatched_QR_Decl.hpp"
+#include "KokkosBatched_QR_Serial_Impl.hpp"
+#include "KokkosBatched_QR_Team_Impl.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    namespace PerfTest {
+
+      // Householder QR of an m x n matrix and a least-squares solve with one right hand side
+      double FlopCountQR_Solve(int mm, int nn) {
+        double m = (double)mm;    double n = (double)nn;
+        return (2.0*m*n*n - 2.0/3.0*n*n*n +
+                4.0*m*n - 2.0*n*n +
+                n*n);
+      }
+
+      template<typename ViewType, typename TauViewType, typename BViewType, typename AlgoTagType>
+      struct Functor_SerialQR_Solve {
+        ViewType _a;
+        TauViewType _t;
+        BViewType _b;
+        Functor_SerialQR_Solve(const ViewType &a, const TauViewType &t, const BViewType &b)
+          : _a(a), _t(t), _b(b) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int k) const {
+          auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+          auto tt = Kokkos::subview(_t, k, Kokkos::ALL());
+          auto bb = Kokkos::subview(_b, k, Kokkos::ALL());
+
+          SerialQR<AlgoTagType>::invoke(aa, tt);
+          SerialQRSolve<AlgoTagType>::invoke(aa, tt, bb);
+        }
+      };
+
+      template<typename ViewType, typename TauViewType, typename BViewType, typename AlgoTagType>
+      struct Functor_TeamQR_Solve {
+        ViewType _a;
+        TauViewType _t;
+        BViewType _b;
+        Functor_TeamQR_Solve(const ViewType &a, const TauViewType &t, const BViewType &b)
+          : _a(a), _t(t), _b(b) {}
+
+        template<typename MemberType>
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const MemberType &member) const {
+          const int k = member.league_rank();
+          auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+          auto tt = Kokkos::subview(_t, k, Kokkos::ALL());
+          auto bb = Kokkos::subview(_b, k, Kokkos::ALL());
+
+          TeamQR<MemberType,AlgoTagType>::invoke(member, aa, tt);
+          member.team_barrier();
+          TeamQRSolve<MemberType,AlgoTagType>::invoke(member, aa, tt, bb);
+        }
+      };
+
+      template<typename ValueType, typename HostSpaceType>
+      void QR_Solve(const int N, const int m, const int n) {
+        typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,HostSpaceType> view_type;
+        typedef Kokkos::View<ValueType**,Kokkos::LayoutRight,HostSpaceType> vector_view_type;
+
+        typedef Vector<SIMD<ValueType>,DefaultVectorLength<ValueType,typename HostSpaceType::memory_space>::value> vector_type;
+        typedef Kokkos::View<vector_type***,Kokkos::LayoutRight,HostSpaceType> pack_view_type;
+        typedef Kokkos::View<vector_type**,Kokkos::LayoutRight,HostSpaceType> pack_vector_view_type;
+
+        const int vl = vector_type::vector_length;
+        const int npack = N/vl + (N%vl > 0);
+
+        const double flop = N*FlopCountQR_Solve(m, n);
+        const double tmax = 1.0e15;
+
+        const int iter_begin = -10, iter_end = 100;
+        Kokkos::Impl::Timer timer;
+
+        view_type amat("amat", N, m, n), a("a", N, m, n);
+        vector_view_type
+          bvec("bvec", N, m), b("b", N, m), bref("bref", N, m),
+          tau("tau", N, n);
+
+        pack_view_type apmat("apmat", npack, m, n), ap("ap", npack, m, n);
+        pack_vector_view_type
+          bpvec("bpvec", npack, m), bp("bp", npack, m),
+          taup("taup", npack, n);
+
+        Kokkos::Random_XorShift64_Pool<HostSpaceType> random(13718);
+        Kokkos::fill_random(amat, random, ValueType(1.0));
+        Kokkos::fill_random(bvec, random, ValueType(1.0));
+        for (int k=0;k<N;++k)
+          for (int i=0;i<n;++i)
+            amat(k,i,i) += ValueType(1.0*n);
+
+        pack_compact(amat, apmat);
+        pack_compact(bvec, bpvec);
+
+        // for KNL (1MB per tile)
+        constexpr size_t LLC_CAPACITY = 34*1024*1024;
+        Flush<LLC_CAPACITY> flush;
+
+        const char *labels[4] = { "Serial Unblocked",
+                                  "Serial Blocked",
+                                  "SIMD Serial",
+                                  "SIMD Team" };
+        for (int p=0;p<4;++p) {
+          double tavg = 0, tmin = tmax;
+          for (int iter=iter_begin;iter<iter_end;++iter) {
+            // flush
+            flush.run();
+
+            // initialize matrices
+            Kokkos::deep_copy(a, amat);
+            Kokkos::deep_copy(b, bvec);
+            Kokkos::deep_copy(ap, apmat);
+            Kokkos::deep_copy(bp, bpvec);
+
+            HostSpaceType::fence();
+            timer.reset();
+
+            switch (p) {
+            case 0: {
+              const Kokkos::RangePolicy<HostSpaceType,Kokkos::Schedule<Kokkos::Static> > policy(0, N);
+              Kokkos::parallel_for(policy, Functor_SerialQR_Solve
+                                   <view_type,vector_view_type,vector_view_type,Algo::QR::Unblocked>(a, tau, b));
+              break;
+            }
+            case 1: {
+              const Kokkos::RangePolicy<HostSpaceType,Kokkos::Schedule<Kokkos::Static> > policy(0, N);
+              Kokkos::parallel_for(policy, Functor_SerialQR_Solve
+                                   <view_type,vector_view_type,vector_view_type,Algo::QR::Blocked>(a, tau, b));
+              break;
+            }
+            case 2: {
+              const Kokkos::RangePolicy<HostSpaceType,Kokkos::Schedule<Kokkos::Static> > policy(0, npack);
+              Kokkos::parallel_for(policy, Functor_SerialQR_Solve
+                                   <pack_view_type,pack_vector_view_type,pack_vector_view_type,Algo::QR::Blocked>(ap, taup, bp));
+              break;
+            }
+            case 3: {
+              const Kokkos::TeamPolicy<HostSpaceType> policy(npack, Kokkos::AUTO);
+              Kokkos::parallel_for(policy, Functor_TeamQR_Solve
+                                   <pack_view_type,pack_vector_view_type,pack_vector_view_type,Algo::QR::Blocked>(ap, taup, bp));
+              break;
+            }
+            }
+
+            HostSpaceType::fence();
+            const double t = timer.seconds();
+            tmin = std::min(tmin, t);
+            tavg += (iter >= 0)*t;
+          }
+          tavg /= iter_end;
+
+          if (p == 0)
+            Kokkos::deep_copy(bref, b);
+          else if (p >= 2)
+            unpack_compact(bp, b);
+
+          // solutions are in the first n entries of b
+          double diff = 0;
+          for (int k=0;k<N;++k)
+            for (int i=0;i<n;++i)
+              diff += std::abs(bref(k,i) - b(k,i));
+
+          std::cout << std::setw(16) << labels[p]
+                    << " m = " << std::setw(3) << m
+                    << " n = " << std::setw(3) << n
+                    << " time = " << std::scientific << tmin
+                    << " avg flop/s = " << (flop/tavg)
+                    << " max flop/s = " << (flop/tmin)
+                    << " diff to ref = " << diff
+                    << std::endl;
+        }
+        std::cout << std::endl;
+      }
+
+    } // end perftest
+  } // end experimental
+} // end batched
+
+using namespace KokkosBatched::Experimental;
+
+template<typename ValueType>
+void run(const int N) {
+  typedef Kokkos::DefaultHostExecutionSpace HostSpaceType;
+
+  PerfTest::QR_Solve<ValueType,HostSpaceType>(N,  3,  3);
+  PerfTest::QR_Solve<ValueType,HostSpaceType>(N,  5,  5);
+  PerfTest::QR_Solve<ValueType,HostSpaceType>(N, 10,  5);
+  PerfTest::QR_Solve<ValueType,HostSpaceType>(N, 10, 10);
+  PerfTest::QR_Solve<ValueType,HostSpaceType>(N, 20, 10);
+  PerfTest::QR_Solve<ValueType,HostSpaceType>(N, 15, 15);
+}
+
+int main(int argc, char *argv[]) {
+
+  Kokkos::initialize(argc, argv);
+
+  int N = 128*128;
+  for (int i=1;i<argc;++i) {
+    const std::string& token = argv[i];
+    if (token == std::string("-N")) N = std::atoi(argv[++i]);
+  }
+
+  {
+    Kokkos::print_configuration(std::cout);
+
+    std::cout << " N = " << N << std::endl;
+
+    std::cout << "\n Testing double\n";
+    run<double>(N);
+
+    std::cout << "\n Testing float\n";
+    run<float>(N);
+  }
+
+  Kokkos::finalize();
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+#include <iomanip>
+
+#include "Kokkos_Core.hpp"
+#include "impl/Kokkos_Timer.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+#include "KokkosBatched_SymEigen_Decl.hpp"
+#include "KokkosBatched_SymEigen_Serial_Impl.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    namespace PerfTest {
+
+      template<typename ViewType, typename EViewType, typename AlgoTagType>
+      struct Functor_SerialSymEigen {
+        ViewType _a, _v;
+        EViewType _e;
+        Functor_SerialSymEigen(const ViewType &a, const EViewType &e, const ViewType &v)
+          : _a(a), _v(v), _e(e) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int k) const {
+          auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+          auto ee = Kokkos::subview(_e, k, Kokkos::ALL());
+          auto vv = Kokkos::subview(_v, k, Kokkos::ALL(), Kokkos::ALL());
+
+          SerialSymEigen<AlgoTagType>::invoke(aa, ee, vv);
+        }
+      };
+
+      template<typename ValueType, typename HostSpaceType, typename AlgoTagType>
+      void SymEigen(const int N, const int BlkSize) {
+        typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,HostSpaceType> view_type;
+        typedef Kokkos::View<ValueType**,Kokkos::LayoutRight,HostSpaceType> eigenvalue_view_type;
+
+        typedef Vector<SIMD<ValueType>,DefaultVectorLength<ValueType,typename HostSpaceType::memory_space>::value> vector_type;
+        typedef Kokkos::View<vector_type***,Kokkos::LayoutRight,HostSpaceType> pack_view_type;
+        typedef Kokkos::View<vector_type**,Kokkos::LayoutRight,HostSpaceType> pack_eigenvalue_view_type;
+
+        const int vl = vector_type::vector_length;
+        const int npack = N/vl + (N%vl > 0);
+
+        const double tmax = 1.0e15;
+
+        const int iter_begin = -10, iter_end = 100;
+        Kokkos::Impl::Timer timer;
+
+        view_type amat("amat", N, BlkSize, BlkSize), a("a", N, BlkSize, BlkSize), v("v", N, BlkSize, BlkSize);
+        eigenvalue_view_type e("e", N, BlkSize), eref("eref", N, BlkSize);
+
+        pack_view_type apmat("apmat", npack, BlkSize, BlkSize), ap("ap", npack, BlkSize, BlkSize), vp("vp", npack, BlkSize, BlkSize);
+        pack_eigenvalue_view_type ep("ep", npack, BlkSize);
+
+        Kokkos::Random_XorShift64_Pool<HostSpaceType> random(13718);
+        Kokkos::fill_random(amat, random, ValueType(1.0));
+        for (int k=0;k<N;++k)
+          for (int i=0;i<BlkSize;++i)
+            for (int j=0;j<i;++j)
+              amat(k,i,j) = amat(k,j,i);
+
+        pack_compact(amat, apmat);
+
+        // for KNL (1MB per tile)
+        constexpr size_t LLC_CAPACITY = 34*1024*1024;
+        Flush<LLC_CAPACITY> flush;
+
+        const char *labels[2] = { "Scalar", "SIMD" };
+        for (int p=0;p<2;++p) {
+          double tavg = 0, tmin = tmax;
+          for (int iter=iter_begin;iter<iter_end;++iter) {
+            // flush
+            flush.run();
+
+            // initialize matrices
+            Kokkos::deep_copy(a, amat);
+            Kokkos::deep_copy(ap, apmat);
+
+            HostSpaceType::fence();
+            timer.reset();
+
+            if (p == 0) {
+              const Kokkos::RangePolicy<HostSpaceType,Kokkos::Schedule<Kokkos::Static> > policy(0, N);
+              Kokkos::parallel_for(policy, Functor_SerialSymEigen
+                                   <view_type,eigenvalue_view_type,AlgoTagType>(a, e, v));
+            } else {
+              const Kokkos::RangePolicy<HostSpaceType,Kokkos::Schedule<Kokkos::Static> > policy(0, npack);
+              Kokkos::parallel_for(policy, Functor_SerialSymEigen
+                                   <pack_view_type,pack_eigenvalue_view_type,AlgoTagType>(ap, ep, vp));
+            }
+
+            HostSpaceType::fence();
+            const double t = timer.seconds();
+            tmin = std::min(tmin, t);
+            tavg += (iter >= 0)*t;
+          }
+          tavg /= iter_end;
+
+          if (p == 0)
+            Kokkos::deep_copy(eref, e);
+          else
+            unpack_compact(ep, e);
+
+          double diff = 0;
+          for (int k=0;k<N;++k)
+            for (int i=0;i<BlkSize;++i)
+              diff += std::abs(eref(k,i) - e(k,i));
+
+          std::cout << std::setw(10) << AlgoTagType::name()
+                    << std::setw(8) << labels[p]
+                    << " BlkSize = " << std::setw(3) << BlkSize
+                    << " time = " << std::scientific << tmin
+                    << " avg matrices/s = " << (N/tavg)
+                    << " max matrices/s = " << (N/tmin)
+                    << " diff to ref = " << diff
+                    << std::endl;
+        }
+        std::cout << std::endl;
+      }
+
+    } // end perftest
+  } // end experimental
+} // end batched
+
+using namespace KokkosBatched::Experimental;
+
+template<typename ValueType>
+void run(const int N) {
+  typedef Kokkos::DefaultHostExecutionSpace HostSpaceType;
+
+  PerfTest::SymEigen<ValueType,HostSpaceType,Algo::SymEigen::ClosedForm>(N, 3);
+  PerfTest::SymEigen<ValueType,HostSpaceType,Algo::SymEigen::Jacobi>(N, 3);
+  PerfTest::SymEigen<ValueType,HostSpaceType,Algo::SymEigen::Jacobi>(N, 6);
+  PerfTest::SymEigen<ValueType,HostSpaceType,Algo::SymEigen::Jacobi>(N, 9);
+}
+
+int main(int argc, char *argv[]) {
+
+  Kokkos::initialize(argc, argv);
+
+  int N = 128*128;
+  for (int i=1;i<argc;++i) {
+    const std::string& token = argv[i];
+    if (token == std::string("-N")) N = std::atoi(argv[++i]);
+  }
+
+  {
+    Kokkos::print_configuration(std::cout);
+
+    std::cout << " N = " << N << std::endl;
+
+    std::cout << "\n Testing double\n";
+    run<double>(N);
+
+    std::cout << "\n Testing float\n";
+    run<float>(N);
+  }
+
+  Kokkos::finalize();
+
+  return 0;
+}
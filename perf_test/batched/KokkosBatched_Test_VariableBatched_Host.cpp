@@ -0,0 +1,167 @@
+#include <iomanip>
+
+#include "Kokkos_Core.hpp"
+#include "impl/Kokkos_Timer.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_VariableBatched_Decl.hpp"
+#include "KokkosBatched_VariableBatched_Impl.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    namespace PerfTest {
+
+      // gemm on entries with m = n = k drawn from [1,BlkSize], followed by lu and two trsv
+      template<typename ValueType, typename HostSpaceType>
+      void VariableBatched(const int N, const int BlkSize) {
+        typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,HostSpaceType> view_type;
+        typedef Kokkos::View<ValueType**,Kokkos::LayoutRight,HostSpaceType> vector_view_type;
+
+        const double tmax = 1.0e15;
+
+        const int iter_begin = -10, iter_end = 100;
+        Kokkos::Impl::Timer timer;
+
+        view_type
+          amat("amat", N, BlkSize, BlkSize), a("a", N, BlkSize, BlkSize),
+          b("b", N, BlkSize, BlkSize), c("c", N, BlkSize, BlkSize);
+        vector_view_type
+          xvec("xvec", N, BlkSize), x("x", N, BlkSize), xref("xref", N, BlkSize);
+        Kokkos::View<int**,Kokkos::LayoutRight,HostSpaceType> sizes("sizes", N, 3);
+
+        Kokkos::Random_XorShift64_Pool<HostSpaceType> random(13718);
+        Kokkos::fill_random(amat, random, ValueType(1.0));
+        Kokkos::fill_random(b, random, ValueType(1.0));
+        Kokkos::fill_random(xvec, random, ValueType(1.0));
+        for (int k=0;k<N;++k) {
+          for (int i=0;i<BlkSize;++i)
+            amat(k,i,i) += ValueType(4.0*BlkSize);
+          const int m = 1 + (k*7)%BlkSize;
+          for (int d=0;d<3;++d)
+            sizes(k,d) = m;
+        }
+
+        // the descriptor is built once and reused by every call
+        timer.reset();
+        VariableBatch<HostSpaceType> batch(sizes);
+        const double tbatch = timer.seconds();
+
+        std::cout << " BlkSize = " << std::setw(3) << BlkSize
+                  << " buckets = " << std::setw(3) << batch.NumBuckets()
+                  << " descriptor time = " << std::scientific << tbatch
+                  << std::endl;
+
+        // for KNL (1MB per tile)
+        constexpr size_t LLC_CAPACITY = 34*1024*1024;
+        Flush<LLC_CAPACITY> flush;
+
+        // Serial as the reference, then SerialSIMD on every instruction set the
+        // build and the host can run, side by side
+        int nrun = 0, modes[5], isas[5];
+        modes[nrun] = VariableBatchedMode::Serial; isas[nrun] = InstructionSet::Default; ++nrun;
+        for (int isa=InstructionSet::Scalar;isa<=InstructionSet::AVX512;++isa) {
+          const int active = set_instruction_set(isa);
+          if (isas[nrun-1] == active) continue;
+          modes[nrun] = VariableBatchedMode::SerialSIMD; isas[nrun] = active; ++nrun;
+        }
+
+        for (int p=0;p<nrun;++p) {
+          set_instruction_set(isas[p]);
+          double tavg = 0, tmin = tmax;
+          for (int iter=iter_begin;iter<iter_end;++iter) {
+            // flush
+            flush.run();
+
+            // initialize matrices
+            Kokkos::deep_copy(a, amat);
+            Kokkos::deep_copy(x, xvec);
+
+            HostSpaceType::fence();
+            timer.reset();
+
+            gemm_variable_batched<Trans::NoTranspose,Trans::NoTranspose>(batch, ValueType(1), a, b, ValueType(1), c, modes[p]);
+            lu_variable_batched(batch, a, modes[p]);
+            trsv_variable_batched<Uplo::Lower,Trans::NoTranspose,Diag::Unit>(batch, ValueType(1), a, x, modes[p]);
+            trsv_variable_batched<Uplo::Upper,Trans::NoTranspose,Diag::NonUnit>(batch, ValueType(1), a, x, modes[p]);
+
+            HostSpaceType::fence();
+            const double t = timer.seconds();
+            tmin = std::min(tmin, t);
+            tavg += (iter >= 0)*t;
+          }
+          tavg /= iter_end;
+
+          if (p == 0)
+            Kokkos::deep_copy(xref, x);
+
+          double diff = 0;
+          for (int k=0;k<N;++k)
+            for (int i=0;i<BlkSize;++i)
+              diff += std::abs(xref(k,i) - x(k,i));
+
+          std::cout << std::setw(12) << VariableBatchedMode::name(modes[p])
+                    << std::setw(8) << (modes[p] == VariableBatchedMode::SerialSIMD ?
+                                        InstructionSet::name(isas[p]) : "")
+                    << " vl = " << std::setw(2) << (modes[p] == VariableBatchedMode::SerialSIMD ?
+                                                    active_vector_length<ValueType>() : 1)
+                    << " BlkSize = " << std::setw(3) << BlkSize
+                    << " time = " << std::scientific << tmin
+                    << " avg matrices/s = " << (N/tavg)
+                    << " max matrices/s = " << (N/tmin)
+                    << " diff to ref = " << diff
+                    << std::endl;
+        }
+        set_instruction_set(InstructionSet::Default);
+        std::cout << std::endl;
+      }
+
+    } // end perftest
+  } // end experimental
+} // end batched
+
+using namespace KokkosBatched::Experimental;
+
+template<typename ValueType>
+void run(const int N) {
+  typedef Kokkos::DefaultHostExecutionSpace HostSpaceType;
+
+  PerfTest::VariableBatched<ValueType,HostSpaceType>(N,  3);
+  PerfTest::VariableBatched<ValueType,HostSpaceType>(N,  5);
+  PerfTest::VariableBatched<ValueType,HostSpaceType>(N, 10);
+  PerfTest::VariableBatched<ValueType,HostSpaceType>(N, 15);
+}
+
+int main(int argc, char *argv[]) {
+
+  Kokkos::initialize(argc, argv);
+
+  int N = 128*128;
+  for (int i=1;i<argc;++i) {
+    const std::string& token = argv[i];
+    if (token == std::string("-N")) N = std::atoi(argv[++i]);
+  }
+
+  {
+    Kokkos::print_configuration(std::cout);
+
+    std::cout << " N = " << N << std::endl;
+    std::cout << " SIMD instruction set = " << InstructionSet::name(active_instruction_set())
+              << " (compiled " << InstructionSet::name(compiled_instruction_set())
+              << ", host " << InstructionSet::name(host_instruction_set()) << ")" << std::endl
+              << " a wider set than the compiled one runs Vector<AVX<T>,l> for AVX512 and the generic vector otherwise"
+              << std::endl;
+
+    std::cout << "\n Testing double\n";
+    run<double>(N);
+
+    std::cout << "\n Testing float\n";
+    run<float>(N);
+  }
+
+  Kokkos::finalize();
+
+  return 0;
+}
@@ -41,6 +41,9 @@
 //@HEADER
 */
 #include <KokkosBlas.hpp>
+#include <KokkosBlas1_reproducible.hpp>
+#include <Kokkos_Random.hpp>
+#include <cmath>
 #include <Teuchos_CommandLineProcessor.hpp>
 #include <Teuchos_TimeMonitor.hpp>
 #include <Teuchos_Comm.hpp>
@@ -67,10 +70,113 @@ RCP<Time> getTimer (const std::string& timerName) {
   return timer;
 }
 
+// Compare the ordinary and the reproducible (order-independent)
+// reductions, so that we know what reproducibility costs.  The
+// vectors hold random values, so that the binned summation does the
+// same work as for real data.
+template<class vector_type>
+bool
+benchmarkKokkosReproducible (std::ostream& out,
+                             const vector_type& x,
+                             const vector_type& y,
+                             const int numTrials)
+{
+  using std::endl;
+  typedef Kokkos::View<double**, Kokkos::LayoutLeft,
+    typename vector_type::device_type> multivector_type;
+  const int numVecs = 4;
+  const int lclNumRows = x.extent (0);
+
+  RCP<Time> dotTimer = getTimer ("Kokkos: Vector: Dot (ordinary)");
+  RCP<Time> reproDotTimer = getTimer ("Kokkos: Vector: Dot (reproducible)");
+  RCP<Time> nrm2Timer = getTimer ("Kokkos: Vector: Nrm2 (ordinary)");
+  RCP<Time> reproNrm2Timer = getTimer ("Kokkos: Vector: Nrm2 (reproducible)");
+  RCP<Time> sumTimer = getTimer ("Kokkos: Vector: Sum (ordinary)");
+  RCP<Time> reproSumTimer = getTimer ("Kokkos: Vector: Sum (reproducible)");
+  RCP<Time> dotMVTimer = getTimer ("Kokkos: MultiVector: Dot (ordinary)");
+  RCP<Time> reproDotMVTimer = getTimer ("Kokkos: MultiVector: Dot (reproducible)");
+
+  Kokkos::Random_XorShift64_Pool<typename vector_type::execution_space> rand_pool (13718);
+  Kokkos::fill_random (x, rand_pool, 1.0);
+  Kokkos::fill_random (y, rand_pool, 1.0);
+  multivector_type X ("X", lclNumRows, numVecs);
+  multivector_type Y ("Y", lclNumRows, numVecs);
+  Kokkos::fill_random (X, rand_pool, 1.0);
+  Kokkos::fill_random (Y, rand_pool, 1.0);
+  Kokkos::View<double*, Kokkos::HostSpace> R ("R", numVecs);
+
+  double results[2];
+  double reproResults[2];
+  results[0] = results[1] = 0.0;
+  reproResults[0] = reproResults[1] = 0.0;
+  {
+    TimeMonitor timeMon (*dotTimer);
+    for (int k = 0; k < numTrials; ++k) {
+      results[k % 2] = KokkosBlas::dot (x, y);
+    }
+  }
+  {
+    TimeMonitor timeMon (*reproDotTimer);
+    for (int k = 0; k < numTrials; ++k) {
+      reproResults[k % 2] = KokkosBlas::Experimental::reproducible_dot (x, y);
+    }
+  }
+  {
+    TimeMonitor timeMon (*nrm2Timer);
+    for (int k = 0; k < numTrials; ++k) {
+      results[k % 2] = KokkosBlas::nrm2 (x);
+    }
+  }
+  {
+    TimeMonitor timeMon (*reproNrm2Timer);
+    for (int k = 0; k < numTrials; ++k) {
+      reproResults[k % 2] = KokkosBlas::Experimental::reproducible_nrm2 (x);
+    }
+  }
+  {
+    TimeMonitor timeMon (*sumTimer);
+    for (int k = 0; k < numTrials; ++k) {
+      results[k % 2] = KokkosBlas::sum (x);
+    }
+  }
+  {
+    TimeMonitor timeMon (*reproSumTimer);
+    for (int k = 0; k < numTrials; ++k) {
+      reproResults[k % 2] = KokkosBlas::Experimental::reproducible_sum (x);
+    }
+  }
+  {
+    TimeMonitor timeMon (*dotMVTimer);
+    for (int k = 0; k < numTrials; ++k) {
+      KokkosBlas::dot (R, X, Y);
+    }
+  }
+  {
+    TimeMonitor timeMon (*reproDotMVTimer);
+    for (int k = 0; k < numTrials; ++k) {
+      KokkosBlas::Experimental::reproducible_dot (R, X, Y);
+    }
+  }
+
+  // The two sums may differ in the last bits, but no more.
+  if (numTrials > 0) {
+    const double tol = 1.0e-12 * lclNumRows;
+    const double expectedResult = KokkosBlas::sum (x);
+    if (std::abs (reproResults[(numTrials - 1) % 2] - expectedResult) >
+        tol * (std::abs (expectedResult) + 1.0)) {
+      out << "Kokkos reproducible sum result is wrong!  Expected " << expectedResult
+          << " but got " << reproResults[(numTrials - 1) % 2] << " instead." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
 bool
 benchmarkKokkos (std::ostream& out,
                  const int lclNumRows,
-                 const int numTrials)
+                 const int numTrials,
+                 const bool runReproducible)
 {
   using std::endl;
   typedef Kokkos::View<double*, Kokkos::LayoutLeft> vector_type;
@@ -118,10 +224,12 @@ benchmarkKokkos (std::ostream& out,
       out << "Kokkos dot product result is wrong!  Expected " << expectedResult
           << " but got " << dotResults[0] << " instead." << endl;
       return false;
-    } else {
-      return true;
     }
   }
+
+  if (runReproducible) {
+    return benchmarkKokkosReproducible (out, x, y, numTrials);
+  }
   return true;
 }
 
@@ -230,6 +338,7 @@ main (int argc, char* argv[])
 
   bool runKokkos = true;
   bool runRaw = true;
+  bool runReproducible = true;
 
   CommandLineProcessor cmdp;
   cmdp.setOption ("lclNumRows", &lclNumRows, "Number of global indices "
@@ -239,6 +348,9 @@ main (int argc, char* argv[])
                   "Whether to run the Kokkos benchmark");
   cmdp.setOption ("runRaw", "noRaw", &runRaw,
                   "Whether to run the raw benchmark");
+  cmdp.setOption ("runReproducible", "noReproducible", &runReproducible,
+                  "Whether to time the reproducible reductions against "
+                  "the ordinary ones (only with runKokkos)");
   const CommandLineProcessor::EParseCommandLineReturn parseResult =
     cmdp.parse (argc, argv);
   if (parseResult == CommandLineProcessor::PARSE_HELP_PRINTED) {
@@ -262,13 +374,14 @@ main (int argc, char* argv[])
          << "  numTrials: " << numTrials << endl
          << "  runKokkos: " << (runKokkos ? "true" : "false") << endl
          << "  runRaw: " << (runRaw ? "true" : "false") << endl
+         << "  runReproducible: " << (runReproducible ? "true" : "false") << endl
          << endl;
   }
 
   // Run the benchmark
   bool success = true;
   if (runKokkos) {
-    const bool lclSuccess = benchmarkKokkos (cout, lclNumRows, numTrials);
+    const bool lclSuccess = benchmarkKokkos (cout, lclNumRows, numTrials, runReproducible);
     success = success && lclSuccess;
   }
   if (runRaw) {
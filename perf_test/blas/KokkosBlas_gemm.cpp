@@ -0,0 +1,169 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file KokkosBlas_gemm.cpp
+/// \brief Compare the packed host GEMM against the team-scratch GEMM
+///   it replaces for double precision host views.
+///
+/// Usage: KokkosBlas_gemm.exe [-m rows] [-n cols] [-k inner]
+///                            [-ta N|T] [-tb N|T] [-iter repeats]
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+#include "impl/Kokkos_Timer.hpp"
+
+#include "KokkosBlas3_gemm.hpp"
+#include "KokkosBlas3_gemm_impl.hpp"
+#include "KokkosBlas3_gemm_packed_impl.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace PerfTest {
+
+  typedef double value_type;
+
+  // The team-scratch kernel with the blocking KokkosBlas::Impl::GEMM
+  // uses on the host.
+  template<class ViewType, int TransposeA, int TransposeB>
+  void team_gemm(const value_type alpha, const ViewType& A, const ViewType& B, const value_type beta, const ViewType& C) {
+    typedef typename ViewType::execution_space execution_space;
+    static constexpr int blockA0 = 24, blockA1 = 16, blockB1 = 64;
+    typedef KokkosBlas::Impl::GEMMImpl<execution_space,ViewType,ViewType,ViewType,
+                                       blockA0,blockA1,blockB1,TransposeA,TransposeB> gemm_type;
+    const int scratch_memory_size =
+      gemm_type::ViewTypeAScratch::required_allocation_size() +
+      gemm_type::ViewTypeBScratch::required_allocation_size() +
+      gemm_type::ViewTypeCScratch::required_allocation_size();
+    gemm_type gemm(alpha,A,B,beta,C);
+    gemm.run(1, blockB1/4, scratch_memory_size < 24000 ? 0 : 1);
+  }
+
+  template<class ViewType, int TransposeA, int TransposeB>
+  void run(const int m, const int n, const int k, const int iter) {
+    typedef typename ViewType::execution_space execution_space;
+    typedef KokkosBlas::Impl::GEMMPackedImpl<execution_space,ViewType,ViewType,ViewType,TransposeA,TransposeB> packed_type;
+    typedef KokkosBlas::Impl::GemmPackedBlocking<value_type> blocking_type;
+
+    ViewType A("A", TransposeA ? k : m, TransposeA ? m : k);
+    ViewType B("B", TransposeB ? n : k, TransposeB ? k : n);
+    ViewType C("C", m, n), Cref("Cref", m, n);
+
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+    Kokkos::fill_random(A, rand_pool, value_type(1));
+    Kokkos::fill_random(B, rand_pool, value_type(1));
+
+    const value_type alpha = 1.5, beta = 0.0;
+    const double flop = 2.0*m*n*k;
+    double t_team = 0, t_packed = 0;
+
+    for (int it=0;it<iter;++it) {
+      Kokkos::Impl::Timer timer;
+
+      Kokkos::fence();
+      timer.reset();
+      team_gemm<ViewType,TransposeA,TransposeB>(alpha, A, B, beta, Cref);
+      Kokkos::fence();
+      t_team += timer.seconds();
+
+      timer.reset();
+      packed_type::run(alpha, A, B, beta, C);
+      Kokkos::fence();
+      t_packed += timer.seconds();
+    }
+    t_team /= iter; t_packed /= iter;
+
+    typename ViewType::HostMirror C_host = Kokkos::create_mirror_view(C);
+    typename ViewType::HostMirror Cref_host = Kokkos::create_mirror_view(Cref);
+    Kokkos::deep_copy(C_host, C);
+    Kokkos::deep_copy(Cref_host, Cref);
+    double diff = 0;
+    for (int i=0;i<m;++i)
+      for (int j=0;j<n;++j)
+        diff += std::abs(C_host(i,j) - Cref_host(i,j));
+
+    std::cout << std::setprecision(4) << std::scientific
+              << " m = " << m << " n = " << n << " k = " << k
+              << " MR = " << blocking_type::MR << " NR = " << blocking_type::NR
+              << " MC = " << blocking_type::MC << " KC = " << blocking_type::KC
+              << " NC = " << blocking_type::NC << "\n"
+              << "   Team scratch time = " << t_team
+              << " GFlop/s = " << flop/t_team*1e-9 << "\n"
+              << "   Packed       time = " << t_packed
+              << " GFlop/s = " << flop/t_packed*1e-9
+              << " diff to team scratch = " << diff << "\n";
+  }
+}
+
+int main (int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  int m = 2000, n = 2000, k = 2000, iter = 5;
+  bool ta = false, tb = false;
+  for (int i=1;i<argc;++i) {
+    const std::string& token = argv[i];
+    if (token == std::string("-m")) m = std::atoi(argv[++i]);
+    if (token == std::string("-n")) n = std::atoi(argv[++i]);
+    if (token == std::string("-k")) k = std::atoi(argv[++i]);
+    if (token == std::string("-ta")) ta = argv[++i][0] != 'N';
+    if (token == std::string("-tb")) tb = argv[++i][0] != 'N';
+    if (token == std::string("-iter")) iter = std::atoi(argv[++i]);
+  }
+
+  Kokkos::print_configuration(std::cout, false);
+  {
+    typedef Kokkos::View<PerfTest::value_type**, Kokkos::LayoutLeft, Kokkos::DefaultHostExecutionSpace> view_type;
+    if (!ta && !tb) PerfTest::run<view_type,0,0>(m, n, k, iter);
+    if ( ta && !tb) PerfTest::run<view_type,1,0>(m, n, k, iter);
+    if (!ta &&  tb) PerfTest::run<view_type,0,1>(m, n, k, iter);
+    if ( ta &&  tb) PerfTest::run<view_type,1,1>(m, n, k, iter);
+  }
+
+  Kokkos::finalize();
+
+  return 0;
+}
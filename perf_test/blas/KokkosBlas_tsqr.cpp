@@ -0,0 +1,197 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+/// \file KokkosBlas_tsqr.cpp
+/// \brief Compare column-by-column Householder QR against TSQR and
+///   CholQR2 for tall-skinny matrices.
+///
+/// Usage: KokkosBlas_tsqr.exe [-m rows] [-n cols] [-iter repeats]
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+#include "impl/Kokkos_Timer.hpp"
+
+#include "KokkosBlas3_tsqr.hpp"
+#include "KokkosBlas3_cholqr2.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+namespace PerfTest {
+
+  typedef double value_type;
+
+  // Classic right-looking Householder QR: every column costs one norm
+  // reduction over the whole matrix height, one reduction per trailing
+  // column and one update, i.e. O(n) dependent global passes over A.
+  template<class AViewType, class VViewType>
+  struct HouseholderApply {
+    typedef typename AViewType::execution_space execution_space;
+    typedef Kokkos::TeamPolicy<execution_space> policy_type;
+    typedef typename policy_type::member_type member_type;
+
+    AViewType A;
+    VViewType v;
+    int k;
+    value_type tau;
+
+    HouseholderApply(const AViewType& A_, const VViewType& v_, const int k_, const value_type tau_)
+      : A(A_), v(v_), k(k_), tau(tau_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator() (const member_type& team) const {
+      const int j = k + 1 + team.league_rank();
+      const int m = A.extent(0);
+      value_type w = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team, k, m), [&] (const int i, value_type& update) {
+        update += v(i)*A(i,j);
+      }, w);
+      w *= tau;
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, k, m), [&] (const int i) {
+        A(i,j) -= w*v(i);
+      });
+    }
+  };
+
+  template<class AViewType>
+  void householder_qr(const AViewType& A) {
+    typedef typename AViewType::execution_space execution_space;
+    typedef Kokkos::View<value_type*, execution_space> vector_type;
+    typedef Kokkos::RangePolicy<execution_space> range_policy;
+
+    const int m = A.extent(0), n = A.extent(1);
+    vector_type v("v", m);
+    for (int k=0;k<n;++k) {
+      value_type ssq = 0;
+      Kokkos::parallel_reduce(range_policy(k, m), KOKKOS_LAMBDA(const int i, value_type& update) {
+        update += A(i,k)*A(i,k);
+      }, ssq);
+
+      value_type alpha = 0;
+      Kokkos::deep_copy(alpha, Kokkos::subview(A, k, k));
+      const value_type beta = alpha >= 0 ? -std::sqrt(ssq) : std::sqrt(ssq);
+      const value_type tau = beta == 0 ? 0 : (beta - alpha)/beta;
+      const value_type scal = beta == alpha ? 0 : 1/(alpha - beta);
+
+      Kokkos::parallel_for(range_policy(k, m), KOKKOS_LAMBDA(const int i) {
+        v(i) = i == k ? 1 : A(i,k)*scal;
+        A(i,k) = i == k ? beta : v(i);
+      });
+
+      if (k+1 < n) {
+        HouseholderApply<AViewType,vector_type> functor(A, v, k, tau);
+        Kokkos::parallel_for(Kokkos::TeamPolicy<execution_space>(n-k-1, Kokkos::AUTO), functor);
+      }
+    }
+    Kokkos::fence();
+  }
+
+  template<class DeviceSpaceType>
+  void run(const int m, const int n, const int iter) {
+    typedef Kokkos::View<value_type**, Kokkos::LayoutLeft, DeviceSpaceType> view_type;
+
+    view_type A0("A0", m, n), A("A", m, n), R("R", n, n);
+    Kokkos::Random_XorShift64_Pool<DeviceSpaceType> rand_pool(13718);
+    Kokkos::fill_random(A0, rand_pool, value_type(1));
+
+    const double flop = 2.0*m*n*n - (2.0/3.0)*n*n*n;
+    double t_hh = 0, t_tsqr = 0, t_cholqr2 = 0;
+
+    for (int it=0;it<iter;++it) {
+      Kokkos::Impl::Timer timer;
+
+      Kokkos::deep_copy(A, A0);
+      Kokkos::fence();
+      timer.reset();
+      householder_qr(A);
+      t_hh += timer.seconds();
+
+      Kokkos::deep_copy(A, A0);
+      Kokkos::fence();
+      timer.reset();
+      KokkosBlas::tsqr(A, R);
+      Kokkos::fence();
+      t_tsqr += timer.seconds();
+
+      Kokkos::deep_copy(A, A0);
+      Kokkos::fence();
+      timer.reset();
+      KokkosBlas::cholqr2(A, R);
+      Kokkos::fence();
+      t_cholqr2 += timer.seconds();
+    }
+    t_hh /= iter; t_tsqr /= iter; t_cholqr2 /= iter;
+
+    std::cout << std::setprecision(4) << std::scientific
+              << " m = " << m << " n = " << n << "\n"
+              << "   Householder (factor only) time = " << t_hh
+              << " GFlop/s = " << flop/t_hh*1e-9 << "\n"
+              << "   TSQR        (Q and R)     time = " << t_tsqr
+              << " GFlop/s = " << flop/t_tsqr*1e-9 << "\n"
+              << "   CholQR2     (Q and R)     time = " << t_cholqr2
+              << " GFlop/s = " << flop/t_cholqr2*1e-9 << "\n";
+  }
+}
+
+int main (int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+
+  int m = 1000000, n = 16, iter = 5;
+  for (int i=1;i<argc;++i) {
+    const std::string& token = argv[i];
+    if (token == std::string("-m")) m = std::atoi(argv[++i]);
+    if (token == std::string("-n")) n = std::atoi(argv[++i]);
+    if (token == std::string("-iter")) iter = std::atoi(argv[++i]);
+  }
+
+  Kokkos::print_configuration(std::cout, false);
+  PerfTest::run<Kokkos::DefaultExecutionSpace>(m, n, iter);
+
+  Kokkos::finalize();
+
+  return 0;
+}
@@ -102,6 +102,7 @@ void print_options(std::ostream& os, const char* app_name, unsigned int indent=0
      << spaces << "      algorithm <algorithm_name>   Set the algorithm to use.  Allowable values are:" << std::endl
      << spaces << "                 COLORING_D2_MATRIX_SQUARED  - Distance-2 coloring using matrix-squared + Distance-1 coloring method." << std::endl
      << spaces << "                 COLORING_D2                 - Distance-2 coloring using traversal based method." << std::endl
+     << spaces << "                 COLORING_D2_VB_BIT          - Distance-2 coloring using traversal based method with forbidden color bitmasks." << std::endl
      << std::endl
      << spaces << "  Optional Parameters:" << std::endl
      << spaces << "      chunksize <N>     Set the chunk size." << std::endl
@@ -180,6 +181,11 @@ int parse_inputs (KokkosKernels::Experiment::Parameters &params, int argc, char
         params.algorithm = 2;
         got_required_param_algorithm = true;
       }
+      else if ( 0 == strcasecmp( argv[i], "COLORING_D2_VB_BIT" ) )
+      {
+        params.algorithm = 3;
+        got_required_param_algorithm = true;
+      }
       else 
       {
         std::cerr << "2-Unrecognized command line argument #" << i << ": " << argv[i] << std::endl ;
@@ -283,6 +289,9 @@ void run_experiment(crsGraph_t crsGraph, Parameters params)
     case 2:
       kh.create_graph_coloring_handle(COLORING_D2);
       break;
+    case 3:
+      kh.create_graph_coloring_handle(COLORING_D2_VB_BIT);
+      break;
     default:
       kh.create_graph_coloring_handle(COLORING_D2_MATRIX_SQUARED);
       break;
@@ -36,6 +36,10 @@ ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash axpby Kokkos
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash dot KokkosBlas1_dot KokkosBlas1_dot_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash dot KokkosBlas1_dot_mv KokkosBlas1_dot_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 
+#iamax
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash iamax KokkosBlas1_iamax KokkosBlas1_iamax_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash iamax KokkosBlas1_iamax_mv KokkosBlas1_iamax_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
 #mult
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash mult KokkosBlas1_mult KokkosBlas1_mult_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash mult KokkosBlas1_mult_mv KokkosBlas1_mult_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
@@ -60,6 +64,9 @@ ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash nrminf Kokko
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash reciprocal KokkosBlas1_reciprocal KokkosBlas1_reciprocal_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash reciprocal KokkosBlas1_reciprocal_mv KokkosBlas1_reciprocal_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 
+#rot
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash rot KokkosBlas1_rot KokkosBlas1_rot_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
 #scal
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash scal KokkosBlas1_scal KokkosBlas1_scal_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash scal KokkosBlas1_scal_mv KokkosBlas1_scal_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
@@ -68,6 +75,9 @@ ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash scal KokkosB
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash sum KokkosBlas1_sum KokkosBlas1_sum_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash sum KokkosBlas1_sum_mv KokkosBlas1_sum_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 
+#swap
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash swap KokkosBlas1_swap KokkosBlas1_swap_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
 #update
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash update KokkosBlas1_update KokkosBlas1_update_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash update KokkosBlas1_update_mv KokkosBlas1_update_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
@@ -77,3 +87,12 @@ ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash gemv KokkosB
 
 #gemm
 ${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash gemm KokkosBlas3_gemm KokkosBlas3_gemm_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#trsm
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash trsm KokkosBlas3_trsm KokkosBlas3_trsm_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#trmm
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash trmm KokkosBlas3_trmm KokkosBlas3_trmm_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
+
+#syrk
+${KOKKOSKERNELS_PATH}/scripts/generate_specialization_function.bash syrk KokkosBlas3_syrk KokkosBlas3_syrk_spec.hpp KokkosBlas ${KOKKOSKERNELS_PATH}
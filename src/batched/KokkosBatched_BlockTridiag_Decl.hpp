@@ -0,0 +1,184 @@
+#ifndef __KOKKOSBATCHED_BLOCK_TRIDIAG_DECL_HPP__
+#define __KOKKOSBATCHED_BLOCK_TRIDIAG_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Batched Block Tridiagonal Factorization and Solve
+    /// =================================================
+    ///
+    /// A batch of ntridiags block tridiagonal matrices (e.g., the lines of a
+    /// line smoother) with m block rows of size blocksize x blocksize:
+    ///
+    ///   | A(0) B(0)                 |
+    ///   | C(0) A(1) B(1)            |
+    ///   |      C(1) A(2) ...        |
+    ///   |           ...  A(m-1)     |
+    ///
+    /// The blocks are stored in the compact layout, A(p,k,i,j)[l] for the
+    /// matrix t = p*vector_length + l when the value type is Vector<SIMD<T>,l>;
+    /// scalar value types store one matrix per p. Lanes beyond ntridiags are
+    /// padding and should hold a nonsingular diagonal (extract sets identity).
+    ///
+    /// Factorization overwrites the blocks with the block LU factors
+    /// (no pivoting); solve then works on a partitioned block multivector
+    /// X(p,j,k,i) with nvectors right hand sides, j = 0, ..., nvectors-1.
+    ///
+
+    template<typename ValueType,
+             typename DeviceType>
+    class BlockTridiagMatrices {
+    public:
+      typedef DeviceType device_type;
+      typedef typename DeviceType::execution_space execution_space;
+      typedef ValueType value_type;
+
+      typedef Kokkos::View<value_type****,Kokkos::LayoutRight,device_type> value_array_type;
+
+    private:
+      int _ntridiags, _nrows, _blocksize;
+      // A B
+      // C
+      value_array_type _A, _B, _C;
+
+    public:
+      BlockTridiagMatrices()
+        : _ntridiags(0), _nrows(0), _blocksize(0), _A(), _B(), _C() {}
+
+      BlockTridiagMatrices(const int ntridiags,
+                           const int nrows,
+                           const int blocksize)
+        : _ntridiags(ntridiags),
+          _nrows(nrows),
+          _blocksize(blocksize),
+          _A("BlockTridiagMatrices::A", adjustDimension<value_type>(ntridiags), nrows,   blocksize, blocksize),
+          _B("BlockTridiagMatrices::B", adjustDimension<value_type>(ntridiags), nrows > 0 ? nrows-1 : 0, blocksize, blocksize),
+          _C("BlockTridiagMatrices::C", adjustDimension<value_type>(ntridiags), nrows > 0 ? nrows-1 : 0, blocksize, blocksize) {}
+
+      value_array_type A() const { return _A; }
+      value_array_type B() const { return _B; }
+      value_array_type C() const { return _C; }
+
+      int NumTridiagMatrices() const { return _ntridiags; }
+      int NumPacks() const { return _A.extent(0); }
+      int NumRows() const { return _nrows; }
+      int BlockSize() const { return _blocksize; }
+    };
+
+    ///
+    /// Serial: one block tridiagonal matrix (of compact entries) per call,
+    ///         A is m x bs x bs, B and C are (m-1) x bs x bs, X is nvectors x m x bs
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialBlockTridiagFactor {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+    };
+
+    template<typename ArgAlgo>
+    struct SerialBlockTridiagSolve {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename XViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const XViewType &X);
+    };
+
+    ///
+    /// Team: the block operations are parallelized over the team
+    ///
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamBlockTridiagFactor {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+    };
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamBlockTridiagSolve {
+      template<typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename XViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const BViewType &B,
+             const CViewType &C,
+             const XViewType &X);
+    };
+
+    ///
+    /// Top-level: launches the kernels over all matrices of the batch
+    ///
+    /// extract : lines(t,k) is the block row of the BlockCrsMatrix that is
+    ///           the k-th block row of the t-th tridiagonal matrix; blocks
+    ///           missing from the sparse matrix are set to zero.
+    /// factorize, solve : mode selects a range policy (Serial) or a team
+    ///           policy (Team); Auto uses Serial on host and Team otherwise.
+    ///           solve copies B into X (unless they are the same view) and
+    ///           solves in place in X.
+    ///
+
+    struct BlockTridiagMode {
+      enum : int { Auto = 0,
+                   Serial = 1,
+                   Team = 2 };
+    };
+
+    struct BlockTridiag {
+      template<typename BlockCrsMatrixType,
+               typename LineViewType,
+               typename BlockTridiagMatricesType>
+      static void
+      extract(const BlockCrsMatrixType &A,
+              const LineViewType &lines,
+              const BlockTridiagMatricesType &T);
+
+      template<typename BlockTridiagMatricesType>
+      static int
+      factorize(const BlockTridiagMatricesType &T,
+                const int mode = BlockTridiagMode::Auto);
+
+      template<typename BlockTridiagMatricesType,
+               typename XViewType,
+               typename BViewType>
+      static int
+      solve(const BlockTridiagMatricesType &T,
+            const XViewType &X,
+            const BViewType &B,
+            const int mode = BlockTridiagMode::Auto);
+    };
+
+  }
+}
+
+#endif
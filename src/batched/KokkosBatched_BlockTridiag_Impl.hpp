@@ -0,0 +1,525 @@
+#ifndef __KOKKOSBATCHED_BLOCK_TRIDIAG_IMPL_HPP__
+#define __KOKKOSBATCHED_BLOCK_TRIDIAG_IMPL_HPP__
+
+#include <sstream>
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Copy_Decl.hpp"
+#include "KokkosBatched_Copy_Impl.hpp"
+
+#include "KokkosBatched_Gemv_Decl.hpp"
+#include "KokkosBatched_Gemv_Serial_Impl.hpp"
+#include "KokkosBatched_Gemv_Team_Impl.hpp"
+
+#include "KokkosBatched_Trsv_Decl.hpp"
+#include "KokkosBatched_Trsv_Serial_Impl.hpp"
+#include "KokkosBatched_Trsv_Team_Impl.hpp"
+
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Serial_Impl.hpp"
+#include "KokkosBatched_Gemm_Team_Impl.hpp"
+
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_Trsm_Serial_Impl.hpp"
+#include "KokkosBatched_Trsm_Team_Impl.hpp"
+
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+#include "KokkosBatched_LU_Team_Impl.hpp"
+
+#include "KokkosBatched_BlockTridiag_Decl.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Block Tridiag Impl
+    /// ==================
+
+    namespace BlockTridiagImpl {
+
+      // the level 2 algorithm matching a level 3 algorithm tag
+      template<typename ArgAlgo> struct Level2Algo { typedef Algo::Level2::Blocked type; };
+      template<> struct Level2Algo<Algo::Level3::Unblocked> { typedef Algo::Level2::Unblocked type; };
+    }
+
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<typename ArgAlgo>
+    template<typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialBlockTridiagFactor<ArgAlgo>::
+    invoke(const AViewType &A,
+           const BViewType &B,
+           const CViewType &C,
+           const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+      const int m = A.extent(0);
+      if (m <= 0) return 0;
+
+      const int kend = m - 1;
+      for (int k=0;k<kend;++k) {
+        auto AA = Kokkos::subview(A, k,   Kokkos::ALL(), Kokkos::ALL());
+        auto BB = Kokkos::subview(B, k,   Kokkos::ALL(), Kokkos::ALL());
+        auto CC = Kokkos::subview(C, k,   Kokkos::ALL(), Kokkos::ALL());
+        auto DD = Kokkos::subview(A, k+1, Kokkos::ALL(), Kokkos::ALL());
+
+        SerialLU<ArgAlgo>
+          ::invoke(AA, tiny);
+        SerialTrsm<Side::Left,Uplo::Lower,Trans::NoTranspose,Diag::Unit,ArgAlgo>
+          ::invoke(1.0, AA, BB);
+        SerialTrsm<Side::Right,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgo>
+          ::invoke(1.0, AA, CC);
+        SerialGemm<Trans::NoTranspose,Trans::NoTranspose,ArgAlgo>
+          ::invoke(-1.0, CC, BB, 1.0, DD);
+      }
+      {
+        auto AA = Kokkos::subview(A, kend, Kokkos::ALL(), Kokkos::ALL());
+        SerialLU<ArgAlgo>
+          ::invoke(AA, tiny);
+      }
+      return 0;
+    }
+
+    template<typename ArgAlgo>
+    template<typename AViewType,
+             typename BViewType,
+             typename CViewType,
+             typename XViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialBlockTridiagSolve<ArgAlgo>::
+    invoke(const AViewType &A,
+           const BViewType &B,
+           const CViewType &C,
+           const XViewType &X) {
+      typedef typename BlockTridiagImpl::Level2Algo<ArgAlgo>::type algo_level2_type;
+
+      const int m = A.extent(0), nvectors = X.extent(0);
+      if (m <= 0) return 0;
+
+      for (int jvec=0;jvec<nvectors;++jvec) {
+        auto x = Kokkos::subview(X, jvec, Kokkos::ALL(), Kokkos::ALL());
+
+        ///
+        /// forward substitution
+        ///
+        const int kend = m - 1;
+        for (int k=0;k<kend;++k) {
+          auto LT = Kokkos::subview(A, k,   Kokkos::ALL(), Kokkos::ALL());
+          auto LB = Kokkos::subview(C, k,   Kokkos::ALL(), Kokkos::ALL());
+
+          auto xt = Kokkos::subview(x, k,   Kokkos::ALL());
+          auto xb = Kokkos::subview(x, k+1, Kokkos::ALL());
+
+          SerialTrsv<Uplo::Lower,Trans::NoTranspose,Diag::Unit,algo_level2_type>
+            ::invoke(1.0, LT, xt);
+          SerialGemv<Trans::NoTranspose,algo_level2_type>
+            ::invoke(-1.0, LB, xt, 1.0, xb);
+        }
+        {
+          auto LL = Kokkos::subview(A, kend, Kokkos::ALL(), Kokkos::ALL());
+          auto xx = Kokkos::subview(x, kend, Kokkos::ALL());
+          SerialTrsv<Uplo::Lower,Trans::NoTranspose,Diag::Unit,algo_level2_type>
+            ::invoke(1.0, LL, xx);
+        }
+
+        ///
+        /// backward substitution
+        ///
+        for (int k=kend;k>0;--k) {
+          auto UT = Kokkos::subview(B, k-1, Kokkos::ALL(), Kokkos::ALL());
+          auto UB = Kokkos::subview(A, k,   Kokkos::ALL(), Kokkos::ALL());
+
+          auto xt = Kokkos::subview(x, k-1, Kokkos::ALL());
+          auto xb = Kokkos::subview(x, k,   Kokkos::ALL());
+
+          SerialTrsv<Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,algo_level2_type>
+            ::invoke(1.0, UB, xb);
+          SerialGemv<Trans::NoTranspose,algo_level2_type>
+            ::invoke(-1.0, UT, xb, 1.0, xt);
+        }
+        {
+          auto UU = Kokkos::subview(A, 0, Kokkos::ALL(), Kokkos::ALL());
+          auto xx = Kokkos::subview(x, 0, Kokkos::ALL());
+          SerialTrsv<Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,algo_level2_type>
+            ::invoke(1.0, UU, xx);
+        }
+      }
+      return 0;
+    }
+
+    ///
+    /// Team Impl
+    /// =========
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    template<typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamBlockTridiagFactor<MemberType,ArgAlgo>::
+    invoke(const MemberType &member,
+           const AViewType &A,
+           const BViewType &B,
+           const CViewType &C,
+           const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny) {
+      const int m = A.extent(0);
+      if (m <= 0) return 0;
+
+      const int kend = m - 1;
+      for (int k=0;k<kend;++k) {
+        auto AA = Kokkos::subview(A, k,   Kokkos::ALL(), Kokkos::ALL());
+        auto BB = Kokkos::subview(B, k,   Kokkos::ALL(), Kokkos::ALL());
+        auto CC = Kokkos::subview(C, k,   Kokkos::ALL(), Kokkos::ALL());
+        auto DD = Kokkos::subview(A, k+1, Kokkos::ALL(), Kokkos::ALL());
+
+        member.team_barrier();
+        TeamLU<MemberType,ArgAlgo>
+          ::invoke(member, AA, tiny);
+        member.team_barrier();
+        TeamTrsm<MemberType,Side::Left,Uplo::Lower,Trans::NoTranspose,Diag::Unit,ArgAlgo>
+          ::invoke(member, 1.0, AA, BB);
+        TeamTrsm<MemberType,Side::Right,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,ArgAlgo>
+          ::invoke(member, 1.0, AA, CC);
+        member.team_barrier();
+        TeamGemm<MemberType,Trans::NoTranspose,Trans::NoTranspose,ArgAlgo>
+          ::invoke(member, -1.0, CC, BB, 1.0, DD);
+      }
+      {
+        auto AA = Kokkos::subview(A, kend, Kokkos::ALL(), Kokkos::ALL());
+        member.team_barrier();
+        TeamLU<MemberType,ArgAlgo>
+          ::invoke(member, AA, tiny);
+      }
+      return 0;
+    }
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    template<typename AViewType,
+             typename BViewType,
+             typename CViewType,
+             typename XViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamBlockTridiagSolve<MemberType,ArgAlgo>::
+    invoke(const MemberType &member,
+           const AViewType &A,
+           const BViewType &B,
+           const CViewType &C,
+           const XViewType &X) {
+      typedef typename BlockTridiagImpl::Level2Algo<ArgAlgo>::type algo_level2_type;
+
+      const int m = A.extent(0), nvectors = X.extent(0);
+      if (m <= 0) return 0;
+
+      for (int jvec=0;jvec<nvectors;++jvec) {
+        auto x = Kokkos::subview(X, jvec, Kokkos::ALL(), Kokkos::ALL());
+
+        ///
+        /// forward substitution
+        ///
+        const int kend = m - 1;
+        for (int k=0;k<kend;++k) {
+          auto LT = Kokkos::subview(A, k,   Kokkos::ALL(), Kokkos::ALL());
+          auto LB = Kokkos::subview(C, k,   Kokkos::ALL(), Kokkos::ALL());
+
+          auto xt = Kokkos::subview(x, k,   Kokkos::ALL());
+          auto xb = Kokkos::subview(x, k+1, Kokkos::ALL());
+
+          member.team_barrier();
+          TeamTrsv<MemberType,Uplo::Lower,Trans::NoTranspose,Diag::Unit,algo_level2_type>
+            ::invoke(member, 1.0, LT, xt);
+          member.team_barrier();
+          TeamGemv<MemberType,Trans::NoTranspose,algo_level2_type>
+            ::invoke(member, -1.0, LB, xt, 1.0, xb);
+        }
+        {
+          auto LL = Kokkos::subview(A, kend, Kokkos::ALL(), Kokkos::ALL());
+          auto xx = Kokkos::subview(x, kend, Kokkos::ALL());
+          member.team_barrier();
+          TeamTrsv<MemberType,Uplo::Lower,Trans::NoTranspose,Diag::Unit,algo_level2_type>
+            ::invoke(member, 1.0, LL, xx);
+        }
+
+        ///
+        /// backward substitution
+        ///
+        for (int k=kend;k>0;--k) {
+          auto UT = Kokkos::subview(B, k-1, Kokkos::ALL(), Kokkos::ALL());
+          auto UB = Kokkos::subview(A, k,   Kokkos::ALL(), Kokkos::ALL());
+
+          auto xt = Kokkos::subview(x, k-1, Kokkos::ALL());
+          auto xb = Kokkos::subview(x, k,   Kokkos::ALL());
+
+          member.team_barrier();
+          TeamTrsv<MemberType,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,algo_level2_type>
+            ::invoke(member, 1.0, UB, xb);
+          member.team_barrier();
+          TeamGemv<MemberType,Trans::NoTranspose,algo_level2_type>
+            ::invoke(member, -1.0, UT, xb, 1.0, xt);
+        }
+        {
+          auto UU = Kokkos::subview(A, 0, Kokkos::ALL(), Kokkos::ALL());
+          auto xx = Kokkos::subview(x, 0, Kokkos::ALL());
+          member.team_barrier();
+          TeamTrsv<MemberType,Uplo::Upper,Trans::NoTranspose,Diag::NonUnit,algo_level2_type>
+            ::invoke(member, 1.0, UU, xx);
+        }
+      }
+      member.team_barrier();
+      return 0;
+    }
+
+    ///
+    /// Top-level Impl
+    /// ==============
+
+    namespace BlockTridiagImpl {
+
+      // one (p,k) block row of the compact matrices per thread; lanes are looped
+      template<typename BlockCrsMatrixType, typename LineViewType, typename TViewType>
+      struct ExtractFunctor {
+        typedef typename TViewType::non_const_value_type compact_value_type;
+        typedef Lane<compact_value_type> lane_type;
+        typedef typename lane_type::value_type value_type;
+        typedef typename BlockCrsMatrixType::ordinal_type ordinal_type;
+
+        BlockCrsMatrixType _A;
+        LineViewType _lines;
+        TViewType _TA, _TB, _TC;
+        int _ntridiags, _nrows, _blocksize;
+
+        ExtractFunctor(const BlockCrsMatrixType &A, const LineViewType &lines,
+                       const TViewType &TA, const TViewType &TB, const TViewType &TC,
+                       const int ntridiags)
+          : _A(A), _lines(lines), _TA(TA), _TB(TB), _TC(TC),
+            _ntridiags(ntridiags), _nrows(TA.extent(1)), _blocksize(TA.extent(2)) {}
+
+        // T(ii,jj)[s] = A(row,col)(ii,jj), zero if the block does not exist
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION
+        void copy_block(const ordinal_type row, const ordinal_type col,
+                        const ViewType &T, const int p, const int k, const int s) const {
+          const auto block_row = _A.block_row_Const(row);
+          const ordinal_type K = block_row.findRelBlockOffset(col);
+          const bool found = (K < block_row.length);
+          for (int ii=0;ii<_blocksize;++ii)
+            for (int jj=0;jj<_blocksize;++jj)
+              lane_type::get(T(p,k,ii,jj), s) = found ? value_type(block_row.local_block_value(K,ii,jj)) : value_type(0);
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int pk) const {
+          const int p = pk/_nrows, k = pk%_nrows;
+          for (int s=0;s<lane_type::vector_length;++s) {
+            const int t = p*lane_type::vector_length + s;
+            if (t < _ntridiags) {
+              const ordinal_type row = _lines(t,k);
+              copy_block(row, row, _TA, p, k, s);
+              if (k+1 < _nrows) {
+                const ordinal_type next = _lines(t,k+1);
+                copy_block(row, next, _TB, p, k, s);
+                copy_block(next, row, _TC, p, k, s);
+              }
+            } else {
+              // padding lanes are set to identity so that they factorize
+              for (int ii=0;ii<_blocksize;++ii)
+                for (int jj=0;jj<_blocksize;++jj) {
+                  lane_type::get(_TA(p,k,ii,jj), s) = (ii == jj ? value_type(1) : value_type(0));
+                  if (k+1 < _nrows) {
+                    lane_type::get(_TB(p,k,ii,jj), s) = value_type(0);
+                    lane_type::get(_TC(p,k,ii,jj), s) = value_type(0);
+                  }
+                }
+            }
+          }
+        }
+      };
+
+      struct SerialTag {};
+      struct TeamTag {};
+
+      template<typename TViewType, typename XViewType, typename BViewType>
+      struct Functor {
+        typedef typename TViewType::non_const_value_type value_type;
+        typedef typename MagnitudeScalarType<value_type>::type magnitude_type;
+        typedef Algo::Level3::Blocked algo_type;
+
+        TViewType _TA, _TB, _TC;
+        XViewType _X;
+        BViewType _B;
+        bool _is_solve;
+
+        Functor(const TViewType &TA, const TViewType &TB, const TViewType &TC)
+          : _TA(TA), _TB(TB), _TC(TC), _X(), _B(), _is_solve(false) {}
+
+        Functor(const TViewType &TA, const TViewType &TB, const TViewType &TC,
+                const XViewType &X, const BViewType &B)
+          : _TA(TA), _TB(TB), _TC(TC), _X(X), _B(B), _is_solve(true) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const SerialTag &, const int p) const {
+          auto A = Kokkos::subview(_TA, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+          auto B = Kokkos::subview(_TB, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+          auto C = Kokkos::subview(_TC, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+
+          if (_is_solve) {
+            auto X = Kokkos::subview(_X, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+            if (_X.data() != _B.data()) {
+              auto b = Kokkos::subview(_B, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+              for (int j=0,jend=X.extent(0);j<jend;++j) {
+                auto xx = Kokkos::subview(X, j, Kokkos::ALL(), Kokkos::ALL());
+                auto bb = Kokkos::subview(b, j, Kokkos::ALL(), Kokkos::ALL());
+                SerialCopy<Trans::NoTranspose>::invoke(bb, xx);
+              }
+            }
+            SerialBlockTridiagSolve<algo_type>::invoke(A, B, C, X);
+          } else {
+            SerialBlockTridiagFactor<algo_type>::invoke(A, B, C, magnitude_type(0));
+          }
+        }
+
+        template<typename MemberType>
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const TeamTag &, const MemberType &member) const {
+          const int p = member.league_rank();
+          auto A = Kokkos::subview(_TA, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+          auto B = Kokkos::subview(_TB, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+          auto C = Kokkos::subview(_TC, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+
+          if (_is_solve) {
+            auto X = Kokkos::subview(_X, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+            if (_X.data() != _B.data()) {
+              auto b = Kokkos::subview(_B, p, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+              for (int j=0,jend=X.extent(0);j<jend;++j) {
+                auto xx = Kokkos::subview(X, j, Kokkos::ALL(), Kokkos::ALL());
+                auto bb = Kokkos::subview(b, j, Kokkos::ALL(), Kokkos::ALL());
+                TeamCopy<MemberType,Trans::NoTranspose>::invoke(member, bb, xx);
+              }
+            }
+            TeamBlockTridiagSolve<MemberType,algo_type>::invoke(member, A, B, C, X);
+          } else {
+            TeamBlockTridiagFactor<MemberType,algo_type>::invoke(member, A, B, C, magnitude_type(0));
+          }
+        }
+      };
+
+      template<typename ExecSpaceType>
+      inline
+      int select(const int mode) {
+        if (mode != BlockTridiagMode::Auto) return mode;
+        return std::is_same<typename ExecSpaceType::memory_space,Kokkos::HostSpace>::value ?
+          int(BlockTridiagMode::Serial) : int(BlockTridiagMode::Team);
+      }
+
+      template<typename FunctorType, typename ExecSpaceType>
+      inline
+      int run(const char *label, const FunctorType &functor, const int npack, const int mode) {
+        switch (select<ExecSpaceType>(mode)) {
+        case BlockTridiagMode::Serial: {
+          const Kokkos::RangePolicy<ExecSpaceType,SerialTag> policy(0, npack);
+          Kokkos::parallel_for(label, policy, functor);
+          break;
+        }
+        case BlockTridiagMode::Team: {
+          const Kokkos::TeamPolicy<ExecSpaceType,TeamTag> policy(npack, Kokkos::AUTO());
+          Kokkos::parallel_for(label, policy, functor);
+          break;
+        }
+        default:
+          return -1;
+        }
+        return 0;
+      }
+    }
+
+    template<typename BlockCrsMatrixType,
+             typename LineViewType,
+             typename BlockTridiagMatricesType>
+    void
+    BlockTridiag::
+    extract(const BlockCrsMatrixType &A,
+            const LineViewType &lines,
+            const BlockTridiagMatricesType &T) {
+      typedef typename BlockTridiagMatricesType::execution_space exec_space;
+      typedef typename BlockTridiagMatricesType::value_array_type t_view_type;
+
+      static_assert(LineViewType::rank == 2, "KokkosBatched::BlockTridiag::extract: lines must have rank 2.");
+
+      const int ntridiags = T.NumTridiagMatrices(), nrows = T.NumRows();
+      if (int(lines.extent(0)) < ntridiags ||
+          int(lines.extent(1)) != nrows ||
+          int(A.blockDim()) != T.BlockSize()) {
+        std::ostringstream os;
+        os << "KokkosBatched::BlockTridiag::extract: Dimensions do not match: "
+           << "lines is " << lines.extent(0) << " x " << lines.extent(1)
+           << " for " << ntridiags << " matrices of " << nrows << " block rows, "
+           << "block size is " << A.blockDim() << " (matrix) and " << T.BlockSize() << " (tridiag)";
+        Kokkos::Impl::throw_runtime_exception(os.str());
+      }
+
+      const Kokkos::RangePolicy<exec_space> policy(0, T.NumPacks()*nrows);
+      Kokkos::parallel_for("KokkosBatched::BlockTridiag::extract", policy,
+                           BlockTridiagImpl::ExtractFunctor<BlockCrsMatrixType,LineViewType,t_view_type>
+                           (A, lines, T.A(), T.B(), T.C(), ntridiags));
+    }
+
+    template<typename BlockTridiagMatricesType>
+    int
+    BlockTridiag::
+    factorize(const BlockTridiagMatricesType &T,
+              const int mode) {
+      typedef typename BlockTridiagMatricesType::execution_space exec_space;
+      typedef typename BlockTridiagMatricesType::value_array_type t_view_type;
+      typedef BlockTridiagImpl::Functor<t_view_type,t_view_type,t_view_type> functor_type;
+
+      return BlockTridiagImpl::run<functor_type,exec_space>
+        ("KokkosBatched::BlockTridiag::factorize", functor_type(T.A(), T.B(), T.C()), T.NumPacks(), mode);
+    }
+
+    template<typename BlockTridiagMatricesType,
+             typename XViewType,
+             typename BViewType>
+    int
+    BlockTridiag::
+    solve(const BlockTridiagMatricesType &T,
+          const XViewType &X,
+          const BViewType &B,
+          const int mode) {
+      typedef typename BlockTridiagMatricesType::execution_space exec_space;
+      typedef typename BlockTridiagMatricesType::value_array_type t_view_type;
+      typedef BlockTridiagImpl::Functor<t_view_type,XViewType,BViewType> functor_type;
+
+      static_assert(XViewType::rank == 4 && BViewType::rank == 4,
+                    "KokkosBatched::BlockTridiag::solve: X and B must have rank 4.");
+
+      if (int(X.extent(0)) != T.NumPacks() || int(X.extent(2)) != T.NumRows() || int(X.extent(3)) != T.BlockSize() ||
+          X.extent(0) != B.extent(0) || X.extent(1) != B.extent(1) ||
+          X.extent(2) != B.extent(2) || X.extent(3) != B.extent(3)) {
+        std::ostringstream os;
+        os << "KokkosBatched::BlockTridiag::solve: Dimensions do not match: "
+           << "T has " << T.NumPacks() << " packs of " << T.NumRows() << " block rows of size " << T.BlockSize()
+           << ", X is " << X.extent(0) << " x " << X.extent(1) << " x " << X.extent(2) << " x " << X.extent(3)
+           << ", B is " << B.extent(0) << " x " << B.extent(1) << " x " << B.extent(2) << " x " << B.extent(3);
+        Kokkos::Impl::throw_runtime_exception(os.str());
+      }
+
+      return BlockTridiagImpl::run<functor_type,exec_space>
+        ("KokkosBatched::BlockTridiag::solve", functor_type(T.A(), T.B(), T.C(), X, B), T.NumPacks(), mode);
+    }
+
+  }
+}
+
+#endif
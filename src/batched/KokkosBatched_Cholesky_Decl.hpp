@@ -0,0 +1,63 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_DECL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Cholesky factorization A = L L^T of a symmetric positive definite
+    /// matrix; only the lower triangular part of A is referenced and it
+    /// is overwritten by L. Real value types only (scalar or SIMD vector);
+    /// definiteness is not checked, a non positive pivot yields NaN in
+    /// the affected entries (lanes).
+    ///
+    /// CholeskySolve solves A X = B in place in B (a vector or a matrix)
+    /// with the factor L computed by Cholesky.
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialCholesky {
+      template<typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamCholesky {
+      template<typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A);
+    };       
+
+    template<typename ArgAlgo>
+    struct SerialCholeskySolve {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const BViewType &B);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamCholeskySolve {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const BViewType &B);
+    };       
+      
+  }
+}
+
+#endif
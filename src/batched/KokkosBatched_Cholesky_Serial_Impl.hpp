@@ -0,0 +1,72 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Cholesky_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    ///
+    /// SerialCholesky lower
+    ///
+
+    template<>
+    template<typename AViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholesky<Algo::Cholesky::Unblocked>::
+    invoke(const AViewType &A) {
+      return SerialCholeskyInternalLower<Algo::Cholesky::Unblocked>::invoke(A.extent(0),
+                                                                            A.data(), A.stride_0(), A.stride_1());
+    }
+
+    template<>
+    template<typename AViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholesky<Algo::Cholesky::Blocked>::
+    invoke(const AViewType &A) {
+      return SerialCholeskyInternalLower<Algo::Cholesky::Blocked>::invoke(A.extent(0),
+                                                                          A.data(), A.stride_0(), A.stride_1());
+    }
+
+    ///
+    /// SerialCholeskySolve lower
+    ///
+
+    template<>
+    template<typename AViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholeskySolve<Algo::Cholesky::Unblocked>::
+    invoke(const AViewType &A,
+           const BViewType &B) {
+      return SerialCholeskySolveInternalLower<Algo::Trsm::Unblocked>::invoke(B.extent(0), B.extent(1),
+                                                                             A.data(), A.stride_0(), A.stride_1(),
+                                                                             B.data(), B.stride_0(), B.stride_1());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholeskySolve<Algo::Cholesky::Blocked>::
+    invoke(const AViewType &A,
+           const BViewType &B) {
+      return SerialCholeskySolveInternalLower<Algo::Trsm::Blocked>::invoke(B.extent(0), B.extent(1),
+                                                                           A.data(), A.stride_0(), A.stride_1(),
+                                                                           B.data(), B.stride_0(), B.stride_1());
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_SERIAL_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_InnerTrsm_Serial_Impl.hpp"
+#include "KokkosBatched_Trsm_Serial_Internal.hpp"
+#include "KokkosBatched_Gemm_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    namespace CholeskyInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<!is_vector<ValueType>::value,ValueType>::type
+      sqrt(const ValueType &a) {
+        return Kokkos::Details::ArithTraits<ValueType>::sqrt(a);
+      }
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<is_vector<ValueType>::value,ValueType>::type
+      sqrt(const ValueType &a) {
+        return KokkosBatched::Experimental::sqrt(a);
+      }
+
+      // lower update of a diagonal block, C(i,j) -= sum_l A(i,l) A(j,l) for j <= i
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      lower_rank_update(const int m, const int k,
+                        const ValueType *__restrict__ A, const int as0, const int as1,
+                        /**/  ValueType *__restrict__ C, const int cs0, const int cs1) {
+        for (int i=0;i<m;++i)
+          for (int j=0;j<=i;++j) {
+            ValueType c(0);
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int l=0;l<k;++l)
+              c += A[i*as0+l*as1]*A[j*as0+l*as1];
+            C[i*cs0+j*cs1] -= c;
+          }
+      }
+    }
+
+    template<typename AlgoType>
+    struct SerialCholeskyInternalLower {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m,
+             ValueType *__restrict__ A, const int as0, const int as1);
+    };
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholeskyInternalLower<Algo::Cholesky::Unblocked>::
+    invoke(const int m,
+           ValueType *__restrict__ A, const int as0, const int as1) {
+      static_assert(IsReal<ValueType>::value,
+                    "KokkosBatched::Cholesky: only real value types are supported.");
+
+      for (int p=0;p<m;++p) {
+        const int iend = m-p-1;
+
+        ValueType
+          *__restrict__ a21 = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ A22 = A+(p+1)*as0+(p+1)*as1;
+
+        ValueType &alpha11 = A[p*as0+p*as1];
+        alpha11 = CholeskyInternal::sqrt(alpha11);
+
+        const ValueType inv_alpha11 = ValueType(1)/alpha11;
+        for (int i=0;i<iend;++i)
+          a21[i*as0] *= inv_alpha11;
+
+        for (int i=0;i<iend;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j=0;j<=i;++j)
+            A22[i*as0+j*as1] -= a21[i*as0] * a21[j*as0];
+      }
+      return 0;
+    }
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialCholeskyInternalLower<Algo::Cholesky::Blocked>::
+    invoke(const int m,
+           ValueType *__restrict__ A, const int as0, const int as1) {
+      enum : int {
+        mbAlgo = Algo::Cholesky::Blocked::mb<Kokkos::Impl::ActiveExecutionMemorySpace>()
+      };
+      const typename MagnitudeScalarType<ValueType>::type one(1.0), minus_one(-1.0);
+
+      if (m <= 0) return 0;
+
+      // A21 L11^T = A21 is solved as L11 A21^T = A21^T
+      InnerTrsmLeftLowerNonUnitDiag<mbAlgo> trsm_llt(as0, as1, as1, as0);
+
+      const int mb = mbAlgo;
+      for (int p=0;p<m;p+=mb) {
+        const int pb = (p+mb) > m ? (m-p) : mb;
+
+        // diagonal block
+        ValueType *__restrict__ Ap = A+p*as0+p*as1;
+        SerialCholeskyInternalLower<Algo::Cholesky::Unblocked>::invoke(pb, Ap, as0, as1);
+
+        // panel
+        const int m_abr = m-p-pb;
+        if (m_abr <= 0) break;
+
+        ValueType
+          *__restrict__ A21 = Ap+pb*as0,
+          *__restrict__ A22 = Ap+pb*as0+pb*as1;
+
+        trsm_llt.serial_invoke(Ap, pb, m_abr, A21);
+
+        // lower trailing update A22 -= A21 A21^T, by column blocks
+        for (int q=0;q<m_abr;q+=mb) {
+          const int qb = (q+mb) > m_abr ? (m_abr-q) : mb;
+          CholeskyInternal::lower_rank_update(qb, pb,
+                                              A21+q*as0, as0, as1,
+                                              A22+q*as0+q*as1, as0, as1);
+          SerialGemmInternal<Algo::Gemm::Blocked>::
+            invoke(m_abr-q-qb, qb, pb,
+                   minus_one,
+                   A21+(q+qb)*as0, as0, as1,
+                   A21+q*as0, as1, as0,
+                   one,
+                   A22+(q+qb)*as0+q*as1, as0, as1);
+        }
+      }
+      return 0;
+    }
+
+    ///
+    /// Solve L L^T X = B with L^T accessed by transposed strides
+    ///
+
+    template<typename AlgoType>
+    struct SerialCholeskySolveInternalLower {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m, const int n,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ B, const int bs0, const int bs1) {
+        const typename MagnitudeScalarType<ValueType>::type one(1.0);
+        SerialTrsmInternalLeftLower<AlgoType>::invoke(false, m, n, one, A, as0, as1, B, bs0, bs1);
+        SerialTrsmInternalLeftUpper<AlgoType>::invoke(false, m, n, one, A, as1, as0, B, bs0, bs1);
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
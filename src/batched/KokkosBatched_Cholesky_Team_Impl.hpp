@@ -0,0 +1,78 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Cholesky_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+
+    ///
+    /// Cholesky lower
+    ///
+
+    template<typename MemberType>
+    struct TeamCholesky<MemberType,Algo::Cholesky::Unblocked> {
+      template<typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A) {
+        return TeamCholeskyInternalLower<Algo::Cholesky::Unblocked>::invoke(member,
+                                                                            A.extent(0),
+                                                                            A.data(), A.stride_0(), A.stride_1());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamCholesky<MemberType,Algo::Cholesky::Blocked> {
+      template<typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A) {
+        return TeamCholeskyInternalLower<Algo::Cholesky::Blocked>::invoke(member,
+                                                                          A.extent(0),
+                                                                          A.data(), A.stride_0(), A.stride_1());
+      }
+    };
+
+    ///
+    /// CholeskySolve lower
+    ///
+
+    template<typename MemberType>
+    struct TeamCholeskySolve<MemberType,Algo::Cholesky::Unblocked> {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const BViewType &B) {
+        return TeamCholeskySolveInternalLower<Algo::Trsm::Unblocked>::invoke(member,
+                                                                             B.extent(0), B.extent(1),
+                                                                             A.data(), A.stride_0(), A.stride_1(),
+                                                                             B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamCholeskySolve<MemberType,Algo::Cholesky::Blocked> {
+      template<typename AViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const BViewType &B) {
+        return TeamCholeskySolveInternalLower<Algo::Trsm::Blocked>::invoke(member,
+                                                                           B.extent(0), B.extent(1),
+                                                                           A.data(), A.stride_0(), A.stride_1(),
+                                                                           B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef __KOKKOSBATCHED_CHOLESKY_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_TEAM_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_InnerTrsm_Serial_Impl.hpp"
+#include "KokkosBatched_Cholesky_Serial_Internal.hpp"
+
+#include "KokkosBatched_Trsm_Team_Internal.hpp"
+#include "KokkosBatched_Gemm_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    template<typename AlgoType>
+    struct TeamCholeskyInternalLower {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int m,
+             ValueType *__restrict__ A, const int as0, const int as1);
+    };
+
+    template<>
+    template<typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamCholeskyInternalLower<Algo::Cholesky::Unblocked>::
+    invoke(const MemberType &member,
+           const int m,
+           ValueType *__restrict__ A, const int as0, const int as1) {
+      static_assert(IsReal<ValueType>::value,
+                    "KokkosBatched::Cholesky: only real value types are supported.");
+
+      for (int p=0;p<m;++p) {
+        const int iend = m-p-1;
+
+        ValueType
+          *__restrict__ a21 = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ A22 = A+(p+1)*as0+(p+1)*as1;
+
+        if (member.team_rank() == 0) {
+          ValueType &alpha11 = A[p*as0+p*as1];
+          alpha11 = CholeskyInternal::sqrt(alpha11);
+        }
+
+        member.team_barrier();
+        const ValueType
+          alpha11 = A[p*as0+p*as1];
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend),[&](const int &i) {
+            a21[i*as0] /= alpha11;
+          });
+
+        member.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend*iend),[&](const int &ij) {
+            // lower triangular part only
+            const int i = ij/iend, j = ij%iend;
+            if (j <= i)
+              A22[i*as0+j*as1] -= a21[i*as0] * a21[j*as0];
+          });
+        member.team_barrier();
+      }
+      return 0;
+    }
+
+    template<>
+    template<typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamCholeskyInternalLower<Algo::Cholesky::Blocked>::
+    invoke(const MemberType &member,
+           const int m,
+           ValueType *__restrict__ A, const int as0, const int as1) {
+      enum : int {
+        mbAlgo = Algo::Cholesky::Blocked::mb<Kokkos::Impl::ActiveExecutionMemorySpace>()
+      };
+      const typename MagnitudeScalarType<ValueType>::type one(1.0), minus_one(-1.0);
+
+      if (m <= 0) return 0;
+
+      // A21 L11^T = A21 is solved as L11 A21^T = A21^T
+      InnerTrsmLeftLowerNonUnitDiag<mbAlgo> trsm_llt(as0, as1, as1, as0);
+
+      const int tsize = member.team_size();
+      const int mb = mbAlgo;
+      for (int p=0;p<m;p+=mb) {
+        const int pb = (p+mb) > m ? (m-p) : mb;
+
+        // diagonal block
+        ValueType *__restrict__ Ap = A+p*as0+p*as1;
+
+        member.team_barrier();
+        if (member.team_rank() == 0)
+          SerialCholeskyInternalLower<Algo::Cholesky::Unblocked>::invoke(pb, Ap, as0, as1);
+        member.team_barrier();
+
+        const int m_abr = m-p-pb;
+        if (m_abr <= 0) break;
+
+        ValueType
+          *__restrict__ A21 = Ap+pb*as0,
+          *__restrict__ A22 = Ap+pb*as0+pb*as1;
+
+        // panel, rows of A21 are distributed over the team
+        const int
+          nb = m_abr/tsize + (m_abr%tsize > 0),
+          np = m_abr%nb,
+          nq = (m_abr/nb)+(np>0);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,nq),[&](const int &iq) {
+            const int i = iq*nb, qb = (i+nb) > m_abr ? np : nb;
+            trsm_llt.serial_invoke(Ap, pb, qb, A21+i*as0);
+          });
+        member.team_barrier();
+
+        // lower trailing update A22 -= A21 A21^T, column blocks are distributed over the team
+        const int qp = m_abr%mb, qq = (m_abr/mb)+(qp>0);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,qq),[&](const int &iq) {
+            const int q = iq*mb, qb = (q+mb) > m_abr ? qp : mb;
+            CholeskyInternal::lower_rank_update(qb, pb,
+                                                A21+q*as0, as0, as1,
+                                                A22+q*as0+q*as1, as0, as1);
+            SerialGemmInternal<Algo::Gemm::Blocked>::
+              invoke(m_abr-q-qb, qb, pb,
+                     minus_one,
+                     A21+(q+qb)*as0, as0, as1,
+                     A21+q*as0, as1, as0,
+                     one,
+                     A22+(q+qb)*as0+q*as1, as0, as1);
+          });
+      }
+      member.team_barrier();
+      return 0;
+    }
+
+    ///
+    /// Solve L L^T X = B with L^T accessed by transposed strides
+    ///
+
+    template<typename AlgoType>
+    struct TeamCholeskySolveInternalLower {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int m, const int n,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ B, const int bs0, const int bs1) {
+        const typename MagnitudeScalarType<ValueType>::type one(1.0);
+        TeamTrsmInternalLeftLower<AlgoType>::invoke(member, false, m, n, one, A, as0, as1, B, bs0, bs1);
+        member.team_barrier();
+        TeamTrsmInternalLeftUpper<AlgoType>::invoke(member, false, m, n, one, A, as1, as0, B, bs0, bs1);
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef __KOKKOSBATCHED_GEMM_BATCHED_DECL_HPP__
+#define __KOKKOSBATCHED_GEMM_BATCHED_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Batched Gemm
+    /// ============
+    ///
+    /// C(b) = beta C(b) + alpha op(A(b)) op(B(b)), b = 0, ..., nbatch-1
+    ///
+    /// Unlike SerialGemm and TeamGemm, which are called by a user kernel
+    /// on a single matrix, this is a top-level (host-called) interface
+    /// that launches the kernel over a whole batch. The batch index is
+    /// the leading dimension of the rank 3 views, e.g., A(b,i,j).
+    ///
+    /// The kernel is chosen from the problem size and the execution space:
+    /// - Serial     : one matrix per thread using SerialGemm (range policy)
+    /// - Team       : one matrix per team using TeamGemm (team policy)
+    /// - SerialSIMD : host only; vector_length matrices are interleaved into
+    ///                Vector<SIMD<T>,l> lanes, multiplied by SerialGemm and
+    ///                scattered back; the packs go one by one through
+    ///                a workspace of one pack per thread, in cache, so
+    ///                no packed copy of the batch is made; the vector
+    ///                length follows active_instruction_set(), by
+    ///                default the widest set of the host
+    ///                (KokkosBatched_InstructionSet.hpp)
+    /// Views whose value type is already Vector<SIMD<T>,l> are multiplied
+    /// directly with the Serial kernel.
+    ///
+    /// Variable size batches pass views padded to the largest problem
+    /// together with sizes(b,0:2) = (m,n,k) of each entry; op(A(b)) is
+    /// m x k, op(B(b)) is k x n and C(b) is m x n. Only the Serial and
+    /// Team kernels are used for variable size batches; VariableBatch
+    /// (KokkosBatched_VariableBatched_Decl.hpp) groups the entries by
+    /// size and interleaves each group instead.
+    ///
+    /// Return value is 0 on success and -1 if a requested mode is not
+    /// available for the given value type or execution space.
+    ///
+
+    struct GemmBatchedMode {
+      enum : int { Auto = 0,
+                   Serial = 1,
+                   Team = 2,
+                   SerialSIMD = 3 };
+
+      static const char* name(const int mode) {
+        switch (mode) {
+        case Serial:     return "Serial";
+        case Team:       return "Team";
+        case SerialSIMD: return "SerialSIMD";
+        default: break;
+        }
+        return "Auto";
+      }
+    };
+
+    template<typename ArgTransA,
+             typename ArgTransB>
+    struct GemmBatched {
+      // uniform batch
+      template<typename ScalarType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      static int
+      invoke(const ScalarType alpha,
+             const AViewType &A,
+             const BViewType &B,
+             const ScalarType beta,
+             const CViewType &C,
+             const int mode = GemmBatchedMode::Auto);
+
+      // variable size batch
+      template<typename ScalarType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType,
+               typename SizeViewType>
+      static
+      typename std::enable_if<Kokkos::is_view<SizeViewType>::value,int>::type
+      invoke(const ScalarType alpha,
+             const AViewType &A,
+             const BViewType &B,
+             const ScalarType beta,
+             const CViewType &C,
+             const SizeViewType &sizes,
+             const int mode = GemmBatchedMode::Auto);
+
+      // the kernel that Auto selects for a batch of m x n x k problems
+      template<typename ValueType,
+               typename ExecSpaceType>
+      static int
+      select(const int nbatch,
+             const int m, const int n, const int k);
+    };
+
+    template<typename ArgTransA,
+             typename ArgTransB,
+             typename ScalarType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    inline
+    int
+    gemm_batched(const ScalarType alpha,
+                 const AViewType &A,
+                 const BViewType &B,
+                 const ScalarType beta,
+                 const CViewType &C,
+                 const int mode = GemmBatchedMode::Auto) {
+      return GemmBatched<ArgTransA,ArgTransB>::invoke(alpha, A, B, beta, C, mode);
+    }
+
+    template<typename ArgTransA,
+             typename ArgTransB,
+             typename ScalarType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType,
+             typename SizeViewType>
+    inline
+    typename std::enable_if<Kokkos::is_view<SizeViewType>::value,int>::type
+    gemm_batched(const ScalarType alpha,
+                 const AViewType &A,
+                 const BViewType &B,
+                 const ScalarType beta,
+                 const CViewType &C,
+                 const SizeViewType &sizes,
+                 const int mode = GemmBatchedMode::Auto) {
+      return GemmBatched<ArgTransA,ArgTransB>::invoke(alpha, A, B, beta, C, sizes, mode);
+    }
+
+  }
+}
+
+#endif
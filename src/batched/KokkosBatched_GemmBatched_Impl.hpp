@@ -0,0 +1,447 @@
+#ifndef __KOKKOSBATCHED_GEMM_BATCHED_IMPL_HPP__
+#define __KOKKOSBATCHED_GEMM_BATCHED_IMPL_HPP__
+
+#include <sstream>
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_InstructionSet.hpp"
+
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Serial_Impl.hpp"
+#include "KokkosBatched_Gemm_Team_Impl.hpp"
+#include "KokkosBatched_GemmBatched_Decl.hpp"
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Batched Gemm Impl
+    /// =================
+
+    namespace GemmBatchedImpl {
+
+      // problem extents of op(A) (m x k) and op(B) (k x n)
+      template<typename ArgTrans>
+      struct OpExtent {
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION static int rows(const ViewType &A) { return A.extent(1); }
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION static int cols(const ViewType &A) { return A.extent(2); }
+        KOKKOS_INLINE_FUNCTION static Kokkos::pair<int,int> range0(const int r, const int) { return Kokkos::pair<int,int>(0,r); }
+        KOKKOS_INLINE_FUNCTION static Kokkos::pair<int,int> range1(const int, const int c) { return Kokkos::pair<int,int>(0,c); }
+      };
+
+      template<>
+      struct OpExtent<Trans::Transpose> {
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION static int rows(const ViewType &A) { return A.extent(2); }
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION static int cols(const ViewType &A) { return A.extent(1); }
+        KOKKOS_INLINE_FUNCTION static Kokkos::pair<int,int> range0(const int, const int c) { return Kokkos::pair<int,int>(0,c); }
+        KOKKOS_INLINE_FUNCTION static Kokkos::pair<int,int> range1(const int r, const int) { return Kokkos::pair<int,int>(0,r); }
+      };
+
+      // interleaving is only done for scalar types with a SIMD vector on host
+      template<typename ValueType, typename ExecSpaceType>
+      struct SIMDAvailable {
+        enum : bool { value = ( std::is_same<typename ExecSpaceType::memory_space,Kokkos::HostSpace>::value &&
+                                ( std::is_same<ValueType,float>::value ||
+                                  std::is_same<ValueType,double>::value ||
+                                  std::is_same<ValueType,Kokkos::complex<float> >::value ||
+                                  std::is_same<ValueType,Kokkos::complex<double> >::value ) ) };
+      };
+
+      ///
+      /// Serial: one problem per thread
+      ///
+      template<typename ArgTransA, typename ArgTransB,
+               typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
+      struct SerialFunctor {
+        ScalarType _alpha, _beta;
+        AViewType _a; BViewType _b; CViewType _c;
+
+        SerialFunctor(const ScalarType alpha, const AViewType &a, const BViewType &b,
+                      const ScalarType beta, const CViewType &c)
+          : _alpha(alpha), _beta(beta), _a(a), _b(b), _c(c) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int k) const {
+          auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+          auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+          auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+
+          SerialGemm<ArgTransA,ArgTransB,Algo::Gemm::Blocked>::
+            invoke(_alpha, aa, bb, _beta, cc);
+        }
+      };
+
+      ///
+      /// Team: one problem per team
+      ///
+      template<typename ArgTransA, typename ArgTransB,
+               typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
+      struct TeamFunctor {
+        ScalarType _alpha, _beta;
+        AViewType _a; BViewType _b; CViewType _c;
+
+        TeamFunctor(const ScalarType alpha, const AViewType &a, const BViewType &b,
+                    const ScalarType beta, const CViewType &c)
+          : _alpha(alpha), _beta(beta), _a(a), _b(b), _c(c) {}
+
+        template<typename MemberType>
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const MemberType &member) const {
+          const int k = member.league_rank();
+          auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+          auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+          auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+
+          TeamGemm<MemberType,ArgTransA,ArgTransB,Algo::Gemm::Blocked>::
+            invoke(member, _alpha, aa, bb, _beta, cc);
+        }
+      };
+
+      ///
+      /// SerialSIMD: vector_length problems per thread, interleaved on the fly
+      ///
+      /// The packs are cut into chunks of consecutive packs; a chunk runs its
+      /// packs one by one through its own workspace of one pack, which stays
+      /// in cache. The workspace is sized by the number of chunks (a few per
+      /// thread), not by the batch.
+      ///
+      template<typename ExecSpaceType>
+      inline
+      int
+      num_chunks(const int npack, const int chunks_per_thread) {
+        const int nchunk = ExecSpaceType::concurrency()*chunks_per_thread;
+        return npack < nchunk ? npack : nchunk;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      Kokkos::pair<int,int>
+      chunk_range(const int c, const int nchunk, const int npack) {
+        return Kokkos::pair<int,int>(int((long(c  )*npack)/nchunk),
+                                     int((long(c+1)*npack)/nchunk));
+      }
+
+      template<typename ArgTransA, typename ArgTransB,
+               typename ScalarType, typename AViewType, typename BViewType, typename CViewType,
+               typename PackViewType>
+      struct SerialSIMDFunctor {
+        typedef typename PackViewType::value_type vector_type;
+        enum : int { vector_length = vector_type::vector_length };
+
+        ScalarType _alpha, _beta;
+        AViewType _a; BViewType _b; CViewType _c;
+        PackViewType _ap, _bp, _cp;
+        int _npack;
+
+        SerialSIMDFunctor(const ScalarType alpha, const AViewType &a, const BViewType &b,
+                          const ScalarType beta, const CViewType &c,
+                          const PackViewType &ap, const PackViewType &bp, const PackViewType &cp,
+                          const int npack)
+          : _alpha(alpha), _beta(beta), _a(a), _b(b), _c(c), _ap(ap), _bp(bp), _cp(cp), _npack(npack) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int q) const {
+          auto aa = Kokkos::subview(_ap, q, Kokkos::ALL(), Kokkos::ALL());
+          auto bb = Kokkos::subview(_bp, q, Kokkos::ALL(), Kokkos::ALL());
+          auto cc = Kokkos::subview(_cp, q, Kokkos::ALL(), Kokkos::ALL());
+
+          const Kokkos::pair<int,int> range = chunk_range(q, _ap.extent(0), _npack);
+          for (int p=range.first;p<range.second;++p) {
+            // gather; lanes beyond the batch are zero
+            SerialPack::invoke(p, _a, _ap, q);
+            SerialPack::invoke(p, _b, _bp, q);
+            if (_beta != ScalarType(0))
+              SerialPack::invoke(p, _c, _cp, q);
+
+            SerialGemm<ArgTransA,ArgTransB,Algo::Gemm::Blocked>::
+              invoke(_alpha, aa, bb, _beta, cc);
+
+            // scatter
+            SerialUnpack::invoke(p, _cp, _c, q);
+          }
+        }
+      };
+
+      template<bool is_simd_available>
+      struct SerialSIMDInvoke {
+        template<typename ArgTransA, typename ArgTransB,
+                 typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
+        static int invoke(const ScalarType, const AViewType &, const BViewType &,
+                          const ScalarType, const CViewType &) {
+          return -1;
+        }
+      };
+
+      template<>
+      struct SerialSIMDInvoke<true> {
+        // packs of the vector length of isa, run by a copy of the functor compiled for isa
+        template<int isa,
+                 typename ArgTransA, typename ArgTransB,
+                 typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
+        static int run(const ScalarType alpha, const AViewType &A, const BViewType &B,
+                       const ScalarType beta, const CViewType &C) {
+          typedef typename CViewType::execution_space exec_space;
+          typedef typename CViewType::non_const_value_type value_type;
+          typedef typename InstructionSetVector<value_type,isa>::type vector_type;
+          typedef Kokkos::View<vector_type***,Kokkos::LayoutRight,exec_space> pack_view_type;
+          typedef SerialSIMDFunctor<ArgTransA,ArgTransB,ScalarType,
+                                    AViewType,BViewType,CViewType,pack_view_type> functor_type;
+
+          const int nbatch = C.extent(0), vl = vector_type::vector_length;
+          const int npack = nbatch/vl + (nbatch%vl > 0);
+
+          // uniform packs: a chunk per thread
+          const int nchunk = num_chunks<exec_space>(npack, 1);
+          pack_view_type
+            ap(Kokkos::ViewAllocateWithoutInitializing("GemmBatched::SIMD::A"), nchunk, A.extent(1), A.extent(2)),
+            bp(Kokkos::ViewAllocateWithoutInitializing("GemmBatched::SIMD::B"), nchunk, B.extent(1), B.extent(2)),
+            cp(Kokkos::ViewAllocateWithoutInitializing("GemmBatched::SIMD::C"), nchunk, C.extent(1), C.extent(2));
+
+          const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Static> > policy(0, nchunk);
+          Kokkos::parallel_for("KokkosBatched::GemmBatched::SerialSIMD", policy,
+                               InstructionSetFunctor<functor_type,isa>
+                               (functor_type(alpha, A, B, beta, C, ap, bp, cp, npack)));
+          return 0;
+        }
+
+        template<typename ArgTransA, typename ArgTransB,
+                 typename ScalarType, typename AViewType, typename BViewType, typename CViewType>
+        static int invoke(const ScalarType alpha, const AViewType &A, const BViewType &B,
+                          const ScalarType beta, const CViewType &C) {
+          switch (active_instruction_set()) {
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__)
+          case InstructionSet::AVX512:
+            return run<InstructionSet::AVX512,ArgTransA,ArgTransB>(alpha, A, B, beta, C);
+          case InstructionSet::AVX2:
+            return run<InstructionSet::AVX2,ArgTransA,ArgTransB>(alpha, A, B, beta, C);
+          case InstructionSet::AVX:
+            return run<InstructionSet::AVX,ArgTransA,ArgTransB>(alpha, A, B, beta, C);
+#endif
+          default: break;
+          }
+          return run<InstructionSet::Compiled,ArgTransA,ArgTransB>(alpha, A, B, beta, C);
+        }
+      };
+
+      ///
+      /// Variable size: entry b uses the leading sizes(b,:) block of the padded views
+      ///
+      struct SerialTag {};
+      struct TeamTag {};
+
+      template<typename ArgTransA, typename ArgTransB,
+               typename ScalarType, typename AViewType, typename BViewType, typename CViewType,
+               typename SizeViewType>
+      struct VariableFunctor {
+        ScalarType _alpha, _beta;
+        AViewType _a; BViewType _b; CViewType _c;
+        SizeViewType _sizes;
+
+        VariableFunctor(const ScalarType alpha, const AViewType &a, const BViewType &b,
+                        const ScalarType beta, const CViewType &c, const SizeViewType &sizes)
+          : _alpha(alpha), _beta(beta), _a(a), _b(b), _c(c), _sizes(sizes) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const SerialTag &, const int k) const {
+          const int m = _sizes(k,0), n = _sizes(k,1), kk = _sizes(k,2);
+          auto aa = Kokkos::subview(_a, k, OpExtent<ArgTransA>::range0(m,kk), OpExtent<ArgTransA>::range1(m,kk));
+          auto bb = Kokkos::subview(_b, k, OpExtent<ArgTransB>::range0(kk,n), OpExtent<ArgTransB>::range1(kk,n));
+          auto cc = Kokkos::subview(_c, k, Kokkos::pair<int,int>(0,m), Kokkos::pair<int,int>(0,n));
+
+          SerialGemm<ArgTransA,ArgTransB,Algo::Gemm::Blocked>::
+            invoke(_alpha, aa, bb, _beta, cc);
+        }
+
+        template<typename MemberType>
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const TeamTag &, const MemberType &member) const {
+          const int k = member.league_rank();
+          const int m = _sizes(k,0), n = _sizes(k,1), kk = _sizes(k,2);
+          auto aa = Kokkos::subview(_a, k, OpExtent<ArgTransA>::range0(m,kk), OpExtent<ArgTransA>::range1(m,kk));
+          auto bb = Kokkos::subview(_b, k, OpExtent<ArgTransB>::range0(kk,n), OpExtent<ArgTransB>::range1(kk,n));
+          auto cc = Kokkos::subview(_c, k, Kokkos::pair<int,int>(0,m), Kokkos::pair<int,int>(0,n));
+
+          TeamGemm<MemberType,ArgTransA,ArgTransB,Algo::Gemm::Blocked>::
+            invoke(member, _alpha, aa, bb, _beta, cc);
+        }
+      };
+
+      template<typename ArgTransA, typename ArgTransB,
+               typename AViewType, typename BViewType, typename CViewType>
+      inline
+      void check(const char *label, const AViewType &A, const BViewType &B, const CViewType &C) {
+        static_assert(AViewType::rank == 3, "KokkosBatched::GemmBatched: A must have rank 3 (batch, row, column).");
+        static_assert(BViewType::rank == 3, "KokkosBatched::GemmBatched: B must have rank 3 (batch, row, column).");
+        static_assert(CViewType::rank == 3, "KokkosBatched::GemmBatched: C must have rank 3 (batch, row, column).");
+        static_assert(std::is_same<typename CViewType::value_type,
+                      typename CViewType::non_const_value_type>::value,
+                      "KokkosBatched::GemmBatched: C must be nonconst.");
+
+        const int
+          nbatch = C.extent(0),
+          am = OpExtent<ArgTransA>::rows(A), ak = OpExtent<ArgTransA>::cols(A),
+          bk = OpExtent<ArgTransB>::rows(B), bn = OpExtent<ArgTransB>::cols(B);
+        if (int(A.extent(0)) != nbatch || int(B.extent(0)) != nbatch ||
+            am != int(C.extent(1)) || bn != int(C.extent(2)) || ak != bk) {
+          std::ostringstream os;
+          os << "KokkosBatched::GemmBatched (" << label << "): Dimensions of A, B and C do not match: "
+             << "A: " << A.extent(0) << " x " << A.extent(1) << " x " << A.extent(2)
+             << ", B: " << B.extent(0) << " x " << B.extent(1) << " x " << B.extent(2)
+             << ", C: " << C.extent(0) << " x " << C.extent(1) << " x " << C.extent(2);
+          Kokkos::Impl::throw_runtime_exception(os.str());
+        }
+      }
+
+    } // end GemmBatchedImpl
+
+    template<typename ArgTransA, typename ArgTransB>
+    template<typename ValueType, typename ExecSpaceType>
+    int
+    GemmBatched<ArgTransA,ArgTransB>::
+    select(const int nbatch,
+           const int m, const int n, const int k) {
+      const int mnk = max(m, max(n, k));
+
+      // already interleaved by the user
+      if (is_vector<ValueType>::value) return GemmBatchedMode::Serial;
+
+      if (std::is_same<typename ExecSpaceType::memory_space,Kokkos::HostSpace>::value) {
+        const int concurrency = ExecSpaceType::concurrency();
+        const int vl = active_vector_length<ValueType>();
+
+        // small problems: interleaving pays off once every thread has a few packs
+        if (GemmBatchedImpl::SIMDAvailable<ValueType,ExecSpaceType>::value &&
+            mnk <= 16 && nbatch >= 2*vl)
+          return GemmBatchedMode::SerialSIMD;
+
+        // a few large problems: the batch alone does not feed all threads
+        if (mnk >= 64 && nbatch < concurrency)
+          return GemmBatchedMode::Team;
+
+        return GemmBatchedMode::Serial;
+      }
+
+      // GPUs: a thread per problem only for tiny problems
+      return mnk <= 8 ? GemmBatchedMode::Serial : GemmBatchedMode::Team;
+    }
+
+    template<typename ArgTransA, typename ArgTransB>
+    template<typename ScalarType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    int
+    GemmBatched<ArgTransA,ArgTransB>::
+    invoke(const ScalarType alpha,
+           const AViewType &A,
+           const BViewType &B,
+           const ScalarType beta,
+           const CViewType &C,
+           const int mode) {
+      typedef typename CViewType::execution_space exec_space;
+      typedef typename CViewType::non_const_value_type value_type;
+
+      GemmBatchedImpl::check<ArgTransA,ArgTransB>("uniform", A, B, C);
+
+      const int nbatch = C.extent(0);
+      if (nbatch == 0) return 0;
+
+      const int m = C.extent(1), n = C.extent(2), k = GemmBatchedImpl::OpExtent<ArgTransA>::cols(A);
+      const int algo = (mode == GemmBatchedMode::Auto ?
+                        select<value_type,exec_space>(nbatch, m, n, k) : mode);
+
+      switch (algo) {
+      case GemmBatchedMode::Serial: {
+        const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Static> > policy(0, nbatch);
+        Kokkos::parallel_for("KokkosBatched::GemmBatched::Serial", policy,
+                             GemmBatchedImpl::SerialFunctor<ArgTransA,ArgTransB,ScalarType,
+                             AViewType,BViewType,CViewType>(alpha, A, B, beta, C));
+        break;
+      }
+      case GemmBatchedMode::Team: {
+        const Kokkos::TeamPolicy<exec_space> policy(nbatch, Kokkos::AUTO);
+        Kokkos::parallel_for("KokkosBatched::GemmBatched::Team", policy,
+                             GemmBatchedImpl::TeamFunctor<ArgTransA,ArgTransB,ScalarType,
+                             AViewType,BViewType,CViewType>(alpha, A, B, beta, C));
+        break;
+      }
+      case GemmBatchedMode::SerialSIMD: {
+        return GemmBatchedImpl::SerialSIMDInvoke<GemmBatchedImpl::SIMDAvailable<value_type,exec_space>::value>::
+          template invoke<ArgTransA,ArgTransB>(alpha, A, B, beta, C);
+      }
+      default:
+        return -1;
+      }
+      return 0;
+    }
+
+    template<typename ArgTransA, typename ArgTransB>
+    template<typename ScalarType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType,
+             typename SizeViewType>
+    typename std::enable_if<Kokkos::is_view<SizeViewType>::value,int>::type
+    GemmBatched<ArgTransA,ArgTransB>::
+    invoke(const ScalarType alpha,
+           const AViewType &A,
+           const BViewType &B,
+           const ScalarType beta,
+           const CViewType &C,
+           const SizeViewType &sizes,
+           const int mode) {
+      typedef typename CViewType::execution_space exec_space;
+      typedef typename CViewType::non_const_value_type value_type;
+
+      static_assert(SizeViewType::rank == 2, "KokkosBatched::GemmBatched: sizes must have rank 2 (batch, 3).");
+      GemmBatchedImpl::check<ArgTransA,ArgTransB>("variable", A, B, C);
+
+      const int nbatch = C.extent(0);
+      if (int(sizes.extent(0)) != nbatch || sizes.extent(1) < 3) {
+        std::ostringstream os;
+        os << "KokkosBatched::GemmBatched (variable): sizes must be " << nbatch << " x 3, "
+           << "but is " << sizes.extent(0) << " x " << sizes.extent(1);
+        Kokkos::Impl::throw_runtime_exception(os.str());
+      }
+      if (nbatch == 0) return 0;
+
+      // padded extents bound every entry of the batch
+      const int m = C.extent(1), n = C.extent(2), k = GemmBatchedImpl::OpExtent<ArgTransA>::cols(A);
+      int algo = (mode == GemmBatchedMode::Auto ?
+                  select<value_type,exec_space>(nbatch, m, n, k) : mode);
+      if (mode == GemmBatchedMode::Auto && algo == GemmBatchedMode::SerialSIMD)
+        algo = GemmBatchedMode::Serial;
+
+      typedef GemmBatchedImpl::VariableFunctor<ArgTransA,ArgTransB,ScalarType,
+        AViewType,BViewType,CViewType,SizeViewType> functor_type;
+      switch (algo) {
+      case GemmBatchedMode::Serial: {
+        const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Dynamic>,
+          GemmBatchedImpl::SerialTag> policy(0, nbatch);
+        Kokkos::parallel_for("KokkosBatched::GemmBatched::Variable::Serial", policy,
+                             functor_type(alpha, A, B, beta, C, sizes));
+        break;
+      }
+      case GemmBatchedMode::Team: {
+        const Kokkos::TeamPolicy<exec_space,GemmBatchedImpl::TeamTag> policy(nbatch, Kokkos::AUTO);
+        Kokkos::parallel_for("KokkosBatched::GemmBatched::Variable::Team", policy,
+                             functor_type(alpha, A, B, beta, C, sizes));
+        break;
+      }
+      default:
+        return -1;
+      }
+      return 0;
+    }
+
+  }
+}
+
+#endif
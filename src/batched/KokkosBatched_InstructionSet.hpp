@@ -0,0 +1,233 @@
+#ifndef __KOKKOSBATCHED_INSTRUCTION_SET_HPP__
+#define __KOKKOSBATCHED_INSTRUCTION_SET_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+// function multiversioning needs the gnu target attribute and cpu detection on x86
+#if !defined(__CUDA_ARCH__) && !defined(__CUDACC__) &&                  \
+  (defined(__x86_64__) || defined(__i386__)) &&                         \
+  (defined(KOKKOS_COMPILER_GNU) || defined(KOKKOS_COMPILER_CLANG))
+#define __KOKKOSBATCHED_ENABLE_MULTIVERSION__
+#endif
+
+#include "KokkosBatched_InstructionSet_AVX512.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Host Instruction Sets
+    /// =====================
+    ///
+    /// Vector<SIMD<T>,l> picks its intrinsics when it is compiled
+    /// (__AVX__, __AVX512F__), which fixes DefaultVectorLength for the
+    /// whole build. The top-level SerialSIMD kernels (GemmBatched and
+    /// VariableBatched) are multiversioned on top of it: a copy of the
+    /// kernel is compiled for every wider instruction set through the
+    /// target attribute, and the copy is selected at run time. The
+    /// AVX512 copy interleaves float and double into the intrinsic
+    /// Vector<AVX<T>,l> of KokkosBatched_InstructionSet_AVX512.hpp; the
+    /// other wider copies work on the generic Vector of that width, i.e.,
+    /// on array loops vectorized by the compiler for the target. By
+    /// default the kernels run the widest set of the host; request
+    /// another one to compare, e.g., with
+    /// KokkosBatched_Test_VariableBatched_Host. Multiversioning needs gcc
+    /// or clang on x86; otherwise the compiled set is the only one.
+    ///
+    /// - compiled_instruction_set() : the set Vector<SIMD<T>,l> is built for
+    /// - host_instruction_set()     : the widest set of the running cpu,
+    ///                                detected once
+    /// - active_instruction_set()   : the set of the SerialSIMD kernels,
+    ///                                the requested set (the widest by
+    ///                                default) clamped to the compiled
+    ///                                and the host sets
+    /// - active_vector_length<T>()  : number of T interleaved by them
+    ///
+    /// set_instruction_set(isa) requests isa and returns the active set;
+    /// InstructionSet::Default restores the default above. It is not
+    /// thread safe and should be called before the kernels run.
+    ///
+
+    struct InstructionSet {
+      enum : int { Default = -1,
+                   Scalar = 0,
+                   AVX = 1,
+                   AVX2 = 2,
+                   AVX512 = 3,
+#if   defined(__KOKKOSBATCHED_ENABLE_AVX__) && defined(__AVX512F__)
+                   Compiled = AVX512
+#elif defined(__KOKKOSBATCHED_ENABLE_AVX__) && defined(__AVX2__)
+                   Compiled = AVX2
+#elif defined(__KOKKOSBATCHED_ENABLE_AVX__) && defined(__AVX__)
+                   Compiled = AVX
+#else
+                   Compiled = Scalar
+#endif
+      };
+
+      static const char* name(const int isa) {
+        switch (isa) {
+        case Default: return "Default";
+        case AVX:    return "AVX";
+        case AVX2:   return "AVX2";
+        case AVX512: return "AVX512";
+        default: break;
+        }
+        return "Scalar";
+      }
+    };
+
+    /// vector length of a kernel built for the instruction set; the
+    /// compiled set uses DefaultVectorLength
+    template<typename ValueType, int isa>
+    struct InstructionSetVectorLength {
+      enum : int { bytes = (isa == InstructionSet::AVX512 ? 64 : 32),
+                   value = (isa == InstructionSet::Compiled ?
+                            int(DefaultVectorLength<ValueType,Kokkos::HostSpace>::value) :
+                            sizeof(ValueType) < bytes ? int(bytes/sizeof(ValueType)) : 1) };
+    };
+
+    /// vector type of a kernel built for the instruction set
+    template<typename ValueType, int isa>
+    struct InstructionSetVector {
+      typedef Vector<SIMD<ValueType>,InstructionSetVectorLength<ValueType,isa>::value> type;
+    };
+
+#if defined(__KOKKOSBATCHED_ENABLE_AVX512_TARGET__)
+    template<>
+    struct InstructionSetVector<float,InstructionSet::AVX512> {
+      typedef Vector<AVX<float>,16> type;
+    };
+    template<>
+    struct InstructionSetVector<double,InstructionSet::AVX512> {
+      typedef Vector<AVX<double>,8> type;
+    };
+#endif
+
+    namespace Impl {
+      inline
+      int
+      detect_host_instruction_set() {
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__)
+        // also checks that the os saves the ymm/zmm state
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return InstructionSet::AVX512;
+        if (__builtin_cpu_supports("avx2") &&
+            __builtin_cpu_supports("fma"))     return InstructionSet::AVX2;
+        if (__builtin_cpu_supports("avx"))     return InstructionSet::AVX;
+        return InstructionSet::Scalar;
+#else
+        return InstructionSet::Compiled;
+#endif
+      }
+
+      inline
+      int&
+      requested_instruction_set() {
+        static int isa = InstructionSet::Default;
+        return isa;
+      }
+    }
+
+    inline
+    int
+    compiled_instruction_set() {
+      return InstructionSet::Compiled;
+    }
+
+    inline
+    int
+    host_instruction_set() {
+      static const int isa = Impl::detect_host_instruction_set();
+      return isa;
+    }
+
+    inline
+    int
+    active_instruction_set() {
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__)
+      int isa = Impl::requested_instruction_set();
+      if (isa == InstructionSet::Default)
+        isa = InstructionSet::AVX512;
+      isa = min(isa, host_instruction_set());
+      return max(isa, int(InstructionSet::Compiled));
+#else
+      return InstructionSet::Compiled;
+#endif
+    }
+
+    /// requests isa for the SerialSIMD kernels and returns the resulting active set
+    inline
+    int
+    set_instruction_set(const int isa) {
+      Impl::requested_instruction_set() = isa;
+      return active_instruction_set();
+    }
+
+    template<typename ValueType>
+    inline
+    int
+    active_vector_length() {
+      switch (active_instruction_set()) {
+      case InstructionSet::AVX512: return InstructionSetVectorLength<ValueType,InstructionSet::AVX512>::value;
+      case InstructionSet::AVX2:   return InstructionSetVectorLength<ValueType,InstructionSet::AVX2>::value;
+      case InstructionSet::AVX:    return InstructionSetVectorLength<ValueType,InstructionSet::AVX>::value;
+      default: break;
+      }
+      return InstructionSetVectorLength<ValueType,InstructionSet::Scalar>::value;
+    }
+
+    ///
+    /// InstructionSetFunctor<FunctorType,isa> runs a range functor with
+    /// the body compiled for isa; flatten inlines the whole call tree
+    /// into the target region so that the generic vector loops are
+    /// vectorized for it. Sets not wider than the compiled one run the
+    /// functor as is.
+    ///
+    template<typename FunctorType, int isa,
+             bool is_wider = (isa > InstructionSet::Compiled)>
+    struct InstructionSetFunctor {
+      FunctorType _functor;
+
+      InstructionSetFunctor(const FunctorType &functor) : _functor(functor) {}
+
+      KOKKOS_INLINE_FUNCTION
+      void operator()(const int i) const { _functor(i); }
+    };
+
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__)
+    template<typename FunctorType>
+    struct InstructionSetFunctor<FunctorType,InstructionSet::AVX,true> {
+      FunctorType _functor;
+
+      InstructionSetFunctor(const FunctorType &functor) : _functor(functor) {}
+
+      __attribute__((target("avx"),flatten))
+      void operator()(const int i) const { _functor(i); }
+    };
+
+    template<typename FunctorType>
+    struct InstructionSetFunctor<FunctorType,InstructionSet::AVX2,true> {
+      FunctorType _functor;
+
+      InstructionSetFunctor(const FunctorType &functor) : _functor(functor) {}
+
+      __attribute__((target("avx2,fma"),flatten))
+      void operator()(const int i) const { _functor(i); }
+    };
+
+    template<typename FunctorType>
+    struct InstructionSetFunctor<FunctorType,InstructionSet::AVX512,true> {
+      FunctorType _functor;
+
+      InstructionSetFunctor(const FunctorType &functor) : _functor(functor) {}
+
+      __attribute__((target("avx512f"),flatten))
+      void operator()(const int i) const { _functor(i); }
+    };
+#endif
+
+  }
+}
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef __KOKKOSBATCHED_INSTRUCTION_SET_AVX512_HPP__
+#define __KOKKOSBATCHED_INSTRUCTION_SET_AVX512_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+///
+/// AVX-512 vectors of the multiversioned SerialSIMD kernels
+/// ========================================================
+///
+/// A build without __AVX512F__ has no intrinsic Vector<SIMD<T>,l> of
+/// 512 bits, and the generic one of that width must stay portable as it
+/// is used outside of the kernels as well. The AVX512 copies of the
+/// SerialSIMD kernels interleave real values into Vector<AVX<T>,l>
+/// instead, whose operations are compiled for avx512f by the pragmas
+/// below and are inlined into the target region of
+/// InstructionSetFunctor. The lanes are kept in memory, not in a
+/// __m512d, so the layout and the calling convention of the type do not
+/// depend on the target of the caller; the loads and stores vanish once
+/// the operations are inlined. The types must only be operated on by a
+/// host that supports avx512f, i.e., through active_instruction_set().
+///
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__) && !defined(__AVX512F__)
+#define __KOKKOSBATCHED_ENABLE_AVX512_TARGET__
+
+#include <immintrin.h>
+
+#if defined(KOKKOS_COMPILER_CLANG)
+#pragma clang attribute push (__attribute__((target("avx512f"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    template<typename T, int l>
+    struct is_vector<Vector<AVX<T>,l> > : public std::true_type {};
+
+    template<int l> struct MagnitudeScalarType<Vector<AVX<float>,l> > { typedef float type; };
+    template<int l> struct MagnitudeScalarType<Vector<AVX<double>,l> > { typedef double type; };
+
+    template<>
+    class Vector<AVX<double>,8> {
+    public:
+      using type = Vector<AVX<double>,8>;
+      using value_type = double;
+      using mag_type = double;
+
+      enum : int { vector_length = 8 };
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX512"; }
+
+    private:
+      alignas(64) mutable value_type _data[vector_length];
+
+    public:
+      inline Vector() { _mm512_storeu_pd(_data, _mm512_setzero_pd()); }
+      inline Vector(const value_type &val) { _mm512_storeu_pd(_data, _mm512_set1_pd(val)); }
+      inline Vector(const type &b) { _mm512_storeu_pd(_data, b); }
+      inline Vector(const __m512d &val) { _mm512_storeu_pd(_data, val); }
+
+      inline
+      type& operator=(const type &b) {
+        _mm512_storeu_pd(_data, b);
+        return *this;
+      }
+
+      inline
+      operator __m512d() const {
+        return _mm512_loadu_pd(_data);
+      }
+
+      inline
+      value_type& operator[](const int &i) const {
+        return _data[i];
+      }
+    };
+
+    template<>
+    class Vector<AVX<float>,16> {
+    public:
+      using type = Vector<AVX<float>,16>;
+      using value_type = float;
+      using mag_type = float;
+
+      enum : int { vector_length = 16 };
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX512"; }
+
+    private:
+      alignas(64) mutable value_type _data[vector_length];
+
+    public:
+      inline Vector() { _mm512_storeu_ps(_data, _mm512_setzero_ps()); }
+      inline Vector(const value_type &val) { _mm512_storeu_ps(_data, _mm512_set1_ps(val)); }
+      inline Vector(const type &b) { _mm512_storeu_ps(_data, b); }
+      inline Vector(const __m512 &val) { _mm512_storeu_ps(_data, val); }
+
+      inline
+      type& operator=(const type &b) {
+        _mm512_storeu_ps(_data, b);
+        return *this;
+      }
+
+      inline
+      operator __m512() const {
+        return _mm512_loadu_ps(_data);
+      }
+
+      inline
+      value_type& operator[](const int &i) const {
+        return _data[i];
+      }
+    };
+
+    /// simd, simd
+
+    inline
+    static Vector<AVX<double>,8>
+    operator + (const Vector<AVX<double>,8> &a, const Vector<AVX<double>,8> &b) {
+      return _mm512_add_pd(a, b);
+    }
+
+    inline
+    static Vector<AVX<float>,16>
+    operator + (const Vector<AVX<float>,16> &a, const Vector<AVX<float>,16> &b) {
+      return _mm512_add_ps(a, b);
+    }
+
+    inline
+    static Vector<AVX<double>,8>
+    operator - (const Vector<AVX<double>,8> &a, const Vector<AVX<double>,8> &b) {
+      return _mm512_sub_pd(a, b);
+    }
+
+    inline
+    static Vector<AVX<float>,16>
+    operator - (const Vector<AVX<float>,16> &a, const Vector<AVX<float>,16> &b) {
+      return _mm512_sub_ps(a, b);
+    }
+
+    inline
+    static Vector<AVX<double>,8>
+    operator * (const Vector<AVX<double>,8> &a, const Vector<AVX<double>,8> &b) {
+      return _mm512_mul_pd(a, b);
+    }
+
+    inline
+    static Vector<AVX<float>,16>
+    operator * (const Vector<AVX<float>,16> &a, const Vector<AVX<float>,16> &b) {
+      return _mm512_mul_ps(a, b);
+    }
+
+    inline
+    static Vector<AVX<double>,8>
+    operator / (const Vector<AVX<double>,8> &a, const Vector<AVX<double>,8> &b) {
+      return _mm512_div_pd(a, b);
+    }
+
+    inline
+    static Vector<AVX<float>,16>
+    operator / (const Vector<AVX<float>,16> &a, const Vector<AVX<float>,16> &b) {
+      return _mm512_div_ps(a, b);
+    }
+
+    template<typename T, int l>
+    inline
+    static Vector<AVX<T>,l>
+    operator - (const Vector<AVX<T>,l> &a) {
+      return Vector<AVX<T>,l>(T(0)) - a;
+    }
+
+    /// compound assignment and mixed simd, real; the real is broadcast
+
+#undef  KOKKOSBATCHED_AVX512_BINARY_OPERATOR
+#define KOKKOSBATCHED_AVX512_BINARY_OPERATOR(op, op_assign)             \
+    template<typename T, int l>                                         \
+    inline                                                              \
+    static Vector<AVX<T>,l>&                                            \
+    operator op_assign (Vector<AVX<T>,l> &a, const Vector<AVX<T>,l> &b) { \
+      a = a op b;                                                       \
+      return a;                                                         \
+    }                                                                   \
+                                                                        \
+    template<typename T, int l>                                         \
+    inline                                                              \
+    static Vector<AVX<T>,l>                                             \
+    operator op (const Vector<AVX<T>,l> &a, const T b) {                \
+      return a op Vector<AVX<T>,l>(b);                                  \
+    }                                                                   \
+                                                                        \
+    template<typename T, int l>                                         \
+    inline                                                              \
+    static Vector<AVX<T>,l>                                             \
+    operator op (const T a, const Vector<AVX<T>,l> &b) {                \
+      return Vector<AVX<T>,l>(a) op b;                                  \
+    }                                                                   \
+                                                                        \
+    template<typename T, int l>                                         \
+    inline                                                              \
+    static Vector<AVX<T>,l>&                                            \
+    operator op_assign (Vector<AVX<T>,l> &a, const T b) {               \
+      a = a op b;                                                       \
+      return a;                                                         \
+    }
+
+    KOKKOSBATCHED_AVX512_BINARY_OPERATOR(+, +=)
+    KOKKOSBATCHED_AVX512_BINARY_OPERATOR(-, -=)
+    KOKKOSBATCHED_AVX512_BINARY_OPERATOR(*, *=)
+    KOKKOSBATCHED_AVX512_BINARY_OPERATOR(/, /=)
+
+#undef  KOKKOSBATCHED_AVX512_BINARY_OPERATOR
+
+  }
+}
+
+#if defined(KOKKOS_COMPILER_CLANG)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+#endif
+#endif
@@ -0,0 +1,75 @@
+#ifndef __KOKKOSBATCHED_INVERSE_DECL_HPP__
+#define __KOKKOSBATCHED_INVERSE_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Inverse of a small square matrix, Ainv = A^{-1}, without pivoting.
+    ///
+    /// Blocks of size 1 to 5 use closed forms (adjugate for 2x2 and 3x3,
+    /// fully unrolled Gauss-Jordan elimination for 4x4 and 5x5) and do
+    /// not modify A. Larger blocks are factorized by LU in place (A is
+    /// overwritten by its factors) followed by two triangular solves
+    /// on Ainv = I.
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialInverse {
+      template<typename AViewType,
+               typename AinvViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const AinvViewType &Ainv);
+    };       
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamInverse {
+      template<typename AViewType,
+               typename AinvViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const AinvViewType &Ainv);
+    };       
+
+    ///
+    /// Top-level: block diagonal (block Jacobi) inverse over a batch
+    ///
+    /// compute : Ainv(k,:,:) = A(k,:,:)^{-1} for all blocks k (A is used
+    ///           as workspace)
+    /// apply   : y(k,:) = alpha Ainv(k,:,:) x(k,:) + beta y(k,:), a small
+    ///           gemv per block
+    ///
+    /// The blocks may be scalar or in the compact SIMD layout, one pack
+    /// of Vector<SIMD<T>,l> blocks per k.
+    ///
+
+    struct BlockDiagInverse {
+      template<typename AViewType,
+               typename AinvViewType>
+      static void
+      compute(const AViewType &A,
+              const AinvViewType &Ainv);
+
+      template<typename ScalarType,
+               typename AinvViewType,
+               typename xViewType,
+               typename yViewType>
+      static void
+      apply(const ScalarType alpha,
+            const AinvViewType &Ainv,
+            const xViewType &x,
+            const ScalarType beta,
+            const yViewType &y);
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,124 @@
+#ifndef __KOKKOSBATCHED_INVERSE_IMPL_HPP__
+#define __KOKKOSBATCHED_INVERSE_IMPL_HPP__
+
+
+#include <sstream>
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Inverse_Decl.hpp"
+#include "KokkosBatched_Inverse_Serial_Impl.hpp"
+#include "KokkosBatched_Gemv_Decl.hpp"
+#include "KokkosBatched_Gemv_Serial_Impl.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Top-level Impl
+    /// ==============
+
+    namespace BlockDiagInverseImpl {
+
+      template<typename AViewType, typename AinvViewType>
+      struct ComputeFunctor {
+        AViewType _A;
+        AinvViewType _Ainv;
+
+        ComputeFunctor(const AViewType &A, const AinvViewType &Ainv)
+          : _A(A), _Ainv(Ainv) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int k) const {
+          auto A    = Kokkos::subview(_A,    k, Kokkos::ALL(), Kokkos::ALL());
+          auto Ainv = Kokkos::subview(_Ainv, k, Kokkos::ALL(), Kokkos::ALL());
+          SerialInverse<Algo::Inverse::Blocked>::invoke(A, Ainv);
+        }
+      };
+
+      template<typename ScalarType, typename AinvViewType, typename xViewType, typename yViewType>
+      struct ApplyFunctor {
+        ScalarType _alpha, _beta;
+        AinvViewType _Ainv;
+        xViewType _x;
+        yViewType _y;
+
+        ApplyFunctor(const ScalarType alpha, const AinvViewType &Ainv, const xViewType &x,
+                     const ScalarType beta, const yViewType &y)
+          : _alpha(alpha), _beta(beta), _Ainv(Ainv), _x(x), _y(y) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int k) const {
+          auto Ainv = Kokkos::subview(_Ainv, k, Kokkos::ALL(), Kokkos::ALL());
+          auto x    = Kokkos::subview(_x,    k, Kokkos::ALL());
+          auto y    = Kokkos::subview(_y,    k, Kokkos::ALL());
+          SerialGemv<Trans::NoTranspose,Algo::Gemv::Blocked>::invoke(_alpha, Ainv, x, _beta, y);
+        }
+      };
+    }
+
+    template<typename AViewType,
+             typename AinvViewType>
+    void
+    BlockDiagInverse::
+    compute(const AViewType &A,
+            const AinvViewType &Ainv) {
+      typedef typename AViewType::execution_space exec_space;
+
+      static_assert(AViewType::rank == 3 && AinvViewType::rank == 3,
+                    "KokkosBatched::BlockDiagInverse::compute: A and Ainv must have rank 3.");
+
+      if (A.extent(0) != Ainv.extent(0) ||
+          A.extent(1) != A.extent(2) ||
+          A.extent(1) != Ainv.extent(1) ||
+          A.extent(2) != Ainv.extent(2)) {
+        std::ostringstream os;
+        os << "KokkosBatched::BlockDiagInverse::compute: Dimensions do not match: "
+           << "A is " << A.extent(0) << " x " << A.extent(1) << " x " << A.extent(2) << ", "
+           << "Ainv is " << Ainv.extent(0) << " x " << Ainv.extent(1) << " x " << Ainv.extent(2);
+        Kokkos::Impl::throw_runtime_exception(os.str());
+      }
+
+      const Kokkos::RangePolicy<exec_space> policy(0, A.extent(0));
+      Kokkos::parallel_for("KokkosBatched::BlockDiagInverse::compute", policy,
+                           BlockDiagInverseImpl::ComputeFunctor<AViewType,AinvViewType>(A, Ainv));
+    }
+
+    template<typename ScalarType,
+             typename AinvViewType,
+             typename xViewType,
+             typename yViewType>
+    void
+    BlockDiagInverse::
+    apply(const ScalarType alpha,
+          const AinvViewType &Ainv,
+          const xViewType &x,
+          const ScalarType beta,
+          const yViewType &y) {
+      typedef typename AinvViewType::execution_space exec_space;
+
+      static_assert(AinvViewType::rank == 3 && xViewType::rank == 2 && yViewType::rank == 2,
+                    "KokkosBatched::BlockDiagInverse::apply: Ainv must have rank 3, x and y rank 2.");
+
+      if (Ainv.extent(0) != x.extent(0) ||
+          Ainv.extent(0) != y.extent(0) ||
+          Ainv.extent(2) != x.extent(1) ||
+          Ainv.extent(1) != y.extent(1)) {
+        std::ostringstream os;
+        os << "KokkosBatched::BlockDiagInverse::apply: Dimensions do not match: "
+           << "Ainv is " << Ainv.extent(0) << " x " << Ainv.extent(1) << " x " << Ainv.extent(2) << ", "
+           << "x is " << x.extent(0) << " x " << x.extent(1) << ", "
+           << "y is " << y.extent(0) << " x " << y.extent(1);
+        Kokkos::Impl::throw_runtime_exception(os.str());
+      }
+
+      const Kokkos::RangePolicy<exec_space> policy(0, Ainv.extent(0));
+      Kokkos::parallel_for("KokkosBatched::BlockDiagInverse::apply", policy,
+                           BlockDiagInverseImpl::ApplyFunctor<ScalarType,AinvViewType,xViewType,yViewType>
+                           (alpha, Ainv, x, beta, y));
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef __KOKKOSBATCHED_INVERSE_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_INVERSE_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Inverse_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<>
+    template<typename AViewType,
+             typename AinvViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialInverse<Algo::Inverse::Unblocked>::
+    invoke(const AViewType &A,
+           const AinvViewType &Ainv) {
+      return SerialInverseInternal<Algo::Inverse::Unblocked>::invoke(A.extent(0),
+                                                                     A.data(), A.stride_0(), A.stride_1(),
+                                                                     Ainv.data(), Ainv.stride_0(), Ainv.stride_1());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename AinvViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialInverse<Algo::Inverse::Blocked>::
+    invoke(const AViewType &A,
+           const AinvViewType &Ainv) {
+      return SerialInverseInternal<Algo::Inverse::Blocked>::invoke(A.extent(0),
+                                                                   A.data(), A.stride_0(), A.stride_1(),
+                                                                   Ainv.data(), Ainv.stride_0(), Ainv.stride_1());
+    }
+
+  }
+}
+
+#endif
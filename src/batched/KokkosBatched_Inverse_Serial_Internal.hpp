@@ -0,0 +1,190 @@
+#ifndef __KOKKOSBATCHED_INVERSE_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_INVERSE_SERIAL_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Set_Internal.hpp"
+#include "KokkosBatched_LU_Serial_Internal.hpp"
+#include "KokkosBatched_Trsm_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    namespace InverseInternal {
+
+      // in-register Gauss-Jordan elimination, the loops are unrolled for fixed m
+      template<int m>
+      struct Unrolled {
+        template<typename ValueType>
+        KOKKOS_INLINE_FUNCTION
+        static void
+        invoke(const ValueType *__restrict__ A, const int as0, const int as1,
+               /**/  ValueType *__restrict__ Ainv, const int ais0, const int ais1) {
+          ValueType a[m][m];
+
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int i=0;i<m;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int j=0;j<m;++j)
+              a[i][j] = A[i*as0+j*as1];
+
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int k=0;k<m;++k) {
+            const ValueType inv_akk = ValueType(1)/a[k][k];
+            a[k][k] = ValueType(1);
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int j=0;j<m;++j)
+              a[k][j] *= inv_akk;
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int i=0;i<m;++i) {
+              if (i == k) continue;
+              const ValueType aik = a[i][k];
+              a[i][k] = ValueType(0);
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+              for (int j=0;j<m;++j)
+                a[i][j] -= aik*a[k][j];
+            }
+          }
+
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int i=0;i<m;++i)
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+            for (int j=0;j<m;++j)
+              Ainv[i*ais0+j*ais1] = a[i][j];
+        }
+      };
+
+      template<>
+      struct Unrolled<1> {
+        template<typename ValueType>
+        KOKKOS_INLINE_FUNCTION
+        static void
+        invoke(const ValueType *__restrict__ A, const int as0, const int as1,
+               /**/  ValueType *__restrict__ Ainv, const int ais0, const int ais1) {
+          Ainv[0] = ValueType(1)/A[0];
+        }
+      };
+
+      // adjugate
+      template<>
+      struct Unrolled<2> {
+        template<typename ValueType>
+        KOKKOS_INLINE_FUNCTION
+        static void
+        invoke(const ValueType *__restrict__ A, const int as0, const int as1,
+               /**/  ValueType *__restrict__ Ainv, const int ais0, const int ais1) {
+          const ValueType
+            a00 = A[0*as0+0*as1], a01 = A[0*as0+1*as1],
+            a10 = A[1*as0+0*as1], a11 = A[1*as0+1*as1];
+
+          const ValueType inv_det = ValueType(1)/(a00*a11 - a01*a10);
+
+          Ainv[0*ais0+0*ais1] =  a11*inv_det;
+          Ainv[0*ais0+1*ais1] = -a01*inv_det;
+          Ainv[1*ais0+0*ais1] = -a10*inv_det;
+          Ainv[1*ais0+1*ais1] =  a00*inv_det;
+        }
+      };
+
+      template<>
+      struct Unrolled<3> {
+        template<typename ValueType>
+        KOKKOS_INLINE_FUNCTION
+        static void
+        invoke(const ValueType *__restrict__ A, const int as0, const int as1,
+               /**/  ValueType *__restrict__ Ainv, const int ais0, const int ais1) {
+          const ValueType
+            a00 = A[0*as0+0*as1], a01 = A[0*as0+1*as1], a02 = A[0*as0+2*as1],
+            a10 = A[1*as0+0*as1], a11 = A[1*as0+1*as1], a12 = A[1*as0+2*as1],
+            a20 = A[2*as0+0*as1], a21 = A[2*as0+1*as1], a22 = A[2*as0+2*as1];
+
+          const ValueType
+            c00 = a11*a22 - a12*a21,
+            c01 = a12*a20 - a10*a22,
+            c02 = a10*a21 - a11*a20;
+
+          const ValueType inv_det = ValueType(1)/(a00*c00 + a01*c01 + a02*c02);
+
+          Ainv[0*ais0+0*ais1] = c00*inv_det;
+          Ainv[0*ais0+1*ais1] = (a02*a21 - a01*a22)*inv_det;
+          Ainv[0*ais0+2*ais1] = (a01*a12 - a02*a11)*inv_det;
+          Ainv[1*ais0+0*ais1] = c01*inv_det;
+          Ainv[1*ais0+1*ais1] = (a00*a22 - a02*a20)*inv_det;
+          Ainv[1*ais0+2*ais1] = (a02*a10 - a00*a12)*inv_det;
+          Ainv[2*ais0+0*ais1] = c02*inv_det;
+          Ainv[2*ais0+1*ais1] = (a01*a20 - a00*a21)*inv_det;
+          Ainv[2*ais0+2*ais1] = (a00*a11 - a01*a10)*inv_det;
+        }
+      };
+
+      // closed forms for m <= 5; returns false if m is not covered
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      bool
+      closed_form(const int m,
+                  const ValueType *__restrict__ A, const int as0, const int as1,
+                  /**/  ValueType *__restrict__ Ainv, const int ais0, const int ais1) {
+        switch (m) {
+        case 0: break;
+        case 1: Unrolled<1>::invoke(A, as0, as1, Ainv, ais0, ais1); break;
+        case 2: Unrolled<2>::invoke(A, as0, as1, Ainv, ais0, ais1); break;
+        case 3: Unrolled<3>::invoke(A, as0, as1, Ainv, ais0, ais1); break;
+        case 4: Unrolled<4>::invoke(A, as0, as1, Ainv, ais0, ais1); break;
+        case 5: Unrolled<5>::invoke(A, as0, as1, Ainv, ais0, ais1); break;
+        default: return false;
+        }
+        return true;
+      }
+    }
+
+    template<typename AlgoType>
+    struct SerialInverseInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m,
+             /**/  ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ Ainv, const int ais0, const int ais1) {
+        if (InverseInternal::closed_form(m, A, as0, as1, Ainv, ais0, ais1)) return 0;
+
+        const typename MagnitudeScalarType<ValueType>::type zero(0), one(1);
+
+        // A = L U, Ainv = U^{-1} L^{-1} I
+        SerialLU_Internal<AlgoType>::invoke(m, m, A, as0, as1, zero);
+
+        SerialSetInternal::invoke(m, m, zero, Ainv, ais0, ais1);
+        for (int i=0;i<m;++i)
+          Ainv[i*ais0+i*ais1] = ValueType(1);
+
+        SerialTrsmInternalLeftLower<AlgoType>::invoke(true,  m, m, one, A, as0, as1, Ainv, ais0, ais1);
+        SerialTrsmInternalLeftUpper<AlgoType>::invoke(false, m, m, one, A, as0, as1, Ainv, ais0, ais1);
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
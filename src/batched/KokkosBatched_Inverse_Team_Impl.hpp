@@ -0,0 +1,46 @@
+#ifndef __KOKKOSBATCHED_INVERSE_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_INVERSE_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Inverse_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+
+    template<typename MemberType>
+    struct TeamInverse<MemberType,Algo::Inverse::Unblocked> {
+      template<typename AViewType,
+               typename AinvViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const AinvViewType &Ainv) {
+        return TeamInverseInternal<Algo::Inverse::Unblocked>::invoke(member,
+                                                                     A.extent(0),
+                                                                     A.data(), A.stride_0(), A.stride_1(),
+                                                                     Ainv.data(), Ainv.stride_0(), Ainv.stride_1());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamInverse<MemberType,Algo::Inverse::Blocked> {
+      template<typename AViewType,
+               typename AinvViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const AinvViewType &Ainv) {
+        return TeamInverseInternal<Algo::Inverse::Blocked>::invoke(member,
+                                                                   A.extent(0),
+                                                                   A.data(), A.stride_0(), A.stride_1(),
+                                                                   Ainv.data(), Ainv.stride_0(), Ainv.stride_1());
+      }
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef __KOKKOSBATCHED_INVERSE_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_INVERSE_TEAM_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Inverse_Serial_Internal.hpp"
+
+#include "KokkosBatched_Set_Internal.hpp"
+#include "KokkosBatched_LU_Team_Internal.hpp"
+#include "KokkosBatched_Trsm_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    template<typename AlgoType>
+    struct TeamInverseInternal {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int m,
+             /**/  ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ Ainv, const int ais0, const int ais1) {
+        if (m <= 5) {
+          // closed forms are too small to split over the team
+          if (member.team_rank() == 0)
+            InverseInternal::closed_form(m, A, as0, as1, Ainv, ais0, ais1);
+          // the other ranks must not read Ainv before it is written
+          member.team_barrier();
+          return 0;
+        }
+
+        const typename MagnitudeScalarType<ValueType>::type zero(0), one(1);
+
+        // A = L U, Ainv = U^{-1} L^{-1} I
+        TeamLU_Internal<AlgoType>::invoke(member, m, m, A, as0, as1, zero);
+
+        TeamSetInternal::invoke(member, m, m, zero, Ainv, ais0, ais1);
+        member.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,m),[&](const int &i) {
+            Ainv[i*ais0+i*ais1] = ValueType(1);
+          });
+        member.team_barrier();
+
+        TeamTrsmInternalLeftLower<AlgoType>::invoke(member, true,  m, m, one, A, as0, as1, Ainv, ais0, ais1);
+        member.team_barrier();
+        TeamTrsmInternalLeftUpper<AlgoType>::invoke(member, false, m, m, one, A, as0, as1, Ainv, ais0, ais1);
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
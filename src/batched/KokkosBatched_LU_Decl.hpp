@@ -17,6 +17,16 @@ namespace KokkosBatched {
       static int
       invoke(const AViewType &A,
              const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+
+      // partial piv version, P is an int view of m entries or, for vector
+      // types, m x vector_length entries (pivots of each lane)
+      template<typename AViewType,
+               typename PViewType>
+      KOKKOS_INLINE_FUNCTION
+      static
+      typename std::enable_if<Kokkos::is_view<PViewType>::value,int>::type
+      invoke(const AViewType &A,
+             const PViewType &P);
     };       
 
     template<typename MemberType,
@@ -29,6 +39,16 @@ namespace KokkosBatched {
       invoke(const MemberType &member, 
              const AViewType &A,
              const typename MagnitudeScalarType<typename AViewType::non_const_value_type>::type tiny = 0);
+
+      // partial piv version
+      template<typename AViewType,
+               typename PViewType>
+      KOKKOS_INLINE_FUNCTION
+      static
+      typename std::enable_if<Kokkos::is_view<PViewType>::value,int>::type
+      invoke(const MemberType &member, 
+             const AViewType &A,
+             const PViewType &P);
     };       
       
   }
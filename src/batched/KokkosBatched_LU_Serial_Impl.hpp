@@ -79,6 +79,36 @@ namespace KokkosBatched {
                                                           tiny);
     }
 
+    ///
+    /// SerialLU partial piv
+    ///
+
+    template<>
+    template<typename AViewType,
+             typename PViewType>
+    KOKKOS_INLINE_FUNCTION
+    typename std::enable_if<Kokkos::is_view<PViewType>::value,int>::type
+    SerialLU<Algo::LU::Unblocked>::
+    invoke(const AViewType &A,
+           const PViewType &P) {
+      return SerialLU_Internal<Algo::LU::Unblocked>::invoke(A.extent(0), A.extent(1),
+                                                            A.data(), A.stride_0(), A.stride_1(),
+                                                            P.data(), P.stride_0(), P.stride_1());
+    }
+    
+    template<>
+    template<typename AViewType,
+             typename PViewType>
+    KOKKOS_INLINE_FUNCTION
+    typename std::enable_if<Kokkos::is_view<PViewType>::value,int>::type
+    SerialLU<Algo::LU::Blocked>::
+    invoke(const AViewType &A,
+           const PViewType &P) {
+      return SerialLU_Internal<Algo::LU::Blocked>::invoke(A.extent(0), A.extent(1),
+                                                          A.data(), A.stride_0(), A.stride_1(),
+                                                          P.data(), P.stride_0(), P.stride_1());
+    }
+
   }
 }
 
@@ -18,6 +18,101 @@ namespace KokkosBatched {
     /// Serial Internal Impl
     /// ====================
 
+    namespace LU_PivotInternal {
+      // pivot magnitude |re| + |im|, same as LAPACK i?amax
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<!is_vector<ValueType>::value,
+                              typename MagnitudeScalarType<ValueType>::type>::type
+      abs1(const ValueType &a) {
+        typedef Kokkos::Details::ArithTraits<ValueType> ats;
+        return ats::abs(ats::real(a)) + ats::abs(ats::imag(a));
+      }
+
+      template<typename ValueType>
+      inline
+      typename std::enable_if<is_vector<ValueType>::value,
+                              Vector<SIMD<typename MagnitudeScalarType<ValueType>::type>,ValueType::vector_length> >::type
+      abs1(const ValueType &a) {
+        Vector<SIMD<typename MagnitudeScalarType<ValueType>::type>,ValueType::vector_length> r_val;
+        for (int k=0;k<ValueType::vector_length;++k)
+          r_val[k] = abs1(a[k]);
+        return r_val;
+      }
+
+      // P[k*ps1] = offset + row index of the largest entry of a column of m entries, for each lane k
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<!is_vector<ValueType>::value,void>::type
+      find_pivot(const int m, const int offset,
+                 const ValueType *__restrict__ a, const int as0,
+                 /**/  int *__restrict__ P, const int ps1) {
+        auto amax = abs1(a[0]);
+        int ipiv = 0;
+        for (int i=1;i<m;++i) {
+          const auto v = abs1(a[i*as0]);
+          if (v > amax) { amax = v; ipiv = i; }
+        }
+        P[0] = offset + ipiv;
+      }
+
+      template<typename ValueType>
+      inline
+      typename std::enable_if<is_vector<ValueType>::value,void>::type
+      find_pivot(const int m, const int offset,
+                 const ValueType *__restrict__ a, const int as0,
+                 /**/  int *__restrict__ P, const int ps1) {
+        typedef Vector<SIMD<typename MagnitudeScalarType<ValueType>::type>,ValueType::vector_length> mag_vector_type;
+
+        // lane-wise compare and blend
+        mag_vector_type amax = abs1(a[0]), ipiv(0);
+        for (int i=1;i<m;++i) {
+          const mag_vector_type v = abs1(a[i*as0]);
+          const auto is_larger = v > amax;
+          amax = conditional_assign(is_larger, v, amax);
+          ipiv = conditional_assign(is_larger, mag_vector_type(i), ipiv);
+        }
+        for (int k=0;k<ValueType::vector_length;++k)
+          P[k*ps1] = offset + static_cast<int>(ipiv[k]);
+      }
+
+      // swap row i with row P[k*ps1] of n columns, for each lane k
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      swap_rows(const int i, const int n,
+                const int *__restrict__ P, const int ps1,
+                ValueType *__restrict__ A, const int as0, const int as1) {
+        typedef Lane<ValueType> lane_type;
+        for (int k=0;k<lane_type::vector_length;++k) {
+          const int piv = P[k*ps1];
+          if (piv != i) {
+            ValueType
+              *__restrict__ ai = A+i*as0,
+              *__restrict__ ap = A+piv*as0;
+            for (int j=0;j<n;++j) {
+              auto &aij = lane_type::get(ai[j*as1], k);
+              auto &apj = lane_type::get(ap[j*as1], k);
+              const auto tmp = aij;
+              aij = apj;
+              apj = tmp;
+            }
+          }
+        }
+      }
+
+      // apply the row interchanges of rows ibeg, ..., iend-1 (laswp)
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      apply_pivots(const int ibeg, const int iend, const int n,
+                   const int *__restrict__ P, const int ps0, const int ps1,
+                   ValueType *__restrict__ A, const int as0, const int as1) {
+        for (int i=ibeg;i<iend;++i)
+          swap_rows(i, n, P+i*ps0, ps1, A, as0, as1);
+      }
+    }
+
     template<typename AlgoType>
     struct SerialLU_Internal {
       template<typename ValueType>
@@ -26,6 +121,14 @@ namespace KokkosBatched {
       invoke(const int m, const int n,
              ValueType *__restrict__ A, const int as0, const int as1,
              const typename MagnitudeScalarType<ValueType>::type tiny);
+
+      // partial pivoting, P[i*ps0+k*ps1] is the row interchanged with row i in lane k
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const int m, const int n,
+             ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  int *__restrict__ P, const int ps0, const int ps1);
     };
 
     template<>
@@ -140,6 +243,102 @@ namespace KokkosBatched {
       return 0;
     }
 
+    ///
+    /// partial pivoting
+    ///
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialLU_Internal<Algo::LU::Unblocked>::
+    invoke(const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           /**/  int *__restrict__ P, const int ps0, const int ps1) {
+      const int k = (m < n ? m : n);
+      if (k <= 0) return 0;
+
+      for (int p=0;p<k;++p) {
+        const int iend = m-p-1, jend = n-p-1;
+
+        // pivot search and row interchange
+        LU_PivotInternal::find_pivot(m-p, p, A+p*as0+p*as1, as0, P+p*ps0, ps1);
+        LU_PivotInternal::swap_rows(p, n, P+p*ps0, ps1, A, as0, as1);
+
+        const ValueType
+          *__restrict__ a12t = A+(p  )*as0+(p+1)*as1;
+        
+        ValueType
+          *__restrict__ a21  = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ A22  = A+(p+1)*as0+(p+1)*as1;
+
+        const ValueType
+          alpha11 = A[p*as0+p*as1];
+        
+        for (int i=0;i<iend;++i) {
+          a21[i*as0] /= alpha11;
+              
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j=0;j<jend;++j)
+            A22[i*as0+j*as1] -= a21[i*as0] * a12t[j*as1];
+        }
+      }
+      return 0;
+    }
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialLU_Internal<Algo::LU::Blocked>::
+    invoke(const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           /**/  int *__restrict__ P, const int ps0, const int ps1) {
+      enum : int {
+        mbAlgo = Algo::LU::Blocked::mb<Kokkos::Impl::ActiveExecutionMemorySpace>()
+      };
+      const typename MagnitudeScalarType<ValueType>::type one(1.0), minus_one(-1.0);
+
+      const int k = (m < n ? m : n);
+      if (k <= 0) return 0;
+
+      InnerTrsmLeftLowerUnitDiag<mbAlgo> trsm_llu(as0, as1, as0, as1);
+
+      const int mb = mbAlgo;
+      for (int p=0;p<k;p+=mb) {
+        const int pb = (p+mb) > k ? (k-p) : mb;
+
+        // pivoted lu on the panel
+        ValueType *__restrict__ Ap = A+p*as0+p*as1;
+        SerialLU_Internal<Algo::LU::Unblocked>::invoke(m-p, pb, Ap, as0, as1, P+p*ps0, ps0, ps1);
+
+        // panel pivots are local, shift them and interchange the remaining columns
+        typedef Lane<ValueType> lane_type;
+        for (int i=p;i<(p+pb);++i)
+          for (int l=0;l<lane_type::vector_length;++l)
+            P[i*ps0+l*ps1] += p;
+
+        const int m_abr = m-p-pb, n_abr = n-p-pb;
+        LU_PivotInternal::apply_pivots(p, p+pb, p,     P, ps0, ps1, A,            as0, as1);
+        LU_PivotInternal::apply_pivots(p, p+pb, n_abr, P, ps0, ps1, A+(p+pb)*as1, as0, as1);
+
+        // trsm update
+        trsm_llu.serial_invoke(Ap, pb, n_abr, Ap+pb*as1);
+
+        // gemm update
+        SerialGemmInternal<Algo::Gemm::Blocked>::
+          invoke(m_abr, n_abr, pb,
+                 minus_one,
+                 Ap+pb*as0, as0, as1,
+                 Ap+pb*as1, as0, as1,
+                 one,
+                 Ap+pb*as0+pb*as1, as0, as1);
+      }
+      return 0;
+    }
+
   }
 }
 
@@ -30,6 +30,18 @@ namespace KokkosBatched {
                                                             A.data(), A.stride_0(), A.stride_1(),
                                                             tiny);
       }
+
+      template<typename AViewType,
+               typename PViewType>
+      KOKKOS_INLINE_FUNCTION
+      static
+      typename std::enable_if<Kokkos::is_view<PViewType>::value,int>::type
+      invoke(const MemberType &member, const AViewType &A, const PViewType &P) {
+        return TeamLU_Internal<Algo::LU::Unblocked>::invoke(member,
+                                                            A.extent(0), A.extent(1),
+                                                            A.data(), A.stride_0(), A.stride_1(),
+                                                            P.data(), P.stride_0(), P.stride_1());
+      }
     };
     
     template<typename MemberType>
@@ -44,6 +56,18 @@ namespace KokkosBatched {
                                                           A.data(), A.stride_0(), A.stride_1(),
                                                           tiny);
       }
+
+      template<typename AViewType,
+               typename PViewType>
+      KOKKOS_INLINE_FUNCTION
+      static
+      typename std::enable_if<Kokkos::is_view<PViewType>::value,int>::type
+      invoke(const MemberType &member, const AViewType &A, const PViewType &P) {
+        return TeamLU_Internal<Algo::LU::Blocked>::invoke(member,
+                                                          A.extent(0), A.extent(1),
+                                                          A.data(), A.stride_0(), A.stride_1(),
+                                                          P.data(), P.stride_0(), P.stride_1());
+      }
     };
 
   }
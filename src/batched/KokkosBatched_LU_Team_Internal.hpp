@@ -8,6 +8,7 @@
 #include "KokkosBatched_Vector.hpp"
 #include "KokkosBatched_InnerLU_Serial_Impl.hpp"
 #include "KokkosBatched_InnerTrsm_Serial_Impl.hpp"
+#include "KokkosBatched_LU_Serial_Internal.hpp"
 
 #include "KokkosBatched_Trsm_Team_Internal.hpp"
 #include "KokkosBatched_Gemm_Team_Internal.hpp"
@@ -29,6 +30,15 @@ namespace KokkosBatched {
              const int m, const int n,
              ValueType *__restrict__ A, const int as0, const int as1,
              const typename MagnitudeScalarType<ValueType>::type tiny);
+
+      // partial pivoting, P[i*ps0+k*ps1] is the row interchanged with row i in lane k
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int 
+      invoke(const MemberType &member,
+             const int m, const int n,
+             ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  int *__restrict__ P, const int ps0, const int ps1);
     };
 
     template<>
@@ -170,6 +180,134 @@ namespace KokkosBatched {
 
       return 0;
     }
+
+    ///
+    /// partial pivoting
+    ///
+
+    template<>
+    template<typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamLU_Internal<Algo::LU::Unblocked>::
+    invoke(const MemberType &member, 
+           const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           /**/  int *__restrict__ P, const int ps0, const int ps1) {
+
+      const int k = (m < n ? m : n);
+      if (k <= 0) return 0;
+
+      for (int p=0;p<k;++p) {
+        const int iend = m-p-1, jend = n-p-1;
+
+        const ValueType 
+          *__restrict__ a12t = A+(p  )*as0+(p+1)*as1;
+
+        ValueType
+          *__restrict__ a21  = A+(p+1)*as0+(p  )*as1,
+          *__restrict__ A22  = A+(p+1)*as0+(p+1)*as1;
+
+        // pivot search and row interchange
+        if (member.team_rank() == 0) 
+          LU_PivotInternal::find_pivot(m-p, p, A+p*as0+p*as1, as0, P+p*ps0, ps1);
+        member.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,n),[&](const int &j) {
+            LU_PivotInternal::swap_rows(p, 1, P+p*ps0, ps1, A+j*as1, as0, as1);
+          });
+
+        member.team_barrier();
+        const ValueType
+          alpha11 = A[p*as0+p*as1];
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend),[&](const int &i) {
+            a21[i*as0] /= alpha11;
+          });
+            
+        member.team_barrier();
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,iend*jend),[&](const int &ij) {
+            // assume layout right for batched computation
+            const int i = ij/jend, j = ij%jend;
+            A22[i*as0+j*as1] -= a21[i*as0] * a12t[j*as1];
+          });
+        member.team_barrier();
+      }
+      return 0;
+    }
+
+    template<>
+    template<typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    TeamLU_Internal<Algo::LU::Blocked>::
+    invoke(const MemberType &member, 
+           const int m, const int n,
+           ValueType *__restrict__ A, const int as0, const int as1,
+           /**/  int *__restrict__ P, const int ps0, const int ps1) {
+
+      enum : int {
+        mbAlgo = Algo::LU::Blocked::mb<Kokkos::Impl::ActiveExecutionMemorySpace>()
+      };
+
+      const int k = (m < n ? m : n);
+      if (k <= 0) return 0;
+
+      const typename MagnitudeScalarType<ValueType>::type one(1.0), minus_one(-1.0);
+
+      InnerTrsmLeftLowerUnitDiag<mbAlgo> trsm_llu(as0, as1, as0, as1);
+
+      const int tsize = member.team_size();
+      const int mb = mbAlgo;
+      for (int p=0;p<k;p+=mb) {
+        const int pb = (p+mb) > k ? (k-p) : mb;
+
+        // pivoted lu on the panel
+        ValueType *__restrict__ Ap = A+p*as0+p*as1;
+
+        member.team_barrier();
+        if (member.team_rank() == 0) {
+          SerialLU_Internal<Algo::LU::Unblocked>::invoke(m-p, pb, Ap, as0, as1, P+p*ps0, ps0, ps1);
+
+          // panel pivots are local
+          typedef Lane<ValueType> lane_type;
+          for (int i=p;i<(p+pb);++i)
+            for (int l=0;l<lane_type::vector_length;++l)
+              P[i*ps0+l*ps1] += p;
+        }
+        member.team_barrier();
+
+        // interchange the remaining columns
+        const int m_abr = m-p-pb, n_abr = n-p-pb;
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,p+n_abr),[&](const int &jj) {
+            const int j = jj < p ? jj : jj+pb;
+            LU_PivotInternal::apply_pivots(p, p+pb, 1, P, ps0, ps1, A+j*as1, as0, as1);
+          });
+        member.team_barrier();
+
+        // trsm update
+        const int 
+          nb = n_abr > 0 ? n_abr/tsize + (n_abr%tsize > 0) : 1,
+          np = n_abr%nb, 
+          nq = (n_abr/nb)+(np>0);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,nq),[&](const int &jq) {
+            const int j = jq*nb, qb = (j+nb) > n_abr ? np : nb;
+            trsm_llu.serial_invoke(Ap, pb, qb, Ap+(j+pb)*as1);
+          });
+        member.team_barrier();
+
+        // gemm update
+        TeamGemmInternal<Algo::Gemm::Blocked>::
+          invoke(member, 
+                 m_abr, n_abr, pb,
+                 minus_one,
+                 Ap+pb*as0, as0, as1,
+                 Ap+pb*as1, as0, as1,
+                 one,
+                 Ap+pb*as0+pb*as1, as0, as1);
+      }
+      member.team_barrier();
+
+      return 0;
+    }
   }
 }
 
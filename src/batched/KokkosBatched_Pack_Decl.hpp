@@ -0,0 +1,89 @@
+#ifndef __KOKKOSBATCHED_PACK_DECL_HPP__
+#define __KOKKOSBATCHED_PACK_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Compact (interleaved) layout converters
+    /// =======================================
+    ///
+    /// A standard batch A(k,i,j), k = 0, ..., nbatch-1, is converted to
+    /// the compact layout Ap(k/l,i,j)[k%l] of Vector<SIMD<T>,l> used by
+    /// the SIMD batched kernels, and back. Rank 2 batches, A(k,i), are
+    /// converted in the same way. Ap must have at least nbatch/l (rounded
+    /// up) packs; lanes beyond the batch are set to zero on packing and
+    /// ignored on unpacking.
+    ///
+    /// Entries stored contiguously (e.g., LayoutRight) are transposed with
+    /// AVX/AVX512 register transposes for double and complex<double>,
+    /// including the partial last pack; the remainder of an entry that
+    /// does not fill a register block uses masked loads and stores.
+    /// Other layouts use a lane-by-lane copy.
+    ///
+
+    ///
+    /// Serial: converts pack p, to be called inside a user kernel; pack
+    /// p of the batch is stored in pack q of Ap (q = p by default), e.g.,
+    /// to stage the packs through a small workspace
+    ///
+    struct SerialPack {
+      template<typename AViewType,
+               typename PackViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int p,
+             const AViewType &A,
+             const PackViewType &Ap);
+
+      template<typename AViewType,
+               typename PackViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int p,
+             const AViewType &A,
+             const PackViewType &Ap,
+             const int q);
+    };
+
+    struct SerialUnpack {
+      template<typename PackViewType,
+               typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int p,
+             const PackViewType &Ap,
+             const AViewType &A);
+
+      template<typename PackViewType,
+               typename AViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int p,
+             const PackViewType &Ap,
+             const AViewType &A,
+             const int q);
+    };
+
+    ///
+    /// Top-level: converts the whole batch
+    ///
+    template<typename AViewType,
+             typename PackViewType>
+    void
+    pack_compact(const AViewType &A,
+                 const PackViewType &Ap);
+
+    template<typename PackViewType,
+             typename AViewType>
+    void
+    unpack_compact(const PackViewType &Ap,
+                   const AViewType &A);
+
+  }
+}
+
+#endif
@@ -0,0 +1,562 @@
+#ifndef __KOKKOSBATCHED_PACK_IMPL_HPP__
+#define __KOKKOSBATCHED_PACK_IMPL_HPP__
+
+#include <sstream>
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pack_Decl.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Pack Internal Impl
+    /// ==================
+
+    namespace PackInternal {
+
+      ///
+      /// dst[q*l+s] = src[s][q] (pack) and its inverse (unpack) for q < len;
+      /// only the first nlane rows of src (dst) exist, the other lanes of
+      /// the packed entry are zeroed by pack and skipped by unpack
+      ///
+      template<typename ValueType, int VectorLength>
+      struct Transpose {
+        KOKKOS_INLINE_FUNCTION
+        static void
+        pack(const int len, const int nlane,
+             const ValueType *const *__restrict__ src,
+             /**/  ValueType *__restrict__ dst) {
+          for (int q=0;q<len;++q)
+            for (int s=0;s<VectorLength;++s)
+              dst[q*VectorLength+s] = s < nlane ? src[s][q] : ValueType(0);
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        static void
+        unpack(const int len, const int nlane,
+               const ValueType *__restrict__ src,
+               /**/  ValueType *const *__restrict__ dst) {
+          for (int q=0;q<len;++q)
+            for (int s=0;s<nlane;++s)
+              dst[s][q] = src[q*VectorLength+s];
+        }
+      };
+
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX__) || defined(__AVX2__)
+      // 4x4 double transpose in registers
+      KOKKOS_INLINE_FUNCTION
+      void transpose4x4(__m256d &r0, __m256d &r1, __m256d &r2, __m256d &r3) {
+        const __m256d
+          t0 = _mm256_unpacklo_pd(r0, r1),
+          t1 = _mm256_unpackhi_pd(r0, r1),
+          t2 = _mm256_unpacklo_pd(r2, r3),
+          t3 = _mm256_unpackhi_pd(r2, r3);
+        r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+        r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+        r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+        r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+      }
+
+      // the remainder q < len of an entry goes through masked loads and stores
+      template<>
+      struct Transpose<double,4> {
+        KOKKOS_INLINE_FUNCTION
+        static void
+        pack(const int len, const int nlane,
+             const double *const *__restrict__ src,
+             /**/  double *__restrict__ dst) {
+          __m256d r[4];
+          int q = 0;
+          for (;q+4<=len;q+=4) {
+            for (int s=0;s<4;++s) r[s] = s < nlane ? _mm256_loadu_pd(src[s]+q) : _mm256_setzero_pd();
+            transpose4x4(r[0], r[1], r[2], r[3]);
+            for (int s=0;s<4;++s) _mm256_storeu_pd(dst+4*(q+s), r[s]);
+          }
+          if (q < len) {
+            const int m = len - q;
+            const __m256i mask = Vector<SIMD<double>,4>::laneMask(m);
+            for (int s=0;s<4;++s) r[s] = s < nlane ? _mm256_maskload_pd(src[s]+q, mask) : _mm256_setzero_pd();
+            transpose4x4(r[0], r[1], r[2], r[3]);
+            for (int s=0;s<m;++s) _mm256_storeu_pd(dst+4*(q+s), r[s]);
+          }
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        static void
+        unpack(const int len, const int nlane,
+               const double *__restrict__ src,
+               /**/  double *const *__restrict__ dst) {
+          __m256d r[4];
+          int q = 0;
+          for (;q+4<=len;q+=4) {
+            for (int s=0;s<4;++s) r[s] = _mm256_loadu_pd(src+4*(q+s));
+            transpose4x4(r[0], r[1], r[2], r[3]);
+            for (int s=0;s<nlane;++s) _mm256_storeu_pd(dst[s]+q, r[s]);
+          }
+          if (q < len) {
+            const int m = len - q;
+            const __m256i mask = Vector<SIMD<double>,4>::laneMask(m);
+            for (int s=0;s<4;++s) r[s] = s < m ? _mm256_loadu_pd(src+4*(q+s)) : _mm256_setzero_pd();
+            transpose4x4(r[0], r[1], r[2], r[3]);
+            for (int s=0;s<nlane;++s) _mm256_maskstore_pd(dst[s]+q, mask, r[s]);
+          }
+        }
+      };
+
+      // a complex<double> is a 128 bit lane; 2x2 transpose of 128 bit lanes
+      template<>
+      struct Transpose<Kokkos::complex<double>,2> {
+        KOKKOS_INLINE_FUNCTION
+        static void
+        pack(const int len, const int nlane,
+             const Kokkos::complex<double> *const *__restrict__ src,
+             /**/  Kokkos::complex<double> *__restrict__ dst) {
+          const double *__restrict__ s0 = nlane > 0 ? (const double*)src[0] : 0;
+          const double *__restrict__ s1 = nlane > 1 ? (const double*)src[1] : 0;
+          double *__restrict__ d = (double*)dst;
+          const __m256d zero = _mm256_setzero_pd();
+          int q = 0;
+          for (;q+2<=len;q+=2) {
+            const __m256d r0 = s0 ? _mm256_loadu_pd(s0+2*q) : zero, r1 = s1 ? _mm256_loadu_pd(s1+2*q) : zero;
+            _mm256_storeu_pd(d+4*q  , _mm256_permute2f128_pd(r0, r1, 0x20));
+            _mm256_storeu_pd(d+4*q+4, _mm256_permute2f128_pd(r0, r1, 0x31));
+          }
+          if (q < len) {
+            const __m256i mask = Vector<SIMD<Kokkos::complex<double> >,2>::laneMask(1);
+            const __m256d r0 = s0 ? _mm256_maskload_pd(s0+2*q, mask) : zero, r1 = s1 ? _mm256_maskload_pd(s1+2*q, mask) : zero;
+            _mm256_storeu_pd(d+4*q, _mm256_permute2f128_pd(r0, r1, 0x20));
+          }
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        static void
+        unpack(const int len, const int nlane,
+               const Kokkos::complex<double> *__restrict__ src,
+               /**/  Kokkos::complex<double> *const *__restrict__ dst) {
+          const double *__restrict__ s = (const double*)src;
+          double *__restrict__ d0 = nlane > 0 ? (double*)dst[0] : 0;
+          double *__restrict__ d1 = nlane > 1 ? (double*)dst[1] : 0;
+          int q = 0;
+          for (;q+2<=len;q+=2) {
+            const __m256d r0 = _mm256_loadu_pd(s+4*q), r1 = _mm256_loadu_pd(s+4*q+4);
+            if (d0) _mm256_storeu_pd(d0+2*q, _mm256_permute2f128_pd(r0, r1, 0x20));
+            if (d1) _mm256_storeu_pd(d1+2*q, _mm256_permute2f128_pd(r0, r1, 0x31));
+          }
+          if (q < len) {
+            const __m256i mask = Vector<SIMD<Kokkos::complex<double> >,2>::laneMask(1);
+            const __m256d r0 = _mm256_loadu_pd(s+4*q);
+            if (d0) _mm256_maskstore_pd(d0+2*q, mask, r0);
+            if (d1) _mm256_maskstore_pd(d1+2*q, mask, _mm256_permute2f128_pd(r0, r0, 0x11));
+          }
+        }
+      };
+#endif
+
+#if defined(__AVX512F__)
+      // 8x8 double transpose in registers
+      KOKKOS_INLINE_FUNCTION
+      void transpose8x8(__m512d *r) {
+        __m512d t[8], u[8];
+        for (int i=0;i<4;++i) {
+          t[2*i  ] = _mm512_unpacklo_pd(r[2*i], r[2*i+1]);
+          t[2*i+1] = _mm512_unpackhi_pd(r[2*i], r[2*i+1]);
+        }
+        // columns (0,4) (2,6) (1,5) (3,7) of rows 0-3 and rows 4-7
+        u[0] = _mm512_shuffle_f64x2(t[0], t[2], _MM_SHUFFLE(2,0,2,0));
+        u[1] = _mm512_shuffle_f64x2(t[0], t[2], _MM_SHUFFLE(3,1,3,1));
+        u[2] = _mm512_shuffle_f64x2(t[1], t[3], _MM_SHUFFLE(2,0,2,0));
+        u[3] = _mm512_shuffle_f64x2(t[1], t[3], _MM_SHUFFLE(3,1,3,1));
+        u[4] = _mm512_shuffle_f64x2(t[4], t[6], _MM_SHUFFLE(2,0,2,0));
+        u[5] = _mm512_shuffle_f64x2(t[4], t[6], _MM_SHUFFLE(3,1,3,1));
+        u[6] = _mm512_shuffle_f64x2(t[5], t[7], _MM_SHUFFLE(2,0,2,0));
+        u[7] = _mm512_shuffle_f64x2(t[5], t[7], _MM_SHUFFLE(3,1,3,1));
+
+        r[0] = _mm512_shuffle_f64x2(u[0], u[4], _MM_SHUFFLE(2,0,2,0));
+        r[4] = _mm512_shuffle_f64x2(u[0], u[4], _MM_SHUFFLE(3,1,3,1));
+        r[2] = _mm512_shuffle_f64x2(u[1], u[5], _MM_SHUFFLE(2,0,2,0));
+        r[6] = _mm512_shuffle_f64x2(u[1], u[5], _MM_SHUFFLE(3,1,3,1));
+        r[1] = _mm512_shuffle_f64x2(u[2], u[6], _MM_SHUFFLE(2,0,2,0));
+        r[5] = _mm512_shuffle_f64x2(u[2], u[6], _MM_SHUFFLE(3,1,3,1));
+        r[3] = _mm512_shuffle_f64x2(u[3], u[7], _MM_SHUFFLE(2,0,2,0));
+        r[7] = _mm512_shuffle_f64x2(u[3], u[7], _MM_SHUFFLE(3,1,3,1));
+      }
+
+      // 4x4 transpose of 128 bit lanes
+      KOKKOS_INLINE_FUNCTION
+      void transpose4x4_128(__m512d *r) {
+        const __m512d
+          t0 = _mm512_shuffle_f64x2(r[0], r[1], _MM_SHUFFLE(1,0,1,0)),
+          t1 = _mm512_shuffle_f64x2(r[0], r[1], _MM_SHUFFLE(3,2,3,2)),
+          t2 = _mm512_shuffle_f64x2(r[2], r[3], _MM_SHUFFLE(1,0,1,0)),
+          t3 = _mm512_shuffle_f64x2(r[2], r[3], _MM_SHUFFLE(3,2,3,2));
+        r[0] = _mm512_shuffle_f64x2(t0, t2, _MM_SHUFFLE(2,0,2,0));
+        r[1] = _mm512_shuffle_f64x2(t0, t2, _MM_SHUFFLE(3,1,3,1));
+        r[2] = _mm512_shuffle_f64x2(t1, t3, _MM_SHUFFLE(2,0,2,0));
+        r[3] = _mm512_shuffle_f64x2(t1, t3, _MM_SHUFFLE(3,1,3,1));
+      }
+
+      // the remainder q < len of an entry goes through masked loads and stores
+      template<>
+      struct Transpose<double,8> {
+        KOKKOS_INLINE_FUNCTION
+        static void
+        pack(const int len, const int nlane,
+             const double *const *__restrict__ src,
+             /**/  double *__restrict__ dst) {
+          __m512d r[8];
+          int q = 0;
+          for (;q+8<=len;q+=8) {
+            for (int s=0;s<8;++s) r[s] = s < nlane ? _mm512_loadu_pd(src[s]+q) : _mm512_setzero_pd();
+            transpose8x8(r);
+            for (int s=0;s<8;++s) _mm512_storeu_pd(dst+8*(q+s), r[s]);
+          }
+          if (q < len) {
+            const int m = len - q;
+            const __mmask8 mask = Vector<SIMD<double>,8>::laneMask(m);
+            for (int s=0;s<8;++s) r[s] = s < nlane ? _mm512_maskz_loadu_pd(mask, src[s]+q) : _mm512_setzero_pd();
+            transpose8x8(r);
+            for (int s=0;s<m;++s) _mm512_storeu_pd(dst+8*(q+s), r[s]);
+          }
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        static void
+        unpack(const int len, const int nlane,
+               const double *__restrict__ src,
+               /**/  double *const *__restrict__ dst) {
+          __m512d r[8];
+          int q = 0;
+          for (;q+8<=len;q+=8) {
+            for (int s=0;s<8;++s) r[s] = _mm512_loadu_pd(src+8*(q+s));
+            transpose8x8(r);
+            for (int s=0;s<nlane;++s) _mm512_storeu_pd(dst[s]+q, r[s]);
+          }
+          if (q < len) {
+            const int m = len - q;
+            const __mmask8 mask = Vector<SIMD<double>,8>::laneMask(m);
+            for (int s=0;s<8;++s) r[s] = s < m ? _mm512_loadu_pd(src+8*(q+s)) : _mm512_setzero_pd();
+            transpose8x8(r);
+            for (int s=0;s<nlane;++s) _mm512_mask_storeu_pd(dst[s]+q, mask, r[s]);
+          }
+        }
+      };
+
+      template<>
+      struct Transpose<Kokkos::complex<double>,4> {
+        KOKKOS_INLINE_FUNCTION
+        static void
+        pack(const int len, const int nlane,
+             const Kokkos::complex<double> *const *__restrict__ src,
+             /**/  Kokkos::complex<double> *__restrict__ dst) {
+          double *__restrict__ d = (double*)dst;
+          __m512d r[4];
+          int q = 0;
+          for (;q+4<=len;q+=4) {
+            for (int s=0;s<4;++s) r[s] = s < nlane ? _mm512_loadu_pd((const double*)(src[s]+q)) : _mm512_setzero_pd();
+            transpose4x4_128(r);
+            for (int s=0;s<4;++s) _mm512_storeu_pd(d+8*(q+s), r[s]);
+          }
+          if (q < len) {
+            const int m = len - q;
+            const __mmask8 mask = Vector<SIMD<Kokkos::complex<double> >,4>::laneMask(m);
+            for (int s=0;s<4;++s) r[s] = s < nlane ? _mm512_maskz_loadu_pd(mask, (const double*)(src[s]+q)) : _mm512_setzero_pd();
+            transpose4x4_128(r);
+            for (int s=0;s<m;++s) _mm512_storeu_pd(d+8*(q+s), r[s]);
+          }
+        }
+
+        KOKKOS_INLINE_FUNCTION
+        static void
+        unpack(const int len, const int nlane,
+               const Kokkos::complex<double> *__restrict__ src,
+               /**/  Kokkos::complex<double> *const *__restrict__ dst) {
+          const double *__restrict__ sp = (const double*)src;
+          __m512d r[4];
+          int q = 0;
+          for (;q+4<=len;q+=4) {
+            for (int s=0;s<4;++s) r[s] = _mm512_loadu_pd(sp+8*(q+s));
+            transpose4x4_128(r);
+            for (int s=0;s<nlane;++s) _mm512_storeu_pd((double*)(dst[s]+q), r[s]);
+          }
+          if (q < len) {
+            const int m = len - q;
+            const __mmask8 mask = Vector<SIMD<Kokkos::complex<double> >,4>::laneMask(m);
+            for (int s=0;s<4;++s) r[s] = s < m ? _mm512_loadu_pd(sp+8*(q+s)) : _mm512_setzero_pd();
+            transpose4x4_128(r);
+            for (int s=0;s<nlane;++s) _mm512_mask_storeu_pd((double*)(dst[s]+q), mask, r[s]);
+          }
+        }
+      };
+#endif
+#endif
+
+      ///
+      /// rank dependent access to a batch entry
+      ///
+      template<int Rank>
+      struct Entry;
+
+      template<>
+      struct Entry<2> {
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION
+        static bool is_contiguous(const ViewType &A) { return A.stride_1() == 1; }
+
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION
+        static int length(const ViewType &A) { return A.extent(1); }
+
+        template<typename AViewType, typename PackViewType>
+        KOKKOS_INLINE_FUNCTION
+        static bool same_extents(const AViewType &A, const PackViewType &Ap) {
+          return A.extent(1) == Ap.extent(1);
+        }
+
+        template<typename AViewType, typename PackViewType>
+        KOKKOS_INLINE_FUNCTION
+        static void pack_lane(const AViewType &A, const int k, const PackViewType &Ap, const int p, const int s) {
+          for (int i=0,iend=A.extent(1);i<iend;++i)
+            Ap(p,i)[s] = A(k,i);
+        }
+
+        template<typename PackViewType>
+        KOKKOS_INLINE_FUNCTION
+        static void zero_lane(const PackViewType &Ap, const int p, const int s) {
+          typedef typename PackViewType::non_const_value_type::value_type value_type;
+          for (int i=0,iend=Ap.extent(1);i<iend;++i)
+            Ap(p,i)[s] = value_type(0);
+        }
+
+        template<typename PackViewType, typename AViewType>
+        KOKKOS_INLINE_FUNCTION
+        static void unpack_lane(const PackViewType &Ap, const int p, const int s, const AViewType &A, const int k) {
+          for (int i=0,iend=A.extent(1);i<iend;++i)
+            A(k,i) = Ap(p,i)[s];
+        }
+      };
+
+      template<>
+      struct Entry<3> {
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION
+        static bool is_contiguous(const ViewType &A) {
+          return A.stride_2() == 1 && int(A.stride_1()) == int(A.extent(2));
+        }
+
+        template<typename ViewType>
+        KOKKOS_INLINE_FUNCTION
+        static int length(const ViewType &A) { return A.extent(1)*A.extent(2); }
+
+        template<typename AViewType, typename PackViewType>
+        KOKKOS_INLINE_FUNCTION
+        static bool same_extents(const AViewType &A, const PackViewType &Ap) {
+          return A.extent(1) == Ap.extent(1) && A.extent(2) == Ap.extent(2);
+        }
+
+        template<typename AViewType, typename PackViewType>
+        KOKKOS_INLINE_FUNCTION
+        static void pack_lane(const AViewType &A, const int k, const PackViewType &Ap, const int p, const int s) {
+          for (int i=0,iend=A.extent(1);i<iend;++i)
+            for (int j=0,jend=A.extent(2);j<jend;++j)
+              Ap(p,i,j)[s] = A(k,i,j);
+        }
+
+        template<typename PackViewType>
+        KOKKOS_INLINE_FUNCTION
+        static void zero_lane(const PackViewType &Ap, const int p, const int s) {
+          typedef typename PackViewType::non_const_value_type::value_type value_type;
+          for (int i=0,iend=Ap.extent(1);i<iend;++i)
+            for (int j=0,jend=Ap.extent(2);j<jend;++j)
+              Ap(p,i,j)[s] = value_type(0);
+        }
+
+        template<typename PackViewType, typename AViewType>
+        KOKKOS_INLINE_FUNCTION
+        static void unpack_lane(const PackViewType &Ap, const int p, const int s, const AViewType &A, const int k) {
+          for (int i=0,iend=A.extent(1);i<iend;++i)
+            for (int j=0,jend=A.extent(2);j<jend;++j)
+              A(k,i,j) = Ap(p,i,j)[s];
+        }
+      };
+
+      template<typename AViewType, typename PackViewType>
+      struct Check {
+        typedef typename PackViewType::non_const_value_type vector_type;
+        static_assert(is_vector<vector_type>::value,
+                      "KokkosBatched::Pack: the packed view must have Vector<SIMD<T>,l> entries.");
+        static_assert(std::is_same<typename AViewType::non_const_value_type,
+                      typename vector_type::value_type>::value,
+                      "KokkosBatched::Pack: value types of the batch and the packed view do not match.");
+        static_assert(int(AViewType::rank) == int(PackViewType::rank) &&
+                      (AViewType::rank == 2 || AViewType::rank == 3),
+                      "KokkosBatched::Pack: views must both have rank 2 or rank 3.");
+      };
+    }
+
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<typename AViewType,
+             typename PackViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialPack::
+    invoke(const int p,
+           const AViewType &A,
+           const PackViewType &Ap) {
+      return invoke(p, A, Ap, p);
+    }
+
+    template<typename AViewType,
+             typename PackViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialPack::
+    invoke(const int p,
+           const AViewType &A,
+           const PackViewType &Ap,
+           const int q) {
+      typedef PackInternal::Check<AViewType,PackViewType> check_type;
+      typedef typename check_type::vector_type vector_type;
+      typedef typename vector_type::value_type value_type;
+      typedef PackInternal::Entry<AViewType::rank> entry_type;
+      enum : int { vl = vector_type::vector_length };
+
+      const int nbatch = A.extent(0), kbeg = p*vl;
+      const int nlane = (nbatch - kbeg) < 0 ? 0 : ((nbatch - kbeg) < vl ? (nbatch - kbeg) : int(vl));
+
+      // a partial pack (the tail of the batch) is transposed as well; the idle lanes are zeroed
+      if (entry_type::is_contiguous(A) && entry_type::is_contiguous(Ap)) {
+        const value_type *src[vl];
+        for (int s=0;s<vl;++s)
+          src[s] = s < nlane ? A.data() + (kbeg+s)*A.stride_0() : nullptr;
+        value_type *dst = reinterpret_cast<value_type*>(Ap.data() + q*Ap.stride_0());
+        PackInternal::Transpose<value_type,vl>::pack(entry_type::length(A), nlane, src, dst);
+      } else {
+        for (int s=0;s<nlane;++s)
+          entry_type::pack_lane(A, kbeg+s, Ap, q, s);
+        for (int s=nlane;s<vl;++s)
+          entry_type::zero_lane(Ap, q, s);
+      }
+      return 0;
+    }
+
+    template<typename PackViewType,
+             typename AViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialUnpack::
+    invoke(const int p,
+           const PackViewType &Ap,
+           const AViewType &A) {
+      return invoke(p, Ap, A, p);
+    }
+
+    template<typename PackViewType,
+             typename AViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialUnpack::
+    invoke(const int p,
+           const PackViewType &Ap,
+           const AViewType &A,
+           const int q) {
+      typedef PackInternal::Check<AViewType,PackViewType> check_type;
+      typedef typename check_type::vector_type vector_type;
+      typedef typename vector_type::value_type value_type;
+      typedef PackInternal::Entry<AViewType::rank> entry_type;
+      enum : int { vl = vector_type::vector_length };
+
+      const int nbatch = A.extent(0), kbeg = p*vl;
+      const int nlane = (nbatch - kbeg) < 0 ? 0 : ((nbatch - kbeg) < vl ? (nbatch - kbeg) : int(vl));
+
+      if (nlane > 0 && entry_type::is_contiguous(A) && entry_type::is_contiguous(Ap)) {
+        value_type *dst[vl];
+        for (int s=0;s<vl;++s)
+          dst[s] = s < nlane ? A.data() + (kbeg+s)*A.stride_0() : nullptr;
+        const value_type *src = reinterpret_cast<const value_type*>(Ap.data() + q*Ap.stride_0());
+        PackInternal::Transpose<value_type,vl>::unpack(entry_type::length(A), nlane, src, dst);
+      } else {
+        for (int s=0;s<nlane;++s)
+          entry_type::unpack_lane(Ap, q, s, A, kbeg+s);
+      }
+      return 0;
+    }
+
+    ///
+    /// Top-level Impl
+    /// ==============
+
+    namespace PackInternal {
+      template<typename AViewType, typename PackViewType>
+      struct PackFunctor {
+        AViewType _a; PackViewType _ap;
+        PackFunctor(const AViewType &a, const PackViewType &ap) : _a(a), _ap(ap) {}
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int p) const { SerialPack::invoke(p, _a, _ap); }
+      };
+
+      template<typename PackViewType, typename AViewType>
+      struct UnpackFunctor {
+        PackViewType _ap; AViewType _a;
+        UnpackFunctor(const PackViewType &ap, const AViewType &a) : _ap(ap), _a(a) {}
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int p) const { SerialUnpack::invoke(p, _ap, _a); }
+      };
+
+      template<typename AViewType, typename PackViewType>
+      inline
+      void check_extents(const char *label, const AViewType &A, const PackViewType &Ap) {
+        typedef typename PackViewType::non_const_value_type vector_type;
+        const int vl = vector_type::vector_length, nbatch = A.extent(0);
+        const int npack = nbatch/vl + (nbatch%vl > 0);
+        if (int(Ap.extent(0)) < npack || !Entry<AViewType::rank>::same_extents(A, Ap)) {
+          std::ostringstream os;
+          os << "KokkosBatched::" << label << ": Dimensions do not match: "
+             << "batch of " << nbatch << " entries needs " << npack
+             << " packs of vector length " << vl << " with the same entry extents, "
+             << "but the packed view has " << Ap.extent(0) << " packs";
+          Kokkos::Impl::throw_runtime_exception(os.str());
+        }
+      }
+    }
+
+    template<typename AViewType,
+             typename PackViewType>
+    void
+    pack_compact(const AViewType &A,
+                 const PackViewType &Ap) {
+      typedef typename PackViewType::execution_space exec_space;
+      PackInternal::check_extents("pack_compact", A, Ap);
+
+      const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Static> > policy(0, Ap.extent(0));
+      Kokkos::parallel_for("KokkosBatched::pack_compact", policy,
+                           PackInternal::PackFunctor<AViewType,PackViewType>(A, Ap));
+    }
+
+    template<typename PackViewType,
+             typename AViewType>
+    void
+    unpack_compact(const PackViewType &Ap,
+                   const AViewType &A) {
+      typedef typename PackViewType::execution_space exec_space;
+      PackInternal::check_extents("unpack_compact", A, Ap);
+
+      typedef typename PackViewType::non_const_value_type vector_type;
+      const int vl = vector_type::vector_length, nbatch = A.extent(0);
+      const int npack = nbatch/vl + (nbatch%vl > 0);
+
+      const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Static> > policy(0, npack);
+      Kokkos::parallel_for("KokkosBatched::unpack_compact", policy,
+                           PackInternal::UnpackFunctor<PackViewType,AViewType>(Ap, A));
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef __KOKKOSBATCHED_QR_DECL_HPP__
+#define __KOKKOSBATCHED_QR_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Householder QR factorization A = Q R of an m x n matrix (m >= n).
+    ///
+    /// On exit, the upper triangular part of A holds R and the entries
+    /// below the diagonal hold the Householder vectors (with implicit
+    /// unit leading entries); t (of length n) holds the scalar factors,
+    /// Q = H(0) H(1) ... H(n-1) with H(i) = I - t(i) v(i) v(i)^T.
+    /// Real value types only (scalar or SIMD vector); a zero column
+    /// yields H(i) = I.
+    ///
+    /// ApplyQ overwrites B (m x nrhs, or a vector) with Q B or Q^T B.
+    ///
+    /// QRSolve solves the least-squares problem min | A X - B | with the
+    /// factors computed by QR; B is overwritten by Q^T B and its first n
+    /// rows hold the solution X.
+    ///
+    /// Unblocked applies a reflector column by column; Blocked applies it
+    /// to mb columns at once, reading the Householder vector once per
+    /// column block.
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialQR {
+      template<typename AViewType,
+               typename tViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const tViewType &t);
+    };
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamQR {
+      template<typename AViewType,
+               typename tViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const tViewType &t);
+    };
+
+    template<typename ArgSide,
+             typename ArgTrans,
+             typename ArgAlgo>
+    struct SerialApplyQ {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const tViewType &t,
+             const BViewType &B);
+    };
+
+    template<typename MemberType,
+             typename ArgSide,
+             typename ArgTrans,
+             typename ArgAlgo>
+    struct TeamApplyQ {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const tViewType &t,
+             const BViewType &B);
+    };
+
+    template<typename ArgAlgo>
+    struct SerialQRSolve {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const tViewType &t,
+             const BViewType &B);
+    };
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamQRSolve {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const tViewType &t,
+             const BViewType &B);
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef __KOKKOSBATCHED_QR_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_QR_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_QR_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    ///
+    /// SerialQR
+    ///
+
+    template<>
+    template<typename AViewType,
+             typename tViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialQR<Algo::QR::Unblocked>::
+    invoke(const AViewType &A,
+           const tViewType &t) {
+      return SerialQR_Internal<Algo::QR::Unblocked>::invoke(A.extent(0), A.extent(1),
+                                                            A.data(), A.stride_0(), A.stride_1(),
+                                                            t.data(), t.stride_0());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename tViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialQR<Algo::QR::Blocked>::
+    invoke(const AViewType &A,
+           const tViewType &t) {
+      return SerialQR_Internal<Algo::QR::Blocked>::invoke(A.extent(0), A.extent(1),
+                                                          A.data(), A.stride_0(), A.stride_1(),
+                                                          t.data(), t.stride_0());
+    }
+
+    ///
+    /// SerialApplyQ Left Transpose
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialApplyQ<Side::Left,Trans::Transpose,ArgAlgo> {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const tViewType &t,
+             const BViewType &B) {
+        return SerialApplyQ_LeftInternal<ArgAlgo>::invoke(true,
+                                                          B.extent(0), B.extent(1), t.extent(0),
+                                                          A.data(), A.stride_0(), A.stride_1(),
+                                                          t.data(), t.stride_0(),
+                                                          B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    ///
+    /// SerialApplyQ Left NoTranspose
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialApplyQ<Side::Left,Trans::NoTranspose,ArgAlgo> {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const tViewType &t,
+             const BViewType &B) {
+        return SerialApplyQ_LeftInternal<ArgAlgo>::invoke(false,
+                                                          B.extent(0), B.extent(1), t.extent(0),
+                                                          A.data(), A.stride_0(), A.stride_1(),
+                                                          t.data(), t.stride_0(),
+                                                          B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    ///
+    /// SerialQRSolve
+    ///
+
+    template<>
+    template<typename AViewType,
+             typename tViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialQRSolve<Algo::QR::Unblocked>::
+    invoke(const AViewType &A,
+           const tViewType &t,
+           const BViewType &B) {
+      return SerialQRSolveInternal<Algo::QR::Unblocked>::invoke(B.extent(0), A.extent(1), B.extent(1),
+                                                                A.data(), A.stride_0(), A.stride_1(),
+                                                                t.data(), t.stride_0(),
+                                                                B.data(), B.stride_0(), B.stride_1());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename tViewType,
+             typename BViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialQRSolve<Algo::QR::Blocked>::
+    invoke(const AViewType &A,
+           const tViewType &t,
+           const BViewType &B) {
+      return SerialQRSolveInternal<Algo::QR::Blocked>::invoke(B.extent(0), A.extent(1), B.extent(1),
+                                                              A.data(), A.stride_0(), A.stride_1(),
+                                                              t.data(), t.stride_0(),
+                                                              B.data(), B.stride_0(), B.stride_1());
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,217 @@
+#ifndef __KOKKOSBATCHED_QR_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_QR_SERIAL_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Trsm_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    namespace QR_Internal {
+      // columns processed at once by a reflector
+      template<typename AlgoType>
+      struct ColumnBlock;
+
+      template<>
+      struct ColumnBlock<Algo::QR::Unblocked> {
+        enum : int { value = 1 };
+      };
+
+      template<>
+      struct ColumnBlock<Algo::QR::Blocked> {
+        enum : int { value = Algo::QR::Blocked::mb<Kokkos::Impl::ActiveExecutionMemorySpace>() };
+      };
+
+      // Householder reflector annihilating x in [alpha; x] where xnorm2 = x^T x;
+      // beta replaces alpha and x is scaled by inv_denom (dlarfg)
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<!is_vector<ValueType>::value,void>::type
+      householder_coeffs(const ValueType alpha, const ValueType xnorm2,
+                         /**/  ValueType &beta, ValueType &tau, ValueType &inv_denom) {
+        if (xnorm2 == ValueType(0)) {
+          beta = alpha; tau = ValueType(0); inv_denom = ValueType(0);
+        } else {
+          const ValueType norm = Kokkos::Details::ArithTraits<ValueType>::sqrt(alpha*alpha + xnorm2);
+          beta = alpha < ValueType(0) ? norm : -norm;
+          tau = (beta - alpha)/beta;
+          inv_denom = ValueType(1)/(alpha - beta);
+        }
+      }
+
+      // lanes are independent and may take different branches
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<is_vector<ValueType>::value,void>::type
+      householder_coeffs(const ValueType alpha, const ValueType xnorm2,
+                         /**/  ValueType &beta, ValueType &tau, ValueType &inv_denom) {
+        for (int l=0;l<ValueType::vector_length;++l)
+          householder_coeffs(alpha[l], xnorm2[l], beta[l], tau[l], inv_denom[l]);
+      }
+
+      // overwrite x(0:m) with [beta; v] and compute tau
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      make_householder(const int m,
+                       /**/  ValueType *__restrict__ x, const int xs0,
+                       /**/  ValueType &tau) {
+        if (m <= 0) return;
+
+        ValueType xnorm2(0);
+        for (int i=1;i<m;++i)
+          xnorm2 += x[i*xs0]*x[i*xs0];
+
+        ValueType beta, inv_denom;
+        householder_coeffs(x[0], xnorm2, beta, tau, inv_denom);
+
+        x[0] = beta;
+        for (int i=1;i<m;++i)
+          x[i*xs0] *= inv_denom;
+      }
+
+      // C(0:m,0:nc) = (I - tau [1; u] [1; u]^T) C(0:m,0:nc) with nc <= mb;
+      // u is read once for all nc columns
+      template<int mb, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      apply_householder(const int m, const int nc,
+                        const ValueType *__restrict__ u, const int us0,
+                        const ValueType tau,
+                        /**/  ValueType *__restrict__ C, const int cs0, const int cs1) {
+        ValueType w[mb];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j=0;j<nc;++j)
+          w[j] = C[j*cs1];
+        for (int i=1;i<m;++i) {
+          const ValueType ui = u[(i-1)*us0];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j=0;j<nc;++j)
+            w[j] += ui*C[i*cs0+j*cs1];
+        }
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+        for (int j=0;j<nc;++j) {
+          w[j] *= tau;
+          C[j*cs1] -= w[j];
+        }
+        for (int i=1;i<m;++i) {
+          const ValueType ui = u[(i-1)*us0];
+#if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
+#pragma unroll
+#endif
+          for (int j=0;j<nc;++j)
+            C[i*cs0+j*cs1] -= ui*w[j];
+        }
+      }
+
+      // C(0:m,0:nc) = Q^T C or Q C with the first k reflectors stored in A and t
+      template<int mb, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      apply_q(const bool transpose,
+              const int m, const int nc, const int k,
+              const ValueType *__restrict__ A, const int as0, const int as1,
+              const ValueType *__restrict__ t, const int ts,
+              /**/  ValueType *__restrict__ C, const int cs0, const int cs1) {
+        for (int q=0;q<k;++q) {
+          const int p = transpose ? q : k-q-1;
+          apply_householder<mb>(m-p, nc,
+                                A+(p+1)*as0+p*as1, as0,
+                                t[p*ts],
+                                C+p*cs0, cs0, cs1);
+        }
+      }
+    }
+
+    template<typename AlgoType>
+    struct SerialQR_Internal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m, const int n,
+             /**/  ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ t, const int ts) {
+        static_assert(IsReal<ValueType>::value,
+                      "KokkosBatched::QR: only real value types are supported.");
+        enum : int { mb = QR_Internal::ColumnBlock<AlgoType>::value };
+
+        const int k = m < n ? m : n;
+        for (int p=0;p<k;++p) {
+          ValueType
+            *__restrict__ a11 = A+p*as0+p*as1,
+            *__restrict__ a21 = a11+as0,
+            *__restrict__ A12 = a11+as1;
+
+          QR_Internal::make_householder(m-p, a11, as0, t[p*ts]);
+
+          const int nr = n-p-1;
+          for (int j=0;j<nr;j+=mb)
+            QR_Internal::apply_householder<mb>(m-p, (j+mb) > nr ? (nr-j) : mb,
+                                               a21, as0,
+                                               t[p*ts],
+                                               A12+j*as1, as0, as1);
+        }
+        return 0;
+      }
+    };
+
+    template<typename AlgoType>
+    struct SerialApplyQ_LeftInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const bool transpose,
+             const int m, const int n, const int k,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             const ValueType *__restrict__ t, const int ts,
+             /**/  ValueType *__restrict__ B, const int bs0, const int bs1) {
+        static_assert(IsReal<ValueType>::value,
+                      "KokkosBatched::ApplyQ: only real value types are supported.");
+        enum : int { mb = QR_Internal::ColumnBlock<AlgoType>::value };
+
+        for (int j=0;j<n;j+=mb)
+          QR_Internal::apply_q<mb>(transpose, m, (j+mb) > n ? (n-j) : mb, k,
+                                   A, as0, as1,
+                                   t, ts,
+                                   B+j*bs1, bs0, bs1);
+        return 0;
+      }
+    };
+
+    ///
+    /// Least squares: B = Q^T B and R X = B(0:n,:)
+    ///
+
+    template<typename AlgoType>
+    struct SerialQRSolveInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m, const int n, const int nrhs,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             const ValueType *__restrict__ t, const int ts,
+             /**/  ValueType *__restrict__ B, const int bs0, const int bs1) {
+        const typename MagnitudeScalarType<ValueType>::type one(1.0);
+        SerialApplyQ_LeftInternal<AlgoType>::invoke(true, m, nrhs, n, A, as0, as1, t, ts, B, bs0, bs1);
+        SerialTrsmInternalLeftUpper<AlgoType>::invoke(false, n, nrhs, one, A, as0, as1, B, bs0, bs1);
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef __KOKKOSBATCHED_QR_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_QR_TEAM_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_QR_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Team Impl
+    /// =========
+
+    ///
+    /// TeamQR
+    ///
+
+    template<typename MemberType>
+    struct TeamQR<MemberType,Algo::QR::Unblocked> {
+      template<typename AViewType,
+               typename tViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const tViewType &t) {
+        return TeamQR_Internal<Algo::QR::Unblocked>::invoke(member,
+                                                          A.extent(0), A.extent(1),
+                                                          A.data(), A.stride_0(), A.stride_1(),
+                                                          t.data(), t.stride_0());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamQR<MemberType,Algo::QR::Blocked> {
+      template<typename AViewType,
+               typename tViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const tViewType &t) {
+        return TeamQR_Internal<Algo::QR::Blocked>::invoke(member,
+                                                        A.extent(0), A.extent(1),
+                                                        A.data(), A.stride_0(), A.stride_1(),
+                                                        t.data(), t.stride_0());
+      }
+    };
+
+    ///
+    /// TeamApplyQ Left Transpose
+    ///
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamApplyQ<MemberType,Side::Left,Trans::Transpose,ArgAlgo> {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const tViewType &t,
+             const BViewType &B) {
+        return TeamApplyQ_LeftInternal<ArgAlgo>::invoke(member, true,
+                                                        B.extent(0), B.extent(1), t.extent(0),
+                                                        A.data(), A.stride_0(), A.stride_1(),
+                                                        t.data(), t.stride_0(),
+                                                        B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    ///
+    /// TeamApplyQ Left NoTranspose
+    ///
+
+    template<typename MemberType,
+             typename ArgAlgo>
+    struct TeamApplyQ<MemberType,Side::Left,Trans::NoTranspose,ArgAlgo> {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const AViewType &A,
+             const tViewType &t,
+             const BViewType &B) {
+        return TeamApplyQ_LeftInternal<ArgAlgo>::invoke(member, false,
+                                                        B.extent(0), B.extent(1), t.extent(0),
+                                                        A.data(), A.stride_0(), A.stride_1(),
+                                                        t.data(), t.stride_0(),
+                                                        B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    ///
+    /// TeamQRSolve
+    ///
+
+    template<typename MemberType>
+    struct TeamQRSolve<MemberType,Algo::QR::Unblocked> {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const tViewType &t, const BViewType &B) {
+        return TeamQRSolveInternal<Algo::QR::Unblocked>::invoke(member,
+                                                              B.extent(0), A.extent(1), B.extent(1),
+                                                              A.data(), A.stride_0(), A.stride_1(),
+                                                              t.data(), t.stride_0(),
+                                                              B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+    template<typename MemberType>
+    struct TeamQRSolve<MemberType,Algo::QR::Blocked> {
+      template<typename AViewType,
+               typename tViewType,
+               typename BViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member, const AViewType &A, const tViewType &t, const BViewType &B) {
+        return TeamQRSolveInternal<Algo::QR::Blocked>::invoke(member,
+                                                            B.extent(0), A.extent(1), B.extent(1),
+                                                            A.data(), A.stride_0(), A.stride_1(),
+                                                            t.data(), t.stride_0(),
+                                                            B.data(), B.stride_0(), B.stride_1());
+      }
+    };
+
+  }
+}
+
+#endif
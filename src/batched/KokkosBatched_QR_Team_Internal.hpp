@@ -0,0 +1,112 @@
+#ifndef __KOKKOSBATCHED_QR_TEAM_INTERNAL_HPP__
+#define __KOKKOSBATCHED_QR_TEAM_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_QR_Serial_Internal.hpp"
+
+#include "KokkosBatched_Trsm_Team_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Team Internal Impl
+    /// ==================
+
+    template<typename AlgoType>
+    struct TeamQR_Internal {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int m, const int n,
+             /**/  ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ t, const int ts) {
+        static_assert(IsReal<ValueType>::value,
+                      "KokkosBatched::QR: only real value types are supported.");
+        enum : int { mb = QR_Internal::ColumnBlock<AlgoType>::value };
+
+        const int k = m < n ? m : n;
+        for (int p=0;p<k;++p) {
+          ValueType
+            *__restrict__ a11 = A+p*as0+p*as1,
+            *__restrict__ a21 = a11+as0,
+            *__restrict__ A12 = a11+as1;
+
+          if (member.team_rank() == 0)
+            QR_Internal::make_householder(m-p, a11, as0, t[p*ts]);
+          member.team_barrier();
+
+          // column blocks of the trailing matrix are distributed over the team
+          const int nr = n-p-1, np = nr%mb, nq = (nr/mb)+(np>0);
+          const ValueType tau = t[p*ts];
+          Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,nq),[&](const int &jq) {
+              const int j = jq*mb, qb = (j+mb) > nr ? np : mb;
+              QR_Internal::apply_householder<mb>(m-p, qb,
+                                                 a21, as0,
+                                                 tau,
+                                                 A12+j*as1, as0, as1);
+            });
+          member.team_barrier();
+        }
+        return 0;
+      }
+    };
+
+    template<typename AlgoType>
+    struct TeamApplyQ_LeftInternal {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const bool transpose,
+             const int m, const int n, const int k,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             const ValueType *__restrict__ t, const int ts,
+             /**/  ValueType *__restrict__ B, const int bs0, const int bs1) {
+        static_assert(IsReal<ValueType>::value,
+                      "KokkosBatched::ApplyQ: only real value types are supported.");
+        enum : int { mb = QR_Internal::ColumnBlock<AlgoType>::value };
+
+        // column blocks of B are independent
+        const int np = n%mb, nq = (n/mb)+(np>0);
+        Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,nq),[&](const int &jq) {
+            const int j = jq*mb, qb = (j+mb) > n ? np : mb;
+            QR_Internal::apply_q<mb>(transpose, m, qb, k,
+                                     A, as0, as1,
+                                     t, ts,
+                                     B+j*bs1, bs0, bs1);
+          });
+        return 0;
+      }
+    };
+
+    ///
+    /// Least squares: B = Q^T B and R X = B(0:n,:)
+    ///
+
+    template<typename AlgoType>
+    struct TeamQRSolveInternal {
+      template<typename MemberType, typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const MemberType &member,
+             const int m, const int n, const int nrhs,
+             const ValueType *__restrict__ A, const int as0, const int as1,
+             const ValueType *__restrict__ t, const int ts,
+             /**/  ValueType *__restrict__ B, const int bs0, const int bs1) {
+        const typename MagnitudeScalarType<ValueType>::type one(1.0);
+        TeamApplyQ_LeftInternal<AlgoType>::invoke(member, true, m, nrhs, n, A, as0, as1, t, ts, B, bs0, bs1);
+        member.team_barrier();
+        TeamTrsmInternalLeftUpper<AlgoType>::invoke(member, false, n, nrhs, one, A, as0, as1, B, bs0, bs1);
+        return 0;
+      }
+    };
+
+  }
+}
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef __KOKKOSBATCHED_SYM_EIGEN_DECL_HPP__
+#define __KOKKOSBATCHED_SYM_EIGEN_DECL_HPP__
+
+
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Eigendecomposition A = V diag(e) V^T of a small symmetric matrix.
+    ///
+    /// Eigenvalues are returned in ascending order in e and the
+    /// corresponding orthonormal eigenvectors in the columns of V.
+    /// Real value types only (scalar or SIMD vector); each lane of a
+    /// SIMD vector is an independent matrix and all branches are
+    /// replaced by lane masks, so the arithmetic stays in SIMD registers.
+    ///
+    /// ClosedForm : 1x1, 2x2 (a single Jacobi rotation) and 3x3
+    ///              (trigonometric eigenvalues, eigenvectors from cross
+    ///              products and the orthogonal complement, eigenvalues
+    ///              refined by Rayleigh quotients), A is not modified;
+    ///              larger matrices use Jacobi.
+    /// Jacobi     : cyclic Jacobi sweeps until the off-diagonal part is
+    ///              negligible in every lane; A is overwritten.
+    ///
+
+    template<typename ArgAlgo>
+    struct SerialSymEigen {
+      template<typename AViewType,
+               typename EViewType,
+               typename VViewType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const AViewType &A,
+             const EViewType &e,
+             const VViewType &V);
+    };
+
+  }
+}
+
+#endif
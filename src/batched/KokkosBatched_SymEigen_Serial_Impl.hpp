@@ -0,0 +1,50 @@
+#ifndef __KOKKOSBATCHED_SYM_EIGEN_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_SYM_EIGEN_SERIAL_IMPL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_SymEigen_Serial_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Serial Impl
+    /// ===========
+
+    template<>
+    template<typename AViewType,
+             typename EViewType,
+             typename VViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialSymEigen<Algo::SymEigen::ClosedForm>::
+    invoke(const AViewType &A,
+           const EViewType &e,
+           const VViewType &V) {
+      return SerialSymEigenInternal<Algo::SymEigen::ClosedForm>::invoke(A.extent(0),
+                                                                        A.data(), A.stride_0(), A.stride_1(),
+                                                                        e.data(), e.stride_0(),
+                                                                        V.data(), V.stride_0(), V.stride_1());
+    }
+
+    template<>
+    template<typename AViewType,
+             typename EViewType,
+             typename VViewType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialSymEigen<Algo::SymEigen::Jacobi>::
+    invoke(const AViewType &A,
+           const EViewType &e,
+           const VViewType &V) {
+      return SerialSymEigenInternal<Algo::SymEigen::Jacobi>::invoke(A.extent(0),
+                                                                    A.data(), A.stride_0(), A.stride_1(),
+                                                                    e.data(), e.stride_0(),
+                                                                    V.data(), V.stride_0(), V.stride_1());
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,471 @@
+#ifndef __KOKKOSBATCHED_SYM_EIGEN_SERIAL_INTERNAL_HPP__
+#define __KOKKOSBATCHED_SYM_EIGEN_SERIAL_INTERNAL_HPP__
+
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Vector_SIMD_Math.hpp"
+#include "KokkosBatched_Set_Internal.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Serial Internal Impl
+    /// ====================
+
+    namespace SymEigenInternal {
+      // lane-wise functions of scalar and SIMD vector types; a mask is a
+      // bool for scalars and a Vector<SIMD<bool>,l> for vectors
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      ValueType
+      select(const bool mask, const ValueType &a, const ValueType &b) {
+        return mask ? a : b;
+      }
+
+      template<typename T, int l>
+      inline
+      Vector<SIMD<T>,l>
+      select(const Vector<SIMD<bool>,l> &mask, const Vector<SIMD<T>,l> &a, const Vector<SIMD<T>,l> &b) {
+        return conditional_assign(mask, a, b);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      bool
+      all(const bool mask) {
+        return mask;
+      }
+
+      template<int l>
+      inline
+      bool
+      all(const Vector<SIMD<bool>,l> &mask) {
+        bool r_val = true;
+        for (int i=0;i<l;++i)
+          r_val &= mask[i];
+        return r_val;
+      }
+
+      // KokkosBatched_Vector_SIMD_Math has no abs; apply it lane-wise
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<!is_vector<ValueType>::value,ValueType>::type
+      abs(const ValueType &a) {
+        return Kokkos::Details::ArithTraits<ValueType>::abs(a);
+      }
+
+      template<typename ValueType>
+      inline
+      typename std::enable_if<is_vector<ValueType>::value,ValueType>::type
+      abs(const ValueType &a) {
+        typedef Kokkos::Details::ArithTraits<typename ValueType::value_type> ats;
+        ValueType r_val;
+        for (int i=0;i<ValueType::vector_length;++i)
+          r_val[i] = ats::abs(a[i]);
+        return r_val;
+      }
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<!is_vector<ValueType>::value,ValueType>::type
+      sqrt(const ValueType &a) {
+        return Kokkos::Details::ArithTraits<ValueType>::sqrt(a);
+      }
+
+      template<typename ValueType>
+      inline
+      typename std::enable_if<is_vector<ValueType>::value,ValueType>::type
+      sqrt(const ValueType &a) {
+        return KokkosBatched::Experimental::sqrt(a);
+      }
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<!is_vector<ValueType>::value,ValueType>::type
+      acos(const ValueType &a) {
+        return Kokkos::Details::ArithTraits<ValueType>::acos(a);
+      }
+
+      template<typename ValueType>
+      inline
+      typename std::enable_if<is_vector<ValueType>::value,ValueType>::type
+      acos(const ValueType &a) {
+        return KokkosBatched::Experimental::acos(a);
+      }
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<!is_vector<ValueType>::value,ValueType>::type
+      cos(const ValueType &a) {
+        return Kokkos::Details::ArithTraits<ValueType>::cos(a);
+      }
+
+      template<typename ValueType>
+      inline
+      typename std::enable_if<is_vector<ValueType>::value,ValueType>::type
+      cos(const ValueType &a) {
+        return KokkosBatched::Experimental::cos(a);
+      }
+
+      ///
+      /// Jacobi rotation annihilating A(p,q), A = J^T A J and V = V J
+      ///
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      rotate(const int n, const int p, const int q,
+             /**/ ValueType *__restrict__ A, const int as0, const int as1,
+             /**/ ValueType *__restrict__ V, const int vs0, const int vs1) {
+        typedef typename MagnitudeScalarType<ValueType>::type mag_type;
+        const ValueType zero(mag_type(0)), one(mag_type(1)), two(mag_type(2));
+
+        const ValueType
+          app = A[p*as0+p*as1],
+          aqq = A[q*as0+q*as1],
+          apq = A[p*as0+q*as1];
+
+        // t = sign(tau)/(|tau| + sqrt(1+tau^2)), the smaller root; a huge tau gives t = 0
+        const auto is_zero = apq == zero;
+        const ValueType tau = (aqq - app)/(two*select(is_zero, one, apq));
+        const ValueType t = select(is_zero, zero,
+                                   select(tau >= zero, one, -one)/(abs(tau) + sqrt(one + tau*tau)));
+        const ValueType c = one/sqrt(one + t*t), s = t*c;
+
+        A[p*as0+p*as1] = app - t*apq;
+        A[q*as0+q*as1] = aqq + t*apq;
+        A[p*as0+q*as1] = zero;
+        A[q*as0+p*as1] = zero;
+
+        for (int k=0;k<n;++k) {
+          if (k == p || k == q) continue;
+          const ValueType akp = A[k*as0+p*as1], akq = A[k*as0+q*as1];
+          A[k*as0+p*as1] = A[p*as0+k*as1] = c*akp - s*akq;
+          A[k*as0+q*as1] = A[q*as0+k*as1] = s*akp + c*akq;
+        }
+        for (int k=0;k<n;++k) {
+          const ValueType vkp = V[k*vs0+p*vs1], vkq = V[k*vs0+q*vs1];
+          V[k*vs0+p*vs1] = c*vkp - s*vkq;
+          V[k*vs0+q*vs1] = s*vkp + c*vkq;
+        }
+      }
+
+      ///
+      /// ascending order, lanes are sorted independently
+      ///
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      sort(const int n,
+           /**/ ValueType *__restrict__ e, const int es,
+           /**/ ValueType *__restrict__ V, const int vs0, const int vs1) {
+        for (int i=0;i<n;++i)
+          for (int j=i+1;j<n;++j) {
+            const ValueType ei = e[i*es], ej = e[j*es];
+            const auto mask = ej < ei;
+            e[i*es] = select(mask, ej, ei);
+            e[j*es] = select(mask, ei, ej);
+            for (int k=0;k<n;++k) {
+              const ValueType vi = V[k*vs0+i*vs1], vj = V[k*vs0+j*vs1];
+              V[k*vs0+i*vs1] = select(mask, vj, vi);
+              V[k*vs0+j*vs1] = select(mask, vi, vj);
+            }
+          }
+      }
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      cross(const ValueType *__restrict__ a, const ValueType *__restrict__ b,
+            /**/  ValueType *__restrict__ c) {
+        c[0] = a[1]*b[2] - a[2]*b[1];
+        c[1] = a[2]*b[0] - a[0]*b[2];
+        c[2] = a[0]*b[1] - a[1]*b[0];
+      }
+
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      ValueType
+      dot(const ValueType *__restrict__ a, const ValueType *__restrict__ b) {
+        return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+      }
+
+      ///
+      /// unit eigenvector of a simple eigenvalue: the largest cross product
+      /// of two rows of A - eval I (of rank 2)
+      ///
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      eigenvector_3x3_simple(const ValueType *__restrict__ a, // a00, a01, a02, a11, a12, a22
+                             const ValueType eval,
+                             /**/  ValueType *__restrict__ v) {
+        typedef typename MagnitudeScalarType<ValueType>::type mag_type;
+        const ValueType zero(mag_type(0)), one(mag_type(1));
+
+        const ValueType
+          r0[3] = { a[0]-eval, a[1], a[2] },
+          r1[3] = { a[1], a[3]-eval, a[4] },
+          r2[3] = { a[2], a[4], a[5]-eval };
+
+        ValueType x01[3], x02[3], x12[3];
+        cross(r0, r1, x01);
+        cross(r0, r2, x02);
+        cross(r1, r2, x12);
+
+        const ValueType d01 = dot(x01, x01), d02 = dot(x02, x02), d12 = dot(x12, x12);
+
+        ValueType d = d01;
+        for (int i=0;i<3;++i) v[i] = x01[i];
+
+        const auto m02 = d02 > d;
+        d = select(m02, d02, d);
+        for (int i=0;i<3;++i) v[i] = select(m02, x02[i], v[i]);
+
+        const auto m12 = d12 > d;
+        d = select(m12, d12, d);
+        for (int i=0;i<3;++i) v[i] = select(m12, x12[i], v[i]);
+
+        const ValueType inv_norm = one/sqrt(select(d == zero, one, d));
+        for (int i=0;i<3;++i) v[i] *= inv_norm;
+      }
+
+      ///
+      /// unit eigenvector of eval orthogonal to the unit vector w; the 2x2
+      /// problem on the orthogonal complement of w is robust for a
+      /// repeated eigenvalue
+      ///
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      void
+      eigenvector_3x3_complement(const ValueType *__restrict__ a, // a00, a01, a02, a11, a12, a22
+                                 const ValueType *__restrict__ w,
+                                 const ValueType eval,
+                                 /**/  ValueType *__restrict__ v) {
+        typedef typename MagnitudeScalarType<ValueType>::type mag_type;
+        const ValueType zero(mag_type(0)), one(mag_type(1));
+
+        // orthonormal basis u, z of the complement of w
+        const auto m = abs(w[0]) > abs(w[1]);
+        const ValueType
+          inv0 = one/sqrt(select(m, w[0]*w[0] + w[2]*w[2], one)),
+          inv1 = one/sqrt(select(m, one, w[1]*w[1] + w[2]*w[2]));
+        const ValueType u[3] = { select(m, -w[2]*inv0, zero),
+                                 select(m, zero, w[2]*inv1),
+                                 select(m, w[0]*inv0, -w[1]*inv1) };
+        ValueType z[3];
+        cross(w, u, z);
+
+        const ValueType
+          au[3] = { a[0]*u[0] + a[1]*u[1] + a[2]*u[2],
+                    a[1]*u[0] + a[3]*u[1] + a[4]*u[2],
+                    a[2]*u[0] + a[4]*u[1] + a[5]*u[2] },
+          az[3] = { a[0]*z[0] + a[1]*z[1] + a[2]*z[2],
+                    a[1]*z[0] + a[3]*z[1] + a[4]*z[2],
+                    a[2]*z[0] + a[4]*z[1] + a[5]*z[2] };
+
+        // [m00 m01; m01 m11] = [u z]^T (A - eval I) [u z]
+        const ValueType
+          m00 = dot(u, au) - eval,
+          m01 = dot(u, az),
+          m11 = dot(z, az) - eval;
+
+        // null vector from the row with the larger diagonal entry
+        const auto use_m00 = abs(m00) >= abs(m11);
+        const ValueType x = select(use_m00, m00, m11), y = m01;
+        const ValueType absx = abs(x), absy = abs(y);
+
+        const auto x_dominant = absx >= absy;
+        const auto is_zero = select(x_dominant, absx, absy) == zero;
+        const ValueType r = select(is_zero, zero, select(x_dominant, y, x)/select(is_zero, one, select(x_dominant, x, y)));
+        const ValueType h = one/sqrt(one + r*r);
+        const ValueType
+          cx = select(x_dominant, h, r*h),
+          cy = select(x_dominant, r*h, h);
+
+        // (A - eval I) is zero on the complement: any vector, take u
+        const ValueType
+          cu = select(is_zero, one,  select(use_m00, cy, cx)),
+          cz = select(is_zero, zero, select(use_m00, -cx, -cy));
+        for (int i=0;i<3;++i)
+          v[i] = cu*u[i] + cz*z[i];
+      }
+    }
+
+    template<typename AlgoType>
+    struct SerialSymEigenInternal {
+      template<typename ValueType>
+      KOKKOS_INLINE_FUNCTION
+      static int
+      invoke(const int m,
+             /**/  ValueType *__restrict__ A, const int as0, const int as1,
+             /**/  ValueType *__restrict__ e, const int es,
+             /**/  ValueType *__restrict__ V, const int vs0, const int vs1);
+    };
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialSymEigenInternal<Algo::SymEigen::Jacobi>::
+    invoke(const int m,
+           /**/  ValueType *__restrict__ A, const int as0, const int as1,
+           /**/  ValueType *__restrict__ e, const int es,
+           /**/  ValueType *__restrict__ V, const int vs0, const int vs1) {
+      static_assert(IsReal<ValueType>::value,
+                    "KokkosBatched::SymEigen: only real value types are supported.");
+      typedef typename MagnitudeScalarType<ValueType>::type mag_type;
+      typedef Kokkos::Details::ArithTraits<mag_type> ats;
+      enum : int { max_sweeps = 32 };
+
+      const mag_type zero(0), one(1);
+      SerialSetInternal::invoke(m, m, zero, V, vs0, vs1);
+      for (int i=0;i<m;++i)
+        V[i*vs0+i*vs1] = one;
+
+      // converged when the off-diagonal part is below eps |A|_F in every lane
+      ValueType norm2(zero);
+      for (int i=0;i<m;++i)
+        for (int j=0;j<m;++j)
+          norm2 += A[i*as0+j*as1]*A[i*as0+j*as1];
+      const ValueType tol2 = norm2*(ats::epsilon()*ats::epsilon());
+
+      for (int sweep=0;sweep<max_sweeps;++sweep) {
+        ValueType off2(zero);
+        for (int i=0;i<m;++i)
+          for (int j=i+1;j<m;++j)
+            off2 += A[i*as0+j*as1]*A[i*as0+j*as1];
+        if (SymEigenInternal::all(off2 <= tol2)) break;
+
+        for (int p=0;p<m;++p)
+          for (int q=p+1;q<m;++q)
+            SymEigenInternal::rotate(m, p, q, A, as0, as1, V, vs0, vs1);
+      }
+
+      for (int i=0;i<m;++i)
+        e[i*es] = A[i*as0+i*as1];
+
+      SymEigenInternal::sort(m, e, es, V, vs0, vs1);
+      return 0;
+    }
+
+    template<>
+    template<typename ValueType>
+    KOKKOS_INLINE_FUNCTION
+    int
+    SerialSymEigenInternal<Algo::SymEigen::ClosedForm>::
+    invoke(const int m,
+           /**/  ValueType *__restrict__ A, const int as0, const int as1,
+           /**/  ValueType *__restrict__ e, const int es,
+           /**/  ValueType *__restrict__ V, const int vs0, const int vs1) {
+      static_assert(IsReal<ValueType>::value,
+                    "KokkosBatched::SymEigen: only real value types are supported.");
+      typedef typename MagnitudeScalarType<ValueType>::type mag_type;
+
+      const ValueType zero(mag_type(0)), one(mag_type(1));
+      switch (m) {
+      case 0: break;
+      case 1: {
+        e[0] = A[0];
+        V[0] = one;
+        break;
+      }
+      case 2: {
+        ValueType a[4] = { A[0], A[as1], A[as0], A[as0+as1] };
+        V[0] = one;  V[vs1] = zero;
+        V[vs0] = zero; V[vs0+vs1] = one;
+        SymEigenInternal::rotate(2, 0, 1, a, 2, 1, V, vs0, vs1);
+        e[0] = a[0];
+        e[es] = a[3];
+        SymEigenInternal::sort(2, e, es, V, vs0, vs1);
+        break;
+      }
+      case 3: {
+        const mag_type half(0.5), two(2), three(3), six(6);
+        const mag_type two_pi_over_three(2.0943951023931954923084289221863);
+
+        // scale by the largest entry to avoid overflow; a zero matrix stays zero
+        const ValueType upper[6] = { A[0],     A[as1],        A[2*as1],
+                                     A[as0+as1], A[as0+2*as1], A[2*as0+2*as1] };
+        ValueType amax = SymEigenInternal::abs(upper[0]);
+        for (int i=1;i<6;++i) {
+          const ValueType ai = SymEigenInternal::abs(upper[i]);
+          amax = SymEigenInternal::select(ai > amax, ai, amax);
+        }
+        amax = SymEigenInternal::select(amax == zero, one, amax);
+        const ValueType inv_amax = one/amax;
+
+        ValueType a[6];
+        for (int i=0;i<6;++i)
+          a[i] = upper[i]*inv_amax;
+
+        // B = (A - q I)/p has eigenvalues 2 cos(angle + 2 pi k/3)
+        const ValueType q = (a[0] + a[3] + a[5])/three;
+        const ValueType b00 = a[0] - q, b11 = a[3] - q, b22 = a[5] - q;
+        const ValueType p2 = (b00*b00 + b11*b11 + b22*b22 +
+                              two*(a[1]*a[1] + a[2]*a[2] + a[4]*a[4]));
+
+        // A = q I, every vector is an eigenvector
+        const auto is_scalar = p2 == zero;
+
+        const ValueType p = SymEigenInternal::sqrt(p2/six);
+        const ValueType inv_p = one/SymEigenInternal::select(is_scalar, one, p);
+        const ValueType
+          c00 = b00*inv_p, c01 = a[1]*inv_p, c02 = a[2]*inv_p,
+          c11 = b11*inv_p, c12 = a[4]*inv_p, c22 = b22*inv_p;
+        ValueType half_det = half*(c00*(c11*c22 - c12*c12) -
+                                   c01*(c01*c22 - c12*c02) +
+                                   c02*(c01*c12 - c11*c02));
+        half_det = SymEigenInternal::select(half_det < -one, -one,
+                                            SymEigenInternal::select(half_det > one, one, half_det));
+
+        const ValueType angle = SymEigenInternal::acos(half_det)/three;
+        const ValueType
+          beta2 = two*SymEigenInternal::cos(angle),
+          beta0 = two*SymEigenInternal::cos(angle + two_pi_over_three),
+          beta1 = -(beta0 + beta2);
+
+        const ValueType
+          eval0 = SymEigenInternal::select(is_scalar, q, q + p*beta0),
+          eval1 = SymEigenInternal::select(is_scalar, q, q + p*beta1),
+          eval2 = SymEigenInternal::select(is_scalar, q, q + p*beta2);
+
+        // start from the eigenvalue farthest from the other two
+        const auto largest_first = half_det >= zero;
+        ValueType v0[3], v1[3], v2[3];
+        SymEigenInternal::eigenvector_3x3_simple(a, SymEigenInternal::select(largest_first, eval2, eval0), v0);
+        SymEigenInternal::eigenvector_3x3_complement(a, v0, eval1, v1);
+        SymEigenInternal::cross(v0, v1, v2);
+
+        for (int i=0;i<3;++i) {
+          const ValueType id_i0 = i == 0 ? one : zero, id_i1 = i == 1 ? one : zero, id_i2 = i == 2 ? one : zero;
+          V[i*vs0      ] = SymEigenInternal::select(is_scalar, id_i0, SymEigenInternal::select(largest_first, v2[i], v0[i]));
+          V[i*vs0+  vs1] = SymEigenInternal::select(is_scalar, id_i1, v1[i]);
+          V[i*vs0+2*vs1] = SymEigenInternal::select(is_scalar, id_i2, SymEigenInternal::select(largest_first, v0[i], v2[i]));
+        }
+
+        // the trigonometric eigenvalues lose half the digits for a nearly
+        // repeated pair; Rayleigh quotients of the eigenvectors do not
+        for (int k=0;k<3;++k) {
+          const ValueType v[3] = { V[k*vs1], V[vs0+k*vs1], V[2*vs0+k*vs1] };
+          const ValueType av[3] = { a[0]*v[0] + a[1]*v[1] + a[2]*v[2],
+                                    a[1]*v[0] + a[3]*v[1] + a[4]*v[2],
+                                    a[2]*v[0] + a[4]*v[1] + a[5]*v[2] };
+          e[k*es] = SymEigenInternal::dot(v, av)*amax;
+        }
+        SymEigenInternal::sort(3, e, es, V, vs0, vs1);
+        break;
+      }
+      default: {
+        SerialSymEigenInternal<Algo::SymEigen::Jacobi>::invoke(m, A, as0, as1, e, es, V, vs0, vs1);
+        break;
+      }
+      }
+      return 0;
+    }
+
+  }
+}
+
+#endif
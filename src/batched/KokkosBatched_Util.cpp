@@ -1,4 +1,5 @@
 #include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_InstructionSet.hpp"
 
 /// \author Kyungjoo Kim (kyukim@sandia.gov)
 
@@ -42,6 +43,11 @@ namespace KokkosBatched {
 #else
       printf("    FMA is not supported\n");
 #endif
+
+      printf("  batched simd instruction set:\n");
+      printf("    compiled : %s\n", InstructionSet::name(compiled_instruction_set()));
+      printf("    host     : %s\n", InstructionSet::name(host_instruction_set()));
+      printf("    active   : %s\n", InstructionSet::name(active_instruction_set()));
     }
   }
 }
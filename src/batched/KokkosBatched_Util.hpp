@@ -47,6 +47,39 @@ namespace KokkosBatched {
 
     template<typename T> struct is_vector : public std::false_type {};
 
+    /// scalar type of a (scalar or SIMD) value type
+    template<typename ValueType, typename Enable = void>
+    struct Scalar { typedef ValueType type; };
+
+    template<typename ValueType>
+    struct Scalar<ValueType,typename std::enable_if<is_vector<ValueType>::value>::type> {
+      typedef typename ValueType::value_type type;
+    };
+
+    /// lane access of a (scalar or SIMD) value
+    template<typename ValueType, typename Enable = void>
+    struct Lane {
+      enum : int { vector_length = 1 };
+      typedef ValueType value_type;
+      KOKKOS_INLINE_FUNCTION
+      static value_type& get(ValueType &v, const int) { return v; }
+    };
+
+    template<typename ValueType>
+    struct Lane<ValueType,typename std::enable_if<is_vector<ValueType>::value>::type> {
+      enum : int { vector_length = ValueType::vector_length };
+      typedef typename ValueType::value_type value_type;
+      KOKKOS_INLINE_FUNCTION
+      static value_type& get(ValueType &v, const int s) { return v[s]; }
+    };
+
+    /// true if the scalar type of a (scalar or SIMD) value type is real
+    template<typename ValueType>
+    struct IsReal {
+      enum : bool { value = std::is_same<typename Scalar<ValueType>::type,
+                                         typename Kokkos::Details::ArithTraits<typename Scalar<ValueType>::type>::mag_type>::value };
+    };
+
     template<typename Ta, typename Tb>
     struct is_same_mag_type {
       static const bool is_specialized = ( Kokkos::Details::ArithTraits<Ta>::is_specialized &&
@@ -197,7 +230,9 @@ namespace KokkosBatched {
                      std::is_same<T,size_t>::value                   ||
                      std::is_same<T,double>::value                   ||
 		     std::is_same<T,float>::value                    ||
+		     std::is_same<T,Kokkos::complex<float> >::value  ||
 		     std::is_same<T,Kokkos::complex<double> >::value ||
+		     std::is_same<T,std::complex<float> >::value     ||
 		     std::is_same<T,std::complex<double> >::value,
 		     "KokkosKernels:: Invalid SIMD<> type." );
       using value_type = T;
@@ -208,7 +243,9 @@ namespace KokkosBatched {
     struct AVX {
       static_assert( std::is_same<T,double>::value                   ||
 		     std::is_same<T,float>::value                    ||
+		     std::is_same<T,Kokkos::complex<float> >::value  ||
 		     std::is_same<T,Kokkos::complex<double> >::value ||
+		     std::is_same<T,std::complex<float> >::value     ||
 		     std::is_same<T,std::complex<double> >::value,
 		     "KokkosKernels:: Invalid AVX<> type." );
       using value_type = T;
@@ -269,6 +306,9 @@ namespace KokkosBatched {
       using Gemm = Level3;
       using Trsm = Level3;
       using LU   = Level3;
+      using Cholesky = Level3;
+      using Inverse = Level3;
+      using QR = Level3;
 
       struct Level2 {
 	struct Unblocked {};
@@ -295,6 +335,15 @@ namespace KokkosBatched {
       using Gemv = Level2;
       using Trsv = Level2;
 
+      struct SymEigen {
+        struct ClosedForm {
+          static const char* name() { return "ClosedForm"; }
+        };
+        struct Jacobi {
+          static const char* name() { return "Jacobi"; }
+        };
+      };
+
       //         struct Level1 {
       //           struct Unblocked {};
       //           struct Blocked {
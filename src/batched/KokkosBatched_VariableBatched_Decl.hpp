@@ -0,0 +1,260 @@
+#ifndef __KOKKOSBATCHED_VARIABLE_BATCHED_DECL_HPP__
+#define __KOKKOSBATCHED_VARIABLE_BATCHED_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+    ///
+    /// Variable Size Batched Kernels
+    /// =============================
+    ///
+    /// A batch of small problems whose dimensions differ from entry to
+    /// entry. As in the variable size GemmBatched interface, the matrices
+    /// are stored in views padded to the largest problem, A(b,i,j), and
+    /// the problem of entry b lives in the leading block given by its
+    /// sizes (m,n,k). The padding is the price of the rank 3 views: the
+    /// storage is N x max(m) x max(n) whatever the distribution of the
+    /// sizes, e.g., a DG mesh mixing a few high order blocks among mostly
+    /// low order ones allocates about 12x the memory of its actual entries.
+    /// Split such batches by size range into several VariableBatch/view
+    /// pairs when memory matters.
+    ///
+    /// VariableBatch is the descriptor of the batch. It is built once on
+    /// host from sizes(b,0:d), d <= 3 (missing columns are zero), and
+    /// groups the entries of the same size into buckets:
+    ///
+    ///   Entries()(BucketOffsets()(q) : BucketOffsets()(q+1))
+    ///
+    /// are the entries of bucket q, in increasing entry order, and
+    /// BucketSizes()(q,:) is their common (m,n,k). The buckets are sorted
+    /// by (m,n,k) and a kernel merges the consecutive buckets that agree
+    /// on the sizes it uses (lu and trsv on m, gemv on (m,n)), so one
+    /// descriptor built for gemm is reused by lu and trsv without
+    /// splitting their groups on n and k. The descriptor only depends on
+    /// the sizes, so it is reused by every call on the batch.
+    ///
+    /// The kernels below are top-level (host-called) and launch over the
+    /// whole batch:
+    /// - Serial     : one entry per thread using the Serial kernel on the
+    ///                leading block of the padded views (any space)
+    /// - SerialSIMD : host only; every group is cut into packs of
+    ///                vector_length entries that are interleaved into
+    ///                Vector<SIMD<T>,l> lanes, solved by the same Serial
+    ///                kernel at the group size and scattered back. The
+    ///                ragged tail of a group fills its idle lanes with a
+    ///                copy of the first entry of the pack, which keeps the
+    ///                arithmetic finite (e.g., LU) and is never written back.
+    ///                The packs go one by one through a small workspace per
+    ///                chunk of packs, viewed at the group size, so no
+    ///                packed copy of the batch is made.
+    ///                As in GemmBatched, vector_length is the one of
+    ///                active_instruction_set(), chosen at run time.
+    /// Auto decides per group: SerialSIMD, when it is available, for the
+    /// small groups (m,n,k <= 16) that fill at least half of the SIMD lanes
+    /// of their packs, and Serial for the other entries.
+    ///
+    /// Sizes used by the kernels:
+    /// - gemm : C(b) = beta C(b) + alpha op(A(b)) op(B(b)), (m,n,k) as in
+    ///          GemmBatched; op(A(b)) is m x k, op(B(b)) is k x n
+    /// - gemv : y(b) = beta y(b) + alpha op(A(b)) x(b), A(b) is m x n
+    /// - lu   : A(b) = L U without pivoting, A(b) is m x m
+    /// - trsv : b(b) = alpha inv(op(A(b))) b(b), A(b) is m x m
+    ///
+    /// Return value is 0 on success and -1 if a requested mode is not
+    /// available for the given value type or execution space.
+    ///
+
+    struct VariableBatchedMode {
+      enum : int { Auto = 0,
+                   Serial = 1,
+                   SerialSIMD = 2 };
+
+      static const char* name(const int mode) {
+        switch (mode) {
+        case Serial:     return "Serial";
+        case SerialSIMD: return "SerialSIMD";
+        default: break;
+        }
+        return "Auto";
+      }
+    };
+
+    template<typename DeviceType>
+    class VariableBatch {
+    public:
+      typedef DeviceType device_type;
+      typedef typename DeviceType::execution_space execution_space;
+
+      typedef Kokkos::View<int*,Kokkos::LayoutRight,device_type> index_array_type;
+      typedef Kokkos::View<int*[3],Kokkos::LayoutRight,device_type> size_array_type;
+
+    private:
+      int _nentries, _max_sizes[3];
+
+      // per entry (m,n,k) and the entries grouped by size
+      size_array_type _sizes;
+      index_array_type _entries;
+
+      // buckets in csr form; the entries and buckets are kept on host as well for the dispatch
+      typename index_array_type::HostMirror _entries_host;
+      index_array_type _bucket_offsets;
+      size_array_type _bucket_sizes;
+      typename index_array_type::HostMirror _bucket_offsets_host;
+      typename size_array_type::HostMirror _bucket_sizes_host;
+
+    public:
+      VariableBatch()
+        : _nentries(0), _max_sizes{0,0,0},
+          _sizes(), _entries(), _entries_host(),
+          _bucket_offsets(), _bucket_sizes(),
+          _bucket_offsets_host(), _bucket_sizes_host() {}
+
+      template<typename SizeViewType>
+      VariableBatch(const SizeViewType &sizes);
+
+      size_array_type Sizes() const { return _sizes; }
+      index_array_type Entries() const { return _entries; }
+      index_array_type BucketOffsets() const { return _bucket_offsets; }
+      size_array_type BucketSizes() const { return _bucket_sizes; }
+
+      typename index_array_type::HostMirror EntriesHost() const { return _entries_host; }
+      typename index_array_type::HostMirror BucketOffsetsHost() const { return _bucket_offsets_host; }
+      typename size_array_type::HostMirror BucketSizesHost() const { return _bucket_sizes_host; }
+
+      int NumEntries() const { return _nentries; }
+      int NumBuckets() const { return _bucket_sizes.extent(0); }
+
+      // largest m, n and k over the batch
+      int MaxSize(const int i) const { return _max_sizes[i]; }
+    };
+
+    template<typename ArgTransA,
+             typename ArgTransB>
+    struct VariableGemmBatched {
+      template<typename DeviceType,
+               typename ScalarType,
+               typename AViewType,
+               typename BViewType,
+               typename CViewType>
+      static int
+      invoke(const VariableBatch<DeviceType> &batch,
+             const ScalarType alpha,
+             const AViewType &A,
+             const BViewType &B,
+             const ScalarType beta,
+             const CViewType &C,
+             const int mode = VariableBatchedMode::Auto);
+    };
+
+    template<typename ArgTrans>
+    struct VariableGemvBatched {
+      template<typename DeviceType,
+               typename ScalarType,
+               typename AViewType,
+               typename xViewType,
+               typename yViewType>
+      static int
+      invoke(const VariableBatch<DeviceType> &batch,
+             const ScalarType alpha,
+             const AViewType &A,
+             const xViewType &x,
+             const ScalarType beta,
+             const yViewType &y,
+             const int mode = VariableBatchedMode::Auto);
+    };
+
+    struct VariableLUBatched {
+      template<typename DeviceType,
+               typename AViewType>
+      static int
+      invoke(const VariableBatch<DeviceType> &batch,
+             const AViewType &A,
+             const int mode = VariableBatchedMode::Auto);
+    };
+
+    template<typename ArgUplo,
+             typename ArgTrans,
+             typename ArgDiag>
+    struct VariableTrsvBatched {
+      template<typename DeviceType,
+               typename ScalarType,
+               typename AViewType,
+               typename bViewType>
+      static int
+      invoke(const VariableBatch<DeviceType> &batch,
+             const ScalarType alpha,
+             const AViewType &A,
+             const bViewType &b,
+             const int mode = VariableBatchedMode::Auto);
+    };
+
+    template<typename ArgTransA,
+             typename ArgTransB,
+             typename DeviceType,
+             typename ScalarType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    inline
+    int
+    gemm_variable_batched(const VariableBatch<DeviceType> &batch,
+                          const ScalarType alpha,
+                          const AViewType &A,
+                          const BViewType &B,
+                          const ScalarType beta,
+                          const CViewType &C,
+                          const int mode = VariableBatchedMode::Auto) {
+      return VariableGemmBatched<ArgTransA,ArgTransB>::invoke(batch, alpha, A, B, beta, C, mode);
+    }
+
+    template<typename ArgTrans,
+             typename DeviceType,
+             typename ScalarType,
+             typename AViewType,
+             typename xViewType,
+             typename yViewType>
+    inline
+    int
+    gemv_variable_batched(const VariableBatch<DeviceType> &batch,
+                          const ScalarType alpha,
+                          const AViewType &A,
+                          const xViewType &x,
+                          const ScalarType beta,
+                          const yViewType &y,
+                          const int mode = VariableBatchedMode::Auto) {
+      return VariableGemvBatched<ArgTrans>::invoke(batch, alpha, A, x, beta, y, mode);
+    }
+
+    template<typename DeviceType,
+             typename AViewType>
+    inline
+    int
+    lu_variable_batched(const VariableBatch<DeviceType> &batch,
+                        const AViewType &A,
+                        const int mode = VariableBatchedMode::Auto) {
+      return VariableLUBatched::invoke(batch, A, mode);
+    }
+
+    template<typename ArgUplo,
+             typename ArgTrans,
+             typename ArgDiag,
+             typename DeviceType,
+             typename ScalarType,
+             typename AViewType,
+             typename bViewType>
+    inline
+    int
+    trsv_variable_batched(const VariableBatch<DeviceType> &batch,
+                          const ScalarType alpha,
+                          const AViewType &A,
+                          const bViewType &b,
+                          const int mode = VariableBatchedMode::Auto) {
+      return VariableTrsvBatched<ArgUplo,ArgTrans,ArgDiag>::invoke(batch, alpha, A, b, mode);
+    }
+
+  }
+}
+
+#endif
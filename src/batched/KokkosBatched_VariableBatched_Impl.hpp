@@ -0,0 +1,1030 @@
+#ifndef __KOKKOSBATCHED_VARIABLE_BATCHED_IMPL_HPP__
+#define __KOKKOSBATCHED_VARIABLE_BATCHED_IMPL_HPP__
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Gemm_Serial_Impl.hpp"
+#include "KokkosBatched_Gemv_Decl.hpp"
+#include "KokkosBatched_Gemv_Serial_Impl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+#include "KokkosBatched_Trsv_Decl.hpp"
+#include "KokkosBatched_Trsv_Serial_Impl.hpp"
+#include "KokkosBatched_GemmBatched_Decl.hpp"
+#include "KokkosBatched_GemmBatched_Impl.hpp"
+#include "KokkosBatched_VariableBatched_Decl.hpp"
+
+
+namespace KokkosBatched {
+  namespace Experimental {
+
+    ///
+    /// Variable Size Batch Descriptor
+    /// ==============================
+
+    template<typename DeviceType>
+    template<typename SizeViewType>
+    VariableBatch<DeviceType>::
+    VariableBatch(const SizeViewType &sizes)
+      : _nentries(sizes.extent(0)), _max_sizes{0,0,0},
+        _sizes("VariableBatch::sizes", sizes.extent(0)),
+        _entries("VariableBatch::entries", sizes.extent(0)) {
+      static_assert(SizeViewType::rank == 2, "KokkosBatched::VariableBatch: sizes must have rank 2 (batch, up to 3).");
+
+      const int ndims = sizes.extent(1);
+      if (ndims > 3) {
+        std::ostringstream os;
+        os << "KokkosBatched::VariableBatch: sizes must have at most 3 columns (m,n,k), "
+           << "but is " << sizes.extent(0) << " x " << sizes.extent(1);
+        Kokkos::Impl::throw_runtime_exception(os.str());
+      }
+
+      auto given_host = Kokkos::create_mirror_view(sizes);
+      Kokkos::deep_copy(given_host, sizes);
+
+      auto sizes_host = Kokkos::create_mirror_view(_sizes);
+      for (int b=0;b<_nentries;++b)
+        for (int d=0;d<3;++d) {
+          const int s = d < ndims ? int(given_host(b,d)) : 0;
+          if (s < 0) {
+            std::ostringstream os;
+            os << "KokkosBatched::VariableBatch: sizes(" << b << "," << d << ") = " << s << " is negative";
+            Kokkos::Impl::throw_runtime_exception(os.str());
+          }
+          sizes_host(b,d) = s;
+          _max_sizes[d] = max(_max_sizes[d], s);
+        }
+
+      // group the entries by (m,n,k); the sort is stable so a bucket keeps the entry order
+      std::vector<int> perm(_nentries);
+      for (int b=0;b<_nentries;++b) perm[b] = b;
+      std::stable_sort(perm.begin(), perm.end(), [&](const int a, const int b) {
+          for (int d=0;d<3;++d)
+            if (sizes_host(a,d) != sizes_host(b,d))
+              return sizes_host(a,d) < sizes_host(b,d);
+          return false;
+        });
+
+      int nbuckets = 0;
+      for (int i=0;i<_nentries;++i)
+        nbuckets += (i == 0 ||
+                     sizes_host(perm[i],0) != sizes_host(perm[i-1],0) ||
+                     sizes_host(perm[i],1) != sizes_host(perm[i-1],1) ||
+                     sizes_host(perm[i],2) != sizes_host(perm[i-1],2));
+
+      _bucket_offsets = index_array_type("VariableBatch::bucket_offsets", nbuckets+1);
+      _bucket_sizes = size_array_type("VariableBatch::bucket_sizes", nbuckets);
+      _bucket_offsets_host = Kokkos::create_mirror_view(_bucket_offsets);
+      _bucket_sizes_host = Kokkos::create_mirror_view(_bucket_sizes);
+
+      _entries_host = Kokkos::create_mirror_view(_entries);
+      for (int i=0,q=-1;i<_nentries;++i) {
+        const int b = perm[i];
+        _entries_host(i) = b;
+        if (q < 0 ||
+            sizes_host(b,0) != _bucket_sizes_host(q,0) ||
+            sizes_host(b,1) != _bucket_sizes_host(q,1) ||
+            sizes_host(b,2) != _bucket_sizes_host(q,2)) {
+          ++q;
+          _bucket_offsets_host(q) = i;
+          for (int d=0;d<3;++d)
+            _bucket_sizes_host(q,d) = sizes_host(b,d);
+        }
+      }
+      _bucket_offsets_host(nbuckets) = _nentries;
+
+      Kokkos::deep_copy(_sizes, sizes_host);
+      Kokkos::deep_copy(_entries, _entries_host);
+      Kokkos::deep_copy(_bucket_offsets, _bucket_offsets_host);
+      Kokkos::deep_copy(_bucket_sizes, _bucket_sizes_host);
+    }
+
+    ///
+    /// Variable Size Batched Impl
+    /// ==========================
+
+    namespace VariableBatchedImpl {
+
+      using GemmBatchedImpl::OpExtent;
+      using GemmBatchedImpl::SIMDAvailable;
+      using GemmBatchedImpl::num_chunks;
+      using GemmBatchedImpl::chunk_range;
+
+      // a group is (begin, end, m, n, k): entries()(begin:end) share the sizes a kernel uses
+      typedef Kokkos::View<int*[5],Kokkos::LayoutRight,Kokkos::HostSpace> group_array_type;
+
+      // a pack is (begin, count, m, n, k): entries()(begin:begin+count) of one group
+      typedef Kokkos::View<int*[5],Kokkos::LayoutRight,Kokkos::HostSpace> pack_array_type;
+
+      ///
+      /// the buckets are sorted by (m,n,k), so the buckets of a kernel that only
+      /// uses the leading rank sizes (lu and trsv use m, gemv (m,n)) are consecutive
+      /// and merge into one group; the unused sizes of a group are zero
+      ///
+      template<typename DeviceType>
+      inline
+      group_array_type
+      make_groups(const VariableBatch<DeviceType> &batch, const int rank) {
+        const auto offsets = batch.BucketOffsetsHost();
+        const auto sizes = batch.BucketSizesHost();
+        const int nbuckets = batch.NumBuckets();
+
+        const auto is_same_group = [&](const int q0, const int q1) {
+          for (int d=0;d<rank;++d)
+            if (sizes(q0,d) != sizes(q1,d)) return false;
+          return true;
+        };
+
+        int ngroups = 0;
+        for (int q=0;q<nbuckets;++q)
+          ngroups += (q == 0 || !is_same_group(q-1, q));
+
+        group_array_type groups("VariableBatched::groups", ngroups);
+        for (int q=0,g=-1;q<nbuckets;++q) {
+          if (q == 0 || !is_same_group(q-1, q)) {
+            ++g;
+            groups(g,0) = offsets(q);
+            for (int d=0;d<3;++d)
+              groups(g,2+d) = d < rank ? sizes(q,d) : 0;
+          }
+          groups(g,1) = offsets(q+1);
+        }
+        return groups;
+      }
+
+      inline
+      int
+      count_packs(const group_array_type &groups, const int g, const int vl) {
+        const int count = groups(g,1) - groups(g,0);
+        return count/vl + (count%vl > 0);
+      }
+
+      inline
+      pack_array_type
+      make_packs(const group_array_type &groups, const int vl) {
+        const int ngroups = groups.extent(0);
+        int npack = 0;
+        for (int g=0;g<ngroups;++g)
+          npack += count_packs(groups, g, vl);
+
+        pack_array_type packs("VariableBatched::packs", npack);
+        for (int g=0,p=0;g<ngroups;++g)
+          for (int begin=groups(g,0),end=groups(g,1);begin<end;begin+=vl,++p) {
+            packs(p,0) = begin;
+            packs(p,1) = min(vl, end - begin);
+            for (int d=0;d<3;++d)
+              packs(p,2+d) = groups(g,2+d);
+          }
+        return packs;
+      }
+
+      // largest size d over the groups, which sizes the SerialSIMD workspace
+      inline
+      int
+      max_group_size(const group_array_type &groups, const int d) {
+        int r_val = 0;
+        for (int g=0,gend=groups.extent(0);g<gend;++g)
+          r_val = max(r_val, groups(g,2+d));
+        return r_val;
+      }
+
+      ///
+      /// split the groups of a kernel between the modes: the entries of the
+      /// Serial groups run one per thread and the SerialSIMD groups are packed.
+      /// Auto decides per group; it interleaves small groups (m,n,k <= 16) whose
+      /// ragged tail leaves at most half of the lanes of their packs idle, so a
+      /// few large or sparsely populated sizes do not turn off SIMD for the rest
+      /// of the batch. Return value is -1 for an unknown mode.
+      ///
+      template<typename ValueType, typename ExecSpaceType, typename DeviceType>
+      inline
+      int
+      select(const VariableBatch<DeviceType> &batch, const int rank, const int mode,
+             typename VariableBatch<DeviceType>::index_array_type &serial_entries,
+             group_array_type &simd_groups) {
+        const group_array_type groups = make_groups(batch, rank);
+        const int ngroups = groups.extent(0);
+
+        std::vector<int> modes(ngroups, mode);
+        switch (mode) {
+        case VariableBatchedMode::Serial:
+        case VariableBatchedMode::SerialSIMD:
+          break;
+        case VariableBatchedMode::Auto: {
+          // vectors are already interleaved by the user
+          const bool is_simd_available = (SIMDAvailable<ValueType,ExecSpaceType>::value &&
+                                          !is_vector<ValueType>::value);
+          const int vl = is_simd_available ? active_vector_length<ValueType>() : 1;
+          for (int g=0;g<ngroups;++g) {
+            const int count = groups(g,1) - groups(g,0);
+            const int mnk = max(groups(g,2), max(groups(g,3), groups(g,4)));
+            modes[g] = (is_simd_available && mnk <= 16 && 2*count >= count_packs(groups, g, vl)*vl ?
+                        VariableBatchedMode::SerialSIMD : VariableBatchedMode::Serial);
+          }
+          break;
+        }
+        default:
+          return -1;
+        }
+
+        int nserial = 0, nsimd = 0;
+        for (int g=0;g<ngroups;++g) {
+          if (modes[g] == VariableBatchedMode::Serial) nserial += groups(g,1) - groups(g,0);
+          else                                         ++nsimd;
+        }
+
+        // a single mode keeps the entries of the descriptor, a mix lists the Serial ones
+        if (nserial == batch.NumEntries()) {
+          serial_entries = batch.Entries();
+        } else {
+          serial_entries = typename VariableBatch<DeviceType>::index_array_type
+            (Kokkos::ViewAllocateWithoutInitializing("VariableBatched::serial_entries"), nserial);
+          if (nserial > 0) {
+            const auto entries_host = batch.EntriesHost();
+            auto serial_entries_host = Kokkos::create_mirror_view(serial_entries);
+            for (int g=0,i=0;g<ngroups;++g)
+              if (modes[g] == VariableBatchedMode::Serial)
+                for (int j=groups(g,0),jend=groups(g,1);j<jend;++j,++i)
+                  serial_entries_host(i) = entries_host(j);
+            Kokkos::deep_copy(serial_entries, serial_entries_host);
+          }
+        }
+
+        simd_groups = group_array_type("VariableBatched::simd_groups", nsimd);
+        for (int g=0,h=0;g<ngroups;++g)
+          if (modes[g] == VariableBatchedMode::SerialSIMD) {
+            for (int d=0;d<5;++d)
+              simd_groups(h,d) = groups(g,d);
+            ++h;
+          }
+        return 0;
+      }
+
+      ///
+      /// interleave entries()(begin:begin+count) into the lanes of a pack block;
+      /// idle lanes of a ragged tail replicate the first entry
+      ///
+      template<typename PackViewType, typename ViewType, typename EntryViewType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<PackViewType::rank == 2,void>::type
+      gather(const PackViewType &ap, const ViewType &A,
+             const EntryViewType &entries, const int begin, const int count) {
+        typedef typename PackViewType::non_const_value_type vector_type;
+        const int m = ap.extent(0), n = ap.extent(1);
+        for (int l=0;l<vector_type::vector_length;++l) {
+          const int b = entries(begin + (l < count ? l : 0));
+          for (int i=0;i<m;++i)
+            for (int j=0;j<n;++j)
+              ap(i,j)[l] = A(b,i,j);
+        }
+      }
+
+      template<typename PackViewType, typename ViewType, typename EntryViewType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<PackViewType::rank == 1,void>::type
+      gather(const PackViewType &ap, const ViewType &A,
+             const EntryViewType &entries, const int begin, const int count) {
+        typedef typename PackViewType::non_const_value_type vector_type;
+        const int m = ap.extent(0);
+        for (int l=0;l<vector_type::vector_length;++l) {
+          const int b = entries(begin + (l < count ? l : 0));
+          for (int i=0;i<m;++i)
+            ap(i)[l] = A(b,i);
+        }
+      }
+
+      template<typename PackViewType, typename ViewType, typename EntryViewType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<PackViewType::rank == 2,void>::type
+      scatter(const PackViewType &ap, const ViewType &A,
+              const EntryViewType &entries, const int begin, const int count) {
+        const int m = ap.extent(0), n = ap.extent(1);
+        for (int l=0;l<count;++l) {
+          const int b = entries(begin + l);
+          for (int i=0;i<m;++i)
+            for (int j=0;j<n;++j)
+              A(b,i,j) = ap(i,j)[l];
+        }
+      }
+
+      template<typename PackViewType, typename ViewType, typename EntryViewType>
+      KOKKOS_INLINE_FUNCTION
+      typename std::enable_if<PackViewType::rank == 1,void>::type
+      scatter(const PackViewType &ap, const ViewType &A,
+              const EntryViewType &entries, const int begin, const int count) {
+        const int m = ap.extent(0);
+        for (int l=0;l<count;++l) {
+          const int b = entries(begin + l);
+          for (int i=0;i<m;++i)
+            A(b,i) = ap(i)[l];
+        }
+      }
+
+      ///
+      /// Gemm
+      ///
+      template<typename ArgTransA, typename ArgTransB,
+               typename ScalarType, typename AViewType, typename BViewType, typename CViewType,
+               typename BatchType>
+      struct GemmFunctor {
+        ScalarType _alpha, _beta;
+        AViewType _a; BViewType _b; CViewType _c;
+        typename BatchType::size_array_type _sizes;
+        typename BatchType::index_array_type _entries;
+
+        GemmFunctor(const BatchType &batch, const typename BatchType::index_array_type &entries,
+                    const ScalarType alpha, const AViewType &a, const BViewType &b,
+                    const ScalarType beta, const CViewType &c)
+          : _alpha(alpha), _beta(beta), _a(a), _b(b), _c(c),
+            _sizes(batch.Sizes()), _entries(entries) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int i) const {
+          const int e = _entries(i), m = _sizes(e,0), n = _sizes(e,1), k = _sizes(e,2);
+          auto aa = Kokkos::subview(_a, e, OpExtent<ArgTransA>::range0(m,k), OpExtent<ArgTransA>::range1(m,k));
+          auto bb = Kokkos::subview(_b, e, OpExtent<ArgTransB>::range0(k,n), OpExtent<ArgTransB>::range1(k,n));
+          auto cc = Kokkos::subview(_c, e, Kokkos::pair<int,int>(0,m), Kokkos::pair<int,int>(0,n));
+
+          SerialGemm<ArgTransA,ArgTransB,Algo::Gemm::Blocked>::
+            invoke(_alpha, aa, bb, _beta, cc);
+        }
+      };
+
+      template<typename ArgTransA, typename ArgTransB,
+               typename ScalarType, typename AViewType, typename BViewType, typename CViewType,
+               typename BatchType, typename WorkViewType>
+      struct GemmSIMDFunctor {
+        typedef typename WorkViewType::non_const_value_type vector_type;
+        typedef UnmanagedViewType<Kokkos::View<vector_type**,Kokkos::LayoutRight,
+                                               typename WorkViewType::device_type> > pack_view_type;
+
+        ScalarType _alpha, _beta;
+        AViewType _a; BViewType _b; CViewType _c;
+        typename BatchType::index_array_type _entries;
+        pack_array_type _packs;
+        WorkViewType _work;
+
+        GemmSIMDFunctor(const BatchType &batch, const pack_array_type &packs,
+                        const ScalarType alpha, const AViewType &a, const BViewType &b,
+                        const ScalarType beta, const CViewType &c,
+                        const WorkViewType &work)
+          : _alpha(alpha), _beta(beta), _a(a), _b(b), _c(c),
+            _entries(batch.Entries()), _packs(packs), _work(work) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int q) const {
+          const Kokkos::pair<int,int> range = chunk_range(q, _work.extent(0), _packs.extent(0));
+          for (int p=range.first;p<range.second;++p) {
+            const int begin = _packs(p,0), count = _packs(p,1);
+            const int m = _packs(p,2), n = _packs(p,3), k = _packs(p,4);
+            const int
+              am = OpExtent<ArgTransA>::range0(m,k).second, an = OpExtent<ArgTransA>::range1(m,k).second,
+              bm = OpExtent<ArgTransB>::range0(k,n).second, bn = OpExtent<ArgTransB>::range1(k,n).second;
+
+            // the workspace of the chunk holds the pack at the bucket size
+            vector_type *w = _work.data() + q*_work.stride_0();
+            pack_view_type aa(w, am, an), bb(w + am*an, bm, bn), cc(w + am*an + bm*bn, m, n);
+
+            gather(aa, _a, _entries, begin, count);
+            gather(bb, _b, _entries, begin, count);
+            if (_beta != ScalarType(0))
+              gather(cc, _c, _entries, begin, count);
+
+            SerialGemm<ArgTransA,ArgTransB,Algo::Gemm::Blocked>::
+              invoke(_alpha, aa, bb, _beta, cc);
+
+            scatter(cc, _c, _entries, begin, count);
+          }
+        }
+      };
+
+      ///
+      /// Gemv
+      ///
+      template<typename ArgTrans,
+               typename ScalarType, typename AViewType, typename xViewType, typename yViewType,
+               typename BatchType>
+      struct GemvFunctor {
+        ScalarType _alpha, _beta;
+        AViewType _a; xViewType _x; yViewType _y;
+        typename BatchType::size_array_type _sizes;
+        typename BatchType::index_array_type _entries;
+
+        GemvFunctor(const BatchType &batch, const typename BatchType::index_array_type &entries,
+                    const ScalarType alpha, const AViewType &a, const xViewType &x,
+                    const ScalarType beta, const yViewType &y)
+          : _alpha(alpha), _beta(beta), _a(a), _x(x), _y(y),
+            _sizes(batch.Sizes()), _entries(entries) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int i) const {
+          const int e = _entries(i), m = _sizes(e,0), n = _sizes(e,1);
+          const bool trans = std::is_same<ArgTrans,Trans::Transpose>::value;
+          auto aa = Kokkos::subview(_a, e, Kokkos::pair<int,int>(0,m), Kokkos::pair<int,int>(0,n));
+          auto xx = Kokkos::subview(_x, e, Kokkos::pair<int,int>(0,trans ? m : n));
+          auto yy = Kokkos::subview(_y, e, Kokkos::pair<int,int>(0,trans ? n : m));
+
+          SerialGemv<ArgTrans,Algo::Gemv::Blocked>::
+            invoke(_alpha, aa, xx, _beta, yy);
+        }
+      };
+
+      template<typename ArgTrans,
+               typename ScalarType, typename AViewType, typename xViewType, typename yViewType,
+               typename BatchType, typename WorkViewType>
+      struct GemvSIMDFunctor {
+        typedef typename WorkViewType::non_const_value_type vector_type;
+        typedef UnmanagedViewType<Kokkos::View<vector_type**,Kokkos::LayoutRight,
+                                               typename WorkViewType::device_type> > pack_view_type;
+        typedef UnmanagedViewType<Kokkos::View<vector_type*,Kokkos::LayoutRight,
+                                               typename WorkViewType::device_type> > pack_vector_view_type;
+
+        ScalarType _alpha, _beta;
+        AViewType _a; xViewType _x; yViewType _y;
+        typename BatchType::index_array_type _entries;
+        pack_array_type _packs;
+        WorkViewType _work;
+
+        GemvSIMDFunctor(const BatchType &batch, const pack_array_type &packs,
+                        const ScalarType alpha, const AViewType &a, const xViewType &x,
+                        const ScalarType beta, const yViewType &y,
+                        const WorkViewType &work)
+          : _alpha(alpha), _beta(beta), _a(a), _x(x), _y(y),
+            _entries(batch.Entries()), _packs(packs), _work(work) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int q) const {
+          const bool trans = std::is_same<ArgTrans,Trans::Transpose>::value;
+          const Kokkos::pair<int,int> range = chunk_range(q, _work.extent(0), _packs.extent(0));
+          for (int p=range.first;p<range.second;++p) {
+            const int begin = _packs(p,0), count = _packs(p,1);
+            const int m = _packs(p,2), n = _packs(p,3);
+            const int xm = trans ? m : n, ym = trans ? n : m;
+
+            vector_type *w = _work.data() + q*_work.stride_0();
+            pack_view_type aa(w, m, n);
+            pack_vector_view_type xx(w + m*n, xm), yy(w + m*n + xm, ym);
+
+            gather(aa, _a, _entries, begin, count);
+            gather(xx, _x, _entries, begin, count);
+            if (_beta != ScalarType(0))
+              gather(yy, _y, _entries, begin, count);
+
+            SerialGemv<ArgTrans,Algo::Gemv::Blocked>::
+              invoke(_alpha, aa, xx, _beta, yy);
+
+            scatter(yy, _y, _entries, begin, count);
+          }
+        }
+      };
+
+      ///
+      /// LU
+      ///
+      template<typename AViewType,
+               typename BatchType>
+      struct LUFunctor {
+        AViewType _a;
+        typename BatchType::size_array_type _sizes;
+        typename BatchType::index_array_type _entries;
+
+        LUFunctor(const BatchType &batch, const typename BatchType::index_array_type &entries,
+                  const AViewType &a)
+          : _a(a), _sizes(batch.Sizes()), _entries(entries) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int i) const {
+          const int e = _entries(i), m = _sizes(e,0);
+          auto aa = Kokkos::subview(_a, e, Kokkos::pair<int,int>(0,m), Kokkos::pair<int,int>(0,m));
+
+          SerialLU<Algo::LU::Blocked>::invoke(aa);
+        }
+      };
+
+      template<typename AViewType,
+               typename BatchType, typename WorkViewType>
+      struct LUSIMDFunctor {
+        typedef typename WorkViewType::non_const_value_type vector_type;
+        typedef UnmanagedViewType<Kokkos::View<vector_type**,Kokkos::LayoutRight,
+                                               typename WorkViewType::device_type> > pack_view_type;
+
+        AViewType _a;
+        typename BatchType::index_array_type _entries;
+        pack_array_type _packs;
+        WorkViewType _work;
+
+        LUSIMDFunctor(const BatchType &batch, const pack_array_type &packs,
+                      const AViewType &a, const WorkViewType &work)
+          : _a(a), _entries(batch.Entries()), _packs(packs), _work(work) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int q) const {
+          const Kokkos::pair<int,int> range = chunk_range(q, _work.extent(0), _packs.extent(0));
+          for (int p=range.first;p<range.second;++p) {
+            const int begin = _packs(p,0), count = _packs(p,1), m = _packs(p,2);
+            pack_view_type aa(_work.data() + q*_work.stride_0(), m, m);
+
+            gather(aa, _a, _entries, begin, count);
+            SerialLU<Algo::LU::Blocked>::invoke(aa);
+            scatter(aa, _a, _entries, begin, count);
+          }
+        }
+      };
+
+      ///
+      /// Trsv
+      ///
+      template<typename ArgUplo, typename ArgTrans, typename ArgDiag,
+               typename ScalarType, typename AViewType, typename bViewType,
+               typename BatchType>
+      struct TrsvFunctor {
+        ScalarType _alpha;
+        AViewType _a; bViewType _b;
+        typename BatchType::size_array_type _sizes;
+        typename BatchType::index_array_type _entries;
+
+        TrsvFunctor(const BatchType &batch, const typename BatchType::index_array_type &entries,
+                    const ScalarType alpha, const AViewType &a, const bViewType &b)
+          : _alpha(alpha), _a(a), _b(b), _sizes(batch.Sizes()), _entries(entries) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int i) const {
+          const int e = _entries(i), m = _sizes(e,0);
+          auto aa = Kokkos::subview(_a, e, Kokkos::pair<int,int>(0,m), Kokkos::pair<int,int>(0,m));
+          auto bb = Kokkos::subview(_b, e, Kokkos::pair<int,int>(0,m));
+
+          SerialTrsv<ArgUplo,ArgTrans,ArgDiag,Algo::Trsv::Blocked>::
+            invoke(_alpha, aa, bb);
+        }
+      };
+
+      template<typename ArgUplo, typename ArgTrans, typename ArgDiag,
+               typename ScalarType, typename AViewType, typename bViewType,
+               typename BatchType, typename WorkViewType>
+      struct TrsvSIMDFunctor {
+        typedef typename WorkViewType::non_const_value_type vector_type;
+        typedef UnmanagedViewType<Kokkos::View<vector_type**,Kokkos::LayoutRight,
+                                               typename WorkViewType::device_type> > pack_view_type;
+        typedef UnmanagedViewType<Kokkos::View<vector_type*,Kokkos::LayoutRight,
+                                               typename WorkViewType::device_type> > pack_vector_view_type;
+
+        ScalarType _alpha;
+        AViewType _a; bViewType _b;
+        typename BatchType::index_array_type _entries;
+        pack_array_type _packs;
+        WorkViewType _work;
+
+        TrsvSIMDFunctor(const BatchType &batch, const pack_array_type &packs,
+                        const ScalarType alpha, const AViewType &a, const bViewType &b,
+                        const WorkViewType &work)
+          : _alpha(alpha), _a(a), _b(b),
+            _entries(batch.Entries()), _packs(packs), _work(work) {}
+
+        KOKKOS_INLINE_FUNCTION
+        void operator()(const int q) const {
+          const Kokkos::pair<int,int> range = chunk_range(q, _work.extent(0), _packs.extent(0));
+          for (int p=range.first;p<range.second;++p) {
+            const int begin = _packs(p,0), count = _packs(p,1), m = _packs(p,2);
+
+            vector_type *w = _work.data() + q*_work.stride_0();
+            pack_view_type aa(w, m, m);
+            pack_vector_view_type bb(w + m*m, m);
+
+            gather(aa, _a, _entries, begin, count);
+            gather(bb, _b, _entries, begin, count);
+
+            SerialTrsv<ArgUplo,ArgTrans,ArgDiag,Algo::Trsv::Blocked>::
+              invoke(_alpha, aa, bb);
+
+            scatter(bb, _b, _entries, begin, count);
+          }
+        }
+      };
+
+      ///
+      /// SerialSIMD launch; the packs are cut into chunks of consecutive packs
+      /// (GemmBatchedImpl::chunk_range), a few per thread, and each chunk
+      /// stages its packs one by one through its own workspace, large enough
+      /// for the largest group and viewed at the group size of every pack
+      ///
+      template<bool is_simd_available>
+      struct SerialSIMDInvoke {
+        template<typename ArgTransA, typename ArgTransB,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename BViewType, typename CViewType>
+        static int gemm(const VariableBatch<DeviceType> &, const group_array_type &,
+                        const ScalarType, const AViewType &, const BViewType &,
+                        const ScalarType, const CViewType &) {
+          return -1;
+        }
+        template<typename ArgTrans,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename xViewType, typename yViewType>
+        static int gemv(const VariableBatch<DeviceType> &, const group_array_type &,
+                        const ScalarType, const AViewType &, const xViewType &,
+                        const ScalarType, const yViewType &) {
+          return -1;
+        }
+        template<typename DeviceType, typename AViewType>
+        static int lu(const VariableBatch<DeviceType> &, const group_array_type &, const AViewType &) {
+          return -1;
+        }
+        template<typename ArgUplo, typename ArgTrans, typename ArgDiag,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename bViewType>
+        static int trsv(const VariableBatch<DeviceType> &, const group_array_type &,
+                        const ScalarType, const AViewType &, const bViewType &) {
+          return -1;
+        }
+      };
+
+      template<>
+      struct SerialSIMDInvoke<true> {
+        template<typename ViewType, int isa>
+        struct PackTypes {
+          typedef typename ViewType::execution_space exec_space;
+          typedef typename ViewType::non_const_value_type value_type;
+          typedef typename InstructionSetVector<value_type,isa>::type vector_type;
+          typedef Kokkos::View<vector_type**,Kokkos::LayoutRight,exec_space> work_view_type;
+          typedef Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Dynamic> > policy_type;
+
+          // chunks are scheduled dynamically as the bucket sizes differ
+          enum : int { chunks_per_thread = 4 };
+
+          // a workspace of len vectors for each chunk
+          static work_view_type workspace(const char *label, const int npack, const int len) {
+            return work_view_type(Kokkos::ViewAllocateWithoutInitializing(label),
+                                  num_chunks<exec_space>(npack, chunks_per_thread), len);
+          }
+        };
+
+        template<int isa,
+                 typename ArgTransA, typename ArgTransB,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename BViewType, typename CViewType>
+        static int gemm_run(const VariableBatch<DeviceType> &batch, const group_array_type &groups,
+                            const ScalarType alpha, const AViewType &A, const BViewType &B,
+                            const ScalarType beta, const CViewType &C) {
+          typedef PackTypes<CViewType,isa> types;
+          const int m = max_group_size(groups, 0), n = max_group_size(groups, 1), k = max_group_size(groups, 2);
+
+          const pack_array_type packs = make_packs(groups, types::vector_type::vector_length);
+          const int npack = packs.extent(0);
+
+          const typename types::work_view_type work =
+            types::workspace("VariableBatched::SIMD::Gemm", npack, m*k + k*n + m*n);
+
+          typedef GemmSIMDFunctor<ArgTransA,ArgTransB,ScalarType,AViewType,BViewType,CViewType,
+                                  VariableBatch<DeviceType>,typename types::work_view_type> functor_type;
+          Kokkos::parallel_for("KokkosBatched::VariableBatched::Gemm::SerialSIMD",
+                               typename types::policy_type(0, work.extent(0)),
+                               InstructionSetFunctor<functor_type,isa>
+                               (functor_type(batch, packs, alpha, A, B, beta, C, work)));
+          return 0;
+        }
+
+        template<int isa,
+                 typename ArgTrans,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename xViewType, typename yViewType>
+        static int gemv_run(const VariableBatch<DeviceType> &batch, const group_array_type &groups,
+                            const ScalarType alpha, const AViewType &A, const xViewType &x,
+                            const ScalarType beta, const yViewType &y) {
+          typedef PackTypes<yViewType,isa> types;
+          const int m = max_group_size(groups, 0), n = max_group_size(groups, 1);
+
+          const pack_array_type packs = make_packs(groups, types::vector_type::vector_length);
+          const int npack = packs.extent(0);
+
+          const typename types::work_view_type work =
+            types::workspace("VariableBatched::SIMD::Gemv", npack, m*n + m + n);
+
+          typedef GemvSIMDFunctor<ArgTrans,ScalarType,AViewType,xViewType,yViewType,
+                                  VariableBatch<DeviceType>,typename types::work_view_type> functor_type;
+          Kokkos::parallel_for("KokkosBatched::VariableBatched::Gemv::SerialSIMD",
+                               typename types::policy_type(0, work.extent(0)),
+                               InstructionSetFunctor<functor_type,isa>
+                               (functor_type(batch, packs, alpha, A, x, beta, y, work)));
+          return 0;
+        }
+
+        template<int isa,
+                 typename DeviceType, typename AViewType>
+        static int lu_run(const VariableBatch<DeviceType> &batch, const group_array_type &groups, const AViewType &A) {
+          typedef PackTypes<AViewType,isa> types;
+          const int m = max_group_size(groups, 0);
+
+          const pack_array_type packs = make_packs(groups, types::vector_type::vector_length);
+          const int npack = packs.extent(0);
+
+          const typename types::work_view_type work =
+            types::workspace("VariableBatched::SIMD::LU", npack, m*m);
+
+          typedef LUSIMDFunctor<AViewType,VariableBatch<DeviceType>,typename types::work_view_type> functor_type;
+          Kokkos::parallel_for("KokkosBatched::VariableBatched::LU::SerialSIMD",
+                               typename types::policy_type(0, work.extent(0)),
+                               InstructionSetFunctor<functor_type,isa>
+                               (functor_type(batch, packs, A, work)));
+          return 0;
+        }
+
+        template<int isa,
+                 typename ArgUplo, typename ArgTrans, typename ArgDiag,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename bViewType>
+        static int trsv_run(const VariableBatch<DeviceType> &batch, const group_array_type &groups,
+                            const ScalarType alpha, const AViewType &A, const bViewType &b) {
+          typedef PackTypes<bViewType,isa> types;
+          const int m = max_group_size(groups, 0);
+
+          const pack_array_type packs = make_packs(groups, types::vector_type::vector_length);
+          const int npack = packs.extent(0);
+
+          const typename types::work_view_type work =
+            types::workspace("VariableBatched::SIMD::Trsv", npack, m*m + m);
+
+          typedef TrsvSIMDFunctor<ArgUplo,ArgTrans,ArgDiag,ScalarType,AViewType,bViewType,
+                                  VariableBatch<DeviceType>,typename types::work_view_type> functor_type;
+          Kokkos::parallel_for("KokkosBatched::VariableBatched::Trsv::SerialSIMD",
+                               typename types::policy_type(0, work.extent(0)),
+                               InstructionSetFunctor<functor_type,isa>
+                               (functor_type(batch, packs, alpha, A, b, work)));
+          return 0;
+        }
+
+        // dispatch to the active instruction set
+        template<typename ArgTransA, typename ArgTransB,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename BViewType, typename CViewType>
+        static int gemm(const VariableBatch<DeviceType> &batch, const group_array_type &groups,
+                        const ScalarType alpha, const AViewType &A, const BViewType &B,
+                        const ScalarType beta, const CViewType &C) {
+          switch (active_instruction_set()) {
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__)
+          case InstructionSet::AVX512: return gemm_run<InstructionSet::AVX512,ArgTransA,ArgTransB>(batch, groups, alpha, A, B, beta, C);
+          case InstructionSet::AVX2:   return gemm_run<InstructionSet::AVX2,ArgTransA,ArgTransB>(batch, groups, alpha, A, B, beta, C);
+          case InstructionSet::AVX:    return gemm_run<InstructionSet::AVX,ArgTransA,ArgTransB>(batch, groups, alpha, A, B, beta, C);
+#endif
+          default: break;
+          }
+          return gemm_run<InstructionSet::Compiled,ArgTransA,ArgTransB>(batch, groups, alpha, A, B, beta, C);
+        }
+
+        template<typename ArgTrans,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename xViewType, typename yViewType>
+        static int gemv(const VariableBatch<DeviceType> &batch, const group_array_type &groups,
+                        const ScalarType alpha, const AViewType &A, const xViewType &x,
+                        const ScalarType beta, const yViewType &y) {
+          switch (active_instruction_set()) {
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__)
+          case InstructionSet::AVX512: return gemv_run<InstructionSet::AVX512,ArgTrans>(batch, groups, alpha, A, x, beta, y);
+          case InstructionSet::AVX2:   return gemv_run<InstructionSet::AVX2,ArgTrans>(batch, groups, alpha, A, x, beta, y);
+          case InstructionSet::AVX:    return gemv_run<InstructionSet::AVX,ArgTrans>(batch, groups, alpha, A, x, beta, y);
+#endif
+          default: break;
+          }
+          return gemv_run<InstructionSet::Compiled,ArgTrans>(batch, groups, alpha, A, x, beta, y);
+        }
+
+        template<typename DeviceType, typename AViewType>
+        static int lu(const VariableBatch<DeviceType> &batch, const group_array_type &groups, const AViewType &A) {
+          switch (active_instruction_set()) {
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__)
+          case InstructionSet::AVX512: return lu_run<InstructionSet::AVX512>(batch, groups, A);
+          case InstructionSet::AVX2:   return lu_run<InstructionSet::AVX2>(batch, groups, A);
+          case InstructionSet::AVX:    return lu_run<InstructionSet::AVX>(batch, groups, A);
+#endif
+          default: break;
+          }
+          return lu_run<InstructionSet::Compiled>(batch, groups, A);
+        }
+
+        template<typename ArgUplo, typename ArgTrans, typename ArgDiag,
+                 typename DeviceType, typename ScalarType,
+                 typename AViewType, typename bViewType>
+        static int trsv(const VariableBatch<DeviceType> &batch, const group_array_type &groups,
+                        const ScalarType alpha, const AViewType &A, const bViewType &b) {
+          switch (active_instruction_set()) {
+#if defined(__KOKKOSBATCHED_ENABLE_MULTIVERSION__)
+          case InstructionSet::AVX512: return trsv_run<InstructionSet::AVX512,ArgUplo,ArgTrans,ArgDiag>(batch, groups, alpha, A, b);
+          case InstructionSet::AVX2:   return trsv_run<InstructionSet::AVX2,ArgUplo,ArgTrans,ArgDiag>(batch, groups, alpha, A, b);
+          case InstructionSet::AVX:    return trsv_run<InstructionSet::AVX,ArgUplo,ArgTrans,ArgDiag>(batch, groups, alpha, A, b);
+#endif
+          default: break;
+          }
+          return trsv_run<InstructionSet::Compiled,ArgUplo,ArgTrans,ArgDiag>(batch, groups, alpha, A, b);
+        }
+      };
+
+      // every view of the batch has an entry per problem and holds the largest problem
+      template<typename DeviceType, typename ViewType>
+      inline
+      void check(const char *label, const char *name,
+                 const VariableBatch<DeviceType> &batch, const ViewType &V,
+                 const int rows, const int cols = 1) {
+        const bool is_matrix = (ViewType::rank == 3);
+        if (int(V.extent(0)) != batch.NumEntries() ||
+            int(V.extent(1)) < rows ||
+            (is_matrix && int(V.extent(2)) < cols)) {
+          std::ostringstream os;
+          os << "KokkosBatched::VariableBatched (" << label << "): " << name << " is "
+             << V.extent(0) << " x " << V.extent(1);
+          if (is_matrix) os << " x " << V.extent(2);
+          os << ", but the batch needs at least " << batch.NumEntries() << " x " << rows;
+          if (is_matrix) os << " x " << cols;
+          Kokkos::Impl::throw_runtime_exception(os.str());
+        }
+      }
+
+    } // end VariableBatchedImpl
+
+    template<typename ArgTransA, typename ArgTransB>
+    template<typename DeviceType,
+             typename ScalarType,
+             typename AViewType,
+             typename BViewType,
+             typename CViewType>
+    int
+    VariableGemmBatched<ArgTransA,ArgTransB>::
+    invoke(const VariableBatch<DeviceType> &batch,
+           const ScalarType alpha,
+           const AViewType &A,
+           const BViewType &B,
+           const ScalarType beta,
+           const CViewType &C,
+           const int mode) {
+      typedef typename CViewType::execution_space exec_space;
+      typedef typename CViewType::non_const_value_type value_type;
+
+      static_assert(AViewType::rank == 3, "KokkosBatched::VariableBatched: A must have rank 3 (batch, row, column).");
+      static_assert(BViewType::rank == 3, "KokkosBatched::VariableBatched: B must have rank 3 (batch, row, column).");
+      static_assert(CViewType::rank == 3, "KokkosBatched::VariableBatched: C must have rank 3 (batch, row, column).");
+
+      const int m = batch.MaxSize(0), n = batch.MaxSize(1), k = batch.MaxSize(2);
+      VariableBatchedImpl::check("gemm", "A", batch, A,
+                                 VariableBatchedImpl::OpExtent<ArgTransA>::range0(m,k).second,
+                                 VariableBatchedImpl::OpExtent<ArgTransA>::range1(m,k).second);
+      VariableBatchedImpl::check("gemm", "B", batch, B,
+                                 VariableBatchedImpl::OpExtent<ArgTransB>::range0(k,n).second,
+                                 VariableBatchedImpl::OpExtent<ArgTransB>::range1(k,n).second);
+      VariableBatchedImpl::check("gemm", "C", batch, C, m, n);
+
+      const int nentries = batch.NumEntries();
+      if (nentries == 0) return 0;
+
+      typename VariableBatch<DeviceType>::index_array_type serial_entries;
+      VariableBatchedImpl::group_array_type simd_groups;
+      if (VariableBatchedImpl::select<value_type,exec_space>(batch, 3, mode, serial_entries, simd_groups))
+        return -1;
+
+      int r_val = 0;
+      if (simd_groups.extent(0) > 0)
+        r_val = VariableBatchedImpl::SerialSIMDInvoke<VariableBatchedImpl::SIMDAvailable<value_type,exec_space>::value>::
+          template gemm<ArgTransA,ArgTransB>(batch, simd_groups, alpha, A, B, beta, C);
+      if (r_val == 0 && serial_entries.extent(0) > 0) {
+        const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Dynamic> > policy(0, serial_entries.extent(0));
+        Kokkos::parallel_for("KokkosBatched::VariableBatched::Gemm::Serial", policy,
+                             VariableBatchedImpl::GemmFunctor<ArgTransA,ArgTransB,ScalarType,
+                             AViewType,BViewType,CViewType,VariableBatch<DeviceType> >(batch, serial_entries, alpha, A, B, beta, C));
+      }
+      return r_val;
+    }
+
+    template<typename ArgTrans>
+    template<typename DeviceType,
+             typename ScalarType,
+             typename AViewType,
+             typename xViewType,
+             typename yViewType>
+    int
+    VariableGemvBatched<ArgTrans>::
+    invoke(const VariableBatch<DeviceType> &batch,
+           const ScalarType alpha,
+           const AViewType &A,
+           const xViewType &x,
+           const ScalarType beta,
+           const yViewType &y,
+           const int mode) {
+      typedef typename yViewType::execution_space exec_space;
+      typedef typename yViewType::non_const_value_type value_type;
+
+      static_assert(AViewType::rank == 3, "KokkosBatched::VariableBatched: A must have rank 3 (batch, row, column).");
+      static_assert(xViewType::rank == 2, "KokkosBatched::VariableBatched: x must have rank 2 (batch, row).");
+      static_assert(yViewType::rank == 2, "KokkosBatched::VariableBatched: y must have rank 2 (batch, row).");
+
+      const int m = batch.MaxSize(0), n = batch.MaxSize(1);
+      const bool trans = std::is_same<ArgTrans,Trans::Transpose>::value;
+      VariableBatchedImpl::check("gemv", "A", batch, A, m, n);
+      VariableBatchedImpl::check("gemv", "x", batch, x, trans ? m : n);
+      VariableBatchedImpl::check("gemv", "y", batch, y, trans ? n : m);
+
+      const int nentries = batch.NumEntries();
+      if (nentries == 0) return 0;
+
+      typename VariableBatch<DeviceType>::index_array_type serial_entries;
+      VariableBatchedImpl::group_array_type simd_groups;
+      if (VariableBatchedImpl::select<value_type,exec_space>(batch, 2, mode, serial_entries, simd_groups))
+        return -1;
+
+      int r_val = 0;
+      if (simd_groups.extent(0) > 0)
+        r_val = VariableBatchedImpl::SerialSIMDInvoke<VariableBatchedImpl::SIMDAvailable<value_type,exec_space>::value>::
+          template gemv<ArgTrans>(batch, simd_groups, alpha, A, x, beta, y);
+      if (r_val == 0 && serial_entries.extent(0) > 0) {
+        const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Dynamic> > policy(0, serial_entries.extent(0));
+        Kokkos::parallel_for("KokkosBatched::VariableBatched::Gemv::Serial", policy,
+                             VariableBatchedImpl::GemvFunctor<ArgTrans,ScalarType,
+                             AViewType,xViewType,yViewType,VariableBatch<DeviceType> >(batch, serial_entries, alpha, A, x, beta, y));
+      }
+      return r_val;
+    }
+
+    template<typename DeviceType,
+             typename AViewType>
+    int
+    VariableLUBatched::
+    invoke(const VariableBatch<DeviceType> &batch,
+           const AViewType &A,
+           const int mode) {
+      typedef typename AViewType::execution_space exec_space;
+      typedef typename AViewType::non_const_value_type value_type;
+
+      static_assert(AViewType::rank == 3, "KokkosBatched::VariableBatched: A must have rank 3 (batch, row, column).");
+
+      const int m = batch.MaxSize(0);
+      VariableBatchedImpl::check("lu", "A", batch, A, m, m);
+
+      const int nentries = batch.NumEntries();
+      if (nentries == 0) return 0;
+
+      typename VariableBatch<DeviceType>::index_array_type serial_entries;
+      VariableBatchedImpl::group_array_type simd_groups;
+      if (VariableBatchedImpl::select<value_type,exec_space>(batch, 1, mode, serial_entries, simd_groups))
+        return -1;
+
+      int r_val = 0;
+      if (simd_groups.extent(0) > 0)
+        r_val = VariableBatchedImpl::SerialSIMDInvoke<VariableBatchedImpl::SIMDAvailable<value_type,exec_space>::value>::
+          lu(batch, simd_groups, A);
+      if (r_val == 0 && serial_entries.extent(0) > 0) {
+        const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Dynamic> > policy(0, serial_entries.extent(0));
+        Kokkos::parallel_for("KokkosBatched::VariableBatched::LU::Serial", policy,
+                             VariableBatchedImpl::LUFunctor<AViewType,VariableBatch<DeviceType> >(batch, serial_entries, A));
+      }
+      return r_val;
+    }
+
+    template<typename ArgUplo, typename ArgTrans, typename ArgDiag>
+    template<typename DeviceType,
+             typename ScalarType,
+             typename AViewType,
+             typename bViewType>
+    int
+    VariableTrsvBatched<ArgUplo,ArgTrans,ArgDiag>::
+    invoke(const VariableBatch<DeviceType> &batch,
+           const ScalarType alpha,
+           const AViewType &A,
+           const bViewType &b,
+           const int mode) {
+      typedef typename bViewType::execution_space exec_space;
+      typedef typename bViewType::non_const_value_type value_type;
+
+      static_assert(AViewType::rank == 3, "KokkosBatched::VariableBatched: A must have rank 3 (batch, row, column).");
+      static_assert(bViewType::rank == 2, "KokkosBatched::VariableBatched: b must have rank 2 (batch, row).");
+
+      const int m = batch.MaxSize(0);
+      VariableBatchedImpl::check("trsv", "A", batch, A, m, m);
+      VariableBatchedImpl::check("trsv", "b", batch, b, m);
+
+      const int nentries = batch.NumEntries();
+      if (nentries == 0) return 0;
+
+      typename VariableBatch<DeviceType>::index_array_type serial_entries;
+      VariableBatchedImpl::group_array_type simd_groups;
+      if (VariableBatchedImpl::select<value_type,exec_space>(batch, 1, mode, serial_entries, simd_groups))
+        return -1;
+
+      int r_val = 0;
+      if (simd_groups.extent(0) > 0)
+        r_val = VariableBatchedImpl::SerialSIMDInvoke<VariableBatchedImpl::SIMDAvailable<value_type,exec_space>::value>::
+          template trsv<ArgUplo,ArgTrans,ArgDiag>(batch, simd_groups, alpha, A, b);
+      if (r_val == 0 && serial_entries.extent(0) > 0) {
+        const Kokkos::RangePolicy<exec_space,Kokkos::Schedule<Kokkos::Dynamic> > policy(0, serial_entries.extent(0));
+        Kokkos::parallel_for("KokkosBatched::VariableBatched::Trsv::Serial", policy,
+                             VariableBatchedImpl::TrsvFunctor<ArgUplo,ArgTrans,ArgDiag,ScalarType,
+                             AViewType,bViewType,VariableBatch<DeviceType> >(batch, serial_entries, alpha, A, b));
+      }
+      return r_val;
+    }
+
+  }
+}
+
+#endif
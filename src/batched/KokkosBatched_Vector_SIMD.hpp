@@ -121,6 +121,21 @@ namespace KokkosBatched {
         storeAligned(p);
       }
 
+      /// partial vectors: the first n lanes are loaded (the others are
+      /// zeroed) or stored, 0 <= n <= vector_length; p[n:] is not accessed
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        for (int i=0;i<vector_length;++i)
+          _data[i] = i < n ? p[i] : value_type(0);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        for (int i=0;i<n;++i)
+          p[i] = _data[i];
+      }
+
       KOKKOS_INLINE_FUNCTION
       value_type& operator[](const int &i) const {
         return _data[i];
@@ -217,6 +232,23 @@ namespace KokkosBatched {
         _mm256_storeu_pd(p, _data);
       }
 
+      /// lane mask of the first n lanes, 0 <= n <= vector_length
+      KOKKOS_INLINE_FUNCTION
+      static __m256i laneMask(const int n) {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_set_pd(3,2,1,0), _mm256_set1_pd(n), _CMP_LT_OQ));
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        _data = _mm256_maskload_pd(p, laneMask(n));
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        _mm256_maskstore_pd(p, laneMask(n), _data);
+      }
+
       KOKKOS_INLINE_FUNCTION
       value_type& operator[](const int &i) const {
         return reinterpret_cast<value_type*>(&_data)[i];
@@ -308,6 +340,229 @@ namespace KokkosBatched {
         _mm256_storeu_pd((mag_type*)p, _data);
       }
 
+      /// lane mask of the first n lanes, 0 <= n <= vector_length
+      KOKKOS_INLINE_FUNCTION
+      static __m256i laneMask(const int n) {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_set_pd(1,1,0,0), _mm256_set1_pd(n), _CMP_LT_OQ));
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        _data = _mm256_maskload_pd((mag_type*)p, laneMask(n));
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        _mm256_maskstore_pd((mag_type*)p, laneMask(n), _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      value_type& operator[](const int &i) const {
+        return reinterpret_cast<value_type*>(&_data)[i];
+      }
+    };
+
+    template<>
+    class Vector<SIMD<float>,8> {
+    public:
+      using type = Vector<SIMD<float>,8>;
+      using value_type = float;
+      using mag_type = float;
+
+      enum : int { vector_length = 8 };
+      typedef __m256 data_type __attribute__ ((aligned(32)));
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX256"; }
+
+      template<typename,int>
+      friend class Vector;
+
+    private:
+      mutable data_type _data;
+
+    public:
+      KOKKOS_INLINE_FUNCTION Vector() { _data = _mm256_setzero_ps(); }
+      KOKKOS_INLINE_FUNCTION Vector(const value_type &val) { _data = _mm256_set1_ps(val); }
+      KOKKOS_INLINE_FUNCTION Vector(const type &b) { _data = b._data; }
+      KOKKOS_INLINE_FUNCTION Vector(const __m256 &val) { _data = val; }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const ArgValueType &val) {
+        auto d = reinterpret_cast<value_type*>(&_data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+        for (int i=0;i<vector_length;++i)
+          d[i] = val;
+      }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const Vector<SIMD<ArgValueType>,vector_length> &b) {
+        static_assert(std::is_convertible<value_type,ArgValueType>::value, "input type is not convertible");
+	auto dd = reinterpret_cast<value_type*>(&_data);
+	auto bb = reinterpret_cast<ArgValueType*>(&b._data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+	for (int i=0;i<vector_length;++i)
+	  dd[i] = bb[i];
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& operator=(const __m256 &val) {
+        _data = val;
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      operator __m256() const {
+        return _data;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadAligned(const value_type *p) {
+        _data = _mm256_load_ps(p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadUnaligned(const value_type *p) {
+        _data = _mm256_loadu_ps(p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeAligned(value_type *p) const {
+        _mm256_store_ps(p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeUnaligned(value_type *p) const {
+        _mm256_storeu_ps(p, _data);
+      }
+
+      /// lane mask of the first n lanes, 0 <= n <= vector_length
+      KOKKOS_INLINE_FUNCTION
+      static __m256i laneMask(const int n) {
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_set_ps(7,6,5,4,3,2,1,0), _mm256_set1_ps(n), _CMP_LT_OQ));
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        _data = _mm256_maskload_ps(p, laneMask(n));
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        _mm256_maskstore_ps(p, laneMask(n), _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      value_type& operator[](const int &i) const {
+        return reinterpret_cast<value_type*>(&_data)[i];
+      }
+    };
+
+    template<>
+    class Vector<SIMD<Kokkos::complex<float> >,4> {
+    public:
+      using type = Vector<SIMD<Kokkos::complex<float> >,4>;
+      using value_type = Kokkos::complex<float>;
+      using mag_type = float;
+
+      static const int vector_length = 4;
+      typedef __m256 data_type __attribute__ ((aligned(32)));
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX256"; }
+      
+      template<typename,int>
+      friend class Vector;
+
+    private:
+      mutable data_type _data;
+
+    public:
+      KOKKOS_INLINE_FUNCTION Vector() { _data = _mm256_setzero_ps(); }
+      KOKKOS_INLINE_FUNCTION Vector(const value_type &val) { _data = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&val)); }
+      KOKKOS_INLINE_FUNCTION Vector(const mag_type &val) { const value_type a(val); _data = _mm256_castpd_ps(_mm256_broadcast_sd((const double*)&a)); }
+      KOKKOS_INLINE_FUNCTION Vector(const type &b) { _data = b._data; }
+      KOKKOS_INLINE_FUNCTION Vector(const __m256 &val) { _data = val; }
+      
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const Vector<SIMD<ArgValueType>,vector_length> &b) {
+        static_assert(std::is_convertible<value_type,ArgValueType>::value, "input type is not convertible");
+	auto dd = reinterpret_cast<value_type*>(&_data);
+	auto bb = reinterpret_cast<ArgValueType*>(&b._data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+	for (int i=0;i<vector_length;++i)
+	  dd[i] = bb[i];
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& operator=(const __m256 &val) {
+        _data = val;
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      operator __m256() const {
+        return _data;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadAligned(const value_type *p) {
+        _data = _mm256_load_ps((mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadUnaligned(const value_type *p) {
+        _data = _mm256_loadu_ps((mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeAligned(value_type *p) const {
+        _mm256_store_ps((mag_type*)p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeUnaligned(value_type *p) const {
+        _mm256_storeu_ps((mag_type*)p, _data);
+      }
+
+      /// lane mask of the first n lanes, 0 <= n <= vector_length
+      KOKKOS_INLINE_FUNCTION
+      static __m256i laneMask(const int n) {
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_set_ps(3,3,2,2,1,1,0,0), _mm256_set1_ps(n), _CMP_LT_OQ));
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        _data = _mm256_maskload_ps((mag_type*)p, laneMask(n));
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        _mm256_maskstore_ps((mag_type*)p, laneMask(n), _data);
+      }
+
       KOKKOS_INLINE_FUNCTION
       value_type& operator[](const int &i) const {
         return reinterpret_cast<value_type*>(&_data)[i];
@@ -399,6 +654,23 @@ namespace KokkosBatched {
         _mm512_storeu_pd(p, _data);
       }
 
+      /// lane mask of the first n lanes, 0 <= n <= vector_length
+      KOKKOS_INLINE_FUNCTION
+      static __mmask8 laneMask(const int n) {
+        return __mmask8((1u << n) - 1u);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        _data = _mm512_maskz_loadu_pd(laneMask(n), p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        _mm512_mask_storeu_pd(p, laneMask(n), _data);
+      }
+
       KOKKOS_INLINE_FUNCTION
       value_type& operator[](const int &i) const {
         return reinterpret_cast<value_type*>(&_data)[i];
@@ -495,6 +767,243 @@ namespace KokkosBatched {
         _mm512_storeu_pd((mag_type*)p, _data);
       }
 
+      /// lane mask of the first n lanes, 0 <= n <= vector_length
+      KOKKOS_INLINE_FUNCTION
+      static __mmask8 laneMask(const int n) {
+        // two doubles per complex lane
+        return __mmask8((1u << 2*n) - 1u);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        _data = _mm512_maskz_loadu_pd(laneMask(n), (mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        _mm512_mask_storeu_pd((mag_type*)p, laneMask(n), _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      value_type& operator[](const int &i) const {
+        return reinterpret_cast<value_type*>(&_data)[i];
+      }
+    };
+
+    template<>
+    class Vector<SIMD<float>,16> {
+    public:
+      using type = Vector<SIMD<float>,16>;
+      using value_type = float;
+      using mag_type = float;
+      
+      enum : int { vector_length = 16 };
+      typedef __m512 data_type __attribute__ ((aligned(64)));
+
+      template<typename,int>
+      friend class Vector;
+
+    private:
+      mutable data_type _data;
+
+    public:
+      KOKKOS_INLINE_FUNCTION Vector() { _data = _mm512_setzero_ps(); }
+      KOKKOS_INLINE_FUNCTION Vector(const value_type &val) { _data = _mm512_set1_ps(val); }
+      KOKKOS_INLINE_FUNCTION Vector(const type &b) { _data = b._data; }
+      KOKKOS_INLINE_FUNCTION Vector(const __m512 &val) { _data = val; }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const ArgValueType &val) {
+        auto d = reinterpret_cast<value_type*>(&_data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+        for (int i=0;i<vector_length;++i)
+          d[i] = val;
+      }
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const Vector<SIMD<ArgValueType>,vector_length> &b) {
+        static_assert(std::is_convertible<value_type,ArgValueType>::value, "input type is not convertible");
+	auto dd = reinterpret_cast<value_type*>(&_data);
+	auto bb = reinterpret_cast<ArgValueType*>(&b._data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+	for (int i=0;i<vector_length;++i)
+	  dd[i] = bb[i];
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& operator=(const __m512 &val) {
+        _data = val;
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      operator __m512() const {
+        return _data;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadAligned(const value_type *p) {
+        _data = _mm512_load_ps(p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadUnaligned(const value_type *p) {
+        _data = _mm512_loadu_ps(p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeAligned(value_type *p) const {
+        _mm512_store_ps(p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeUnaligned(value_type *p) const {
+        _mm512_storeu_ps(p, _data);
+      }
+
+      /// lane mask of the first n lanes, 0 <= n <= vector_length
+      KOKKOS_INLINE_FUNCTION
+      static __mmask16 laneMask(const int n) {
+        return __mmask16((1u << n) - 1u);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        _data = _mm512_maskz_loadu_ps(laneMask(n), p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        _mm512_mask_storeu_ps(p, laneMask(n), _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      value_type& operator[](const int &i) const {
+        return reinterpret_cast<value_type*>(&_data)[i];
+      }
+    };
+
+    template<>
+    class Vector<SIMD<Kokkos::complex<float> >,8> {
+    public:
+      using type = Vector<SIMD<Kokkos::complex<float> >,8>;
+      using value_type = Kokkos::complex<float>;
+      using mag_type = float;
+
+      enum : int { vector_length = 8 };
+      typedef __m512 data_type __attribute__ ((aligned(64)));
+
+      KOKKOS_INLINE_FUNCTION
+      static const char* label() { return "AVX512"; }
+
+      template<typename,int>
+      friend class Vector;
+
+    private:
+      mutable data_type _data;
+
+    public:
+      KOKKOS_INLINE_FUNCTION Vector() { _data = _mm512_setzero_ps(); }
+      KOKKOS_INLINE_FUNCTION Vector(const value_type &val) {
+        _data = _mm512_mask_blend_ps(0x5555, _mm512_set1_ps(val.imag()), _mm512_set1_ps(val.real()));
+      }
+      KOKKOS_INLINE_FUNCTION Vector(const mag_type &val) {
+        _data = _mm512_mask_blend_ps(0x5555, _mm512_setzero_ps(), _mm512_set1_ps(val));
+      }
+      KOKKOS_INLINE_FUNCTION Vector(const type &b) { _data = b._data; }
+      KOKKOS_INLINE_FUNCTION Vector(const __m512 &val) { _data = val; }
+
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const ArgValueType &val) {
+        auto d = reinterpret_cast<value_type*>(&_data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+        for (int i=0;i<vector_length;++i)
+          d[i] = val;
+      }
+      template<typename ArgValueType>
+      KOKKOS_INLINE_FUNCTION Vector(const Vector<SIMD<ArgValueType>,vector_length> &b) {
+        static_assert(std::is_convertible<value_type,ArgValueType>::value, "input type is not convertible");
+	auto dd = reinterpret_cast<value_type*>(&_data);
+	auto bb = reinterpret_cast<value_type*>(&b._data);
+#if defined( KOKKOS_ENABLE_PRAGMA_IVDEP )
+#pragma ivdep
+#endif
+#if defined( KOKKOS_ENABLE_PRAGMA_VECTOR )
+#pragma vector always
+#endif
+	for (int i=0;i<vector_length;++i)
+	  dd[i] = bb[i];
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& operator=(const __m512 &val) {
+        _data = val;
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      operator __m512() const {
+        return _data;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadAligned(const value_type *p) {
+        _data = _mm512_load_ps((mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadUnaligned(const value_type *p) {
+        _data = _mm512_loadu_ps((mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeAligned(value_type *p) const {
+        _mm512_store_ps((mag_type*)p, _data);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeUnaligned(value_type *p) const {
+        _mm512_storeu_ps((mag_type*)p, _data);
+      }
+
+      /// lane mask of the first n lanes, 0 <= n <= vector_length
+      KOKKOS_INLINE_FUNCTION
+      static __mmask16 laneMask(const int n) {
+        // two floats per complex lane
+        return __mmask16((1u << 2*n) - 1u);
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      type& loadMasked(const value_type *p, const int n) {
+        _data = _mm512_maskz_loadu_ps(laneMask(n), (mag_type*)p);
+        return *this;
+      }
+
+      KOKKOS_INLINE_FUNCTION
+      void storeMasked(value_type *p, const int n) const {
+        _mm512_mask_storeu_ps((mag_type*)p, laneMask(n), _data);
+      }
+
       KOKKOS_INLINE_FUNCTION
       value_type& operator[](const int &i) const {
         return reinterpret_cast<value_type*>(&_data)[i];
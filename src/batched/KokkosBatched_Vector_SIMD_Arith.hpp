@@ -31,6 +31,22 @@ namespace KokkosBatched {
     }
 #endif
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    operator + (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_add_ps(a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator + (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_add_ps(a, b);
+    }
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
     KOKKOS_FORCEINLINE_FUNCTION
@@ -49,6 +65,22 @@ namespace KokkosBatched {
     }
 #endif
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    operator + (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_add_ps(a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator + (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      return _mm256_add_ps(a, b);
+    }
+#endif
+
 #endif
 #endif
 
@@ -200,6 +232,22 @@ namespace KokkosBatched {
     }
 #endif
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    operator - (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_sub_ps(a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator - (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_sub_ps(a, b);
+    }
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
     KOKKOS_FORCEINLINE_FUNCTION
@@ -218,6 +266,22 @@ namespace KokkosBatched {
     }
 #endif
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    operator - (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_sub_ps(a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator - (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      return _mm256_sub_ps(a, b);
+    }
+#endif
+
 #endif
 #endif
 
@@ -402,6 +466,34 @@ namespace KokkosBatched {
     }
 #endif
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    operator * (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_mul_ps(a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator * (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      const __m512
+        as = _mm512_permute_ps(a, 0xb1),
+        br = _mm512_moveldup_ps(b),
+        bi = _mm512_movehdup_ps(b);
+
+#if defined(__FMA__)
+      return _mm512_fmaddsub_ps(a, br, _mm512_mul_ps(as, bi));
+#else
+      return _mm512_add_ps(_mm512_mul_ps(a, br),
+                           _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mul_ps(as, bi)),
+                                                                _mm512_castps_si512(_mm512_mask_blend_ps(0x5555, _mm512_setzero_ps(),
+                                                                                                         _mm512_set1_ps(-0.0f))))));
+#endif
+    }
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
     KOKKOS_FORCEINLINE_FUNCTION
@@ -430,6 +522,31 @@ namespace KokkosBatched {
     }
 #endif
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    operator * (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_mul_ps(a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator * (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      const __m256
+        as = _mm256_permute_ps(a, 0xb1),
+        br = _mm256_moveldup_ps(b),
+        bi = _mm256_movehdup_ps(b);
+
+#if defined(__FMA__)
+      return _mm256_fmaddsub_ps(a, br, _mm256_mul_ps(as, bi));
+#else
+      return _mm256_addsub_ps(_mm256_mul_ps(a, br), _mm256_mul_ps(as, bi));
+#endif
+    }
+#endif
+
 #endif
 #endif
 
@@ -500,6 +617,14 @@ namespace KokkosBatched {
     }
 #endif
 
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator * (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const float b) {
+      return _mm512_mul_ps(a, _mm512_set1_ps(b));
+    }
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
 
@@ -512,6 +637,15 @@ namespace KokkosBatched {
     }
 #endif
 
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator * (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const float b) {
+      return _mm256_mul_ps(a, _mm256_set1_ps(b));
+    }
+#endif
+
 #endif
 #endif
 
@@ -534,6 +668,14 @@ namespace KokkosBatched {
     }
 #endif
 
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator * (const float a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_mul_ps(_mm512_set1_ps(a), b);
+    }
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
 
@@ -546,6 +688,15 @@ namespace KokkosBatched {
     }
 #endif
 
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator * (const float a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      return _mm256_mul_ps(_mm256_set1_ps(a), b);
+    }
+#endif
+
 #endif
 #endif
 
@@ -626,7 +777,7 @@ namespace KokkosBatched {
 #else
       return _mm512_div_pd(_mm512_add_pd(_mm512_mul_pd(a, br),
                                          _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(_mm512_mul_pd(as, bi)),
-                                                                              _mm512_castpd_si512(_mm512_mask_broadcast_f64x4(_mm512_setzero_pd(), 0xAA,
+                                                                              _mm512_castpd_si512(_mm512_mask_broadcast_f64x4(_mm512_setzero_pd(), 0x55,
                                                                                                                               _mm256_set1_pd(-0.0)))))),
                            _mm512_add_pd(_mm512_mul_pd(br, br), _mm512_mul_pd(bi, bi)));
       // const __mm512d cc = _mm512_mul_pd(as, bi);
@@ -636,6 +787,39 @@ namespace KokkosBatched {
     }
 #endif
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    operator / (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_div_ps(a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator / (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      const __m512
+        as = _mm512_permute_ps(a, 0xb1),
+        cb = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(b),
+                                                  _mm512_castps_si512(_mm512_mask_blend_ps(0xaaaa, _mm512_setzero_ps(),
+                                                                                           _mm512_set1_ps(-0.0f))))),
+        br = _mm512_moveldup_ps(cb),
+        bi = _mm512_movehdup_ps(cb);
+
+#if defined(__FMA__)
+      return _mm512_div_ps(_mm512_fmaddsub_ps(a,  br, _mm512_mul_ps(as, bi)),
+                           _mm512_fmadd_ps   (br, br, _mm512_mul_ps(bi, bi)));
+#else
+      return _mm512_div_ps(_mm512_add_ps(_mm512_mul_ps(a, br),
+                                         _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mul_ps(as, bi)),
+                                                                              _mm512_castps_si512(_mm512_mask_blend_ps(0x5555, _mm512_setzero_ps(),
+                                                                                                                       _mm512_set1_ps(-0.0f)))))),
+                           _mm512_add_ps(_mm512_mul_ps(br, br), _mm512_mul_ps(bi, bi)));
+#endif
+    }
+#endif
+
 #endif
 
 #if defined(__AVX__) || defined(__AVX2__)
@@ -669,6 +853,34 @@ namespace KokkosBatched {
     }
 #endif
 
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    operator / (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_div_ps(a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,4)
+    operator / (const Vector<SIMD<Kokkos::complex<float> >,4> &a, const Vector<SIMD<Kokkos::complex<float> >,4> &b) {
+      const __m256
+        as = _mm256_permute_ps(a, 0xb1),
+        cb = _mm256_xor_ps(b, _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f)),
+        br = _mm256_moveldup_ps(cb),
+        bi = _mm256_movehdup_ps(cb);
+
+#if defined(__FMA__)
+      return _mm256_div_ps(_mm256_fmaddsub_ps(a, br, _mm256_mul_ps(as, bi)),
+                           _mm256_add_ps(_mm256_mul_ps(br, br), _mm256_mul_ps(bi, bi)));
+#else
+      return _mm256_div_ps(_mm256_addsub_ps(_mm256_mul_ps(a, br), _mm256_mul_ps(as, bi)),
+                           _mm256_add_ps(_mm256_mul_ps(br, br), _mm256_mul_ps(bi, bi)));
+#endif
+    }
+#endif
+
 #endif
 #endif
 
@@ -712,6 +924,15 @@ namespace KokkosBatched {
     }
 #endif
 
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    operator / (const Vector<SIMD<Kokkos::complex<float> >,8> &a, const float b) {
+      return _mm512_div_ps(a, _mm512_set1_ps(b));
+    }
+#endif
+
 #endif
 #endif
 
@@ -794,6 +1015,243 @@ namespace KokkosBatched {
       a = a / b;
       return a;
     }
+
+    ///
+    /// masked arithmetic on partial vectors: lanes [0,n) of the result are
+    /// a op b and lanes [n,l) are copied from src, 0 <= n <= l
+    ///
+
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double,8)
+    mask_add(const Vector<SIMD<double>,8> &src, const int n, const Vector<SIMD<double>,8> &a, const Vector<SIMD<double>,8> &b) {
+      return _mm512_mask_add_pd(src, Vector<SIMD<double>,8>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    mask_add(const Vector<SIMD<float>,16> &src, const int n, const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_mask_add_ps(src, Vector<SIMD<float>,16>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double,8)
+    mask_sub(const Vector<SIMD<double>,8> &src, const int n, const Vector<SIMD<double>,8> &a, const Vector<SIMD<double>,8> &b) {
+      return _mm512_mask_sub_pd(src, Vector<SIMD<double>,8>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    mask_sub(const Vector<SIMD<float>,16> &src, const int n, const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_mask_sub_ps(src, Vector<SIMD<float>,16>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double,8)
+    mask_mul(const Vector<SIMD<double>,8> &src, const int n, const Vector<SIMD<double>,8> &a, const Vector<SIMD<double>,8> &b) {
+      return _mm512_mask_mul_pd(src, Vector<SIMD<double>,8>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    mask_mul(const Vector<SIMD<float>,16> &src, const int n, const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_mask_mul_ps(src, Vector<SIMD<float>,16>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double,8)
+    mask_div(const Vector<SIMD<double>,8> &src, const int n, const Vector<SIMD<double>,8> &a, const Vector<SIMD<double>,8> &b) {
+      return _mm512_mask_div_pd(src, Vector<SIMD<double>,8>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,16)
+    mask_div(const Vector<SIMD<float>,16> &src, const int n, const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) {
+      return _mm512_mask_div_ps(src, Vector<SIMD<float>,16>::laneMask(n), a, b);
+    }
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>,4)
+    mask_add(const Vector<SIMD<Kokkos::complex<double> >,4> &src, const int n,
+             const Vector<SIMD<Kokkos::complex<double> >,4> &a, const Vector<SIMD<Kokkos::complex<double> >,4> &b) {
+      return _mm512_mask_add_pd(src, Vector<SIMD<Kokkos::complex<double> >,4>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>,4)
+    mask_sub(const Vector<SIMD<Kokkos::complex<double> >,4> &src, const int n,
+             const Vector<SIMD<Kokkos::complex<double> >,4> &a, const Vector<SIMD<Kokkos::complex<double> >,4> &b) {
+      return _mm512_mask_sub_pd(src, Vector<SIMD<Kokkos::complex<double> >,4>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>,4)
+    mask_mul(const Vector<SIMD<Kokkos::complex<double> >,4> &src, const int n,
+             const Vector<SIMD<Kokkos::complex<double> >,4> &a, const Vector<SIMD<Kokkos::complex<double> >,4> &b) {
+      return _mm512_mask_blend_pd(Vector<SIMD<Kokkos::complex<double> >,4>::laneMask(n), src, a * b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>,4)
+    mask_div(const Vector<SIMD<Kokkos::complex<double> >,4> &src, const int n,
+             const Vector<SIMD<Kokkos::complex<double> >,4> &a, const Vector<SIMD<Kokkos::complex<double> >,4> &b) {
+      return _mm512_mask_blend_pd(Vector<SIMD<Kokkos::complex<double> >,4>::laneMask(n), src, a / b);
+    }
+#endif
+
+#if !defined(KOKKOS_COMPILER_GNU)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    mask_add(const Vector<SIMD<Kokkos::complex<float> >,8> &src, const int n,
+             const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_mask_add_ps(src, Vector<SIMD<Kokkos::complex<float> >,8>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    mask_sub(const Vector<SIMD<Kokkos::complex<float> >,8> &src, const int n,
+             const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_mask_sub_ps(src, Vector<SIMD<Kokkos::complex<float> >,8>::laneMask(n), a, b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    mask_mul(const Vector<SIMD<Kokkos::complex<float> >,8> &src, const int n,
+             const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_mask_blend_ps(Vector<SIMD<Kokkos::complex<float> >,8>::laneMask(n), src, a * b);
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>,8)
+    mask_div(const Vector<SIMD<Kokkos::complex<float> >,8> &src, const int n,
+             const Vector<SIMD<Kokkos::complex<float> >,8> &a, const Vector<SIMD<Kokkos::complex<float> >,8> &b) {
+      return _mm512_mask_blend_ps(Vector<SIMD<Kokkos::complex<float> >,8>::laneMask(n), src, a / b);
+    }
+#endif
+
+#endif
+#if defined(__AVX__) || defined(__AVX2__)
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double,4)
+    mask_add(const Vector<SIMD<double>,4> &src, const int n, const Vector<SIMD<double>,4> &a, const Vector<SIMD<double>,4> &b) {
+      return _mm256_blendv_pd(src, _mm256_add_pd(a, b), _mm256_castsi256_pd(Vector<SIMD<double>,4>::laneMask(n)));
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    mask_add(const Vector<SIMD<float>,8> &src, const int n, const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_blendv_ps(src, _mm256_add_ps(a, b), _mm256_castsi256_ps(Vector<SIMD<float>,8>::laneMask(n)));
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double,4)
+    mask_sub(const Vector<SIMD<double>,4> &src, const int n, const Vector<SIMD<double>,4> &a, const Vector<SIMD<double>,4> &b) {
+      return _mm256_blendv_pd(src, _mm256_sub_pd(a, b), _mm256_castsi256_pd(Vector<SIMD<double>,4>::laneMask(n)));
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    mask_sub(const Vector<SIMD<float>,8> &src, const int n, const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_blendv_ps(src, _mm256_sub_ps(a, b), _mm256_castsi256_ps(Vector<SIMD<float>,8>::laneMask(n)));
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double,4)
+    mask_mul(const Vector<SIMD<double>,4> &src, const int n, const Vector<SIMD<double>,4> &a, const Vector<SIMD<double>,4> &b) {
+      return _mm256_blendv_pd(src, _mm256_mul_pd(a, b), _mm256_castsi256_pd(Vector<SIMD<double>,4>::laneMask(n)));
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    mask_mul(const Vector<SIMD<float>,8> &src, const int n, const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_blendv_ps(src, _mm256_mul_ps(a, b), _mm256_castsi256_ps(Vector<SIMD<float>,8>::laneMask(n)));
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double,4)
+    mask_div(const Vector<SIMD<double>,4> &src, const int n, const Vector<SIMD<double>,4> &a, const Vector<SIMD<double>,4> &b) {
+      return _mm256_blendv_pd(src, _mm256_div_pd(a, b), _mm256_castsi256_pd(Vector<SIMD<double>,4>::laneMask(n)));
+    }
+
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float,8)
+    mask_div(const Vector<SIMD<float>,8> &src, const int n, const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) {
+      return _mm256_blendv_ps(src, _mm256_div_ps(a, b), _mm256_castsi256_ps(Vector<SIMD<float>,8>::laneMask(n)));
+    }
+
+#endif
+#endif
+
+    template<typename T, int l>
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T,l)
+    mask_add(const Vector<SIMD<T>,l> &src, const int n, const Vector<SIMD<T>,l> &a, const Vector<SIMD<T>,l> &b) {
+      Vector<SIMD<T>,l> r_val;
+      for (int i=0;i<l;++i)
+        r_val[i] = i < n ? a[i] + b[i] : src[i];
+      return r_val;
+    }
+
+    template<typename T, int l>
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T,l)
+    mask_sub(const Vector<SIMD<T>,l> &src, const int n, const Vector<SIMD<T>,l> &a, const Vector<SIMD<T>,l> &b) {
+      Vector<SIMD<T>,l> r_val;
+      for (int i=0;i<l;++i)
+        r_val[i] = i < n ? a[i] - b[i] : src[i];
+      return r_val;
+    }
+
+    template<typename T, int l>
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T,l)
+    mask_mul(const Vector<SIMD<T>,l> &src, const int n, const Vector<SIMD<T>,l> &a, const Vector<SIMD<T>,l> &b) {
+      Vector<SIMD<T>,l> r_val;
+      for (int i=0;i<l;++i)
+        r_val[i] = i < n ? a[i] * b[i] : src[i];
+      return r_val;
+    }
+
+    template<typename T, int l>
+    KOKKOS_FORCEINLINE_FUNCTION
+    static
+    KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T,l)
+    mask_div(const Vector<SIMD<T>,l> &src, const int n, const Vector<SIMD<T>,l> &a, const Vector<SIMD<T>,l> &b) {
+      Vector<SIMD<T>,l> r_val;
+      for (int i=0;i<l;++i)
+        r_val[i] = i < n ? a[i] / b[i] : src[i];
+      return r_val;
+    }
+
 #undef KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE
 #undef KOKKOSKERNELS_SIMD_ARITH_RETURN_REFERENCE_TYPE
   }
@@ -14,6 +14,27 @@ namespace KokkosBatched {
 
     /// simd 
 
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+    inline
+    static
+    KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float,16)
+    sqrt(const Vector<SIMD<float>,16> &a) {
+      return _mm512_sqrt_ps(a);
+    }
+
+#endif
+#if defined(__AVX__) || defined(__AVX2__)
+    inline
+    static
+    KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float,8)
+    sqrt(const Vector<SIMD<float>,8> &a) {
+      return _mm256_sqrt_ps(a);
+    }
+
+#endif
+#endif
+
     template<typename T, int l>
     inline
     static
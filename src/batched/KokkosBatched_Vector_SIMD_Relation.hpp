@@ -8,7 +8,50 @@
 namespace KokkosBatched {
   namespace Experimental {
 
-    // vector, vector
+    // vector, vector; single precision avx compares give a bit mask of the lanes
+
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+#undef  KOKKOSBATCHED_RELATION_OPERATOR
+#define KOKKOSBATCHED_RELATION_OPERATOR(op, pred)                       \
+    inline                                                              \
+    const Vector<SIMD<bool>,16> operator op (const Vector<SIMD<float>,16> &a, const Vector<SIMD<float>,16> &b) { \
+      const __mmask16 m = _mm512_cmp_ps_mask(a, b, pred);               \
+      Vector<SIMD<bool>,16> r_val;                                      \
+      for (int i=0;i<16;++i)                                            \
+        r_val[i] = (m >> i) & 1;                                        \
+      return r_val;                                                     \
+    }
+
+    KOKKOSBATCHED_RELATION_OPERATOR(<,  _CMP_LT_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(>,  _CMP_GT_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(<=, _CMP_LE_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(>=, _CMP_GE_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(==, _CMP_EQ_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(!=, _CMP_NEQ_UQ)
+
+#endif
+#if defined(__AVX__) || defined(__AVX2__)
+#undef  KOKKOSBATCHED_RELATION_OPERATOR
+#define KOKKOSBATCHED_RELATION_OPERATOR(op, pred)                       \
+    inline                                                              \
+    const Vector<SIMD<bool>,8> operator op (const Vector<SIMD<float>,8> &a, const Vector<SIMD<float>,8> &b) { \
+      const int m = _mm256_movemask_ps(_mm256_cmp_ps(a, b, pred));      \
+      Vector<SIMD<bool>,8> r_val;                                       \
+      for (int i=0;i<8;++i)                                             \
+        r_val[i] = (m >> i) & 1;                                        \
+      return r_val;                                                     \
+    }
+
+    KOKKOSBATCHED_RELATION_OPERATOR(<,  _CMP_LT_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(>,  _CMP_GT_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(<=, _CMP_LE_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(>=, _CMP_GE_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(==, _CMP_EQ_OQ)
+    KOKKOSBATCHED_RELATION_OPERATOR(!=, _CMP_NEQ_UQ)
+
+#endif
+#endif
 
 #undef  KOKKOSBATCHED_RELATION_OPERATOR
 #define KOKKOSBATCHED_RELATION_OPERATOR(op)                             \
@@ -46,8 +46,10 @@
 
 #include<KokkosBlas1_abs.hpp>
 #include<KokkosBlas1_axpby.hpp>
+#include<KokkosBlas1_axpby_dot.hpp>
 #include<KokkosBlas1_dot.hpp>
 #include<KokkosBlas1_fill.hpp>
+#include<KokkosBlas1_iamax.hpp>
 #include<KokkosBlas1_mult.hpp>
 #include<KokkosBlas1_nrm1.hpp>
 #include<KokkosBlas1_nrm2.hpp>
@@ -56,9 +58,12 @@
 #include<KokkosBlas1_nrm2w_squared.hpp>
 #include<KokkosBlas1_nrminf.hpp>
 #include<KokkosBlas1_reciprocal.hpp>
+#include<KokkosBlas1_rot.hpp>
 #include<KokkosBlas1_scal.hpp>
 #include<KokkosBlas1_sum.hpp>
+#include<KokkosBlas1_swap.hpp>
 #include<KokkosBlas1_update.hpp>
+#include<KokkosBlas1_update_nrm2.hpp>
 
 
 #include<KokkosBlas2_gemv.hpp>
@@ -0,0 +1,223 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_AXPBY_DOT_HPP_
+#define KOKKOSBLAS1_AXPBY_DOT_HPP_
+
+#include<KokkosBlas1_axpby_dot_impl.hpp>
+#include<KokkosKernels_helpers.hpp>
+#include<climits>
+#include<sstream>
+
+namespace KokkosBlas {
+namespace Impl {
+
+template<class XMV, class YMV, class WMV>
+void
+axpby_dot_check (const XMV& X, const YMV& Y, const WMV& W)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::axpby_dot: "
+                 "X is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YMV>::value, "KokkosBlas::axpby_dot: "
+                 "Y is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<WMV>::value, "KokkosBlas::axpby_dot: "
+                 "W is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_same<typename YMV::value_type,
+                 typename YMV::non_const_value_type>::value,
+                 "KokkosBlas::axpby_dot: Y is const.  "
+                 "It must be nonconst, because it is an output argument "
+                 "(we must be able to write to its entries).");
+  static_assert (int(YMV::rank) == int(XMV::rank) && int(YMV::rank) == int(WMV::rank),
+                 "KokkosBlas::axpby_dot: X, Y and W must have the same rank.");
+
+  if (X.extent(0) != Y.extent(0) || X.extent(1) != Y.extent(1) ||
+      W.extent(0) != Y.extent(0) || W.extent(1) != Y.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::axpby_dot: Dimensions of X, Y, and W do not match: "
+       << "X: " << X.extent(0) << " x " << X.extent(1)
+       << ", Y: " << Y.extent(0) << " x " << Y.extent(1)
+       << ", W: " << W.extent(0) << " x " << W.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+}
+
+} // namespace Impl
+
+/// \brief Fused Y := a*X + b*Y and dot(W, Y) for single vectors.
+///
+/// Computes the same result as KokkosBlas::axpby (a, x, b, y)
+/// followed by KokkosBlas::dot (w, y), but in one pass, so x, y and w
+/// are read once and y is written once.  This is the typical residual
+/// update of a Krylov method (for example r := r - alpha*A*p followed
+/// by dot(r, r) or dot(z, r)).
+///
+/// \tparam XV 1-D input View
+/// \tparam YV 1-D input/output View
+/// \tparam WV 1-D input View
+///
+/// \param a [in] Coefficient of x
+/// \param x [in] Input vector
+/// \param b [in] Coefficient of y.  If zero, y is not read.
+/// \param y [in/out] Input vector on entry, a*x + b*y on exit
+/// \param w [in] Vector to dot with the updated y.  It may be the
+///   same View as y.
+///
+/// \return dot(w, y) of the updated y, conjugating w.
+template<class XV, class YV, class WV>
+typename Kokkos::Details::InnerProductSpaceTraits<typename YV::non_const_value_type>::dot_type
+axpby_dot (const typename XV::non_const_value_type& a, const XV& x,
+           const typename YV::non_const_value_type& b, const YV& y,
+           const WV& w)
+{
+  static_assert (XV::rank == 1, "KokkosBlas::axpby_dot: "
+                 "X, Y and W must have rank 1.  Use the overload with an "
+                 "output View R for multivectors.");
+  Impl::axpby_dot_check (x, y, w);
+
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      XV::rank == 1,
+      typename XV::const_value_type*,
+      typename XV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XV>::array_layout,
+    typename XV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      YV::rank == 1,
+      typename YV::non_const_value_type*,
+      typename YV::non_const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YV>::array_layout,
+    typename YV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      WV::rank == 1,
+      typename WV::const_value_type*,
+      typename WV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<WV>::array_layout,
+    typename WV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > WV_Internal;
+
+  XV_Internal x_internal = x;
+  YV_Internal y_internal = y;
+  WV_Internal w_internal = w;
+
+  if (y.extent(0) < static_cast<size_t> (INT_MAX)) {
+    return Impl::V_AxpbyDot_Invoke<XV_Internal, YV_Internal, WV_Internal, int>
+      (a, x_internal, b, y_internal, w_internal);
+  }
+  else {
+    return Impl::V_AxpbyDot_Invoke<XV_Internal, YV_Internal, WV_Internal, int64_t>
+      (a, x_internal, b, y_internal, w_internal);
+  }
+}
+
+/// \brief Column-wise fused Y := a*X + b*Y and R(j) = dot(W(:,j),
+///   Y(:,j)) for multivectors.
+///
+/// \tparam RV 1-D output View, with one entry per column of Y
+/// \tparam XMV 2-D input View
+/// \tparam YMV 2-D input/output View
+/// \tparam WMV 2-D input View
+template<class RV, class XMV, class YMV, class WMV>
+void
+axpby_dot (const RV& R,
+           const typename XMV::non_const_value_type& a, const XMV& X,
+           const typename YMV::non_const_value_type& b, const YMV& Y,
+           const WMV& W)
+{
+  static_assert (Kokkos::Impl::is_view<RV>::value, "KokkosBlas::axpby_dot: "
+                 "R is not a Kokkos::View.");
+  static_assert (RV::rank == 1 && XMV::rank == 2, "KokkosBlas::axpby_dot: "
+                 "R must have rank 1, and X, Y and W must have rank 2.");
+  Impl::axpby_dot_check (X, Y, W);
+  if (R.extent(0) != Y.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::axpby_dot: R has " << R.extent(0) << " entries, "
+       << "but Y has " << Y.extent(1) << " columns.";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      XMV::rank == 1,
+      typename XMV::const_value_type*,
+      typename XMV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XMV>::array_layout,
+    typename XMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XMV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      YMV::rank == 1,
+      typename YMV::non_const_value_type*,
+      typename YMV::non_const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YMV>::array_layout,
+    typename YMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YMV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      WMV::rank == 1,
+      typename WMV::const_value_type*,
+      typename WMV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<WMV>::array_layout,
+    typename WMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > WMV_Internal;
+
+  XMV_Internal X_internal = X;
+  YMV_Internal Y_internal = Y;
+  WMV_Internal W_internal = W;
+
+  if (Y.extent(0) < static_cast<size_t> (INT_MAX)) {
+    Impl::MV_AxpbyDot_Invoke<RV, XMV_Internal, YMV_Internal, WMV_Internal, int>
+      (R, a, X_internal, b, Y_internal, W_internal);
+  }
+  else {
+    Impl::MV_AxpbyDot_Invoke<RV, XMV_Internal, YMV_Internal, WMV_Internal, int64_t>
+      (R, a, X_internal, b, Y_internal, W_internal);
+  }
+}
+
+}
+
+#endif // KOKKOSBLAS1_AXPBY_DOT_HPP_
@@ -45,7 +45,9 @@
 #define KOKKOSBLAS1_DOT_HPP_
 
 #include<KokkosBlas1_dot_spec.hpp>
+#include<KokkosBlas1_dot_mv_impl.hpp>
 #include<KokkosKernels_helpers.hpp>
+#include<climits>
 
 namespace KokkosBlas {
 
@@ -134,7 +136,8 @@ dot (const XVector& x, const YVector& y)
 template<class RV, class XMV, class YMV>
 void
 dot (const RV& R, const XMV& X, const YMV& Y,
-     typename std::enable_if<Kokkos::Impl::is_view<RV>::value, int>::type = 0)
+     typename std::enable_if<Kokkos::Impl::is_view<RV>::value &&
+                             static_cast<int> (RV::rank) != 2, int>::type = 0)
 {
   static_assert (Kokkos::Impl::is_view<RV>::value, "KokkosBlas::dot: "
                  "R is not a Kokkos::View.");
@@ -224,6 +227,73 @@ dot (const RV& R, const XMV& X, const YMV& Y,
 
   Impl::Dot<RV_Internal, XMV_Internal, YMV_Internal>::dot(R_internal, X_internal, Y_internal);
 }
+
+/// \brief Compute the dot products of every column of X with every
+///   column of Y in a single pass: R(i,j) = dot(X(:,i), Y(:,j)).
+///
+/// \tparam RV 2-D output View
+/// \tparam XMV 2-D input View
+/// \tparam YMV 2-D input View
+///
+/// \param R [out] Output 2-D View, X.extent(1) x Y.extent(1).
+/// \param X [in] Input 2-D View.
+/// \param Y [in] Input 2-D View with as many rows as X.
+///
+/// This is the block inner product X^H Y used by block Krylov and
+/// Gram-Schmidt methods.  Unlike calling the column-wise dot once per
+/// column of Y, X and Y are each read only once; it pays off for a
+/// handful of columns, since every thread keeps all
+/// X.extent(1)*Y.extent(1) sums.  For many columns, prefer
+/// KokkosBlas::gemm.
+template<class RV, class XMV, class YMV>
+void
+dot (const RV& R, const XMV& X, const YMV& Y,
+     typename std::enable_if<Kokkos::Impl::is_view<RV>::value &&
+                             static_cast<int> (RV::rank) == 2, int>::type = 0)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::dot: "
+                 "X is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YMV>::value, "KokkosBlas::dot: "
+                 "Y is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_same<typename RV::value_type,
+                   typename RV::non_const_value_type>::value,
+                 "KokkosBlas::dot: R is const.  "
+                 "It must be nonconst, because it is an output argument "
+                 "(we have to be able to write to its entries).");
+  static_assert (XMV::rank == 2 && YMV::rank == 2,
+                 "KokkosBlas::dot: If R has rank 2, X and Y must have rank 2.");
+
+  if (X.extent(0) != Y.extent(0) ||
+      R.extent(0) != X.extent(1) ||
+      R.extent(1) != Y.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::dot: Dimensions of R, X, and Y do not match: "
+       << "R: " << R.extent(0) << " x " << R.extent(1)
+       << ", X: " << X.extent(0) << " x " << X.extent(1)
+       << ", Y: " << Y.extent(0) << " x " << Y.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef Kokkos::View<typename XMV::const_value_type**,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XMV>::array_layout,
+    typename XMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XMV_Internal;
+  typedef Kokkos::View<typename YMV::const_value_type**,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YMV>::array_layout,
+    typename YMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YMV_Internal;
+
+  XMV_Internal X_internal = X;
+  YMV_Internal Y_internal = Y;
+
+  const size_t numRows = X.extent(0);
+  if (numRows < static_cast<size_t> (INT_MAX)) {
+    Impl::MV_MultiDot_Invoke<RV, XMV_Internal, YMV_Internal, int> (R, X_internal, Y_internal);
+  }
+  else {
+    Impl::MV_MultiDot_Invoke<RV, XMV_Internal, YMV_Internal, int64_t> (R, X_internal, Y_internal);
+  }
+}
 }
 
 #endif
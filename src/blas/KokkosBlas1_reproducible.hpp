@@ -0,0 +1,278 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_REPRODUCIBLE_HPP_
+#define KOKKOSBLAS1_REPRODUCIBLE_HPP_
+
+#include<KokkosBlas1_reproducible_impl.hpp>
+#include<KokkosKernels_helpers.hpp>
+#include<climits>
+#include<sstream>
+#include<vector>
+
+/// \file KokkosBlas1_reproducible.hpp
+/// \brief Reproducible versions of dot, nrm2 and sum.
+///
+/// KokkosBlas::dot, nrm2 and sum add their terms in an order that
+/// depends on the number of threads and on scheduling, so their
+/// results may differ in the last bits from run to run.  The
+/// functions here return bitwise identical results for the same
+/// input, regardless of the execution space, the thread count or the
+/// layout.  They read the input twice and do a few more flops per
+/// entry, so expect them to take a few times as long as the ordinary
+/// reductions; perf_test/blas/KokkosBlas_blas1.cpp measures the cost.
+/// They are header-only and work for real and complex floating-point
+/// types.
+
+namespace KokkosBlas {
+namespace Experimental {
+namespace Impl {
+
+template<class V>
+using ReproducibleInternal = Kokkos::View<
+  typename Kokkos::Impl::if_c<
+    V::rank == 1,
+    typename V::const_value_type*,
+    typename V::const_value_type** >::type,
+  typename KokkosKernels::Impl::GetUnifiedLayout<V>::array_layout,
+  typename V::device_type,
+  Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+// Sum the components of the terms of op, column by column, and
+// return one value_type per column.
+template<class TermOp>
+std::vector<typename TermOp::value_type>
+reproducible_columns (const TermOp& op, const size_t numRows, const size_t numCols)
+{
+  typedef typename TermOp::value_type value_type;
+  typedef KokkosBlas::Impl::ReproducibleParts<value_type> Parts;
+  typedef typename Parts::accum_type accum_type;
+
+  static_assert (! Kokkos::Details::ArithTraits<typename Parts::mag_type>::is_exact,
+                 "KokkosBlas::Experimental::reproducible_*: Reproducible "
+                 "reductions only make sense for floating-point types.");
+
+  std::vector<accum_type> comps (numCols * Parts::count, accum_type (0));
+  if (numRows < static_cast<size_t> (INT_MAX)) {
+    KokkosBlas::Impl::Reproducible_Invoke<TermOp> (op, numRows, numCols, comps.data ());
+  }
+  else {
+    KokkosBlas::Impl::Reproducible_Invoke<TermOp, int64_t> (op, numRows, numCols, comps.data ());
+  }
+  std::vector<value_type> result (numCols);
+  for (size_t j = 0; j < numCols; ++j) {
+    result[j] = Parts::make (&comps[j * Parts::count]);
+  }
+  return result;
+}
+
+template<class RV, class T>
+void
+reproducible_copy_out (const RV& R, const std::vector<T>& result, const char name[])
+{
+  static_assert (Kokkos::Impl::is_view<RV>::value, "KokkosBlas::Experimental::"
+                 "reproducible_*: R is not a Kokkos::View.");
+  static_assert (RV::rank == 1, "KokkosBlas::Experimental::reproducible_*: "
+                 "R must have rank 1.");
+  if (R.extent(0) != result.size ()) {
+    std::ostringstream os;
+    os << "KokkosBlas::Experimental::" << name << ": R has " << R.extent(0)
+       << " entries, but X has " << result.size () << " columns.";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+  typename RV::HostMirror h_R = Kokkos::create_mirror_view (R);
+  for (size_t j = 0; j < result.size (); ++j) {
+    h_R(j) = result[j];
+  }
+  Kokkos::deep_copy (R, h_R);
+}
+
+} // namespace Impl
+
+/// \brief Reproducible dot product of two vectors, dot(x,y) =
+///   sum_i conj(x(i)) * y(i).
+///
+/// Same as KokkosBlas::dot(x,y), but the result depends only on the
+/// entries of x and y, not on how the reduction is split among
+/// threads.
+template<class XVector, class YVector>
+typename Kokkos::Details::InnerProductSpaceTraits<typename XVector::non_const_value_type>::dot_type
+reproducible_dot (const XVector& x, const YVector& y)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value &&
+                 Kokkos::Impl::is_view<YVector>::value,
+                 "KokkosBlas::Experimental::reproducible_dot: "
+                 "x and y must be Kokkos::View.");
+  static_assert (XVector::rank == 1 && YVector::rank == 1,
+                 "KokkosBlas::Experimental::reproducible_dot: "
+                 "x and y must have rank 1.");
+  if (x.extent(0) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::Experimental::reproducible_dot: Dimensions do not match: "
+       << "x: " << x.extent(0) << " x 1"
+       << ", y: " << y.extent(0) << " x 1";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef Impl::ReproducibleInternal<XVector> XVector_Internal;
+  typedef Impl::ReproducibleInternal<YVector> YVector_Internal;
+  KokkosBlas::Impl::ReproducibleDotTerm<XVector_Internal, YVector_Internal> op (x, y);
+  return Impl::reproducible_columns (op, x.extent(0), 1)[0];
+}
+
+/// \brief Reproducible column-wise dot products: R(j) =
+///   dot(X(:,j), Y(:,j)).
+///
+/// \tparam RV 1-D output View
+/// \tparam XMV 2-D input View
+/// \tparam YMV 2-D input View
+template<class RV, class XMV, class YMV>
+void
+reproducible_dot (const RV& R, const XMV& X, const YMV& Y)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value &&
+                 Kokkos::Impl::is_view<YMV>::value,
+                 "KokkosBlas::Experimental::reproducible_dot: "
+                 "X and Y must be Kokkos::View.");
+  static_assert (XMV::rank == 2 && YMV::rank == 2,
+                 "KokkosBlas::Experimental::reproducible_dot: "
+                 "X and Y must have rank 2.");
+  if (X.extent(0) != Y.extent(0) || X.extent(1) != Y.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::Experimental::reproducible_dot: Dimensions do not match: "
+       << "X: " << X.extent(0) << " x " << X.extent(1)
+       << ", Y: " << Y.extent(0) << " x " << Y.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef Impl::ReproducibleInternal<XMV> XMV_Internal;
+  typedef Impl::ReproducibleInternal<YMV> YMV_Internal;
+  KokkosBlas::Impl::ReproducibleDotTerm<XMV_Internal, YMV_Internal> op (X, Y);
+  Impl::reproducible_copy_out (R, Impl::reproducible_columns (op, X.extent(0), X.extent(1)),
+                               "reproducible_dot");
+}
+
+/// \brief Reproducible 2-norm of a vector.
+///
+/// The sum of squares is reproducible, and so is its square root.
+template<class XVector>
+typename Kokkos::Details::InnerProductSpaceTraits<typename XVector::non_const_value_type>::mag_type
+reproducible_nrm2 (const XVector& x)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::Experimental::reproducible_nrm2: "
+                 "x must be a Kokkos::View.");
+  static_assert (XVector::rank == 1,
+                 "KokkosBlas::Experimental::reproducible_nrm2: "
+                 "x must have rank 1.");
+  typedef typename Kokkos::Details::InnerProductSpaceTraits<
+    typename XVector::non_const_value_type>::mag_type mag_type;
+
+  typedef Impl::ReproducibleInternal<XVector> XVector_Internal;
+  KokkosBlas::Impl::ReproducibleSquareTerm<XVector_Internal> op (x);
+  return Kokkos::Details::ArithTraits<mag_type>::sqrt
+    (Impl::reproducible_columns (op, x.extent(0), 1)[0]);
+}
+
+/// \brief Reproducible column-wise 2-norms: R(j) = ||X(:,j)||_2.
+template<class RV, class XMV>
+void
+reproducible_nrm2 (const RV& R, const XMV& X)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value,
+                 "KokkosBlas::Experimental::reproducible_nrm2: "
+                 "X must be a Kokkos::View.");
+  static_assert (XMV::rank == 2,
+                 "KokkosBlas::Experimental::reproducible_nrm2: "
+                 "X must have rank 2.");
+  typedef typename Kokkos::Details::InnerProductSpaceTraits<
+    typename XMV::non_const_value_type>::mag_type mag_type;
+
+  typedef Impl::ReproducibleInternal<XMV> XMV_Internal;
+  KokkosBlas::Impl::ReproducibleSquareTerm<XMV_Internal> op (X);
+  std::vector<mag_type> result = Impl::reproducible_columns (op, X.extent(0), X.extent(1));
+  for (size_t j = 0; j < result.size (); ++j) {
+    result[j] = Kokkos::Details::ArithTraits<mag_type>::sqrt (result[j]);
+  }
+  Impl::reproducible_copy_out (R, result, "reproducible_nrm2");
+}
+
+/// \brief Reproducible sum of the entries of a vector.
+template<class XVector>
+typename XVector::non_const_value_type
+reproducible_sum (const XVector& x)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::Experimental::reproducible_sum: "
+                 "x must be a Kokkos::View.");
+  static_assert (XVector::rank == 1,
+                 "KokkosBlas::Experimental::reproducible_sum: "
+                 "x must have rank 1.");
+
+  typedef Impl::ReproducibleInternal<XVector> XVector_Internal;
+  KokkosBlas::Impl::ReproducibleSumTerm<XVector_Internal> op (x);
+  return Impl::reproducible_columns (op, x.extent(0), 1)[0];
+}
+
+/// \brief Reproducible column-wise sums: R(j) = sum_i X(i,j).
+template<class RV, class XMV>
+void
+reproducible_sum (const RV& R, const XMV& X)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value,
+                 "KokkosBlas::Experimental::reproducible_sum: "
+                 "X must be a Kokkos::View.");
+  static_assert (XMV::rank == 2,
+                 "KokkosBlas::Experimental::reproducible_sum: "
+                 "X must have rank 2.");
+
+  typedef Impl::ReproducibleInternal<XMV> XMV_Internal;
+  KokkosBlas::Impl::ReproducibleSumTerm<XMV_Internal> op (X);
+  Impl::reproducible_copy_out (R, Impl::reproducible_columns (op, X.extent(0), X.extent(1)),
+                               "reproducible_sum");
+}
+
+}
+}
+
+#endif // KOKKOSBLAS1_REPRODUCIBLE_HPP_
@@ -0,0 +1,116 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_ROT_HPP_
+#define KOKKOSBLAS1_ROT_HPP_
+
+#include<KokkosBlas1_rot_spec.hpp>
+#include<KokkosKernels_helpers.hpp>
+
+namespace KokkosBlas {
+
+/// \brief Apply the plane (Givens) rotation defined by c and s to the
+///   pairs (x(i), y(i)):
+///
+///   x(i) := c*x(i) + s*y(i),
+///   y(i) := c*y(i) - conj(s)*x(i).
+///
+/// For real vectors this is BLAS xROT; for complex vectors it is
+/// LAPACK xROT (complex s).
+///
+/// \tparam XVector Type of the first vector x; a 1-D Kokkos::View.
+/// \tparam YVector Type of the second vector y; a 1-D Kokkos::View.
+///
+/// \param x [in/out] 1-D View.
+/// \param y [in/out] 1-D View, with the same length as x.
+/// \param c [in] Cosine of the rotation; a real number.
+/// \param s [in] Sine of the rotation.
+template<class XVector, class YVector>
+void
+rot (const XVector& x, const YVector& y,
+     const typename Kokkos::Details::ArithTraits<typename XVector::non_const_value_type>::mag_type& c,
+     const typename XVector::non_const_value_type& s)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::rot: XVector must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YVector>::value,
+                 "KokkosBlas::rot: YVector must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_same<typename XVector::value_type,
+                 typename XVector::non_const_value_type>::value &&
+                 Kokkos::Impl::is_same<typename YVector::value_type,
+                 typename YVector::non_const_value_type>::value,
+                 "KokkosBlas::rot: x or y is const.  "
+                 "Both must be nonconst, because they are output arguments "
+                 "(we have to be able to write to their entries).");
+  static_assert (Kokkos::Impl::is_same<typename XVector::non_const_value_type,
+                 typename YVector::non_const_value_type>::value,
+                 "KokkosBlas::rot: x and y must have the same value type.");
+  static_assert (XVector::rank == 1 && YVector::rank == 1, "KokkosBlas::rot: "
+                 "Both Vector inputs must have rank 1.");
+
+  // Check compatibility of dimensions at run time.
+  if (x.extent(0) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::rot: Dimensions of x and y do not match: "
+       << "x: " << x.extent(0) << ", y: " << y.extent(0);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef Kokkos::View<typename XVector::non_const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
+    typename XVector::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XVector_Internal;
+  typedef Kokkos::View<typename YVector::non_const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YVector>::array_layout,
+    typename YVector::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YVector_Internal;
+
+  XVector_Internal X = x;
+  YVector_Internal Y = y;
+
+  Impl::Rot<XVector_Internal,YVector_Internal>::rot (X,Y,c,s);
+}
+
+}
+
+#endif // KOKKOSBLAS1_ROT_HPP_
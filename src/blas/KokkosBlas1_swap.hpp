@@ -0,0 +1,105 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_SWAP_HPP_
+#define KOKKOSBLAS1_SWAP_HPP_
+
+#include<KokkosBlas1_swap_spec.hpp>
+#include<KokkosKernels_helpers.hpp>
+
+namespace KokkosBlas {
+
+/// \brief Exchange the entries of the vectors x and y.
+///
+/// \tparam XVector Type of the first vector x; a 1-D Kokkos::View.
+/// \tparam YVector Type of the second vector y; a 1-D Kokkos::View.
+///
+/// \param x [in/out] 1-D View.
+/// \param y [in/out] 1-D View, with the same length as x.
+template<class XVector, class YVector>
+void
+swap (const XVector& x, const YVector& y)
+{
+  static_assert (Kokkos::Impl::is_view<XVector>::value,
+                 "KokkosBlas::swap: XVector must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YVector>::value,
+                 "KokkosBlas::swap: YVector must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_same<typename XVector::value_type,
+                 typename XVector::non_const_value_type>::value &&
+                 Kokkos::Impl::is_same<typename YVector::value_type,
+                 typename YVector::non_const_value_type>::value,
+                 "KokkosBlas::swap: x or y is const.  "
+                 "Both must be nonconst, because they are output arguments "
+                 "(we have to be able to write to their entries).");
+  static_assert (Kokkos::Impl::is_same<typename XVector::non_const_value_type,
+                 typename YVector::non_const_value_type>::value,
+                 "KokkosBlas::swap: x and y must have the same value type.");
+  static_assert (XVector::rank == 1 && YVector::rank == 1, "KokkosBlas::swap: "
+                 "Both Vector inputs must have rank 1.");
+
+  // Check compatibility of dimensions at run time.
+  if (x.extent(0) != y.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosBlas::swap: Dimensions of x and y do not match: "
+       << "x: " << x.extent(0) << ", y: " << y.extent(0);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef Kokkos::View<typename XVector::non_const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XVector>::array_layout,
+    typename XVector::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XVector_Internal;
+  typedef Kokkos::View<typename YVector::non_const_value_type*,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YVector>::array_layout,
+    typename YVector::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YVector_Internal;
+
+  XVector_Internal X = x;
+  YVector_Internal Y = y;
+
+  Impl::Swap<XVector_Internal,YVector_Internal>::swap (X,Y);
+}
+
+}
+
+#endif // KOKKOSBLAS1_SWAP_HPP_
@@ -0,0 +1,215 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_UPDATE_NRM2_HPP_
+#define KOKKOSBLAS1_UPDATE_NRM2_HPP_
+
+#include<KokkosBlas1_update_nrm2_impl.hpp>
+#include<KokkosKernels_helpers.hpp>
+#include<climits>
+#include<sstream>
+
+namespace KokkosBlas {
+namespace Impl {
+
+template<class XMV, class YMV, class ZMV>
+void
+update_nrm2_check (const XMV& X, const YMV& Y, const ZMV& Z)
+{
+  static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::update_nrm2: "
+                 "X is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YMV>::value, "KokkosBlas::update_nrm2: "
+                 "Y is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<ZMV>::value, "KokkosBlas::update_nrm2: "
+                 "Z is not a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_same<typename ZMV::value_type,
+                 typename ZMV::non_const_value_type>::value,
+                 "KokkosBlas::update_nrm2: Z is const.  "
+                 "It must be nonconst, because it is an output argument "
+                 "(we must be able to write to its entries).");
+  static_assert (int(ZMV::rank) == int(XMV::rank) && int(ZMV::rank) == int(YMV::rank),
+                 "KokkosBlas::update_nrm2: X, Y and Z must have the same rank.");
+
+  if (X.extent(0) != Y.extent(0) || X.extent(1) != Y.extent(1) ||
+      X.extent(0) != Z.extent(0) || X.extent(1) != Z.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::update_nrm2: Dimensions of X, Y, and Z do not match: "
+       << "Z: " << Z.extent(0) << " x " << Z.extent(1)
+       << ", X: " << X.extent(0) << " x " << X.extent(1)
+       << ", Y: " << Y.extent(0) << " x " << Y.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+}
+
+} // namespace Impl
+
+/// \brief Fused Z := alpha*X + beta*Y + gamma*Z and ||Z||_2 for
+///   single vectors.
+///
+/// Computes the same result as KokkosBlas::update followed by
+/// KokkosBlas::nrm2 on z, but in one pass, so z is not read back
+/// from memory for the norm.
+///
+/// \tparam XV 1-D input View
+/// \tparam YV 1-D input View
+/// \tparam ZV 1-D input/output View
+///
+/// \return The 2-norm of the updated z.
+template<class XV, class YV, class ZV>
+typename Kokkos::Details::InnerProductSpaceTraits<typename ZV::non_const_value_type>::mag_type
+update_nrm2 (const typename XV::non_const_value_type& alpha, const XV& x,
+             const typename YV::non_const_value_type& beta, const YV& y,
+             const typename ZV::non_const_value_type& gamma, const ZV& z)
+{
+  static_assert (XV::rank == 1, "KokkosBlas::update_nrm2: "
+                 "X, Y and Z must have rank 1.  Use the overload with an "
+                 "output View R for multivectors.");
+  Impl::update_nrm2_check (x, y, z);
+
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      XV::rank == 1,
+      typename XV::const_value_type*,
+      typename XV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XV>::array_layout,
+    typename XV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      YV::rank == 1,
+      typename YV::const_value_type*,
+      typename YV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YV>::array_layout,
+    typename YV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      ZV::rank == 1,
+      typename ZV::non_const_value_type*,
+      typename ZV::non_const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<ZV>::array_layout,
+    typename ZV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > ZV_Internal;
+
+  XV_Internal x_internal = x;
+  YV_Internal y_internal = y;
+  ZV_Internal z_internal = z;
+
+  if (z.extent(0) < static_cast<size_t> (INT_MAX)) {
+    return Impl::V_UpdateNrm2_Invoke<XV_Internal, YV_Internal, ZV_Internal, int>
+      (alpha, x_internal, beta, y_internal, gamma, z_internal);
+  }
+  else {
+    return Impl::V_UpdateNrm2_Invoke<XV_Internal, YV_Internal, ZV_Internal, int64_t>
+      (alpha, x_internal, beta, y_internal, gamma, z_internal);
+  }
+}
+
+/// \brief Column-wise fused Z := alpha*X + beta*Y + gamma*Z and
+///   R(j) = ||Z(:,j)||_2 for multivectors.
+///
+/// \tparam RV 1-D output View, with one entry per column of Z
+/// \tparam XMV 2-D input View
+/// \tparam YMV 2-D input View
+/// \tparam ZMV 2-D input/output View
+template<class RV, class XMV, class YMV, class ZMV>
+void
+update_nrm2 (const RV& R,
+             const typename XMV::non_const_value_type& alpha, const XMV& X,
+             const typename YMV::non_const_value_type& beta, const YMV& Y,
+             const typename ZMV::non_const_value_type& gamma, const ZMV& Z)
+{
+  static_assert (Kokkos::Impl::is_view<RV>::value, "KokkosBlas::update_nrm2: "
+                 "R is not a Kokkos::View.");
+  static_assert (RV::rank == 1 && XMV::rank == 2, "KokkosBlas::update_nrm2: "
+                 "R must have rank 1, and X, Y and Z must have rank 2.");
+  Impl::update_nrm2_check (X, Y, Z);
+  if (R.extent(0) != Z.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBlas::update_nrm2: R has " << R.extent(0) << " entries, "
+       << "but Z has " << Z.extent(1) << " columns.";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      XMV::rank == 1,
+      typename XMV::const_value_type*,
+      typename XMV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<XMV>::array_layout,
+    typename XMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > XMV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      YMV::rank == 1,
+      typename YMV::const_value_type*,
+      typename YMV::const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<YMV>::array_layout,
+    typename YMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > YMV_Internal;
+  typedef Kokkos::View<
+    typename Kokkos::Impl::if_c<
+      ZMV::rank == 1,
+      typename ZMV::non_const_value_type*,
+      typename ZMV::non_const_value_type** >::type,
+    typename KokkosKernels::Impl::GetUnifiedLayout<ZMV>::array_layout,
+    typename ZMV::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > ZMV_Internal;
+
+  XMV_Internal X_internal = X;
+  YMV_Internal Y_internal = Y;
+  ZMV_Internal Z_internal = Z;
+
+  if (Z.extent(0) < static_cast<size_t> (INT_MAX)) {
+    Impl::MV_UpdateNrm2_Invoke<RV, XMV_Internal, YMV_Internal, ZMV_Internal, int>
+      (R, alpha, X_internal, beta, Y_internal, gamma, Z_internal);
+  }
+  else {
+    Impl::MV_UpdateNrm2_Invoke<RV, XMV_Internal, YMV_Internal, ZMV_Internal, int64_t>
+      (R, alpha, X_internal, beta, Y_internal, gamma, Z_internal);
+  }
+}
+
+}
+
+#endif // KOKKOSBLAS1_UPDATE_NRM2_HPP_
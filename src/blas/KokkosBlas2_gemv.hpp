@@ -56,6 +56,11 @@ namespace KokkosBlas {
 
 /// \brief Dense matrix-vector multiply: y = beta*y + alpha*A*x.
 ///
+/// Without a TPL, the kernel is chosen by the shape of A.  Transpose
+/// and conjugate transpose products with a tall A, and nontranspose
+/// products with a short and wide A, use a two-level (team + vector)
+/// blocked reduction; all other cases parallelize over rows of A.
+///
 /// \tparam AViewType Input matrix, as a 2-D Kokkos::View
 /// \tparam XViewType Input vector, as a 1-D Kokkos::View
 /// \tparam YViewType Output vector, as a nonconst 1-D Kokkos::View
@@ -0,0 +1,119 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOSBLAS3_CHOLQR2_HPP_
+#define KOKKOSBLAS3_CHOLQR2_HPP_
+
+/// \file KokkosBlas3_cholqr2.hpp
+
+#include <KokkosKernels_Macros.hpp>
+#include <KokkosBlas3_cholqr2_impl.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+/// \brief Tall-skinny QR factorization by CholeskyQR2, A = Q*R,
+///   computing Q in place.
+///
+/// Each of two passes forms the Gram matrix G = A^H A with
+/// KokkosBlas::herk, factors G = U^H U on the host (it is only n x n),
+/// and overwrites A with A U^{-1} using KokkosBlas::trsm.  All the work
+/// on A is level 3 BLAS with one reduction per pass, so this is the
+/// fastest way to orthogonalize a block of vectors.
+///
+/// \tparam AViewType Input/output matrix, as a nonconst 2-D Kokkos::View
+/// \tparam RViewType Output matrix, as a nonconst 2-D Kokkos::View
+///
+/// \param A [in/out] On entry, the m x n matrix to factor, m >= n.  On
+///   exit, Q: the m x n matrix with orthonormal columns.
+/// \param R [out] The n x n upper triangular factor, with positive
+///   diagonal.  Its strictly lower triangle is set to zero.
+///
+/// CholQR2 is only stable if the condition number of A is less than
+/// about 1/sqrt(machine epsilon), i.e., 1e8 in double precision.  If
+/// the Gram matrix is not numerically positive definite, this throws;
+/// A is then partially overwritten.  Use KokkosBlas::tsqr for
+/// ill-conditioned A.
+template<class AViewType,
+         class RViewType>
+void
+cholqr2 (const AViewType& A,
+         const RViewType& R)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<RViewType>::value,
+                 "RViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (static_cast<int> (RViewType::rank) == 2,
+                 "RViewType must have rank 2.");
+  static_assert (std::is_same<typename AViewType::value_type,
+                              typename AViewType::non_const_value_type>::value,
+                 "AViewType must be nonconst.");
+  static_assert (std::is_same<typename RViewType::value_type,
+                              typename RViewType::non_const_value_type>::value,
+                 "RViewType must be nonconst.");
+
+  // Check compatibility of dimensions at run time.
+  int64_t A0 = A.extent(0);
+  int64_t A1 = A.extent(1);
+  int64_t R0 = R.extent(0);
+  int64_t R1 = R.extent(1);
+
+  if ( (A0 < A1) || (R0 != A1) || (R1 != A1) ) {
+    std::ostringstream os;
+    os << "KokkosBlas::cholqr2: Dimensions of A and R do not match or A is wide: "
+       << "A: " << A.extent(0) << " x " << A.extent(1)
+       << " R: " << R.extent(0) << " x " << R.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  Impl::cholqr2_impl (A, R);
+}
+
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS3_CHOLQR2_HPP_
@@ -0,0 +1,194 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS3_SYRK_HPP_
+#define KOKKOSBLAS3_SYRK_HPP_
+
+/// \file KokkosBlas3_syrk.hpp
+
+#include <KokkosKernels_Macros.hpp>
+#include <KokkosBlas3_syrk_spec.hpp>
+#include <KokkosKernels_helpers.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+namespace Impl {
+
+template<class AViewType, class CViewType>
+void
+syrk_check_and_invoke (const char name[],
+                       const char uplo[],
+                       const char trans[],
+                       const bool herm,
+                       typename CViewType::const_value_type& alpha,
+                       const AViewType& A,
+                       typename CViewType::const_value_type& beta,
+                       const CViewType& C)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<CViewType>::value,
+                 "CViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (static_cast<int> (CViewType::rank) == 2,
+                 "CViewType must have rank 2.");
+  static_assert (std::is_same<typename CViewType::value_type,
+                              typename CViewType::non_const_value_type>::value,
+                 "CViewType must be nonconst.");
+
+  // Check validity of the character arguments
+  const char t = herm ? 'C' : 'T';
+  bool valid_uplo  = (uplo[0] == 'U') || (uplo[0] == 'u') ||
+                     (uplo[0] == 'L') || (uplo[0] == 'l');
+  bool valid_trans = (trans[0] == 'N') || (trans[0] == 'n') ||
+                     (trans[0] == t) || (trans[0] == t - 'A' + 'a');
+  if(!(valid_uplo && valid_trans)) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": uplo[0] = '" << uplo[0] << "' trans[0] = '" << trans[0] << "'. "
+       << "Valid values are 'U' or 'u' (Upper), 'L' or 'l' (Lower) for uplo, and "
+       << "'N' or 'n' (No transpose), '" << t << "' or '" << char(t - 'A' + 'a') << "' for trans.";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Check compatibility of dimensions at run time.
+  const bool A_t = !(trans[0] == 'N' || trans[0] == 'n');
+  int64_t A0 = A.extent(0);
+  int64_t A1 = A.extent(1);
+  int64_t C0 = C.extent(0);
+  int64_t C1 = C.extent(1);
+
+  if ( (C0 != C1) || ((A_t ? A1 : A0) != C0) ) {
+    std::ostringstream os;
+    os << "KokkosBlas::" << name << ": Dimensions of A and C do not match: "
+       << "trans: " << trans[0]
+       << " A: " << A.extent(0) << " x " << A.extent(1)
+       << " C: " << C.extent(0) << " x " << C.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Return if degenerated matrices are provided.  An empty inner
+  // dimension still scales C by beta.
+  if(C.extent(0) == 0)
+    return;
+
+  // Minimize the number of Impl::SYRK instantiations, by
+  // standardizing on particular View specializations for its template
+  // parameters.
+  typedef Kokkos::View<typename AViewType::const_value_type**,
+    typename AViewType::array_layout,
+    typename AViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > AVT;
+  typedef Kokkos::View<typename CViewType::non_const_value_type**,
+    typename CViewType::array_layout,
+    typename CViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > CVT;
+  typedef Impl::SYRK<AVT, CVT> impl_type;
+  impl_type::syrk (uplo, trans, herm, alpha, A, beta, C);
+}
+
+} // namespace Impl
+
+/// \brief Symmetric rank-k update of one triangle of C:
+///   C := alpha*A*A^T + beta*C if trans is "N", or
+///   C := alpha*A^T*A + beta*C if trans is "T".
+///
+/// When C is at most KOKKOSBLAS3_SYRK_GRAM_MAX_K (64) wide, this uses
+/// a dedicated tall-skinny kernel: each team reduces the k x k Gram
+/// triangle of a chunk of rows in scratch, and the per-team triangles
+/// are combined in a pairwise tree.  Wider C are blocked recursively,
+/// with only the off-diagonal blocks handed to KokkosBlas::gemm.
+///
+/// \tparam AViewType Input matrix, as a 2-D Kokkos::View
+/// \tparam CViewType Output matrix, as a nonconst 2-D Kokkos::View
+///
+/// \param uplo [in] "U" to update the upper triangle of C, "L" to
+///   update the lower triangle.  The other triangle is not referenced.
+/// \param trans [in] "N" for C = A*A^T, "T" for C = A^T*A.
+/// \param alpha [in] Input coefficient of the product
+/// \param A [in] Input matrix, as a 2-D Kokkos::View
+/// \param beta [in] Input coefficient of C
+/// \param C [in/out] Output matrix, as a square nonconst 2-D Kokkos::View
+///
+/// All characters after the first in uplo and trans are ignored.  This
+/// works just like the BLAS routines.
+template<class AViewType,
+         class CViewType>
+void
+syrk (const char uplo[],
+      const char trans[],
+      typename CViewType::const_value_type& alpha,
+      const AViewType& A,
+      typename CViewType::const_value_type& beta,
+      const CViewType& C)
+{
+  Impl::syrk_check_and_invoke ("syrk", uplo, trans, false, alpha, A, beta, C);
+}
+
+/// \brief Hermitian rank-k update of one triangle of C:
+///   C := alpha*A*A^H + beta*C if trans is "N", or
+///   C := alpha*A^H*A + beta*C if trans is "C".
+///
+/// Same algorithm as syrk().  As in the BLAS, alpha and beta are real,
+/// so that C stays Hermitian.
+///
+/// \param uplo [in] "U" or "L", see syrk().
+/// \param trans [in] "N" for C = A*A^H, "C" for C = A^H*A.
+template<class AViewType,
+         class CViewType>
+void
+herk (const char uplo[],
+      const char trans[],
+      typename Kokkos::Details::ArithTraits<typename CViewType::non_const_value_type>::mag_type alpha,
+      const AViewType& A,
+      typename Kokkos::Details::ArithTraits<typename CViewType::non_const_value_type>::mag_type beta,
+      const CViewType& C)
+{
+  typedef typename CViewType::non_const_value_type value_type;
+  Impl::syrk_check_and_invoke ("herk", uplo, trans, true, value_type(alpha), A, value_type(beta), C);
+}
+
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS3_SYRK_HPP_
@@ -0,0 +1,162 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS3_TRMM_HPP_
+#define KOKKOSBLAS3_TRMM_HPP_
+
+/// \file KokkosBlas3_trmm.hpp
+
+#include <KokkosKernels_Macros.hpp>
+#include <KokkosBlas3_trmm_spec.hpp>
+#include <KokkosKernels_helpers.hpp>
+#include <sstream>
+#include <type_traits>
+
+namespace KokkosBlas {
+
+/// \brief Dense triangular matrix-matrix multiply:
+///   B := alpha*op(A)*B if side is "L", or
+///   B := alpha*B*op(A) if side is "R".
+///
+/// The product is recursively blocked: diagonal blocks of at most
+/// KOKKOSBLAS3_TRMM_BLOCK_SIZE rows are multiplied directly, and the
+/// off-diagonal contributions are handed to KokkosBlas::gemm.
+///
+/// \tparam AViewType Input triangular matrix, as a 2-D Kokkos::View
+/// \tparam BViewType Input/output matrix, as a nonconst 2-D Kokkos::View
+///
+/// \param side [in] "L" if op(A) is applied from the left, "R" if it
+///   is applied from the right.
+/// \param uplo [in] "U" if A is upper triangular, "L" if A is lower
+///   triangular.  Entries of the other triangle are not referenced.
+/// \param trans [in] "N" for non-transpose, "T" for transpose, "C"
+///   for conjugate transpose.
+/// \param diag [in] "U" if A has an implicit unit diagonal, "N" if
+///   the diagonal of A is stored.
+/// \param alpha [in] Input coefficient of B
+/// \param A [in] Input matrix, as a square 2-D Kokkos::View
+/// \param B [in/out] Input matrix on entry, product on exit, as a
+///   nonconst 2-D Kokkos::View
+///
+/// All characters after the first in side, uplo, trans and diag are
+/// ignored.  This works just like the BLAS routines.
+template<class AViewType,
+         class BViewType>
+void
+trmm (const char side[],
+      const char uplo[],
+      const char trans[],
+      const char diag[],
+      typename BViewType::const_value_type& alpha,
+      const AViewType& A,
+      const BViewType& B)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<BViewType>::value,
+                 "BViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (static_cast<int> (BViewType::rank) == 2,
+                 "BViewType must have rank 2.");
+  static_assert (std::is_same<typename BViewType::value_type,
+                              typename BViewType::non_const_value_type>::value,
+                 "BViewType must be nonconst.");
+
+  // Check validity of the character arguments
+  bool valid_side  = (side[0] == 'L') || (side[0] == 'l') ||
+                     (side[0] == 'R') || (side[0] == 'r');
+  bool valid_uplo  = (uplo[0] == 'U') || (uplo[0] == 'u') ||
+                     (uplo[0] == 'L') || (uplo[0] == 'l');
+  bool valid_trans = (trans[0] == 'N') || (trans[0] == 'n') ||
+                     (trans[0] == 'T') || (trans[0] == 't') ||
+                     (trans[0] == 'C') || (trans[0] == 'c');
+  bool valid_diag  = (diag[0] == 'U') || (diag[0] == 'u') ||
+                     (diag[0] == 'N') || (diag[0] == 'n');
+  if(!(valid_side && valid_uplo && valid_trans && valid_diag)) {
+    std::ostringstream os;
+    os << "KokkosBlas::trmm: side[0] = '" << side[0] << "' uplo[0] = '" << uplo[0]
+       << "' trans[0] = '" << trans[0] << "' diag[0] = '" << diag[0] << "'. "
+       << "Valid values are 'L'/'R' for side, 'U'/'L' for uplo, "
+       << "'N'/'T'/'C' for trans and 'U'/'N' for diag (either case).";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Check compatibility of dimensions at run time.
+  const bool is_left = (side[0] == 'L') || (side[0] == 'l');
+  int64_t A0 = A.extent(0);
+  int64_t A1 = A.extent(1);
+  int64_t B0 = B.extent(0);
+  int64_t B1 = B.extent(1);
+
+  if ( (A0 != A1) || (A0 != (is_left ? B0 : B1)) ) {
+    std::ostringstream os;
+    os << "KokkosBlas::trmm: Dimensions of A and B do not match: "
+       << "side: " << side[0]
+       << " A: " << A.extent(0) << " x " << A.extent(1)
+       << " B: " << B.extent(0) << " x " << B.extent(1);
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+
+  // Return if degenerated matrices are provided
+  if((B.extent(0) == 0) || (B.extent(1) == 0))
+    return;
+
+  // Minimize the number of Impl::TRMM instantiations, by
+  // standardizing on particular View specializations for its template
+  // parameters.
+  typedef Kokkos::View<typename AViewType::const_value_type**,
+    typename AViewType::array_layout,
+    typename AViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > AVT;
+  typedef Kokkos::View<typename BViewType::non_const_value_type**,
+    typename BViewType::array_layout,
+    typename BViewType::device_type,
+    Kokkos::MemoryTraits<Kokkos::Unmanaged> > BVT;
+  typedef Impl::TRMM<AVT, BVT> impl_type;
+  impl_type::trmm (side, uplo, trans, diag, alpha, A, B);
+}
+
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS3_TRMM_HPP_
@@ -0,0 +1,269 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_AXPBY_DOT_IMPL_HPP_
+#define KOKKOSBLAS1_AXPBY_DOT_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// \brief Fused axpby and dot product functor for single vectors:
+///   y := a*x + b*y, then sum dot(w(i), y(i)).
+///
+/// w may be the same View as y; it is read after y(i) is written, so
+/// the dot product always sees the updated y.  If b is zero, y is not
+/// read, so it may hold Inf or NaN on input.
+///
+/// \tparam XV 1-D input View
+/// \tparam YV 1-D input/output View
+/// \tparam WV 1-D input View
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class XV, class YV, class WV, class SizeType = typename YV::size_type>
+struct V_AxpbyDot_Functor
+{
+  typedef typename YV::execution_space              execution_space;
+  typedef SizeType                                        size_type;
+  typedef typename YV::non_const_value_type             yvalue_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<yvalue_type> IPT;
+  typedef Kokkos::Details::ArithTraits<typename IPT::dot_type>   AT;
+  typedef typename IPT::dot_type                         value_type;
+
+  typename XV::non_const_value_type m_a;
+  typename YV::non_const_value_type m_b;
+  typename XV::const_type m_x;
+  YV m_y;
+  typename WV::const_type m_w;
+
+  V_AxpbyDot_Functor (const typename XV::non_const_value_type& a, const XV& x,
+                      const typename YV::non_const_value_type& b, const YV& y,
+                      const WV& w) :
+    m_a (a), m_b (b), m_x (x), m_y (y), m_w (w)
+  {
+    static_assert (Kokkos::Impl::is_view<XV>::value && Kokkos::Impl::is_view<YV>::value &&
+                   Kokkos::Impl::is_view<WV>::value,
+                   "KokkosBlas::Impl::V_AxpbyDot_Functor: "
+                   "X, Y and W must be Kokkos::View specializations.");
+    static_assert (XV::rank == 1 && YV::rank == 1 && WV::rank == 1,
+                   "KokkosBlas::Impl::V_AxpbyDot_Functor: "
+                   "X, Y and W must have rank 1.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i, value_type& sum) const
+  {
+    const yvalue_type y_i = m_b == Kokkos::Details::ArithTraits<yvalue_type>::zero () ?
+      yvalue_type (m_a * m_x(i)) : yvalue_type (m_a * m_x(i) + m_b * m_y(i));
+    m_y(i) = y_i;
+    sum += IPT::dot (m_w(i), y_i);
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type& update) const
+  {
+    update = AT::zero ();
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type& update,
+        const value_type& source) const
+  {
+    update += source;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type& update,
+        const volatile value_type& source) const
+  {
+    update += source;
+  }
+};
+
+/// \brief Column-wise fused axpby and dot product functor for
+///   multivectors: Y(:,j) := a*X(:,j) + b*Y(:,j), then
+///   r(j) = dot(W(:,j), Y(:,j)).
+///
+/// \tparam RV 1-D output View
+/// \tparam XMV 2-D input View
+/// \tparam YMV 2-D input/output View
+/// \tparam WMV 2-D input View
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class RV, class XMV, class YMV, class WMV, class SizeType = typename YMV::size_type>
+struct MV_AxpbyDot_Functor
+{
+  typedef typename YMV::execution_space             execution_space;
+  typedef SizeType                                        size_type;
+  typedef typename YMV::non_const_value_type            yvalue_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<yvalue_type> IPT;
+  typedef Kokkos::Details::ArithTraits<typename IPT::dot_type>   AT;
+  typedef typename IPT::dot_type                       value_type[];
+
+  size_type value_count;
+  typename XMV::non_const_value_type m_a;
+  typename YMV::non_const_value_type m_b;
+  typename XMV::const_type m_x;
+  YMV m_y;
+  typename WMV::const_type m_w;
+
+  MV_AxpbyDot_Functor (const typename XMV::non_const_value_type& a, const XMV& x,
+                       const typename YMV::non_const_value_type& b, const YMV& y,
+                       const WMV& w) :
+    value_count (y.extent(1)), m_a (a), m_b (b), m_x (x), m_y (y), m_w (w)
+  {
+    static_assert (Kokkos::Impl::is_view<RV>::value,
+                   "KokkosBlas::Impl::MV_AxpbyDot_Functor: "
+                   "R is not a Kokkos::View.");
+    static_assert (RV::rank == 1 && XMV::rank == 2 && YMV::rank == 2 && WMV::rank == 2,
+                   "KokkosBlas::Impl::MV_AxpbyDot_Functor: "
+                   "RV must have rank 1 and XMV, YMV and WMV must have rank 2.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type i, value_type sum) const
+  {
+    const size_type numVecs = value_count;
+    const bool b_zero = (m_b == Kokkos::Details::ArithTraits<yvalue_type>::zero ());
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < numVecs; ++j) {
+      const yvalue_type y_ij = b_zero ?
+        yvalue_type (m_a * m_x(i,j)) : yvalue_type (m_a * m_x(i,j) + m_b * m_y(i,j));
+      m_y(i,j) = y_ij;
+      sum[j] += IPT::dot (m_w(i,j), y_ij);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type update) const
+  {
+    const size_type numVecs = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j] = AT::zero ();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type update,
+        const volatile value_type source) const
+  {
+    const size_type numVecs = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j] += source[j];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type update,
+        const value_type source) const
+  {
+    const size_type numVecs = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j] += source[j];
+    }
+  }
+};
+
+template<class XV, class YV, class WV, class SizeType>
+typename Kokkos::Details::InnerProductSpaceTraits<typename YV::non_const_value_type>::dot_type
+V_AxpbyDot_Invoke (const typename XV::non_const_value_type& a, const XV& X,
+                   const typename YV::non_const_value_type& b, const YV& Y,
+                   const WV& W)
+{
+  typedef typename YV::execution_space execution_space;
+  typedef V_AxpbyDot_Functor<XV, YV, WV, SizeType> functor_type;
+
+  const SizeType numRows = static_cast<SizeType> (Y.extent(0));
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  typename functor_type::value_type result;
+  functor_type op (a, X, b, Y, W);
+  Kokkos::parallel_reduce ("KokkosBlas::axpby_dot", policy, op, result);
+  return result;
+}
+
+template<class RV, class XMV, class YMV, class WMV, class SizeType>
+void
+MV_AxpbyDot_Invoke (const RV& r,
+                    const typename XMV::non_const_value_type& a, const XMV& X,
+                    const typename YMV::non_const_value_type& b, const YMV& Y,
+                    const WMV& W)
+{
+  typedef typename YMV::execution_space execution_space;
+
+  const SizeType numRows = static_cast<SizeType> (Y.extent(0));
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  MV_AxpbyDot_Functor<RV, XMV, YMV, WMV, SizeType> op (a, X, b, Y, W);
+  Kokkos::parallel_reduce ("KokkosBlas::axpby_dot[MV]", policy, op, r);
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_AXPBY_DOT_IMPL_HPP_
@@ -666,6 +666,149 @@ struct Dot_MV<RV, XV, YMV, SizeType, 1, 2> {
   }
 };
 
+/// \brief Functor for the all-pairs ("multi") dot product of two
+///   multivectors: R(i,j) = dot(X(:,i), Y(:,j)) for every column i
+///   of X and j of Y, computed in a single pass over the rows.
+///
+/// This generalizes MV_Dot_Right_FunctorVector, which only pairs
+/// column j of X with column j of Y.  Each thread accumulates all
+/// numColsX*numColsY products of a row at once, so X and Y are each
+/// read from memory once, instead of once per pair.
+///
+/// \tparam RV 2-D output View (numColsX x numColsY)
+/// \tparam XMV 2-D input View
+/// \tparam YMV 2-D input View
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class RV, class XMV, class YMV, class SizeType = typename XMV::size_type>
+struct MV_MultiDot_Functor
+{
+  typedef typename XMV::execution_space             execution_space;
+  typedef SizeType                                        size_type;
+  typedef typename XMV::non_const_value_type            xvalue_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<xvalue_type> IPT;
+  typedef Kokkos::Details::ArithTraits<typename IPT::dot_type>   AT;
+  typedef typename IPT::dot_type                       value_type[];
+
+  size_type value_count;
+  size_type m_numColsX;
+  size_type m_numColsY;
+  typename XMV::const_type m_x;
+  typename YMV::const_type m_y;
+
+  MV_MultiDot_Functor (const XMV& x, const YMV& y) :
+    value_count (x.extent(1) * y.extent(1)),
+    m_numColsX (x.extent(1)), m_numColsY (y.extent(1)), m_x (x), m_y (y)
+  {
+    static_assert (Kokkos::Impl::is_view<RV>::value, "KokkosBlas::Impl::"
+                   "MV_MultiDot_Functor: R is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<XMV>::value, "KokkosBlas::Impl::"
+                   "MV_MultiDot_Functor: X is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<YMV>::value, "KokkosBlas::Impl::"
+                   "MV_MultiDot_Functor: Y is not a Kokkos::View.");
+    static_assert (RV::rank == 2 && XMV::rank == 2 && YMV::rank == 2,
+                   "KokkosBlas::Impl::MV_MultiDot_Functor: "
+                   "RV, XMV and YMV must have rank 2.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type i, value_type sum) const
+  {
+    const size_type numColsX = m_numColsX;
+    const size_type numColsY = m_numColsY;
+    for (size_type k = 0; k < numColsY; ++k) {
+      const typename YMV::non_const_value_type y_ik = m_y(i,k);
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+      for (size_type j = 0; j < numColsX; ++j) {
+        sum[j + k*numColsX] += IPT::dot (m_x(i,j), y_ik);
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type update) const
+  {
+    const size_type count = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < count; ++j) {
+      update[j] = AT::zero ();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type update,
+        const volatile value_type source) const
+  {
+    const size_type count = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < count; ++j) {
+      update[j] += source[j];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type update,
+        const value_type source) const
+  {
+    const size_type count = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < count; ++j) {
+      update[j] += source[j];
+    }
+  }
+};
+
+/// \brief Compute the all-pairs dot products R(i,j) = dot(X(:,i),
+///   Y(:,j)) in one pass over the rows of X and Y.
+///
+/// The reduction result is packed column-major into a contiguous
+/// buffer, which is then copied into R, so R may have any layout.
+template<class RV, class XMV, class YMV, class SizeType>
+void
+MV_MultiDot_Invoke (const RV& r, const XMV& X, const YMV& Y)
+{
+  typedef typename XMV::execution_space execution_space;
+  typedef Kokkos::View<typename RV::non_const_value_type*, Kokkos::LayoutLeft,
+    typename RV::device_type> packed_type;
+
+  const SizeType numRows = static_cast<SizeType> (X.extent(0));
+  const SizeType numColsX = static_cast<SizeType> (X.extent(1));
+  const SizeType numColsY = static_cast<SizeType> (Y.extent(1));
+  if (numColsX == 0 || numColsY == 0) {
+    return;
+  }
+
+  packed_type packed (Kokkos::ViewAllocateWithoutInitializing ("KokkosBlas::dot::multi"),
+                      numColsX * numColsY);
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+  MV_MultiDot_Functor<RV, XMV, YMV, SizeType> op (X, Y);
+  Kokkos::parallel_reduce ("KokkosBlas::dot[MultiDot]", policy, op, packed);
+
+  Kokkos::View<typename RV::non_const_value_type**, Kokkos::LayoutLeft,
+    typename RV::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+    packed2d (packed.data (), numColsX, numColsY);
+  Kokkos::deep_copy (r, packed2d);
+}
+
 } // namespace Impl
 } // namespace KokkosBlas
 
@@ -0,0 +1,324 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_IAMAX_IMPL_HPP_
+#define KOKKOSBLAS1_IAMAX_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <KokkosBlas1_iamax_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// \brief Magnitude used to rank entries in iamax: |Re(x)| + |Im(x)|,
+///   as in BLAS i?amax.  For real x this is just |x|.
+template<class Scalar>
+KOKKOS_INLINE_FUNCTION
+typename Kokkos::Details::ArithTraits<Scalar>::mag_type
+iamax_magnitude (const Scalar& x)
+{
+  typedef Kokkos::Details::ArithTraits<Scalar> AT;
+  typedef Kokkos::Details::ArithTraits<typename AT::mag_type> MAT;
+  return MAT::abs (AT::real (x)) + MAT::abs (AT::imag (x));
+}
+
+/// \brief Largest magnitude seen so far and the (0-based) index of
+///   its first occurrence.
+template<class MagType, class SizeType>
+struct IamaxValue {
+  MagType val;
+  SizeType loc;
+};
+
+/// \brief Keep the larger magnitude; on ties keep the smaller index,
+///   so the result does not depend on the order of the reduction.
+template<class MagType, class SizeType>
+KOKKOS_INLINE_FUNCTION void
+iamax_join (IamaxValue<MagType,SizeType>& update,
+            const MagType val, const SizeType loc)
+{
+  if (val > update.val || (val == update.val && loc < update.loc)) {
+    update.val = val;
+    update.loc = loc;
+  }
+}
+
+//
+// iamax
+//
+
+/// \brief iamax functor for single vectors.
+///
+/// \tparam RV 0-D output View
+/// \tparam XV 1-D input View
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class RV, class XV, class SizeType = typename XV::size_type>
+struct V_Iamax_Functor
+{
+  typedef typename XV::execution_space              execution_space;
+  typedef SizeType                                        size_type;
+  typedef typename XV::non_const_value_type             xvalue_type;
+  typedef typename Kokkos::Details::ArithTraits<xvalue_type>::mag_type mag_type;
+  typedef IamaxValue<mag_type, size_type>                value_type;
+
+  typename XV::const_type m_x;
+  size_type m_n;
+
+  V_Iamax_Functor (const XV& x) :
+    m_x (x), m_n (x.extent(0))
+  {
+    static_assert (Kokkos::Impl::is_view<RV>::value,
+                   "KokkosBlas::Impl::V_Iamax_Functor: "
+                   "R is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<XV>::value,
+                   "KokkosBlas::Impl::V_Iamax_Functor: "
+                   "X is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_same<typename RV::value_type,
+                   typename RV::non_const_value_type>::value,
+                   "KokkosBlas::Impl::V_Iamax_Functor: R is const.  "
+                   "It must be nonconst, because it is an output argument "
+                   "(we have to be able to write to its entries).");
+    static_assert (RV::rank == 0 && XV::rank == 1,
+                   "KokkosBlas::Impl::V_Iamax_Functor: "
+                   "RV must have rank 0 and XV must have rank 1.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i, value_type& lmax) const
+  {
+    iamax_join (lmax, iamax_magnitude (m_x(i)), i);
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type& update) const
+  {
+    update.val = Kokkos::Details::ArithTraits<mag_type>::zero ();
+    update.loc = m_n;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type& update,
+        const volatile value_type& source) const
+  {
+    if (source.val > update.val ||
+        (source.val == update.val && source.loc < update.loc)) {
+      update.val = source.val;
+      update.loc = source.loc;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type& update,
+        const value_type& source) const
+  {
+    iamax_join (update, source.val, source.loc);
+  }
+};
+
+/// \brief Column-wise iamax functor for multivectors; works for
+///   any layout, but best performance with LayoutRight.
+///
+/// \tparam RV 1-D output View
+/// \tparam XMV 2-D input View
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class RV, class XMV, class SizeType = typename XMV::size_type>
+struct MV_Iamax_Right_FunctorVector
+{
+  typedef typename XMV::execution_space             execution_space;
+  typedef SizeType                                        size_type;
+  typedef typename XMV::non_const_value_type            xvalue_type;
+  typedef typename Kokkos::Details::ArithTraits<xvalue_type>::mag_type mag_type;
+  typedef IamaxValue<mag_type, size_type>                 entry_type;
+  typedef entry_type                                   value_type[];
+
+  size_type value_count;
+  typename XMV::const_type m_x;
+  size_type m_n;
+
+  MV_Iamax_Right_FunctorVector (const XMV& x) :
+    value_count (x.extent(1)), m_x (x), m_n (x.extent(0))
+  {
+    static_assert (Kokkos::Impl::is_view<RV>::value,
+                   "KokkosBlas::Impl::MV_Iamax_Right_FunctorVector: "
+                   "R is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<XMV>::value,
+                   "KokkosBlas::Impl::MV_Iamax_Right_FunctorVector: "
+                   "X is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_same<typename RV::value_type,
+                   typename RV::non_const_value_type>::value,
+                   "KokkosBlas::Impl::MV_Iamax_Right_FunctorVector: "
+                   "R is const.  It must be nonconst, because it is an output "
+                   "argument (we must be able to write to its entries).");
+    static_assert (RV::rank == 1 && XMV::rank == 2,
+                   "KokkosBlas::Impl::MV_Iamax_Right_FunctorVector: "
+                   "RV must have rank 1 and XMV must have rank 2.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type i, value_type lmax) const
+  {
+    const size_type numVecs = value_count;
+    for (size_type j = 0; j < numVecs; ++j) {
+      iamax_join (lmax[j], iamax_magnitude (m_x(i,j)), i);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type update) const
+  {
+    const size_type numVecs = value_count;
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j].val = Kokkos::Details::ArithTraits<mag_type>::zero ();
+      update[j].loc = m_n;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type update,
+        const volatile value_type source) const
+  {
+    const size_type numVecs = value_count;
+    for (size_type j = 0; j < numVecs; ++j) {
+      if (source[j].val > update[j].val ||
+          (source[j].val == update[j].val && source[j].loc < update[j].loc)) {
+        update[j].val = source[j].val;
+        update[j].loc = source[j].loc;
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type update,
+        const value_type source) const
+  {
+    const size_type numVecs = value_count;
+    for (size_type j = 0; j < numVecs; ++j) {
+      iamax_join (update[j], source[j].val, source[j].loc);
+    }
+  }
+};
+
+
+/// \brief Find the (1-based) index of the entry of largest magnitude
+///   of the single vector (1-D View) X, and store it in the 0-D View r.
+///
+/// If every entry of X is NaN, the result is 1, as in reference BLAS.
+template<class RV, class XV, class SizeType>
+void
+V_Iamax_Invoke (const RV& r, const XV& X)
+{
+  typedef typename XV::execution_space execution_space;
+  typedef typename RV::non_const_value_type index_type;
+
+  const SizeType numRows = static_cast<SizeType> (X.extent(0));
+
+  // BLAS returns 0 for an empty vector.
+  if( numRows == 0 ) {
+    Kokkos::deep_copy(r,index_type(0));
+    return;
+  }
+
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  typedef V_Iamax_Functor<RV, XV, SizeType> functor_type;
+  functor_type op (X);
+  typename functor_type::value_type result;
+  Kokkos::parallel_reduce (policy, op, result);
+  Kokkos::deep_copy(r,index_type(result.loc < numRows ? result.loc + 1 : 1));
+}
+
+
+/// \brief Find the (1-based) indices of the entries of largest
+///   magnitude of the columns of the multivector (2-D View) X, and
+///   store them in the 1-D View r.
+template<class RV, class XMV, class SizeType>
+void
+MV_Iamax_Invoke (const RV& r, const XMV& X)
+{
+  typedef typename XMV::execution_space execution_space;
+  typedef typename RV::non_const_value_type index_type;
+
+  const SizeType numRows = static_cast<SizeType> (X.extent(0));
+  const SizeType numCols = static_cast<SizeType> (X.extent(1));
+
+  // BLAS returns 0 for an empty vector.
+  if( numRows == 0 ) {
+    Kokkos::deep_copy(r,index_type(0));
+    return;
+  }
+
+  // If the input multivector (2-D View) has only one column, invoke
+  // the single-vector version of the kernel.
+  if (numCols == 1) {
+    typedef Kokkos::View<typename RV::non_const_value_type,
+                         typename RV::array_layout,
+                         typename RV::device_type,
+                         Kokkos::MemoryTraits<Kokkos::Unmanaged>> RV0D;
+    RV0D r_0(r, 0);
+    auto X_0 = Kokkos::subview (X, Kokkos::ALL (), 0);
+    typedef decltype (X_0) XV1D;
+    V_Iamax_Invoke<RV0D, XV1D, SizeType> (r_0, X_0);
+  }
+  else {
+    typedef MV_Iamax_Right_FunctorVector<RV, XMV, SizeType> functor_type;
+    typedef typename functor_type::entry_type entry_type;
+
+    Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+    functor_type op (X);
+    Kokkos::View<entry_type*, Kokkos::HostSpace> result ("Iamax::Result", numCols);
+    Kokkos::parallel_reduce (policy, op, result);
+
+    typename RV::HostMirror h_r = Kokkos::create_mirror_view (r);
+    for (SizeType j = 0; j < numCols; ++j) {
+      h_r(j) = result(j).loc < numRows ? result(j).loc + 1 : 1;
+    }
+    Kokkos::deep_copy (r, h_r);
+  }
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_IAMAX_IMPL_HPP_
@@ -0,0 +1,451 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_REPRODUCIBLE_IMPL_HPP_
+#define KOKKOSBLAS1_REPRODUCIBLE_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+#include <cmath>
+#include <limits>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// Reproducible (order-independent) reductions.
+//
+// We use the binned summation of Demmel and Nguyen ("Fast
+// reproducible floating-point summation", ARITH 2013), on which
+// ReproBLAS is built.  A first pass computes delta = max_i |t_i| over
+// the terms t_i of the sum.  From delta and the number of terms n, we
+// pick KOKKOSBLAS_REPRODUCIBLE_FOLD extractors M_k = 1.5 * 2^{e_k}.
+// For each term and level k, q = (M_k + t) - M_k rounds t to a
+// multiple of ulp(M_k); we add q to bin k and carry the exact
+// remainder t - q to the next level.  e_0 is chosen so that the sum
+// of all n rounded terms fits in the significand, and each e_{k+1}
+// so that the sum of all n level-k remainders does.  Thus every bin
+// is summed exactly, in any order and with any split among threads,
+// and the result depends only on the multiset of terms.
+//
+// Each level keeps about (digits - log2(n)) bits, so three levels
+// make the result at least as accurate as ordinary summation in
+// practice.  float terms are binned in double, which leaves more
+// bits per level.
+//
+// Determinism also requires that each term t_i is computed the same
+// way everywhere.  Do not build with value-unsafe floating-point
+// optimizations (e.g., -ffast-math), which may contract or
+// reassociate the extraction step.
+//
+
+#define KOKKOSBLAS_REPRODUCIBLE_FOLD 3
+
+/// \brief Type in which we bin terms of type T.
+template<class T>
+struct ReproducibleAccumType {
+  typedef T type;
+};
+
+template<>
+struct ReproducibleAccumType<float> {
+  typedef double type;
+};
+
+/// \brief Split a (possibly complex) term into its real components,
+///   and reassemble a result from them.
+template<class T, bool is_complex = Kokkos::Details::ArithTraits<T>::is_complex>
+struct ReproducibleParts {
+  typedef typename Kokkos::Details::ArithTraits<T>::mag_type mag_type;
+  typedef typename ReproducibleAccumType<mag_type>::type accum_type;
+  enum { count = 1 };
+
+  KOKKOS_INLINE_FUNCTION static accum_type
+  get (const T& v, const int /* p */) {
+    return static_cast<accum_type> (v);
+  }
+
+  static T make (const accum_type parts[]) {
+    return static_cast<T> (parts[0]);
+  }
+};
+
+template<class T>
+struct ReproducibleParts<T, true> {
+  typedef Kokkos::Details::ArithTraits<T> AT;
+  typedef typename AT::mag_type mag_type;
+  typedef typename ReproducibleAccumType<mag_type>::type accum_type;
+  enum { count = 2 };
+
+  KOKKOS_INLINE_FUNCTION static accum_type
+  get (const T& v, const int p) {
+    return static_cast<accum_type> (p == 0 ? AT::real (v) : AT::imag (v));
+  }
+
+  static T make (const accum_type parts[]) {
+    return T (static_cast<mag_type> (parts[0]), static_cast<mag_type> (parts[1]));
+  }
+};
+
+/// \brief Entry (i,j) of a 1-D (j ignored) or 2-D View.
+template<class V, int rank = V::rank>
+struct ReproducibleAccess {
+  template<class SizeType>
+  KOKKOS_INLINE_FUNCTION static typename V::const_value_type&
+  get (const V& v, const SizeType i, const SizeType /* j */) {
+    return v(i);
+  }
+};
+
+template<class V>
+struct ReproducibleAccess<V, 2> {
+  template<class SizeType>
+  KOKKOS_INLINE_FUNCTION static typename V::const_value_type&
+  get (const V& v, const SizeType i, const SizeType j) {
+    return v(i,j);
+  }
+};
+
+/// \brief Term t(i,j) = conj(x(i,j)) * y(i,j) of a dot product.
+template<class XV, class YV>
+struct ReproducibleDotTerm {
+  typedef typename XV::execution_space execution_space;
+  typedef Kokkos::Details::InnerProductSpaceTraits<typename XV::non_const_value_type> IPT;
+  typedef typename IPT::dot_type value_type;
+
+  typename XV::const_type m_x;
+  typename YV::const_type m_y;
+
+  ReproducibleDotTerm (const XV& x, const YV& y) : m_x (x), m_y (y) {}
+
+  template<class SizeType>
+  KOKKOS_INLINE_FUNCTION value_type
+  operator() (const SizeType i, const SizeType j) const {
+    return IPT::dot (ReproducibleAccess<typename XV::const_type>::get (m_x, i, j),
+                     ReproducibleAccess<typename YV::const_type>::get (m_y, i, j));
+  }
+};
+
+/// \brief Term t(i,j) = |x(i,j)|^2 of a squared 2-norm.
+template<class XV>
+struct ReproducibleSquareTerm {
+  typedef typename XV::execution_space execution_space;
+  typedef Kokkos::Details::InnerProductSpaceTraits<typename XV::non_const_value_type> IPT;
+  typedef typename IPT::mag_type value_type;
+
+  typename XV::const_type m_x;
+
+  ReproducibleSquareTerm (const XV& x) : m_x (x) {}
+
+  template<class SizeType>
+  KOKKOS_INLINE_FUNCTION value_type
+  operator() (const SizeType i, const SizeType j) const {
+    const value_type tmp =
+      IPT::norm (ReproducibleAccess<typename XV::const_type>::get (m_x, i, j));
+    return tmp * tmp;
+  }
+};
+
+/// \brief Term t(i,j) = x(i,j) of a sum.
+template<class XV>
+struct ReproducibleSumTerm {
+  typedef typename XV::execution_space execution_space;
+  typedef typename XV::non_const_value_type value_type;
+
+  typename XV::const_type m_x;
+
+  ReproducibleSumTerm (const XV& x) : m_x (x) {}
+
+  template<class SizeType>
+  KOKKOS_INLINE_FUNCTION value_type
+  operator() (const SizeType i, const SizeType j) const {
+    return ReproducibleAccess<typename XV::const_type>::get (m_x, i, j);
+  }
+};
+
+/// \brief First pass: max |component| of the terms of each column.
+///
+/// \tparam TermOp One of the Reproducible*Term functors above.
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class TermOp, class SizeType>
+struct Reproducible_MaxAbs_Functor
+{
+  typedef typename TermOp::execution_space         execution_space;
+  typedef SizeType                                       size_type;
+  typedef ReproducibleParts<typename TermOp::value_type>     Parts;
+  typedef typename Parts::accum_type                    accum_type;
+  typedef Kokkos::Details::ArithTraits<accum_type>              AT;
+  typedef accum_type                                  value_type[];
+
+  size_type value_count;
+  TermOp m_op;
+  size_type m_numCols;
+
+  Reproducible_MaxAbs_Functor (const TermOp& op, const size_type numCols) :
+    value_count (numCols * Parts::count), m_op (op), m_numCols (numCols)
+  {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type i, value_type update) const
+  {
+    for (size_type j = 0; j < m_numCols; ++j) {
+      const typename TermOp::value_type t = m_op (i, j);
+      for (int p = 0; p < Parts::count; ++p) {
+        const accum_type a = AT::abs (Parts::get (t, p));
+        if (a > update[j*Parts::count + p]) {
+          update[j*Parts::count + p] = a;
+        }
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type update) const
+  {
+    for (size_type j = 0; j < value_count; ++j) {
+      update[j] = AT::zero ();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type update,
+        const volatile value_type source) const
+  {
+    for (size_type j = 0; j < value_count; ++j) {
+      if (source[j] > update[j]) {
+        update[j] = source[j];
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type update,
+        const value_type source) const
+  {
+    for (size_type j = 0; j < value_count; ++j) {
+      if (source[j] > update[j]) {
+        update[j] = source[j];
+      }
+    }
+  }
+};
+
+/// \brief Second pass: binned sums of the terms of each column.
+///
+/// Bin k of component p of column j lives at
+/// (j*Parts::count + p)*KOKKOSBLAS_REPRODUCIBLE_FOLD + k, in both the
+/// extractor View and the reduction result.  A zero extractor at
+/// level 0 means "sum this component plainly" (all terms zero, or
+/// some not finite); a zero extractor at a later level ends the fold
+/// (the remainders would underflow).
+///
+/// \tparam TermOp One of the Reproducible*Term functors above.
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class TermOp, class SizeType>
+struct Reproducible_BinnedSum_Functor
+{
+  typedef typename TermOp::execution_space         execution_space;
+  typedef SizeType                                       size_type;
+  typedef ReproducibleParts<typename TermOp::value_type>     Parts;
+  typedef typename Parts::accum_type                    accum_type;
+  typedef Kokkos::Details::ArithTraits<accum_type>              AT;
+  typedef accum_type                                  value_type[];
+
+  size_type value_count;
+  TermOp m_op;
+  size_type m_numCols;
+  Kokkos::View<const accum_type*, execution_space> m_extractor;
+
+  Reproducible_BinnedSum_Functor (const TermOp& op, const size_type numCols,
+                                  const Kokkos::View<const accum_type*, execution_space>& extractor) :
+    value_count (numCols * Parts::count * KOKKOSBLAS_REPRODUCIBLE_FOLD),
+    m_op (op), m_numCols (numCols), m_extractor (extractor)
+  {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type i, value_type sum) const
+  {
+    for (size_type j = 0; j < m_numCols; ++j) {
+      const typename TermOp::value_type v = m_op (i, j);
+      for (int p = 0; p < Parts::count; ++p) {
+        const size_type bin = (j*Parts::count + p) * KOKKOSBLAS_REPRODUCIBLE_FOLD;
+        accum_type t = Parts::get (v, p);
+        for (int k = 0; k < KOKKOSBLAS_REPRODUCIBLE_FOLD; ++k) {
+          const accum_type M = m_extractor(bin + k);
+          if (M == AT::zero ()) {
+            if (k == 0) {
+              sum[bin] += t;
+            }
+            break;
+          }
+          const accum_type q = (M + t) - M;
+          sum[bin + k] += q;
+          t -= q;
+        }
+      }
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type update) const
+  {
+    for (size_type j = 0; j < value_count; ++j) {
+      update[j] = AT::zero ();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type update,
+        const volatile value_type source) const
+  {
+    for (size_type j = 0; j < value_count; ++j) {
+      update[j] += source[j];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type update,
+        const value_type source) const
+  {
+    for (size_type j = 0; j < value_count; ++j) {
+      update[j] += source[j];
+    }
+  }
+};
+
+/// \brief Choose the extractors of one component from its max
+///   |term| and the number of terms.
+template<class accum_type>
+void
+reproducible_extractors (accum_type M[], const accum_type maxAbs, const size_t numRows)
+{
+  typedef std::numeric_limits<accum_type> limits;
+
+  for (int k = 0; k < KOKKOSBLAS_REPRODUCIBLE_FOLD; ++k) {
+    M[k] = accum_type (0);
+  }
+  if (! (maxAbs > accum_type (0)) || maxAbs > limits::max ()) {
+    return; // zero, NaN or Inf: sum plainly
+  }
+
+  // numRows <= 2^logN
+  int logN = 0;
+  while (logN < limits::digits && (size_t (1) << logN) < numRows) {
+    ++logN;
+  }
+  if (logN + 2 >= limits::digits) {
+    return; // not enough bits left to bin; cannot happen in practice
+  }
+
+  // maxAbs < 2^e, so the sum of all terms is less than 2^{e+logN}.
+  int e = 0;
+  std::frexp (maxAbs, &e);
+  e += logN + 1;
+  if (e + 1 > limits::max_exponent) {
+    return; // the sum may overflow anyway
+  }
+  for (int k = 0; k < KOKKOSBLAS_REPRODUCIBLE_FOLD; ++k) {
+    if (e < limits::min_exponent - 1) {
+      break; // ulp(M_k) would be subnormal
+    }
+    M[k] = std::ldexp (accum_type (1.5), e);
+    // Each remainder is at most ulp(M_k)/2 = 2^{e-digits}.
+    e += logN + 1 - limits::digits;
+  }
+}
+
+/// \brief Compute, for each column j < numCols of the terms op(i,j),
+///   the reproducible sum of each component of the terms.
+///
+/// \param result [out] Host array of length numCols * Parts::count.
+template<class TermOp, class SizeType>
+void
+Reproducible_Invoke (const TermOp& op, const SizeType numRows, const SizeType numCols,
+                     typename ReproducibleParts<typename TermOp::value_type>::accum_type result[])
+{
+  typedef typename TermOp::execution_space execution_space;
+  typedef ReproducibleParts<typename TermOp::value_type> Parts;
+  typedef typename Parts::accum_type accum_type;
+  typedef Kokkos::View<accum_type*, execution_space> extractor_type;
+
+  const SizeType numComps = numCols * Parts::count;
+  if (numComps == 0) {
+    return;
+  }
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  Kokkos::View<accum_type*, Kokkos::HostSpace> maxAbs ("KokkosBlas::reproducible::maxAbs", numComps);
+  Reproducible_MaxAbs_Functor<TermOp, SizeType> maxOp (op, numCols);
+  Kokkos::parallel_reduce ("KokkosBlas::reproducible[MaxAbs]", policy, maxOp, maxAbs);
+
+  extractor_type extractor (Kokkos::ViewAllocateWithoutInitializing ("KokkosBlas::reproducible::extractor"),
+                            numComps * KOKKOSBLAS_REPRODUCIBLE_FOLD);
+  typename extractor_type::HostMirror h_extractor = Kokkos::create_mirror_view (extractor);
+  for (SizeType c = 0; c < numComps; ++c) {
+    reproducible_extractors (&h_extractor(c * KOKKOSBLAS_REPRODUCIBLE_FOLD),
+                             maxAbs(c), static_cast<size_t> (numRows));
+  }
+  Kokkos::deep_copy (extractor, h_extractor);
+
+  Kokkos::View<accum_type*, Kokkos::HostSpace> bins ("KokkosBlas::reproducible::bins",
+                                                      numComps * KOKKOSBLAS_REPRODUCIBLE_FOLD);
+  Reproducible_BinnedSum_Functor<TermOp, SizeType> binOp (op, numCols, extractor);
+  Kokkos::parallel_reduce ("KokkosBlas::reproducible[BinnedSum]", policy, binOp, bins);
+
+  // Every bin is exact, so adding them in a fixed order, smallest
+  // first, gives the same result everywhere.
+  for (SizeType c = 0; c < numComps; ++c) {
+    accum_type s = accum_type (0);
+    for (int k = KOKKOSBLAS_REPRODUCIBLE_FOLD - 1; k >= 0; --k) {
+      s += bins(c * KOKKOSBLAS_REPRODUCIBLE_FOLD + k);
+    }
+    result[c] = s;
+  }
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_REPRODUCIBLE_IMPL_HPP_
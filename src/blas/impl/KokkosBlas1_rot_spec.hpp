@@ -0,0 +1,173 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_ROT_SPEC_HPP_
+#define KOKKOSBLAS1_ROT_SPEC_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+// Include the actual functors
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+#include <KokkosBlas1_rot_impl.hpp>
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+// Specialization struct which defines whether a specialization exists
+template<class XV, class YV, int rank = XV::rank>
+struct rot_eti_spec_avail {
+  enum : bool { value = false };
+};
+}
+}
+
+//
+// Macro for declaration of full specialization availability
+// KokkosBlas::Impl::Rot for rank == 1.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _INST macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSBLAS1_ROT_ETI_SPEC_AVAIL( SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE ) \
+    template<> \
+    struct rot_eti_spec_avail< \
+        Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+        Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                     Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+        1> { enum : bool { value = true }; };
+
+// Include the actual specialization declarations
+#include<KokkosBlas1_rot_tpl_spec_avail.hpp>
+#include<generated_specializations_hpp/KokkosBlas1_rot_eti_spec_avail.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Unification layer
+template<class XV, class YV, int rank = XV::rank,
+         bool tpl_spec_avail = rot_tpl_spec_avail<XV,YV>::value,
+         bool eti_spec_avail = rot_eti_spec_avail<XV,YV>::value>
+struct Rot {
+  static void rot (const XV& X, const YV& Y,
+                   const typename Kokkos::Details::ArithTraits<typename XV::non_const_value_type>::mag_type& c,
+                   const typename XV::non_const_value_type& s);
+};
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
+//! Full specialization of Rot for single vectors (1-D Views).
+template<class XV, class YV>
+struct Rot<XV, YV, 1, false, KOKKOSKERNELS_IMPL_COMPILE_LIBRARY>
+{
+  typedef typename XV::size_type size_type;
+
+  static void rot (const XV& X, const YV& Y,
+                   const typename Kokkos::Details::ArithTraits<typename XV::non_const_value_type>::mag_type& c,
+                   const typename XV::non_const_value_type& s)
+  {
+    static_assert (Kokkos::Impl::is_view<XV>::value, "KokkosBlas::Impl::"
+                   "Rot<1-D>: XV is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<YV>::value, "KokkosBlas::Impl::"
+                   "Rot<1-D>: YV is not a Kokkos::View.");
+    static_assert (XV::rank == 1, "KokkosBlas::Impl::Rot<1-D>: "
+                   "XV is not rank 1.");
+    static_assert (YV::rank == 1, "KokkosBlas::Impl::Rot<1-D>: "
+                   "YV is not rank 1.");
+
+    #ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+    if(KOKKOSKERNELS_IMPL_COMPILE_LIBRARY)
+      printf("KokkosBlas1::rot<> ETI specialization for < %s , %s >\n",typeid(XV).name(),typeid(YV).name());
+    else {
+      printf("KokkosBlas1::rot<> non-ETI specialization for < %s , %s >\n",typeid(XV).name(),typeid(YV).name());
+    }
+    #endif
+    const size_type numRows = X.extent(0);
+
+    if (numRows < static_cast<size_type> (INT_MAX) ) {
+      V_Rot_Invoke<XV, YV, int> (X,Y,c,s);
+    }
+    else {
+      typedef std::int64_t index_type;
+      V_Rot_Invoke<XV, YV, index_type> (X,Y,c,s);
+    }
+  }
+};
+#endif
+
+}
+}
+
+//
+// Macro for declaration of full specialization of
+// KokkosBlas::Impl::Rot for rank == 1.  This is NOT for users!!!  All
+// the declarations of full specializations go in this header file.
+// We may spread out definitions (see _DEF macro below) across one or
+// more .cpp files.
+//
+#define KOKKOSBLAS1_ROT_ETI_SPEC_DECL( SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE ) \
+extern template struct Rot< \
+         Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+         Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+         1, false, true>;
+
+//
+// Macro for definition of full specialization of
+// KokkosBlas::Impl::Rot for rank == 1.  This is NOT for users!!!  We
+// use this macro in one or more .cpp files in this directory.
+//
+#define KOKKOSBLAS1_ROT_ETI_SPEC_INST( SCALAR, LAYOUT, EXEC_SPACE, MEM_SPACE ) \
+template struct Rot< \
+         Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+         Kokkos::View<SCALAR*, LAYOUT, Kokkos::Device<EXEC_SPACE, MEM_SPACE>, \
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+         1, false, true>;
+
+#include<KokkosBlas1_rot_tpl_spec_decl.hpp>
+#include<generated_specializations_hpp/KokkosBlas1_rot_eti_spec_decl.hpp>
+
+#endif // KOKKOSBLAS1_ROT_SPEC_HPP_
@@ -0,0 +1,121 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_SWAP_IMPL_HPP_
+#define KOKKOSBLAS1_SWAP_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <KokkosBlas1_swap_spec.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+//
+// swap
+//
+
+/// \brief Functor that exchanges the entries of two single vectors.
+///
+/// \tparam XV 1-D input/output View
+/// \tparam YV 1-D input/output View
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class XV, class YV, class SizeType = typename XV::size_type>
+struct V_Swap_Functor
+{
+  typedef typename XV::execution_space              execution_space;
+  typedef SizeType                                        size_type;
+  typedef typename XV::non_const_value_type             xvalue_type;
+
+  XV m_x;
+  YV m_y;
+
+  V_Swap_Functor (const XV& x, const YV& y) :
+    m_x (x), m_y (y)
+  {
+    static_assert (Kokkos::Impl::is_view<XV>::value,
+                   "KokkosBlas::Impl::V_Swap_Functor: "
+                   "X is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<YV>::value,
+                   "KokkosBlas::Impl::V_Swap_Functor: "
+                   "Y is not a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_same<typename XV::value_type,
+                   typename XV::non_const_value_type>::value &&
+                   Kokkos::Impl::is_same<typename YV::value_type,
+                   typename YV::non_const_value_type>::value,
+                   "KokkosBlas::Impl::V_Swap_Functor: X or Y is const.  "
+                   "Both must be nonconst, because they are output arguments "
+                   "(we have to be able to write to their entries).");
+    static_assert (XV::rank == 1 && YV::rank == 1,
+                   "KokkosBlas::Impl::V_Swap_Functor: "
+                   "XV and YV must have rank 1.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i) const
+  {
+    const xvalue_type tmp = m_x(i);
+    m_x(i) = m_y(i);
+    m_y(i) = tmp;
+  }
+};
+
+/// \brief Exchange the entries of the single vectors (1-D Views) X and Y.
+template<class XV, class YV, class SizeType>
+void
+V_Swap_Invoke (const XV& X, const YV& Y)
+{
+  typedef typename XV::execution_space execution_space;
+
+  const SizeType numRows = static_cast<SizeType> (X.extent(0));
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  typedef V_Swap_Functor<XV, YV, SizeType> functor_type;
+  functor_type op (X, Y);
+  Kokkos::parallel_for (policy, op);
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_SWAP_IMPL_HPP_
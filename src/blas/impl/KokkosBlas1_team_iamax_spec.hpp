@@ -0,0 +1,102 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_TEAM_IAMAX_SPEC_HPP_
+#define KOKKOSBLAS1_TEAM_IAMAX_SPEC_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+
+namespace KokkosBlas {
+namespace Experimental {
+namespace Impl {
+
+template<class XV>
+struct team_iamax_tpl_spec_avail {
+  constexpr static bool value = false;
+};
+
+// Unification and Specialization layer
+template<class TeamType, class XV, bool tpl_spec_avail = team_iamax_tpl_spec_avail<XV>::value>
+struct TeamIamax {
+  typedef typename XV::size_type size_type;
+
+  static KOKKOS_INLINE_FUNCTION size_type team_iamax (const TeamType& team, const XV& X);
+};
+
+template<class TeamType, class XV>
+struct TeamIamax<TeamType, XV, false> {
+  typedef typename XV::size_type size_type;
+  typedef Kokkos::Details::ArithTraits<typename XV::non_const_value_type> AT;
+  typedef typename AT::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type> MAT;
+
+  // Same ranking as KokkosBlas::iamax: |Re(x)| + |Im(x)|, first index
+  // wins ties.  The first pass finds the largest magnitude, the second
+  // the smallest index that attains it.
+  static KOKKOS_INLINE_FUNCTION size_type team_iamax (const TeamType& team, const XV& X) {
+    const int N = X.extent(0);
+    if (N == 0) return 0;
+
+    mag_type vmax;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,N), [&] (const int& i, mag_type& lmax) {
+      const mag_type val = MAT::abs(AT::real(X(i))) + MAT::abs(AT::imag(X(i)));
+      if (val > lmax) lmax = val;
+    }, Kokkos::Max<mag_type>(vmax));
+
+    int imin;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,N), [&] (const int& i, int& lmin) {
+      const mag_type val = MAT::abs(AT::real(X(i))) + MAT::abs(AT::imag(X(i)));
+      if (val == vmax && i < lmin) lmin = i;
+    }, Kokkos::Min<int>(imin));
+
+    return imin < N ? imin + 1 : 1;
+  }
+};
+
+}
+}
+}
+
+#endif
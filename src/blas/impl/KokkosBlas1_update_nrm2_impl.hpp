@@ -0,0 +1,291 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_UPDATE_NRM2_IMPL_HPP_
+#define KOKKOSBLAS1_UPDATE_NRM2_IMPL_HPP_
+
+#include <KokkosKernels_config.h>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <Kokkos_InnerProductSpaceTraits.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+/// \brief Fused update and 2-norm functor for single vectors:
+///   z := a*x + b*y + c*z, then sum |z(i)|^2.
+///
+/// As in KokkosBlas::update, y is not read if b is zero and z is not
+/// read if c is zero, so they may hold Inf or NaN on input.
+///
+/// \tparam XV 1-D input View
+/// \tparam YV 1-D input View
+/// \tparam ZV 1-D input/output View
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class XV, class YV, class ZV, class SizeType = typename ZV::size_type>
+struct V_UpdateNrm2_Functor
+{
+  typedef typename ZV::execution_space              execution_space;
+  typedef SizeType                                        size_type;
+  typedef typename ZV::non_const_value_type             zvalue_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<zvalue_type> IPT;
+  typedef Kokkos::Details::ArithTraits<typename IPT::mag_type>   AT;
+  typedef typename IPT::mag_type                         value_type;
+
+  typename XV::non_const_value_type m_a;
+  typename YV::non_const_value_type m_b;
+  typename ZV::non_const_value_type m_c;
+  typename XV::const_type m_x;
+  typename YV::const_type m_y;
+  ZV m_z;
+
+  V_UpdateNrm2_Functor (const typename XV::non_const_value_type& a, const XV& x,
+                        const typename YV::non_const_value_type& b, const YV& y,
+                        const typename ZV::non_const_value_type& c, const ZV& z) :
+    m_a (a), m_b (b), m_c (c), m_x (x), m_y (y), m_z (z)
+  {
+    static_assert (Kokkos::Impl::is_view<XV>::value && Kokkos::Impl::is_view<YV>::value &&
+                   Kokkos::Impl::is_view<ZV>::value,
+                   "KokkosBlas::Impl::V_UpdateNrm2_Functor: "
+                   "X, Y and Z must be Kokkos::View specializations.");
+    static_assert (XV::rank == 1 && YV::rank == 1 && ZV::rank == 1,
+                   "KokkosBlas::Impl::V_UpdateNrm2_Functor: "
+                   "X, Y and Z must have rank 1.");
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const size_type& i, value_type& sum) const
+  {
+    typedef Kokkos::Details::ArithTraits<zvalue_type> ATZ;
+    zvalue_type z_i = m_a * m_x(i);
+    if (m_b != ATZ::zero ()) z_i += m_b * m_y(i);
+    if (m_c != ATZ::zero ()) z_i += m_c * m_z(i);
+    m_z(i) = z_i;
+    const typename IPT::mag_type tmp = IPT::norm (z_i);
+    sum += tmp * tmp;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type& update) const
+  {
+    update = AT::zero ();
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type& update,
+        const value_type& source) const
+  {
+    update += source;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type& update,
+        const volatile value_type& source) const
+  {
+    update += source;
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  final (value_type& update) const {
+    update = AT::sqrt (update);
+  }
+};
+
+/// \brief Column-wise fused update and 2-norm functor for
+///   multivectors: Z(:,j) := a*X(:,j) + b*Y(:,j) + c*Z(:,j), then
+///   r(j) = ||Z(:,j)||_2.
+///
+/// \tparam RV 1-D output View
+/// \tparam XMV 2-D input View
+/// \tparam YMV 2-D input View
+/// \tparam ZMV 2-D input/output View
+/// \tparam SizeType Index type.  Use int (32 bits) if possible.
+template<class RV, class XMV, class YMV, class ZMV, class SizeType = typename ZMV::size_type>
+struct MV_UpdateNrm2_Functor
+{
+  typedef typename ZMV::execution_space             execution_space;
+  typedef SizeType                                        size_type;
+  typedef typename ZMV::non_const_value_type            zvalue_type;
+  typedef Kokkos::Details::InnerProductSpaceTraits<zvalue_type> IPT;
+  typedef Kokkos::Details::ArithTraits<typename IPT::mag_type>   AT;
+  typedef typename IPT::mag_type                       value_type[];
+
+  size_type value_count;
+  typename XMV::non_const_value_type m_a;
+  typename YMV::non_const_value_type m_b;
+  typename ZMV::non_const_value_type m_c;
+  typename XMV::const_type m_x;
+  typename YMV::const_type m_y;
+  ZMV m_z;
+
+  MV_UpdateNrm2_Functor (const typename XMV::non_const_value_type& a, const XMV& x,
+                         const typename YMV::non_const_value_type& b, const YMV& y,
+                         const typename ZMV::non_const_value_type& c, const ZMV& z) :
+    value_count (z.extent(1)), m_a (a), m_b (b), m_c (c), m_x (x), m_y (y), m_z (z)
+  {
+    static_assert (Kokkos::Impl::is_view<RV>::value,
+                   "KokkosBlas::Impl::MV_UpdateNrm2_Functor: "
+                   "R is not a Kokkos::View.");
+    static_assert (RV::rank == 1 && XMV::rank == 2 && YMV::rank == 2 && ZMV::rank == 2,
+                   "KokkosBlas::Impl::MV_UpdateNrm2_Functor: "
+                   "RV must have rank 1 and XMV, YMV and ZMV must have rank 2.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator() (const size_type i, value_type sum) const
+  {
+    typedef Kokkos::Details::ArithTraits<zvalue_type> ATZ;
+    const size_type numVecs = value_count;
+    const bool b_zero = (m_b == ATZ::zero ());
+    const bool c_zero = (m_c == ATZ::zero ());
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < numVecs; ++j) {
+      zvalue_type z_ij = m_a * m_x(i,j);
+      if (! b_zero) z_ij += m_b * m_y(i,j);
+      if (! c_zero) z_ij += m_c * m_z(i,j);
+      m_z(i,j) = z_ij;
+      const typename IPT::mag_type tmp = IPT::norm (z_ij);
+      sum[j] += tmp * tmp;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  init (value_type update) const
+  {
+    const size_type numVecs = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j] = AT::zero ();
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (volatile value_type update,
+        const volatile value_type source) const
+  {
+    const size_type numVecs = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j] += source[j];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  join (value_type update,
+        const value_type source) const
+  {
+    const size_type numVecs = value_count;
+#ifdef KOKKOS_ENABLE_PRAGMA_IVDEP
+#pragma ivdep
+#endif
+#ifdef KOKKOS_ENABLE_PRAGMA_VECTOR
+#pragma vector always
+#endif
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j] += source[j];
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  final (value_type update) const
+  {
+    const size_type numVecs = value_count;
+    for (size_type j = 0; j < numVecs; ++j) {
+      update[j] = AT::sqrt (update[j]);
+    }
+  }
+};
+
+template<class XV, class YV, class ZV, class SizeType>
+typename Kokkos::Details::InnerProductSpaceTraits<typename ZV::non_const_value_type>::mag_type
+V_UpdateNrm2_Invoke (const typename XV::non_const_value_type& a, const XV& X,
+                     const typename YV::non_const_value_type& b, const YV& Y,
+                     const typename ZV::non_const_value_type& c, const ZV& Z)
+{
+  typedef typename ZV::execution_space execution_space;
+  typedef V_UpdateNrm2_Functor<XV, YV, ZV, SizeType> functor_type;
+
+  const SizeType numRows = static_cast<SizeType> (Z.extent(0));
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  typename functor_type::value_type result;
+  functor_type op (a, X, b, Y, c, Z);
+  Kokkos::parallel_reduce ("KokkosBlas::update_nrm2", policy, op, result);
+  return result;
+}
+
+template<class RV, class XMV, class YMV, class ZMV, class SizeType>
+void
+MV_UpdateNrm2_Invoke (const RV& r,
+                      const typename XMV::non_const_value_type& a, const XMV& X,
+                      const typename YMV::non_const_value_type& b, const YMV& Y,
+                      const typename ZMV::non_const_value_type& c, const ZMV& Z)
+{
+  typedef typename ZMV::execution_space execution_space;
+
+  const SizeType numRows = static_cast<SizeType> (Z.extent(0));
+  Kokkos::RangePolicy<execution_space, SizeType> policy (0, numRows);
+
+  MV_UpdateNrm2_Functor<RV, XMV, YMV, ZMV, SizeType> op (a, X, b, Y, c, Z);
+  Kokkos::parallel_reduce ("KokkosBlas::update_nrm2[MV]", policy, op, r);
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOSBLAS1_UPDATE_NRM2_IMPL_HPP_
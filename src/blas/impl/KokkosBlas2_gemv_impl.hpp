@@ -479,6 +479,285 @@ singleLevelGemv (const char trans[],
   }
 }
 
+// Smallest block of the reduction dimension handed to one team by
+// the two-level GEMV, and the largest number of such blocks.  The
+// latter bounds the size of the temporary array of partial sums.
+#define KOKKOSBLAS_GEMV_TWO_LEVEL_MIN_BLOCK_SIZE 256
+#define KOKKOSBLAS_GEMV_TWO_LEVEL_MAX_NUM_BLOCKS 4096
+
+// Functor for the first pass of a two-level (team + vector) GEMV that
+// reduces along the long dimension of A.  In the (conjugate)
+// transpose case the reduction runs over the rows of A and there is
+// one output entry per column of A; in the nontranspose case it runs
+// over the columns of A.  Each team owns one block of the reduction
+// dimension.  Threads of the team split the output entries and vector
+// lanes split the block, so each team writes one partial sum per
+// output entry.  Unlike SingleLevelTransposeGEMV, this needs neither
+// an array reduction nor atomic updates of y.
+template<class AViewType,
+         class XViewType,
+         class PartialViewType,
+         const bool transpose,
+         const bool conj,
+         class IndexType = typename AViewType::size_type>
+struct TwoLevelBlockedGEMV {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+  typedef typename PartialViewType::non_const_value_type partial_value_type;
+
+  TwoLevelBlockedGEMV (const AViewType& A,
+                       const XViewType& x,
+                       const PartialViewType& partial,
+                       const IndexType blockSize) :
+    A_ (A), x_ (x), partial_ (partial), blockSize_ (blockSize)
+  {
+    static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                   "AViewType must be a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<XViewType>::value,
+                   "XViewType must be a Kokkos::View.");
+    static_assert (Kokkos::Impl::is_view<PartialViewType>::value,
+                   "PartialViewType must be a Kokkos::View.");
+    static_assert (static_cast<int> (AViewType::rank) == 2,
+                   "AViewType must have rank 2.");
+    static_assert (static_cast<int> (XViewType::rank) == 1,
+                   "XViewType must have rank 1.");
+    static_assert (static_cast<int> (PartialViewType::rank) == 2,
+                   "PartialViewType must have rank 2.");
+    static_assert (std::is_integral<IndexType>::value,
+                   "IndexType must be an integer.");
+  }
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const member_type& team) const
+  {
+    typedef Kokkos::Details::ArithTraits<typename AViewType::non_const_value_type> KAT;
+
+    const IndexType numOut = transpose ? A_.extent(1) : A_.extent(0);
+    const IndexType numRed = transpose ? A_.extent(0) : A_.extent(1);
+    const IndexType block = team.league_rank ();
+    const IndexType begin = block * blockSize_;
+    const IndexType len = (numRed - begin < blockSize_) ? numRed - begin : blockSize_;
+
+    Kokkos::parallel_for (Kokkos::TeamThreadRange (team, numOut),
+                          [&] (const IndexType& j) {
+      partial_value_type sum = Kokkos::Details::ArithTraits<partial_value_type>::zero ();
+      Kokkos::parallel_reduce (Kokkos::ThreadVectorRange (team, len),
+                               [&] (const IndexType& k, partial_value_type& update) {
+        const IndexType r = begin + k;
+        if (transpose) {
+          const auto A_rj = conj ? KAT::conj (A_(r,j)) : A_(r,j);
+          update += A_rj * x_(r);
+        }
+        else {
+          update += A_(j,r) * x_(r);
+        }
+      }, sum);
+      Kokkos::single (Kokkos::PerThread (team), [&] () {
+        partial_(block, j) = sum;
+      });
+    });
+  }
+
+private:
+  typename AViewType::const_type A_;
+  typename XViewType::const_type x_;
+  PartialViewType partial_;
+  IndexType blockSize_;
+};
+
+// Functor for the second pass of the two-level GEMV: sums the partial
+// results of all blocks for output entry j, then applies alpha and
+// beta.  The number of blocks is bounded, so a flat loop suffices.
+template<class AViewType,
+         class PartialViewType,
+         class YViewType,
+         class IndexType = typename AViewType::size_type>
+struct TwoLevelBlockedGEMVFinal {
+  typedef typename YViewType::non_const_value_type y_value_type;
+  typedef typename AViewType::non_const_value_type AlphaCoeffType;
+  typedef typename YViewType::non_const_value_type BetaCoeffType;
+
+  TwoLevelBlockedGEMVFinal (const AlphaCoeffType& alpha,
+                            const PartialViewType& partial,
+                            const BetaCoeffType& beta,
+                            const YViewType& y) :
+    alpha_ (alpha), partial_ (partial), beta_ (beta), y_ (y)
+  {}
+
+  KOKKOS_INLINE_FUNCTION void
+  operator () (const IndexType& j) const
+  {
+    using Kokkos::Details::ArithTraits;
+
+    const IndexType numBlocks = partial_.extent(0);
+    y_value_type A_x = ArithTraits<y_value_type>::zero ();
+    for (IndexType b = 0; b < numBlocks; ++b) {
+      A_x += partial_(b, j);
+    }
+    // Use beta as a pre-multiplier only if nonzero, so that y may hold
+    // Inf or NaN on input when beta is zero.
+    const y_value_type y_j =
+      beta_ == ArithTraits<BetaCoeffType>::zero () ?
+      ArithTraits<y_value_type>::zero () :
+      beta_ * y_[j];
+    y_[j] = y_j + alpha_ * A_x;
+  }
+
+private:
+  AlphaCoeffType alpha_;
+  typename PartialViewType::const_type partial_;
+  BetaCoeffType beta_;
+  YViewType y_;
+};
+
+// Launch the first pass of the two-level GEMV over numBlocks teams.
+template<class AViewType,
+         class XViewType,
+         class PartialViewType,
+         const bool transpose,
+         const bool conj,
+         class IndexType>
+void
+twoLevelBlockedGemvPartial (const AViewType& A,
+                            const XViewType& x,
+                            const PartialViewType& partial,
+                            const IndexType blockSize)
+{
+  typedef typename AViewType::execution_space execution_space;
+  typedef TwoLevelBlockedGEMV<AViewType, XViewType, PartialViewType,
+    transpose, conj, IndexType> functor_type;
+
+  // Vector lanes split one block of the reduction dimension.
+  int vector_length = 1;
+  while ((static_cast<IndexType> (vector_length*2*3) <= blockSize) && (vector_length < 32)) vector_length *= 2;
+
+  functor_type functor (A, x, partial, blockSize);
+  const int team_size = Kokkos::TeamPolicy<execution_space>::team_size_recommended (functor, vector_length);
+  Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevel]",
+                        Kokkos::TeamPolicy<execution_space> (partial.extent(0), team_size, vector_length),
+                        functor);
+}
+
+// Two-level (team + vector) parallel version of GEMV.  The reduction
+// dimension (rows of A for (conjugate) transpose, columns of A
+// otherwise) is cut into blocks, one per team.  Teams write partial
+// sums into a temporary array, and a second pass combines them into y.
+// This suits tall-skinny transpose and short-wide nontranspose GEMV,
+// where singleLevelGemv either reduces into a short array from every
+// thread or has too few rows to keep the machine busy.
+template<class AViewType,
+         class XViewType,
+         class YViewType,
+         class IndexType = typename AViewType::size_type>
+void
+twoLevelGemv (const char trans[],
+              typename AViewType::const_value_type& alpha,
+              const AViewType& A,
+              const XViewType& x,
+              typename YViewType::const_value_type& beta,
+              const YViewType& y)
+{
+  static_assert (Kokkos::Impl::is_view<AViewType>::value,
+                 "AViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<XViewType>::value,
+                 "XViewType must be a Kokkos::View.");
+  static_assert (Kokkos::Impl::is_view<YViewType>::value,
+                 "YViewType must be a Kokkos::View.");
+  static_assert (static_cast<int> (AViewType::rank) == 2,
+                 "AViewType must have rank 2.");
+  static_assert (static_cast<int> (XViewType::rank) == 1,
+                 "XViewType must have rank 1.");
+  static_assert (static_cast<int> (YViewType::rank) == 1,
+                 "YViewType must have rank 1.");
+  static_assert (std::is_integral<IndexType>::value,
+                 "IndexType must be an integer");
+
+  typedef typename YViewType::non_const_value_type y_value_type;
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename AViewType::non_const_value_type AlphaCoeffType;
+  typedef Kokkos::View<y_value_type**, Kokkos::LayoutLeft,
+    typename YViewType::device_type> partial_view_type;
+
+  const char tr = trans[0];
+  const bool transpose = (tr != 'N' && tr != 'n');
+  const bool conj = (tr == 'C' || tr == 'c' || tr == 'H' || tr == 'h');
+  const IndexType numOut = transpose ? A.extent(1) : A.extent(0);
+  const IndexType numRed = transpose ? A.extent(0) : A.extent(1);
+
+  if (numOut == 0) {
+    return;
+  }
+  // Without a reduction, GEMV only scales y; singleLevelGemv already
+  // handles that without the temporary array.
+  if (numRed == 0 || alpha == Kokkos::Details::ArithTraits<AlphaCoeffType>::zero ()) {
+    singleLevelGemv<AViewType, XViewType, YViewType, IndexType>
+      (trans, alpha, A, x, beta, y);
+    return;
+  }
+
+  IndexType maxBlocks = 4 * static_cast<IndexType> (execution_space::concurrency ());
+  if (maxBlocks > KOKKOSBLAS_GEMV_TWO_LEVEL_MAX_NUM_BLOCKS) {
+    maxBlocks = KOKKOSBLAS_GEMV_TWO_LEVEL_MAX_NUM_BLOCKS;
+  }
+  if (maxBlocks < 1) {
+    maxBlocks = 1;
+  }
+  IndexType numBlocks = (numRed + KOKKOSBLAS_GEMV_TWO_LEVEL_MIN_BLOCK_SIZE - 1) /
+    KOKKOSBLAS_GEMV_TWO_LEVEL_MIN_BLOCK_SIZE;
+  if (numBlocks > maxBlocks) {
+    numBlocks = maxBlocks;
+  }
+  const IndexType blockSize = (numRed + numBlocks - 1) / numBlocks;
+  // Rounding blockSize up may leave trailing blocks empty; drop them.
+  numBlocks = (numRed + blockSize - 1) / blockSize;
+
+  partial_view_type partial (Kokkos::ViewAllocateWithoutInitializing ("KokkosBlas::gemv::partial"),
+                             numBlocks, numOut);
+  if (! transpose) {
+    twoLevelBlockedGemvPartial<AViewType, XViewType, partial_view_type,
+      false, false, IndexType> (A, x, partial, blockSize);
+  }
+  else if (! conj) {
+    twoLevelBlockedGemvPartial<AViewType, XViewType, partial_view_type,
+      true, false, IndexType> (A, x, partial, blockSize);
+  }
+  else {
+    twoLevelBlockedGemvPartial<AViewType, XViewType, partial_view_type,
+      true, true, IndexType> (A, x, partial, blockSize);
+  }
+
+  typedef TwoLevelBlockedGEMVFinal<AViewType, partial_view_type,
+    YViewType, IndexType> final_functor_type;
+  final_functor_type finalFunctor (alpha, partial, beta, y);
+  Kokkos::parallel_for ("KokkosBlas::gemv[TwoLevelFinal]",
+                        Kokkos::RangePolicy<execution_space, IndexType> (0, numOut),
+                        finalFunctor);
+}
+
+// Shape heuristic used by KokkosBlas::gemv to choose between
+// singleLevelGemv and twoLevelGemv.  Every team of the two-level
+// version loops over all outputs of its block, so it only pays off
+// when there are few outputs and a long reduction: (conjugate)
+// transpose GEMV on tall-skinny A with enough rows to split into
+// blocks, and nontranspose GEMV when A has far more columns than rows.
+// Otherwise one output per thread already feeds the device.
+template<class IndexType>
+inline bool
+gemvPreferTwoLevel (const char trans[],
+                    const IndexType numRows,
+                    const IndexType numCols)
+{
+  const char tr = trans[0];
+  if (numRows == 0 || numCols == 0) {
+    return false;
+  }
+  if (tr == 'N' || tr == 'n') {
+    return numRows <= numCols / 16;
+  }
+  return numCols <= numRows / 16 &&
+    numRows >= 2 * KOKKOSBLAS_GEMV_TWO_LEVEL_MIN_BLOCK_SIZE;
+}
+
 } // namespace Impl
 } // namespace KokkosBlas
 
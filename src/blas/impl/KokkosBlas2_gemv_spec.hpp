@@ -132,15 +132,31 @@ struct GEMV {
     const size_type numRows = A.extent(0);
     const size_type numCols = A.extent(1);
 
+    // Tall-skinny (conjugate) transpose and short-wide nontranspose
+    // shapes go to the two-level (team + vector) version.
+    const bool twoLevel = gemvPreferTwoLevel<size_type> (trans, numRows, numCols);
+
     // Prefer int as the index type, but use a larger type if needed.
     if (numRows < static_cast<size_type> (INT_MAX) &&
         numCols < static_cast<size_type> (INT_MAX)) {
-      singleLevelGemv<AViewType, XViewType, YViewType,int>
-         (trans, alpha, A, x, beta, y);
+      if (twoLevel) {
+        twoLevelGemv<AViewType, XViewType, YViewType, int>
+           (trans, alpha, A, x, beta, y);
+      }
+      else {
+        singleLevelGemv<AViewType, XViewType, YViewType, int>
+           (trans, alpha, A, x, beta, y);
+      }
     }
     else {
-      singleLevelGemv<AViewType, XViewType, YViewType, int64_t>
-         (trans, alpha, A, x, beta, y);
+      if (twoLevel) {
+        twoLevelGemv<AViewType, XViewType, YViewType, int64_t>
+           (trans, alpha, A, x, beta, y);
+      }
+      else {
+        singleLevelGemv<AViewType, XViewType, YViewType, int64_t>
+           (trans, alpha, A, x, beta, y);
+      }
     }
   }
   #else
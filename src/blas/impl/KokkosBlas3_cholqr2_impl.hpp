@@ -0,0 +1,146 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+
+#ifndef KOKKOS_BLAS3_CHOLQR2_IMPL_HPP_
+#define KOKKOS_BLAS3_CHOLQR2_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBlas3_syrk.hpp>
+#include<KokkosBlas3_trsm.hpp>
+#include<sstream>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Overwrite the upper triangle of the small n x n Hermitian positive
+// definite host matrix G with its Cholesky factor U, G = U^H U, and
+// zero the strictly lower triangle.  Returns the index of the first
+// nonpositive pivot, or -1 on success.
+template<class HostViewType>
+int cholqr_host_potrf(const HostViewType& G) {
+  typedef typename HostViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+  typedef typename ATV::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type> ATM;
+
+  const int n = G.extent_int(0);
+  for(int j = 0; j < n; ++j) {
+    mag_type d = ATV::real(G(j,j));
+    for(int k = 0; k < j; ++k)
+      d -= ATV::abs(G(k,j))*ATV::abs(G(k,j));
+    if(!(d > ATM::zero()))
+      return j;
+    const mag_type ujj = ATM::sqrt(d);
+    G(j,j) = value_type(ujj);
+    for(int l = j+1; l < n; ++l) {
+      value_type s = G(j,l);
+      for(int k = 0; k < j; ++k)
+        s -= ATV::conj(G(k,j))*G(k,l);
+      G(j,l) = s/ujj;
+    }
+    for(int i = j+1; i < n; ++i)
+      G(i,j) = ATV::zero();
+  }
+  return -1;
+}
+
+// One CholQR pass: G := A^H A, G = U^H U, A := A U^{-1}.  U is left
+// in both U (device) and h_U (host).
+template<class AViewType, class UViewType>
+void cholqr_pass(const AViewType& A, const UViewType& U, const typename UViewType::HostMirror& h_U) {
+  herk ("U", "C", 1.0, A, 0.0, U);
+  Kokkos::deep_copy (h_U, U);
+  const int info = cholqr_host_potrf (h_U);
+  if(info >= 0) {
+    std::ostringstream os;
+    os << "KokkosBlas::cholqr2: The Gram matrix A^H A is not numerically "
+       << "positive definite (pivot " << info << " of " << h_U.extent(0) << ").  "
+       << "A is rank deficient or too ill-conditioned for CholQR2; use "
+       << "KokkosBlas::tsqr instead.";
+    Kokkos::Impl::throw_runtime_exception (os.str ());
+  }
+  Kokkos::deep_copy (U, h_U);
+  trsm ("R", "U", "N", "N", 1.0, U, A);
+}
+
+// A := Q, R := R, for the m x n A, m >= n.
+template<class AViewType, class RViewType>
+void cholqr2_impl(const AViewType& A, const RViewType& R) {
+  typedef typename AViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+  typedef Kokkos::View<value_type**,typename AViewType::array_layout,
+                       typename AViewType::device_type> work_view_type;
+
+  const int n = A.extent_int(1);
+  if(n == 0) return;
+
+  work_view_type U1("KokkosBlas::cholqr2::R1",n,n);
+  work_view_type U2("KokkosBlas::cholqr2::R2",n,n);
+  typename work_view_type::HostMirror h_U1 = Kokkos::create_mirror_view (U1);
+  typename work_view_type::HostMirror h_U2 = Kokkos::create_mirror_view (U2);
+
+  // The first pass leaves A with a condition number near 1, so the
+  // second one makes it orthonormal to machine precision.
+  cholqr_pass (A, U1, h_U1);
+  cholqr_pass (A, U2, h_U2);
+
+  // R = R2 R1, both upper triangular.
+  typename RViewType::HostMirror h_R = Kokkos::create_mirror_view (R);
+  for(int i = 0; i < n; ++i) {
+    for(int j = 0; j < n; ++j) {
+      value_type s = ATV::zero();
+      for(int k = i; k <= j; ++k)
+        s += h_U2(i,k)*h_U1(k,j);
+      h_R(i,j) = s;
+    }
+  }
+  Kokkos::deep_copy (R, h_R);
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOS_BLAS3_CHOLQR2_IMPL_HPP_
@@ -0,0 +1,385 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_BLAS3_GEMM_PACKED_IMPL_HPP_
+#define KOKKOS_BLAS3_GEMM_PACKED_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBatched_Vector.hpp>
+
+// Cache sizes (in bytes) used to derive the KC/MC/NC blocking of the
+// packed host GEMM.  Override at configure time to match the target.
+#ifndef KOKKOSBLAS_GEMM_HOST_L1_CACHE_SIZE
+#define KOKKOSBLAS_GEMM_HOST_L1_CACHE_SIZE 32768
+#endif
+#ifndef KOKKOSBLAS_GEMM_HOST_L2_CACHE_SIZE
+#define KOKKOSBLAS_GEMM_HOST_L2_CACHE_SIZE 524288
+#endif
+#ifndef KOKKOSBLAS_GEMM_HOST_L3_CACHE_SIZE
+#define KOKKOSBLAS_GEMM_HOST_L3_CACHE_SIZE 8388608
+#endif
+
+namespace KokkosBlas {
+namespace Impl {
+
+// The packed path is only worth it where the SIMD wrappers of the
+// batched layer map onto AVX/AVX2/AVX-512 registers.
+template<class AViewType, class BViewType, class CViewType>
+struct gemm_packed_host_avail {
+#if !defined(__CUDA_ARCH__) && (defined(__AVX512F__) || defined(__AVX2__) || defined(__AVX__))
+  enum : bool { value = std::is_same<typename CViewType::memory_space,Kokkos::HostSpace>::value &&
+                        std::is_same<typename AViewType::non_const_value_type,double>::value &&
+                        std::is_same<typename BViewType::non_const_value_type,double>::value &&
+                        std::is_same<typename CViewType::non_const_value_type,double>::value };
+#else
+  enum : bool { value = false };
+#endif
+};
+
+// Register and cache blocking of the packed GEMM, in the BLIS
+// terminology.  The microkernel computes an MR x NR block of C from
+// an MR x KC panel of A and a KC x NR panel of B.  KC is chosen so
+// that a packed B micropanel fills half of L1, MC so that a packed
+// MC x KC block of A fills half of L2, and NC so that a packed KC x NC
+// block of B fills half of L3.
+template<class ValueType>
+struct GemmPackedBlocking {
+  typedef KokkosBatched::Experimental::Vector<KokkosBatched::Experimental::SIMD<ValueType>,
+    KokkosBatched::Experimental::DefaultVectorLength<ValueType,Kokkos::HostSpace>::value> vector_type;
+
+  enum : int { VL = vector_type::vector_length,
+               MV = 2,
+               MR = MV*VL,
+               NR = 6 };
+
+  enum : int { KC_raw = (KOKKOSBLAS_GEMM_HOST_L1_CACHE_SIZE/2) / (NR*sizeof(ValueType)),
+               KC = KC_raw < 64 ? 64 : (KC_raw/8)*8 };
+  enum : int { MC_raw = (KOKKOSBLAS_GEMM_HOST_L2_CACHE_SIZE/2) / (KC*sizeof(ValueType)),
+               MC = MC_raw < MR ? MR : (MC_raw/MR)*MR };
+  enum : int { NC_raw = (KOKKOSBLAS_GEMM_HOST_L3_CACHE_SIZE/2) / (KC*sizeof(ValueType)),
+               NC = NC_raw < NR ? NR : (NC_raw/NR)*NR };
+};
+
+// Pack rows [ic,ic+mc) and inner indices [pc,pc+kc) of op(A) into
+// micropanels of MR rows.  Panel ip is stored as kc consecutive
+// columns of MR entries; rows past mc are zero padded.
+template<class AViewType, int MR, int TransposeA>
+struct GemmPackA {
+  typedef typename AViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+
+  AViewType A;
+  value_type* buf;
+  int mc, ic, pc, kc;
+
+  GemmPackA(const AViewType& A_, value_type* buf_, const int mc_, const int ic_, const int pc_, const int kc_)
+    : A(A_), buf(buf_), mc(mc_), ic(ic_), pc(pc_), kc(kc_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int ip) const {
+    value_type* dst = buf + ip*MR*kc;
+    const int i0 = ip*MR;
+    for(int p=0; p<kc; ++p) {
+      for(int r=0; r<MR; ++r) {
+        const int i = i0+r;
+        dst[p*MR+r] = i < mc ? (TransposeA>0 ? A(pc+p,ic+i) : A(ic+i,pc+p)) : ATV::zero();
+      }
+    }
+  }
+};
+
+// Pack inner indices [pc,pc+kc) and columns [jc,jc+nc) of op(B) into
+// micropanels of NR columns.  Panel jp is stored as kc consecutive
+// rows of NR entries; columns past nc are zero padded.
+template<class BViewType, int NR, int TransposeB>
+struct GemmPackB {
+  typedef typename BViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+
+  BViewType B;
+  value_type* buf;
+  int nc, jc, pc, kc;
+
+  GemmPackB(const BViewType& B_, value_type* buf_, const int nc_, const int jc_, const int pc_, const int kc_)
+    : B(B_), buf(buf_), nc(nc_), jc(jc_), pc(pc_), kc(kc_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int jp) const {
+    value_type* dst = buf + jp*NR*kc;
+    const int j0 = jp*NR;
+    for(int p=0; p<kc; ++p) {
+      for(int c=0; c<NR; ++c) {
+        const int j = j0+c;
+        dst[p*NR+c] = j < nc ? (TransposeB>0 ? B(jc+j,pc+p) : B(pc+p,jc+j)) : ATV::zero();
+      }
+    }
+  }
+};
+
+// Register-blocked microkernel: ab := A_panel * B_panel, where ab is
+// an MR x NR column-major block.  The MV x NR accumulators stay in
+// SIMD registers over the whole kc loop; each step loads MV vectors of
+// A and broadcasts NR entries of B.
+template<class ValueType, int VL, int MV, int NR>
+struct GemmPackedMicroKernel {
+  typedef KokkosBatched::Experimental::Vector<KokkosBatched::Experimental::SIMD<ValueType>,VL> vector_type;
+  enum : int { MR = MV*VL };
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void invoke(const int kc,
+                     const ValueType *KOKKOS_RESTRICT a,
+                     const ValueType *KOKKOS_RESTRICT b,
+                     /**/  ValueType *KOKKOS_RESTRICT ab) {
+    vector_type c[MV][NR], a_v[MV];
+    for(int v=0; v<MV; ++v)
+      for(int j=0; j<NR; ++j)
+        c[v][j] = ValueType(0);
+
+    for(int p=0; p<kc; ++p, a+=MR, b+=NR) {
+      for(int v=0; v<MV; ++v)
+        a_v[v].loadUnaligned(a+v*VL);
+      for(int j=0; j<NR; ++j) {
+        const vector_type b_j(b[j]);
+        for(int v=0; v<MV; ++v)
+          c[v][j] += a_v[v]*b_j;
+      }
+    }
+
+    for(int j=0; j<NR; ++j)
+      for(int v=0; v<MV; ++v)
+        c[v][j].storeUnaligned(ab+j*MR+v*VL);
+  }
+};
+
+// Multiply the packed MC x KC block of A with the packed KC x NC
+// block of B and update C(ic:ic+mc, jc:jc+nc).  As in BLIS, the two
+// loops around the microkernel are parallel: work item w owns a group
+// of NR-wide column micropanels and a group of MR-tall row
+// micropanels.  It walks the column micropanels in the outer loop so
+// that each B micropanel stays in L1 while the A block streams from L2.
+template<class CViewType, class Blocking>
+struct GemmPackedMacroKernel {
+  typedef typename CViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+  enum : int { VL = Blocking::VL, MV = Blocking::MV, MR = Blocking::MR, NR = Blocking::NR };
+
+  CViewType C;
+  const value_type *Apack, *Bpack;
+  value_type alpha, beta;
+  int mc, ic, nc, jc, kc;
+  bool first;
+  int num_panels_m, num_panels_n, panels_per_row_group, panels_per_col_group, num_col_groups;
+
+  GemmPackedMacroKernel(const CViewType& C_, const value_type* Apack_, const value_type* Bpack_,
+                        const value_type alpha_, const value_type beta_,
+                        const int mc_, const int ic_, const int nc_, const int jc_, const int kc_, const bool first_,
+                        const int panels_per_row_group_, const int panels_per_col_group_)
+    : C(C_), Apack(Apack_), Bpack(Bpack_), alpha(alpha_), beta(beta_),
+      mc(mc_), ic(ic_), nc(nc_), jc(jc_), kc(kc_), first(first_),
+      num_panels_m((mc_+MR-1)/MR), num_panels_n((nc_+NR-1)/NR),
+      panels_per_row_group(panels_per_row_group_), panels_per_col_group(panels_per_col_group_),
+      num_col_groups((num_panels_n+panels_per_col_group_-1)/panels_per_col_group_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int w) const {
+    const int ip_begin = (w/num_col_groups)*panels_per_row_group;
+    const int jp_begin = (w%num_col_groups)*panels_per_col_group;
+    const int ip_end = ip_begin+panels_per_row_group < num_panels_m ? ip_begin+panels_per_row_group : num_panels_m;
+    const int jp_end = jp_begin+panels_per_col_group < num_panels_n ? jp_begin+panels_per_col_group : num_panels_n;
+
+    value_type ab[MR*NR];
+    for(int jp=jp_begin; jp<jp_end; ++jp) {
+      const int j0 = jp*NR;
+      const int nr = j0+NR < nc ? NR : nc-j0;
+      for(int ip=ip_begin; ip<ip_end; ++ip) {
+        const int i0 = ip*MR;
+        const int mr = i0+MR < mc ? MR : mc-i0;
+        GemmPackedMicroKernel<value_type,VL,MV,NR>::invoke(kc, Apack+ip*MR*kc, Bpack+jp*NR*kc, ab);
+        for(int c=0; c<nr; ++c) {
+          for(int r=0; r<mr; ++r) {
+            value_type& C_ij = C(ic+i0+r,jc+j0+c);
+            // Only the first inner block applies beta; beta == 0 must
+            // not read C so that Inf/NaN in C do not propagate.
+            const value_type C_old = !first ? C_ij :
+                                     beta == ATV::zero() ? ATV::zero() : beta*C_ij;
+            C_ij = C_old + alpha*ab[c*MR+r];
+          }
+        }
+      }
+    }
+  }
+};
+
+// C := beta*C, used when there is nothing to accumulate.
+template<class CViewType>
+struct GemmPackedScaleC {
+  typedef typename CViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+
+  CViewType C;
+  value_type beta;
+
+  GemmPackedScaleC(const CViewType& C_, const value_type beta_) : C(C_), beta(beta_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int j) const {
+    for(int i=0; i<C.extent_int(0); ++i)
+      C(i,j) = beta == ATV::zero() ? ATV::zero() : beta*C(i,j);
+  }
+};
+
+// BLIS-style host GEMM: C := beta*C + alpha*op(A)*op(B).  op(B) is
+// packed one KC x NC block at a time and, for each of them, op(A) one
+// MC x KC block at a time into contiguous micropanels; the macrokernel
+// then runs the register-blocked microkernel over all MR x NR tiles of
+// the current MC x NC block of C.
+template<class ExecSpace, class AViewType, class BViewType, class CViewType, int TransposeA, int TransposeB>
+struct GEMMPackedImpl {
+  typedef typename CViewType::non_const_value_type value_type;
+  typedef GemmPackedBlocking<value_type> blocking_type;
+  typedef Kokkos::View<value_type*, Kokkos::LayoutRight, Kokkos::HostSpace> pack_view_type;
+  enum : int { MR = blocking_type::MR, NR = blocking_type::NR,
+               MC = blocking_type::MC, KC = blocking_type::KC, NC = blocking_type::NC };
+
+  static void run(const value_type alpha, const AViewType& A, const BViewType& B, const value_type beta, const CViewType& C) {
+    typedef Kokkos::RangePolicy<ExecSpace> policy_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ATV;
+
+    const int m = C.extent_int(0);
+    const int n = C.extent_int(1);
+    const int k = TransposeA>0 ? A.extent_int(0) : A.extent_int(1);
+
+    if(m == 0 || n == 0)
+      return;
+    if(k == 0 || alpha == ATV::zero()) {
+      if(beta != ATV::one())
+        Kokkos::parallel_for("KokkosBlas::gemm[Packed::ScaleC]", policy_type(0,n), GemmPackedScaleC<CViewType>(C,beta));
+      return;
+    }
+
+    const int mc_max = m < MC ? m : MC;
+    const int nc_max = n < NC ? n : NC;
+    const int kc_max = k < KC ? k : KC;
+    pack_view_type Apack(Kokkos::ViewAllocateWithoutInitializing("KokkosBlas::gemm::Apack"), ((mc_max+MR-1)/MR)*MR*kc_max);
+    pack_view_type Bpack(Kokkos::ViewAllocateWithoutInitializing("KokkosBlas::gemm::Bpack"), ((nc_max+NR-1)/NR)*NR*kc_max);
+
+    // Aim at a few work items per thread.
+    const int num_work = 4*ExecSpace::concurrency();
+
+    for(int jc=0; jc<n; jc+=NC) {
+      const int nc = jc+NC < n ? NC : n-jc;
+      const int num_panels_n = (nc+NR-1)/NR;
+
+      // Split the column micropanels first; the row micropanels of an
+      // MC block are only split when there are not enough of them.
+      int num_col_groups = num_work < num_panels_n ? num_work : num_panels_n;
+      const int panels_per_col_group = (num_panels_n+num_col_groups-1)/num_col_groups;
+      num_col_groups = (num_panels_n+panels_per_col_group-1)/panels_per_col_group;
+
+      for(int pc=0; pc<k; pc+=KC) {
+        const int kc = pc+KC < k ? KC : k-pc;
+
+        Kokkos::parallel_for("KokkosBlas::gemm[Packed::PackB]", policy_type(0,num_panels_n),
+                             GemmPackB<BViewType,NR,TransposeB>(B,Bpack.data(),nc,jc,pc,kc));
+
+        for(int ic=0; ic<m; ic+=MC) {
+          const int mc = ic+MC < m ? MC : m-ic;
+          const int num_panels_m = (mc+MR-1)/MR;
+
+          int num_row_groups = (num_work+num_col_groups-1)/num_col_groups;
+          if(num_row_groups > num_panels_m) num_row_groups = num_panels_m;
+          const int panels_per_row_group = (num_panels_m+num_row_groups-1)/num_row_groups;
+          num_row_groups = (num_panels_m+panels_per_row_group-1)/panels_per_row_group;
+
+          Kokkos::parallel_for("KokkosBlas::gemm[Packed::PackA]", policy_type(0,num_panels_m),
+                               GemmPackA<AViewType,MR,TransposeA>(A,Apack.data(),mc,ic,pc,kc));
+
+          GemmPackedMacroKernel<CViewType,blocking_type>
+            macro_kernel(C,Apack.data(),Bpack.data(),alpha,beta,mc,ic,nc,jc,kc,pc==0,
+                         panels_per_row_group,panels_per_col_group);
+          Kokkos::parallel_for("KokkosBlas::gemm[Packed]", policy_type(0,num_row_groups*num_col_groups), macro_kernel);
+        }
+      }
+    }
+  }
+};
+
+// Entry point used by KokkosBlas::Impl::GEMM.  Returns false if the
+// packed path does not apply to these view types or modes, in which
+// case the caller falls back to the team-scratch GEMMImpl.
+template<class AViewType, class BViewType, class CViewType,
+         bool avail = gemm_packed_host_avail<AViewType,BViewType,CViewType>::value>
+struct GEMMPackedHost {
+  static bool invoke(const char /*transA*/[], const char /*transB*/[],
+                     typename AViewType::const_value_type& /*alpha*/,
+                     const AViewType& /*A*/, const BViewType& /*B*/,
+                     typename CViewType::const_value_type& /*beta*/,
+                     const CViewType& /*C*/) {
+    return false;
+  }
+};
+
+template<class AViewType, class BViewType, class CViewType>
+struct GEMMPackedHost<AViewType,BViewType,CViewType,true> {
+  static bool invoke(const char transA[], const char transB[],
+                     typename AViewType::const_value_type& alpha,
+                     const AViewType& A, const BViewType& B,
+                     typename CViewType::const_value_type& beta,
+                     const CViewType& C) {
+    typedef typename CViewType::execution_space execution_space;
+    // Real scalars only, so conjugate transpose is plain transpose.
+    const bool tA = !(transA[0]=='N' || transA[0]=='n');
+    const bool tB = !(transB[0]=='N' || transB[0]=='n');
+    if(!tA && !tB) GEMMPackedImpl<execution_space,AViewType,BViewType,CViewType,0,0>::run(alpha,A,B,beta,C);
+    if( tA && !tB) GEMMPackedImpl<execution_space,AViewType,BViewType,CViewType,1,0>::run(alpha,A,B,beta,C);
+    if(!tA &&  tB) GEMMPackedImpl<execution_space,AViewType,BViewType,CViewType,0,1>::run(alpha,A,B,beta,C);
+    if( tA &&  tB) GEMMPackedImpl<execution_space,AViewType,BViewType,CViewType,1,1>::run(alpha,A,B,beta,C);
+    return true;
+  }
+};
+
+}
+}
+#endif
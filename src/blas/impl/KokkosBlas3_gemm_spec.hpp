@@ -49,6 +49,7 @@
 
 #if !defined(KOKKOSKERNELS_ETI_ONLY) || KOKKOSKERNELS_IMPL_COMPILE_LIBRARY
 #include<KokkosBlas3_gemm_impl.hpp>
+#include<KokkosBlas3_gemm_packed_impl.hpp>
 #endif
 
 namespace KokkosBlas {
@@ -129,6 +130,13 @@ struct GEMM {
                  "CViewType must have rank 2.");
 
   Kokkos::Profiling::pushRegion(eti_spec_avail?"KokkosBlas::gemm[ETI]":"KokkosBlas::gemm[noETI]");
+
+  // Host double precision goes through the packed (BLIS-style) kernel
+  if(KokkosBlas::Impl::GEMMPackedHost<AViewType,BViewType,CViewType>::invoke(transA,transB,alpha,A,B,beta,C)) {
+    Kokkos::Profiling::popRegion();
+    return;
+  }
+
   // Figure out Scalar Types
   typedef typename AViewType::non_const_value_type ScalarA;
   typedef typename BViewType::non_const_value_type ScalarB;
@@ -0,0 +1,359 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_BLAS3_SYRK_IMPL_HPP_
+#define KOKKOS_BLAS3_SYRK_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBlas3_gemm.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Diagonal blocks of C up to this size are computed by the tall-skinny
+// Gram kernel; larger C are split in half and the off-diagonal block
+// goes to gemm.
+#define KOKKOSBLAS3_SYRK_GRAM_MAX_K 64
+// Rows of W staged in scratch at a time by one team of the Gram kernel.
+#define KOKKOSBLAS3_SYRK_GRAM_TILE_ROWS 32
+// Upper bound on the number of per-team partial triangles.
+#define KOKKOSBLAS3_SYRK_GRAM_MAX_CHUNKS 1024
+
+// Both syrk and herk are computed as C = W^H W (herk) or C = W^T W
+// (syrk) for a W with few columns.  For trans "T"/"C", W = A; for
+// trans "N", W is the (conjugate) transpose of A.  The upper triangle
+// of W^H W is stored packed by columns: entry (p,q), p <= q, is at
+// q*(q+1)/2 + p.
+KOKKOS_INLINE_FUNCTION
+int syrk_packed_index(const int p, const int q) {
+  return q*(q+1)/2 + p;
+}
+
+// First pass of the Gram kernel.  Each team owns a contiguous chunk of
+// rows of W and accumulates the packed triangle of its rows' W^H W in
+// scratch, one tile of rows at a time: threads own columns q of the
+// triangle and vector lanes own rows p <= q.  The finished triangle is
+// written to column league_rank of partial.
+template<class AViewType, class PartialViewType, bool TransW, bool Conj>
+struct SyrkGramPartial {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename PartialViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+  typedef Kokkos::View<value_type*,Kokkos::LayoutLeft,typename execution_space::scratch_memory_space,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > ScratchAccType;
+  typedef Kokkos::View<value_type**,Kokkos::LayoutRight,typename execution_space::scratch_memory_space,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > ScratchTileType;
+
+  AViewType A;
+  PartialViewType partial;
+  int m, n, chunk_size, scratch_level;
+
+  SyrkGramPartial(const AViewType& A_, const PartialViewType& partial_, const int chunk_size_)
+    : A(A_), partial(partial_),
+      m(TransW ? A_.extent_int(1) : A_.extent_int(0)),
+      n(TransW ? A_.extent_int(0) : A_.extent_int(1)),
+      chunk_size(chunk_size_), scratch_level(0) {}
+
+  static size_t scratch_size(const int n) {
+    return ScratchAccType::shmem_size(n*(n+1)/2) +
+           ScratchTileType::shmem_size(KOKKOSBLAS3_SYRK_GRAM_TILE_ROWS,n);
+  }
+
+  // Entry (i,p) of W; for herk with trans "N" this is conj(A(p,i)).
+  KOKKOS_INLINE_FUNCTION
+  value_type W(const int i, const int p) const {
+    return TransW ? (Conj ? ATV::conj(A(p,i)) : value_type(A(p,i))) : value_type(A(i,p));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const member_type& team) const {
+    const int chunk = team.league_rank();
+    const int begin = chunk*chunk_size;
+    const int end = begin+chunk_size < m ? begin+chunk_size : m;
+    const int num_packed = n*(n+1)/2;
+
+    ScratchAccType acc(team.team_scratch(scratch_level),num_packed);
+    ScratchTileType tile(team.team_scratch(scratch_level),KOKKOSBLAS3_SYRK_GRAM_TILE_ROWS,n);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,num_packed), [&] (const int e) {
+      acc(e) = ATV::zero();
+    });
+
+    for(int t0 = begin; t0 < end; t0 += KOKKOSBLAS3_SYRK_GRAM_TILE_ROWS) {
+      const int nt = t0+KOKKOSBLAS3_SYRK_GRAM_TILE_ROWS < end ? KOKKOSBLAS3_SYRK_GRAM_TILE_ROWS : end-t0;
+      team.team_barrier();
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nt), [&] (const int r) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,n), [&] (const int p) {
+          tile(r,p) = W(t0+r,p);
+        });
+      });
+      team.team_barrier();
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,n), [&] (const int q) {
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,q+1), [&] (const int p) {
+          value_type sum = ATV::zero();
+          for(int r = 0; r < nt; ++r)
+            sum += (Conj ? ATV::conj(tile(r,p)) : tile(r,p)) * tile(r,q);
+          acc(syrk_packed_index(p,q)) += sum;
+        });
+      });
+    }
+    team.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,num_packed), [&] (const int e) {
+      partial(e,chunk) = acc(e);
+    });
+  }
+};
+
+// One level of the pairwise tree that combines the per-team partial
+// triangles: column c += column c+stride for every c that is a
+// multiple of 2*stride.  After ceil(log2(numChunks)) levels, column 0
+// holds the full sum.  The pairing does not depend on the number of
+// threads, so the result is reproducible from run to run.
+template<class PartialViewType>
+struct SyrkGramCombine {
+  PartialViewType partial;
+  int num_packed, num_chunks, stride;
+
+  SyrkGramCombine(const PartialViewType& partial_, const int stride_)
+    : partial(partial_), num_packed(partial_.extent_int(0)),
+      num_chunks(partial_.extent_int(1)), stride(stride_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int t) const {
+    const int e = t % num_packed;
+    const int c = (t / num_packed) * 2 * stride;
+    if(c + stride < num_chunks)
+      partial(e,c) += partial(e,c+stride);
+  }
+};
+
+// Scale the combined triangle into the requested triangle of C.
+// For beta == 0, C is not read, so it may hold Inf or NaN on input.
+template<class CViewType, class PartialViewType, bool Upper, bool Conj>
+struct SyrkGramFinal {
+  typedef typename CViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+
+  value_type alpha, beta;
+  typename PartialViewType::const_type partial;
+  CViewType C;
+  int n;
+
+  SyrkGramFinal(const value_type& alpha_, const PartialViewType& partial_,
+                const value_type& beta_, const CViewType& C_)
+    : alpha(alpha_), beta(beta_), partial(partial_), C(C_), n(C_.extent_int(0)) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int t) const {
+    const int p = t % n;
+    const int q = t / n;
+    if(p > q)
+      return;
+    // Lower entry (q,p) of W^H W is the conjugate of upper entry (p,q).
+    const value_type s = partial(syrk_packed_index(p,q),0);
+    const value_type v = alpha * ((!Upper && Conj) ? ATV::conj(s) : s);
+    value_type& c = Upper ? C(p,q) : C(q,p);
+    c = (beta == ATV::zero()) ? v : beta*c + v;
+    // As in xHERK, the diagonal of a Hermitian C is real on output.
+    if(Conj && p == q)
+      c = ATV::real(c);
+  }
+};
+
+// Tall-skinny Gram kernel: the requested triangle of C (at most
+// KOKKOSBLAS3_SYRK_GRAM_MAX_K square) becomes alpha*W^H W + beta*C.
+// Rows of W are split into chunks, one per team; the per-team
+// triangles are combined in a pairwise tree instead of tiling C the
+// way gemm does, so a 10M x 32 W still fills the device.
+template<class AViewType, class CViewType, bool TransW, bool Conj>
+void
+syrk_gram (const bool upper,
+           typename CViewType::const_value_type& alpha,
+           const AViewType& A,
+           typename CViewType::const_value_type& beta,
+           const CViewType& C)
+{
+  typedef typename CViewType::execution_space execution_space;
+  typedef typename CViewType::non_const_value_type value_type;
+  typedef Kokkos::View<value_type**,Kokkos::LayoutLeft,typename CViewType::device_type> partial_view_type;
+  typedef SyrkGramPartial<AViewType,partial_view_type,TransW,Conj> partial_functor_type;
+
+  const int n = C.extent_int(0);
+  const int m = TransW ? A.extent_int(1) : A.extent_int(0);
+  if(n == 0)
+    return;
+
+  // Enough chunks to occupy every thread, but never so many that the
+  // partial triangles outgrow the input.
+  const int tile = KOKKOSBLAS3_SYRK_GRAM_TILE_ROWS;
+  const int max_chunks = 4*execution_space::concurrency() < KOKKOSBLAS3_SYRK_GRAM_MAX_CHUNKS ?
+                         4*execution_space::concurrency() : KOKKOSBLAS3_SYRK_GRAM_MAX_CHUNKS;
+  int num_chunks = (m+tile-1)/tile;
+  if(num_chunks > max_chunks) num_chunks = max_chunks;
+  if(num_chunks < 1) num_chunks = 1;
+  const int chunk_size = ((m+num_chunks-1)/num_chunks + tile-1)/tile*tile;
+  num_chunks = chunk_size > 0 ? (m+chunk_size-1)/chunk_size : 1;
+  if(num_chunks < 1) num_chunks = 1;
+
+  const int num_packed = n*(n+1)/2;
+  partial_view_type partial(Kokkos::ViewAllocateWithoutInitializing("KokkosBlas::syrk::partial"),
+                            num_packed,num_chunks);
+
+  partial_functor_type functor(A,partial,chunk_size);
+  const size_t scratch_memory_size = partial_functor_type::scratch_size(n);
+  functor.scratch_level = scratch_memory_size < 24000 ? 0 : 1;
+
+  // Vector lanes split one column of the triangle.
+  int vector_length = 1;
+  while((vector_length*2 <= n) && (vector_length < 32)) vector_length *= 2;
+  const int team_size = Kokkos::TeamPolicy<execution_space>::team_size_recommended(functor,vector_length);
+
+  Kokkos::TeamPolicy<execution_space> policy(num_chunks,team_size,vector_length);
+  Kokkos::parallel_for("KokkosBlas::syrk[Gram]",
+                       policy.set_scratch_size(functor.scratch_level,Kokkos::PerTeam(scratch_memory_size)),
+                       functor);
+
+  for(int stride = 1; stride < num_chunks; stride *= 2) {
+    const int num_pairs = (num_chunks + 2*stride - 1)/(2*stride);
+    Kokkos::parallel_for("KokkosBlas::syrk[GramCombine]",
+                         Kokkos::RangePolicy<execution_space>(0,num_packed*num_pairs),
+                         SyrkGramCombine<partial_view_type>(partial,stride));
+  }
+
+  if(upper)
+    Kokkos::parallel_for("KokkosBlas::syrk[GramFinal]", Kokkos::RangePolicy<execution_space>(0,n*n),
+                         SyrkGramFinal<CViewType,partial_view_type,true,Conj>(alpha,partial,beta,C));
+  else
+    Kokkos::parallel_for("KokkosBlas::syrk[GramFinal]", Kokkos::RangePolicy<execution_space>(0,n*n),
+                         SyrkGramFinal<CViewType,partial_view_type,false,Conj>(alpha,partial,beta,C));
+}
+
+template<class AViewType, class CViewType>
+struct SyrkRecursive {
+  typedef typename CViewType::non_const_value_type value_type;
+  typedef Kokkos::pair<int,int> range_type;
+
+  bool upper, transW, herm;
+  value_type alpha, beta;
+  AViewType A;
+  CViewType C;
+
+  SyrkRecursive(const char uplo[], const char trans[], const bool herm_,
+                const value_type& alpha_, const AViewType& A_,
+                const value_type& beta_, const CViewType& C_)
+    : herm(herm_), alpha(alpha_), beta(beta_), A(A_), C(C_) {
+    upper = (uplo[0] == 'U') || (uplo[0] == 'u');
+    transW = (trans[0] == 'N') || (trans[0] == 'n');
+  }
+
+  // Rows/columns c of C, i.e. columns c of W.
+  void gram(const range_type& c) const {
+    const auto all = Kokkos::ALL();
+    auto Csub = Kokkos::subview(C,c,c);
+    if(transW) {
+      auto Asub = Kokkos::subview(A,c,all);
+      if(herm) syrk_gram<decltype(Asub),decltype(Csub),true,true>(upper,alpha,Asub,beta,Csub);
+      else     syrk_gram<decltype(Asub),decltype(Csub),true,false>(upper,alpha,Asub,beta,Csub);
+    }
+    else {
+      auto Asub = Kokkos::subview(A,all,c);
+      if(herm) syrk_gram<decltype(Asub),decltype(Csub),false,true>(upper,alpha,Asub,beta,Csub);
+      else     syrk_gram<decltype(Asub),decltype(Csub),false,false>(upper,alpha,Asub,beta,Csub);
+    }
+  }
+
+  void compute(const int c0, const int n) const {
+    if(n <= 0)
+      return;
+    if(n <= KOKKOSBLAS3_SYRK_GRAM_MAX_K) {
+      gram(range_type(c0,c0+n));
+      return;
+    }
+
+    const int n1 = n/2;
+    const range_type r1(c0,c0+n1), r2(c0+n1,c0+n);
+    const auto all = Kokkos::ALL();
+    const char* tc = herm ? "C" : "T";
+
+    compute(c0,n1);
+    compute(c0+n1,n-n1);
+
+    // Off-diagonal block: C12 = alpha*op(A1)*op(A2)^H or C21 = alpha*op(A2)*op(A1)^H.
+    const range_type& ri = upper ? r1 : r2;
+    const range_type& rj = upper ? r2 : r1;
+    if(transW)
+      KokkosBlas::gemm("N",tc,alpha,Kokkos::subview(A,ri,all),Kokkos::subview(A,rj,all),
+                       beta,Kokkos::subview(C,ri,rj));
+    else
+      KokkosBlas::gemm(tc,"N",alpha,Kokkos::subview(A,all,ri),Kokkos::subview(A,all,rj),
+                       beta,Kokkos::subview(C,ri,rj));
+  }
+};
+
+// Symmetric (herm == false) or Hermitian (herm == true) rank-k update
+// of one triangle of C: C := alpha*op(A)*op(A)^T + beta*C (or ^H).
+// Blocks of C up to KOKKOSBLAS3_SYRK_GRAM_MAX_K wide use the
+// tall-skinny Gram kernel; wider C are blocked recursively and only
+// the off-diagonal blocks go to gemm, so the other triangle is never
+// computed.
+template<class AViewType, class CViewType>
+void
+syrk_recursive (const char uplo[],
+                const char trans[],
+                const bool herm,
+                typename CViewType::const_value_type& alpha,
+                const AViewType& A,
+                typename CViewType::const_value_type& beta,
+                const CViewType& C)
+{
+  SyrkRecursive<AViewType,CViewType> syrk(uplo,trans,herm,alpha,A,beta,C);
+  syrk.compute(0,C.extent_int(0));
+}
+
+}
+}
+#endif
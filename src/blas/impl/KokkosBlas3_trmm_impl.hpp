@@ -0,0 +1,223 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+#ifndef KOKKOS_BLAS3_TRMM_IMPL_HPP_
+#define KOKKOS_BLAS3_TRMM_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBlas1_scal.hpp>
+#include<KokkosBlas3_gemm.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Diagonal blocks up to this size are multiplied directly; larger
+// ones are split in half and the off-diagonal update goes to gemm.
+#define KOKKOSBLAS3_TRMM_BLOCK_SIZE 64
+
+// Multiply with one diagonal block op(A)(a0:a0+n, a0:a0+n) in place.
+// For Side == 0 (left), work item r is a column of B and rows
+// a0:a0+n of it are replaced by op(A) b.  For Side == 1 (right), work
+// item r is a row of B and columns a0:a0+n are replaced by b op(A).
+// Entries are overwritten in the order in which they are no longer
+// needed by the remaining ones.
+template<class AViewType, class BViewType, int Side, bool LowerOpA, int TransA, bool UnitDiag>
+struct TrmmBlockFunctor {
+  typedef typename BViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<typename AViewType::non_const_value_type> ATA;
+
+  AViewType A;
+  BViewType B;
+  int a0, n;
+
+  TrmmBlockFunctor(const AViewType& A_, const BViewType& B_, const int a0_, const int n_)
+    : A(A_), B(B_), a0(a0_), n(n_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  value_type opA(const int i, const int j) const {
+    return TransA == 0 ? A(a0+i,a0+j) :
+           TransA == 1 ? A(a0+j,a0+i) : ATA::conj(A(a0+j,a0+i));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  value_type& b(const int r, const int i) const {
+    return Side == 0 ? B(a0+i,r) : B(r,a0+i);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int r) const {
+    // Left & upper and right & lower sweep forward; the other two backward.
+    const bool forward = (Side == 0) != LowerOpA;
+    for(int t=0; t<n; ++t) {
+      const int i = forward ? t : n-1-t;
+      value_type b_i = UnitDiag ? b(r,i) : opA(i,i) * b(r,i);
+      if(forward) {
+        for(int k=i+1; k<n; ++k)
+          b_i += (Side == 0 ? opA(i,k) : opA(k,i)) * b(r,k);
+      } else {
+        for(int k=0; k<i; ++k)
+          b_i += (Side == 0 ? opA(i,k) : opA(k,i)) * b(r,k);
+      }
+      b(r,i) = b_i;
+    }
+  }
+};
+
+template<class AViewType, class BViewType>
+struct TrmmRecursive {
+  typedef typename BViewType::non_const_value_type value_type;
+  typedef typename BViewType::execution_space execution_space;
+  typedef Kokkos::pair<int,int> range_type;
+
+  const char* trans;
+  int side, transA;
+  bool lowerOpA, unitDiag;
+  AViewType A;
+  BViewType B;
+
+  TrmmRecursive(const char side_[], const char uplo[], const char trans_[], const char diag[],
+                const AViewType& A_, const BViewType& B_)
+    : trans(trans_), A(A_), B(B_) {
+    side = (side_[0] == 'L' || side_[0] == 'l') ? 0 : 1;
+    transA = (trans_[0] == 'N' || trans_[0] == 'n') ? 0 :
+             (trans_[0] == 'T' || trans_[0] == 't') ? 1 : 2;
+    const bool lowerA = (uplo[0] == 'L' || uplo[0] == 'l');
+    lowerOpA = transA == 0 ? lowerA : !lowerA;
+    unitDiag = (diag[0] == 'U' || diag[0] == 'u');
+  }
+
+  // Rows rows and columns cols of op(A), as a view of A to be passed to
+  // gemm together with trans.
+  Kokkos::View<typename AViewType::const_value_type**, typename AViewType::array_layout,
+               typename AViewType::device_type, Kokkos::MemoryTraits<Kokkos::Unmanaged> >
+  opA_block(const range_type& rows, const range_type& cols) const {
+    return transA == 0 ? Kokkos::subview(A, rows, cols) : Kokkos::subview(A, cols, rows);
+  }
+
+  template<int Side, bool LowerOpA, int TransA, bool UnitDiag>
+  void multiply_block(const int a0, const int n) const {
+    TrmmBlockFunctor<AViewType,BViewType,Side,LowerOpA,TransA,UnitDiag> functor(A,B,a0,n);
+    const int num_rhs = Side == 0 ? B.extent_int(1) : B.extent_int(0);
+    Kokkos::parallel_for("KokkosBlas::trmm[Block]", Kokkos::RangePolicy<execution_space>(0,num_rhs), functor);
+  }
+
+  template<int Side, bool LowerOpA>
+  void multiply_block(const int a0, const int n) const {
+    if(transA == 0) { if(unitDiag) multiply_block<Side,LowerOpA,0,true>(a0,n); else multiply_block<Side,LowerOpA,0,false>(a0,n); }
+    if(transA == 1) { if(unitDiag) multiply_block<Side,LowerOpA,1,true>(a0,n); else multiply_block<Side,LowerOpA,1,false>(a0,n); }
+    if(transA == 2) { if(unitDiag) multiply_block<Side,LowerOpA,2,true>(a0,n); else multiply_block<Side,LowerOpA,2,false>(a0,n); }
+  }
+
+  // Multiply with the diagonal block op(A)(a0:a0+n, a0:a0+n).
+  void multiply(const int a0, const int n) const {
+    if(n <= 0)
+      return;
+    if(n <= KOKKOSBLAS3_TRMM_BLOCK_SIZE) {
+      if(side == 0) { if(lowerOpA) multiply_block<0,true>(a0,n); else multiply_block<0,false>(a0,n); }
+      else          { if(lowerOpA) multiply_block<1,true>(a0,n); else multiply_block<1,false>(a0,n); }
+      return;
+    }
+
+    const value_type one = Kokkos::Details::ArithTraits<value_type>::one();
+    const int n1 = n/2;
+    const range_type r1(a0,a0+n1), r2(a0+n1,a0+n);
+    const auto all = Kokkos::ALL();
+
+    if(side == 0 && lowerOpA) {
+      // [L11 0; L21 L22] [B1; B2] = [L11 B1; L21 B1 + L22 B2]
+      multiply(a0+n1,n-n1);
+      KokkosBlas::gemm(trans,"N",one,opA_block(r2,r1),Kokkos::subview(B,r1,all),one,Kokkos::subview(B,r2,all));
+      multiply(a0,n1);
+    }
+    else if(side == 0) {
+      // [U11 U12; 0 U22] [B1; B2] = [U11 B1 + U12 B2; U22 B2]
+      multiply(a0,n1);
+      KokkosBlas::gemm(trans,"N",one,opA_block(r1,r2),Kokkos::subview(B,r2,all),one,Kokkos::subview(B,r1,all));
+      multiply(a0+n1,n-n1);
+    }
+    else if(lowerOpA) {
+      // [B1 B2] [L11 0; L21 L22] = [B1 L11 + B2 L21, B2 L22]
+      multiply(a0,n1);
+      KokkosBlas::gemm("N",trans,one,Kokkos::subview(B,all,r2),opA_block(r2,r1),one,Kokkos::subview(B,all,r1));
+      multiply(a0+n1,n-n1);
+    }
+    else {
+      // [B1 B2] [U11 U12; 0 U22] = [B1 U11, B1 U12 + B2 U22]
+      multiply(a0+n1,n-n1);
+      KokkosBlas::gemm("N",trans,one,Kokkos::subview(B,all,r1),opA_block(r1,r2),one,Kokkos::subview(B,all,r2));
+      multiply(a0,n1);
+    }
+  }
+};
+
+// Triangular matrix-matrix multiply, B := alpha*op(A)*B or
+// B := alpha*B*op(A).  Diagonal blocks are multiplied by one work item
+// per column (left) or row (right) of B; everything else is gemm.
+template<class AViewType, class BViewType>
+void
+trmm_recursive (const char side[],
+                const char uplo[],
+                const char trans[],
+                const char diag[],
+                typename BViewType::const_value_type& alpha,
+                const AViewType& A,
+                const BViewType& B)
+{
+  typedef typename BViewType::non_const_value_type value_type;
+
+  if(B.extent(0) == 0 || B.extent(1) == 0)
+    return;
+  if(alpha != Kokkos::Details::ArithTraits<value_type>::one())
+    KokkosBlas::scal(B,alpha,B);
+  if(alpha == Kokkos::Details::ArithTraits<value_type>::zero())
+    return;
+
+  TrmmRecursive<AViewType,BViewType> multiplier(side,uplo,trans,diag,A,B);
+  multiplier.multiply(0,A.extent_int(0));
+}
+
+}
+}
+#endif
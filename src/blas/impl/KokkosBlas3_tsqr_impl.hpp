@@ -0,0 +1,482 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+
+
+#ifndef KOKKOS_BLAS3_TSQR_IMPL_HPP_
+#define KOKKOS_BLAS3_TSQR_IMPL_HPP_
+
+#include<Kokkos_Core.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBatched_Util.hpp>
+#include<KokkosBatched_Gemm_Decl.hpp>
+#include<KokkosBatched_Gemm_Team_Impl.hpp>
+
+namespace KokkosBlas {
+namespace Impl {
+
+// Minimum number of rows of A factored by one team at the leaves of
+// the reduction tree.
+#define KOKKOSBLAS3_TSQR_LEAF_ROWS 256
+// Upper bound on the number of leaves.
+#define KOKKOSBLAS3_TSQR_MAX_LEAVES 1024
+// Rows of a leaf staged in scratch at a time while forming Q.
+#define KOKKOSBLAS3_TSQR_TILE_ROWS 32
+
+// TSQR factors the m x n matrix A (m >= n) as follows.  A is split into
+// P blocks of at least max(LEAF_ROWS, n) rows, and one team computes
+// the Householder QR of each block in place.  The P n x n R factors are
+// then reduced in a binary tree: each node stacks the R factors of its
+// two children into a 2n x n work matrix and factors that.  The R of
+// the root is the R of A.  Q is formed explicitly top-down: each node
+// turns its Householder vectors into an explicit 2n x n Q_node and
+// multiplies it by the n x n block its parent passed down, splitting
+// the product between its two children; each leaf finally overwrites
+// its block of A with Q_leaf times its n x n block.  Only the n x n
+// factors travel between teams.
+
+// Team-level unblocked Householder QR of the rows x n matrix A, rows
+// >= n, as in LAPACK's xGEQR2.  On exit, R is in the upper triangle
+// of A and the Householder vectors, with implicit unit leading
+// entries, are below the diagonal, so that A = H_0 H_1 ... H_{n-1} R
+// with H_j = I - tau(j) v_j v_j^H.
+template<class MemberType, class AViewType, class TauViewType>
+KOKKOS_INLINE_FUNCTION
+void tsqr_team_geqr2(const MemberType& team, const AViewType& A, const TauViewType& tau) {
+  typedef typename AViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+  typedef typename ATV::mag_type mag_type;
+  typedef Kokkos::Details::ArithTraits<mag_type> ATM;
+
+  const int m = A.extent_int(0);
+  const int n = A.extent_int(1);
+  for(int j = 0; j < n; ++j) {
+    const value_type alpha = A(j,j);
+    mag_type xnorm2 = ATM::zero();
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,j+1,m), [&] (const int i, mag_type& update) {
+      const mag_type a = ATV::abs(A(i,j));
+      update += a*a;
+    }, xnorm2);
+
+    value_type beta = alpha, tau_j = ATV::zero(), scale = ATV::zero();
+    if(xnorm2 > ATM::zero() || ATV::imag(alpha) != ATM::zero()) {
+      const mag_type abs_alpha = ATV::abs(alpha);
+      const mag_type anorm = ATM::sqrt(abs_alpha*abs_alpha + xnorm2);
+      beta = value_type(ATV::real(alpha) >= ATM::zero() ? -anorm : anorm);
+      tau_j = (beta - alpha)/beta;
+      scale = ATV::one()/(alpha - beta);
+    }
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,j+1,m), [&] (const int i) {
+      A(i,j) *= scale;
+    });
+    team.team_barrier();
+    Kokkos::single(Kokkos::PerTeam(team), [&] () {
+      A(j,j) = beta;
+      tau(j) = tau_j;
+    });
+
+    // A(j:m,j+1:n) := H_j^H A(j:m,j+1:n)
+    const value_type ctau = ATV::conj(tau_j);
+    if(ctau != ATV::zero()) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,j+1,n), [&] (const int k) {
+        value_type s = ATV::zero();
+        Kokkos::parallel_reduce(Kokkos::ThreadVectorRange(team,m-j-1), [&] (const int ii, value_type& update) {
+          update += ATV::conj(A(j+1+ii,j))*A(j+1+ii,k);
+        }, s);
+        const value_type w = ctau*(A(j,k) + s);
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,m-j-1), [&] (const int ii) {
+          A(j+1+ii,k) -= A(j+1+ii,j)*w;
+        });
+        Kokkos::single(Kokkos::PerThread(team), [&] () {
+          A(j,k) -= w;
+        });
+      });
+    }
+    team.team_barrier();
+  }
+}
+
+// Team-level formation of the explicit rows x n Q = H_0 ... H_{n-1}
+// [I; 0] in place of the Householder vectors left by tsqr_team_geqr2,
+// as in LAPACK's xORG2R.
+template<class MemberType, class AViewType, class TauViewType>
+KOKKOS_INLINE_FUNCTION
+void tsqr_team_org2r(const MemberType& team, const AViewType& A, const TauViewType& tau) {
+  typedef typename AViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+
+  const int m = A.extent_int(0);
+  const int n = A.extent_int(1);
+  for(int j = n-1; j >= 0; --j) {
+    const value_type tau_j = tau(j);
+
+    // A(j:m,j+1:n) := H_j A(j:m,j+1:n); row j of these columns is zero.
+    if(tau_j != ATV::zero()) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,j+1,n), [&] (const int k) {
+        value_type s = ATV::zero();
+        Kokkos::parallel_reduce(Kokkos::ThreadVectorRange(team,m-j-1), [&] (const int ii, value_type& update) {
+          update += ATV::conj(A(j+1+ii,j))*A(j+1+ii,k);
+        }, s);
+        const value_type w = tau_j*s;
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,m-j-1), [&] (const int ii) {
+          A(j+1+ii,k) -= A(j+1+ii,j)*w;
+        });
+        Kokkos::single(Kokkos::PerThread(team), [&] () {
+          A(j,k) = -w;
+        });
+      });
+    }
+    team.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,m), [&] (const int i) {
+      if(i < j)       A(i,j) = ATV::zero();
+      else if(i == j) A(i,j) = ATV::one() - tau_j;
+      else            A(i,j) = -tau_j*A(i,j);
+    });
+    team.team_barrier();
+  }
+}
+
+// Shape of the reduction tree: level 0 has the P leaves, level l has
+// ceil(count(l-1)/2) nodes, the last level has the root.  Internal
+// nodes of level l >= 1 are numbered from offset[l].
+struct TsqrTree {
+  int num_leaves, leaf_rows, num_levels, num_nodes;
+  int count[32], offset[32];
+
+  TsqrTree(const int m, const int n, const int max_leaves) {
+    leaf_rows = KOKKOSBLAS3_TSQR_LEAF_ROWS > n ? KOKKOSBLAS3_TSQR_LEAF_ROWS : n;
+    num_leaves = m/leaf_rows;
+    if(num_leaves > max_leaves) {
+      leaf_rows = (m+max_leaves-1)/max_leaves;
+      num_leaves = m/leaf_rows;
+    }
+    if(num_leaves < 1) num_leaves = 1;
+    count[0] = num_leaves;
+    offset[0] = 0;
+    num_levels = 1;
+    num_nodes = 0;
+    while(count[num_levels-1] > 1) {
+      count[num_levels] = (count[num_levels-1]+1)/2;
+      offset[num_levels] = num_nodes;
+      num_nodes += count[num_levels];
+      ++num_levels;
+    }
+  }
+
+  // Rows [begin(p), end(p)) of A belong to leaf p; the last leaf also
+  // takes the remainder, so every leaf has at least n rows.
+  KOKKOS_INLINE_FUNCTION int begin(const int p) const { return p*leaf_rows; }
+  KOKKOS_INLINE_FUNCTION int end(const int p, const int m) const { return p+1 == num_leaves ? m : (p+1)*leaf_rows; }
+};
+
+template<class AViewType, class TauViewType>
+struct TsqrLeafFactor {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+
+  AViewType A;
+  TauViewType tau;
+  TsqrTree tree;
+
+  TsqrLeafFactor(const AViewType& A_, const TauViewType& tau_, const TsqrTree& tree_)
+    : A(A_), tau(tau_), tree(tree_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const member_type& team) const {
+    const int p = team.league_rank();
+    auto Ap = Kokkos::subview(A,Kokkos::make_pair(tree.begin(p),tree.end(p,A.extent_int(0))),Kokkos::ALL());
+    auto taup = Kokkos::subview(tau,p,Kokkos::ALL());
+    tsqr_team_geqr2(team,Ap,taup);
+  }
+};
+
+// Factor the nodes of one level >= 1 of the tree.
+template<class AViewType, class WorkViewType, class TauViewType>
+struct TsqrNodeFactor {
+  typedef typename WorkViewType::execution_space execution_space;
+  typedef typename WorkViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+
+  AViewType A;
+  WorkViewType W;
+  TauViewType tau;
+  TsqrTree tree;
+  int level;
+
+  TsqrNodeFactor(const AViewType& A_, const WorkViewType& W_, const TauViewType& tau_,
+                 const TsqrTree& tree_, const int level_)
+    : A(A_), W(W_), tau(tau_), tree(tree_), level(level_) {}
+
+  // Entry (i,k), i <= k, of the R factor of child c of level-1.
+  KOKKOS_INLINE_FUNCTION
+  value_type child_R(const int c, const int i, const int k) const {
+    return level == 1 ? A(tree.begin(c)+i,k) : W(tree.offset[level-1]+c,i,k);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const member_type& team) const {
+    const int q = team.league_rank();
+    const int node = tree.offset[level]+q;
+    const int n = W.extent_int(2);
+    const int num_children = tree.count[level-1];
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,2*n*n), [&] (const int e) {
+      const int r = e/n, k = e%n;
+      const int c = 2*q + r/n, i = r%n;
+      W(node,r,k) = (c < num_children && i <= k) ? child_R(c,i,k) : ATV::zero();
+    });
+    team.team_barrier();
+
+    auto Wn = Kokkos::subview(W,node,Kokkos::ALL(),Kokkos::ALL());
+    auto taun = Kokkos::subview(tau,node,Kokkos::ALL());
+    tsqr_team_geqr2(team,Wn,taun);
+  }
+};
+
+// Form the explicit Q of the nodes of one level >= 1 of the tree, and
+// multiply it by the n x n block passed down by the parent (identity
+// for the root): C(node) := Q_node * C_parent.
+template<class WorkViewType, class TauViewType>
+struct TsqrNodeQ {
+  typedef typename WorkViewType::execution_space execution_space;
+  typedef typename WorkViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+
+  WorkViewType W, C;
+  TauViewType tau;
+  TsqrTree tree;
+  int level;
+
+  TsqrNodeQ(const WorkViewType& W_, const WorkViewType& C_, const TauViewType& tau_,
+            const TsqrTree& tree_, const int level_)
+    : W(W_), C(C_), tau(tau_), tree(tree_), level(level_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const member_type& team) const {
+    using namespace KokkosBatched::Experimental;
+    const int q = team.league_rank();
+    const int node = tree.offset[level]+q;
+    const int n = W.extent_int(2);
+
+    auto Wn = Kokkos::subview(W,node,Kokkos::ALL(),Kokkos::ALL());
+    auto Cn = Kokkos::subview(C,node,Kokkos::ALL(),Kokkos::ALL());
+    tsqr_team_org2r(team,Wn,Kokkos::subview(tau,node,Kokkos::ALL()));
+
+    if(level+1 == tree.num_levels) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,2*n*n), [&] (const int e) {
+        Cn(e/n,e%n) = Wn(e/n,e%n);
+      });
+    } else {
+      const int parent = tree.offset[level+1] + q/2;
+      auto Cp = Kokkos::subview(C,parent,Kokkos::make_pair((q%2)*n,(q%2)*n+n),Kokkos::ALL());
+      TeamGemm<member_type,Trans::NoTranspose,Trans::NoTranspose,Algo::Gemm::Unblocked>::
+        invoke(team,ATV::one(),Wn,Cp,ATV::zero(),Cn);
+    }
+  }
+};
+
+// Form the explicit Q of each leaf in place and multiply it by the
+// n x n block passed down by its parent, a tile of rows at a time.
+template<class AViewType, class WorkViewType, class TauViewType>
+struct TsqrLeafQ {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename AViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+  typedef typename Kokkos::TeamPolicy<execution_space>::member_type member_type;
+  typedef Kokkos::View<value_type**,Kokkos::LayoutRight,typename execution_space::scratch_memory_space,
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > ScratchViewType;
+
+  AViewType A;
+  WorkViewType C;
+  TauViewType tau;
+  TsqrTree tree;
+  int scratch_level;
+
+  TsqrLeafQ(const AViewType& A_, const WorkViewType& C_, const TauViewType& tau_, const TsqrTree& tree_)
+    : A(A_), C(C_), tau(tau_), tree(tree_), scratch_level(0) {}
+
+  static size_t scratch_size(const int n) {
+    return ScratchViewType::shmem_size(n,n) +
+           ScratchViewType::shmem_size(KOKKOSBLAS3_TSQR_TILE_ROWS,n);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const member_type& team) const {
+    using namespace KokkosBatched::Experimental;
+    const int p = team.league_rank();
+    const int begin = tree.begin(p), end = tree.end(p,A.extent_int(0));
+    const int n = A.extent_int(1);
+
+    auto Ap = Kokkos::subview(A,Kokkos::make_pair(begin,end),Kokkos::ALL());
+    tsqr_team_org2r(team,Ap,Kokkos::subview(tau,p,Kokkos::ALL()));
+    if(tree.num_levels == 1)
+      return;
+
+    ScratchViewType Cs(team.team_scratch(scratch_level),n,n);
+    ScratchViewType tile(team.team_scratch(scratch_level),KOKKOSBLAS3_TSQR_TILE_ROWS,n);
+    const int parent = tree.offset[1] + p/2;
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,n*n), [&] (const int e) {
+      Cs(e/n,e%n) = C(parent,(p%2)*n + e/n,e%n);
+    });
+
+    for(int t0 = begin; t0 < end; t0 += KOKKOSBLAS3_TSQR_TILE_ROWS) {
+      const int nt = t0+KOKKOSBLAS3_TSQR_TILE_ROWS < end ? KOKKOSBLAS3_TSQR_TILE_ROWS : end-t0;
+      team.team_barrier();
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nt*n), [&] (const int e) {
+        tile(e/n,e%n) = A(t0+e/n,e%n);
+      });
+      team.team_barrier();
+      auto At = Kokkos::subview(A,Kokkos::make_pair(t0,t0+nt),Kokkos::ALL());
+      auto tt = Kokkos::subview(tile,Kokkos::make_pair(0,nt),Kokkos::ALL());
+      TeamGemm<member_type,Trans::NoTranspose,Trans::NoTranspose,Algo::Gemm::Unblocked>::
+        invoke(team,ATV::one(),tt,Cs,ATV::zero(),At);
+    }
+  }
+};
+
+template<class RViewType, class SrcViewType>
+struct TsqrCopyR {
+  typedef typename RViewType::non_const_value_type value_type;
+  typedef Kokkos::Details::ArithTraits<value_type> ATV;
+
+  RViewType R;
+  SrcViewType src;
+
+  TsqrCopyR(const RViewType& R_, const SrcViewType& src_) : R(R_), src(src_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const int e) const {
+    const int n = R.extent_int(1);
+    const int i = e/n, k = e%n;
+    R(i,k) = i <= k ? value_type(src(i,k)) : ATV::zero();
+  }
+};
+
+template<class Functor>
+int tsqr_team_size(const Functor& functor, int& vector_length, const int m) {
+  typedef typename Functor::execution_space execution_space;
+  // Vector lanes split the rows of a column.
+  vector_length = 1;
+  while((vector_length*2 <= m) && (vector_length < 32)) vector_length *= 2;
+  return Kokkos::TeamPolicy<execution_space>::team_size_recommended(functor,vector_length);
+}
+
+// A := Q, R := R, for the m x n A, m >= n.
+template<class AViewType, class RViewType>
+void tsqr_impl(const AViewType& A, const RViewType& R) {
+  typedef typename AViewType::execution_space execution_space;
+  typedef typename AViewType::non_const_value_type value_type;
+  typedef Kokkos::View<value_type**,Kokkos::LayoutRight,typename AViewType::device_type> tau_view_type;
+  typedef Kokkos::View<value_type***,Kokkos::LayoutRight,typename AViewType::device_type> work_view_type;
+
+  const int m = A.extent_int(0);
+  const int n = A.extent_int(1);
+  if(n == 0) return;
+
+  const int max_leaves = 4*execution_space::concurrency() < KOKKOSBLAS3_TSQR_MAX_LEAVES ?
+                         4*execution_space::concurrency() : KOKKOSBLAS3_TSQR_MAX_LEAVES;
+  const TsqrTree tree(m,n,max_leaves);
+
+  tau_view_type tau_leaf("KokkosBlas::tsqr::tau_leaf",tree.num_leaves,n);
+  tau_view_type tau_node("KokkosBlas::tsqr::tau_node",tree.num_nodes,n);
+  work_view_type W(Kokkos::ViewAllocateWithoutInitializing("KokkosBlas::tsqr::W"),tree.num_nodes,2*n,n);
+  work_view_type C(Kokkos::ViewAllocateWithoutInitializing("KokkosBlas::tsqr::C"),tree.num_nodes,2*n,n);
+
+  int vector_length = 1, team_size = 1;
+
+  // Factor the leaves, then the tree bottom-up.
+  {
+    TsqrLeafFactor<AViewType,tau_view_type> functor(A,tau_leaf,tree);
+    team_size = tsqr_team_size(functor,vector_length,tree.leaf_rows);
+    Kokkos::parallel_for("KokkosBlas::tsqr[LeafFactor]",
+                         Kokkos::TeamPolicy<execution_space>(tree.num_leaves,team_size,vector_length),
+                         functor);
+  }
+  for(int level = 1; level < tree.num_levels; ++level) {
+    TsqrNodeFactor<AViewType,work_view_type,tau_view_type> functor(A,W,tau_node,tree,level);
+    team_size = tsqr_team_size(functor,vector_length,2*n);
+    Kokkos::parallel_for("KokkosBlas::tsqr[NodeFactor]",
+                         Kokkos::TeamPolicy<execution_space>(tree.count[level],team_size,vector_length),
+                         functor);
+  }
+
+  // Copy out R before Q overwrites it.
+  if(tree.num_levels == 1) {
+    auto src = Kokkos::subview(A,Kokkos::make_pair(0,n),Kokkos::ALL());
+    Kokkos::parallel_for("KokkosBlas::tsqr[CopyR]",Kokkos::RangePolicy<execution_space>(0,n*n),
+                         TsqrCopyR<RViewType,decltype(src)>(R,src));
+  } else {
+    auto src = Kokkos::subview(W,tree.num_nodes-1,Kokkos::make_pair(0,n),Kokkos::ALL());
+    Kokkos::parallel_for("KokkosBlas::tsqr[CopyR]",Kokkos::RangePolicy<execution_space>(0,n*n),
+                         TsqrCopyR<RViewType,decltype(src)>(R,src));
+  }
+
+  // Form Q top-down.
+  for(int level = tree.num_levels-1; level >= 1; --level) {
+    TsqrNodeQ<work_view_type,tau_view_type> functor(W,C,tau_node,tree,level);
+    team_size = tsqr_team_size(functor,vector_length,2*n);
+    Kokkos::parallel_for("KokkosBlas::tsqr[NodeQ]",
+                         Kokkos::TeamPolicy<execution_space>(tree.count[level],team_size,vector_length),
+                         functor);
+  }
+  {
+    typedef TsqrLeafQ<AViewType,work_view_type,tau_view_type> functor_type;
+    functor_type functor(A,C,tau_leaf,tree);
+    const size_t scratch_memory_size = functor_type::scratch_size(n);
+    functor.scratch_level = scratch_memory_size < 24000 ? 0 : 1;
+    team_size = tsqr_team_size(functor,vector_length,tree.leaf_rows);
+    Kokkos::TeamPolicy<execution_space> policy(tree.num_leaves,team_size,vector_length);
+    Kokkos::parallel_for("KokkosBlas::tsqr[LeafQ]",
+                         policy.set_scratch_size(functor.scratch_level,Kokkos::PerTeam(scratch_memory_size)),
+                         functor);
+  }
+}
+
+} // namespace Impl
+} // namespace KokkosBlas
+
+#endif // KOKKOS_BLAS3_TSQR_IMPL_HPP_
@@ -45,6 +45,7 @@
 #include "KokkosSparse_gauss_seidel_handle.hpp"
 #include "KokkosSparse_spgemm_handle.hpp"
 #include "KokkosSparse_spadd_handle.hpp"
+#include "KokkosSparse_par_ilu_handle.hpp"
 #ifndef _KOKKOSKERNELHANDLE_HPP
 #define _KOKKOSKERNELHANDLE_HPP
 
@@ -135,6 +136,7 @@ public:
 	  this->gcHandle = right_side_handle.get_graph_coloring_handle();
 	  this->gsHandle = right_side_handle.get_gs_handle();
 	  this->spgemmHandle = right_side_handle.get_spgemm_handle();
+	  this->parIluHandle = right_side_handle.get_par_ilu_handle();
 
 
 	  this->team_work_size = right_side_handle.get_set_team_work_size();
@@ -150,6 +152,7 @@ public:
 	  is_owner_of_the_gs_handle = false;
 	  is_owner_of_the_spgemm_handle = false;
 	  is_owner_of_the_spadd_handle = false;
+	  is_owner_of_the_par_ilu_handle = false;
 	  //return *this;
   }
 
@@ -165,6 +168,10 @@ public:
       <const_size_type, const_nnz_lno_t, const_nnz_scalar_t,
 	  HandleExecSpace, HandleTempMemorySpace, HandlePersistentMemorySpace> SPGEMMHandleType;
 
+  typedef typename KokkosSparse::ParILUHandle
+      <const_size_type, const_nnz_lno_t, const_nnz_scalar_t,
+	  HandleExecSpace, HandleTempMemorySpace, HandlePersistentMemorySpace> ParILUHandleType;
+
   typedef typename Kokkos::View<nnz_scalar_t *, HandleTempMemorySpace> in_scalar_nnz_view_t;
 
   typedef typename Kokkos::View<size_type *, HandleTempMemorySpace> row_lno_temp_work_view_t;
@@ -194,6 +201,7 @@ private:
   GaussSeidelHandleType *gsHandle;
   SPGEMMHandleType *spgemmHandle;
   SPADDHandleType *spaddHandle;
+  ParILUHandleType *parIluHandle;
 
   int team_work_size;
   size_t shared_memory_size;
@@ -208,6 +216,7 @@ private:
   bool is_owner_of_the_gs_handle;
   bool is_owner_of_the_spgemm_handle;
   bool is_owner_of_the_spadd_handle;
+  bool is_owner_of_the_par_ilu_handle;
 
 
 public:
@@ -215,19 +224,20 @@ public:
 
 
   KokkosKernelsHandle():
-      gcHandle(NULL), gsHandle(NULL),spgemmHandle(NULL),spaddHandle(NULL),
+      gcHandle(NULL), gsHandle(NULL),spgemmHandle(NULL),spaddHandle(NULL),parIluHandle(NULL),
       team_work_size (-1), shared_memory_size(16128),
       suggested_team_size(-1),
       my_exec_space(KokkosKernels::Impl::kk_get_exec_space_type<HandleExecSpace>()),
       use_dynamic_scheduling(true), KKVERBOSE(false),vector_size(-1),
 	  is_owner_of_the_gc_handle(true), is_owner_of_the_gs_handle(true), is_owner_of_the_spgemm_handle(true),
-    is_owner_of_the_spadd_handle(true) {}
+    is_owner_of_the_spadd_handle(true), is_owner_of_the_par_ilu_handle(true) {}
 
   ~KokkosKernelsHandle(){
     this->destroy_gs_handle();
     this->destroy_graph_coloring_handle();
     this->destroy_spgemm_handle();
     this->destroy_spadd_handle();
+    this->destroy_par_ilu_handle();
   }
 
 
@@ -447,6 +457,32 @@ public:
     }
   }
 
+
+  ParILUHandleType *get_par_ilu_handle(){
+    return this->parIluHandle;
+  }
+
+  /**
+   * \brief Creates the handle of the fixed-point (Chow-Patel) ILU(0) factorization.
+   * \param algo: PARILU_ASYNC (in-place sweeps) or PARILU_SYNC (Jacobi-style sweeps).
+   * \param max_sweeps: number of sweeps run by par_ilu_numeric.
+   */
+  void create_par_ilu_handle(
+      KokkosSparse::ParILUAlgorithm algo = KokkosSparse::PARILU_DEFAULT,
+      int max_sweeps = 5){
+    this->destroy_par_ilu_handle();
+    this->is_owner_of_the_par_ilu_handle = true;
+    this->parIluHandle = new ParILUHandleType(algo, max_sweeps);
+  }
+
+  void destroy_par_ilu_handle(){
+    if (is_owner_of_the_par_ilu_handle && this->parIluHandle != NULL)
+    {
+      delete this->parIluHandle;
+      this->parIluHandle = NULL;
+    }
+  }
+
 };
 
 }
@@ -1130,6 +1130,7 @@ struct LowerTriangularMatrix{
   const lno_t team_work_size;
   const ExecSpaceType exec_space;
   const bool is_lower;
+  const bool incl_diag;
 
   LowerTriangularMatrix(
       const lno_t num_rows_,
@@ -1141,11 +1142,12 @@ struct LowerTriangularMatrix{
       lno_t * t_adj_,
       scalar_t *out_vals_,
       const lno_t team_row_work_size_,
-      bool is_lower_ = true):
+      bool is_lower_ = true,
+      bool incl_diag_ = false):
         num_rows(num_rows_),
         xadj(xadj_), adj(adj_), in_vals (in_vals_),permutation(permutation_),
         t_xadj(t_xadj_),  t_adj(t_adj_), t_vals(out_vals_),
-        team_work_size(team_row_work_size_), exec_space (kk_get_exec_space_type<ExecutionSpace>()), is_lower(is_lower_) {}
+        team_work_size(team_row_work_size_), exec_space (kk_get_exec_space_type<ExecutionSpace>()), is_lower(is_lower_), incl_diag(incl_diag_) {}
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const CountTag&, const team_count_member_t & teamMember) const {
@@ -1172,12 +1174,12 @@ struct LowerTriangularMatrix{
           colIndex = permutation[colIndex];
         }
         if (is_lower){
-          if (row_perm > colIndex){
+          if (row_perm > colIndex || (incl_diag && row_perm == colIndex)){
             rowsize_ += 1;
           }
         }
         else {
-          if (row_perm < colIndex){
+          if (row_perm < colIndex || (incl_diag && row_perm == colIndex)){
             rowsize_ += 1;
           }
         }
@@ -1230,7 +1232,7 @@ struct LowerTriangularMatrix{
             colperm = permutation[colIndex];
           }
           if (is_lower){
-            if (row_perm > colperm){
+            if (row_perm > colperm || (incl_diag && row_perm == colperm)){
               if (in_vals != NULL){
                 t_vals[write_begin + w] = in_vals[adjind];
               }
@@ -1238,7 +1240,7 @@ struct LowerTriangularMatrix{
             }
           }
           else {
-            if (row_perm < colperm){
+            if (row_perm < colperm || (incl_diag && row_perm == colperm)){
               if (in_vals != NULL){
                 t_vals[write_begin + w] = in_vals[adjind];
               }
@@ -1263,7 +1265,8 @@ void kk_get_lower_triangle_count_parallel(
     const lno_t *new_indices = NULL,
     bool use_dynamic_scheduling = false,
     int chunksize = 4,
-    bool is_lower = true
+    bool is_lower = true,
+    bool incl_diag = false
     ){
 
 
@@ -1280,7 +1283,8 @@ void kk_get_lower_triangle_count_parallel(
       out_xadj,
       NULL, NULL,
       team_work_chunk_size,
-      is_lower);
+      is_lower,
+      incl_diag);
 
 
   typedef typename ltm_t::team_count_policy_t count_tp_t;
@@ -1450,7 +1454,8 @@ void kk_get_lower_triangle_fill_parallel(
     const lno_t *new_indices = NULL,
     bool use_dynamic_scheduling = false,
     bool chunksize = 4,
-    bool is_lower = true
+    bool is_lower = true,
+    bool incl_diag = false
     ){
 
 
@@ -1467,7 +1472,8 @@ void kk_get_lower_triangle_fill_parallel(
       out_xadj,
       out_adj,out_vals,
       team_work_chunk_size,
-      is_lower);
+      is_lower,
+      incl_diag);
 
 
   typedef typename ltm_t::team_fill_policy_t fill_p_t;
@@ -1523,14 +1529,15 @@ void kk_get_lower_triangle_count(
     const lno_t *new_indices = NULL,
     bool use_dynamic_scheduling = false,
     bool chunksize = 4,
-    bool is_lower = true
+    bool is_lower = true,
+    bool incl_diag = false
     ){
   //Kokkos::Impl::Timer timer1;
 
 
   //kk_get_lower_triangle_count_sequential(nv, in_xadj, in_adj, out_xadj, new_indices);
   kk_get_lower_triangle_count_parallel<size_type, lno_t, ExecutionSpace>(
-      nv, ne, in_xadj, in_adj, out_xadj, new_indices,use_dynamic_scheduling,chunksize, is_lower);
+      nv, ne, in_xadj, in_adj, out_xadj, new_indices,use_dynamic_scheduling,chunksize, is_lower, incl_diag);
   //double count = timer1.seconds();
   //std::cout << "lower count time:" << count<< std::endl;
 
@@ -1547,7 +1554,8 @@ void kk_get_lower_triangle_fill(
     const lno_t *new_indices = NULL,
     bool use_dynamic_scheduling = false,
     bool chunksize = 4,
-    bool is_lower = true
+    bool is_lower = true,
+    bool incl_diag = false
     ){
   //Kokkos::Impl::Timer timer1;
 /*
@@ -1574,7 +1582,8 @@ void kk_get_lower_triangle_fill(
       new_indices,
       use_dynamic_scheduling,
       chunksize,
-      is_lower
+      is_lower,
+      incl_diag
       );
 
   //double fill = timer1.seconds();
@@ -1770,7 +1779,8 @@ void kk_get_lower_triangle(
     new_indices_t &new_indices,
     bool use_dynamic_scheduling = false,
     bool chunksize = 4,
-    bool is_lower = true){
+    bool is_lower = true,
+    bool incl_diag = false){
 
   //typedef typename row_map_view_t::const_type const_row_map_view_t;
   //typedef typename cols_view_t::const_type   const_cols_view_t;
@@ -1793,7 +1803,7 @@ void kk_get_lower_triangle(
       out_rowmap.data(),
       new_indices.data(),
       use_dynamic_scheduling,
-      chunksize,  is_lower);
+      chunksize,  is_lower, incl_diag);
 
   kk_exclusive_parallel_prefix_sum
   <out_row_map_view_t, exec_space>(nr + 1, out_rowmap);
@@ -1816,7 +1826,7 @@ void kk_get_lower_triangle(
       nr, ne,
       rowmap, entries, vals,
       out_rowmap.data(), out_entries.data(), out_values.data(),
-      new_indices.data(), use_dynamic_scheduling, chunksize,is_lower);
+      new_indices.data(), use_dynamic_scheduling, chunksize,is_lower, incl_diag);
 }
 
 template <typename row_map_view_t,
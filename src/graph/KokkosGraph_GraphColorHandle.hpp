@@ -59,7 +59,11 @@ enum ColoringAlgorithm { COLORING_DEFAULT,
                          COLORING_SERIAL2,
                          COLORING_SPGEMM,
                          COLORING_D2_MATRIX_SQUARED,          // Distance-2 Graph Coloring (Brian's Code)
-                         COLORING_D2                          // Distance-2 Graph Coloring (WCMCLEN)
+                         COLORING_D2,                         // Distance-2 Graph Coloring (WCMCLEN)
+                         COLORING_D2_VB_BIT,                  // Distance-2 Graph Coloring with forbidden color bitmasks
+                         COLORING_JP,                         // Jones-Plassmann with random (hashed) priorities
+                         COLORING_JP_LDF,                     // Jones-Plassmann with largest-degree-first priorities
+                         COLORING_JP_SL                       // Jones-Plassmann with smallest-last priorities
                        };
 
 enum ConflictList{COLORING_NOCONFLICT, COLORING_ATOMIC, COLORING_PPS};
@@ -137,6 +141,8 @@ private:
 
   int eb_num_initial_colors; //the number of colors to assign at the beginning of the edge-based algorithm
 
+  unsigned int jp_seed; //the seed of the vertex hash used as random priority in the Jones-Plassmann algorithms
+
   //STATISTICS
   double overall_coloring_time; //the overall time that it took to color the graph. In the case of the iterative calls.
   double coloring_time; //the time that it took to color the graph
@@ -169,7 +175,7 @@ private:
     tictoc(false),
     vb_edge_filtering(false),
     vb_chunk_size(8),
-    max_number_of_iterations(200), eb_num_initial_colors(1),
+    max_number_of_iterations(200), eb_num_initial_colors(1), jp_seed(0),
     overall_coloring_time(0),
     coloring_time(0),
     num_phases(0), size_of_edge_list(0), lower_triangle_src(), lower_triangle_dst(),
@@ -196,7 +202,8 @@ private:
 
 
   /** \brief Changes the graph coloring algorithm.
-   *  \param col_algo: Coloring algorithm: one of COLORING_VB, COLORING_VBBIT, COLORING_VBCS, COLORING_EB
+   *  \param col_algo: Coloring algorithm: one of COLORING_VB, COLORING_VBBIT, COLORING_VBCS, COLORING_EB,
+   *        COLORING_JP, COLORING_JP_LDF, COLORING_JP_SL
    *  \param set_default_parameters: whether or not to reset the default parameters for the given algorithm.
    */
   void set_algorithm(const ColoringAlgorithm &col_algo, bool set_default_parameters = true){
@@ -598,6 +605,10 @@ private:
     case COLORING_SPGEMM:
     case COLORING_D2_MATRIX_SQUARED:
     case COLORING_D2:
+    case COLORING_D2_VB_BIT:
+    case COLORING_JP:
+    case COLORING_JP_LDF:
+    case COLORING_JP_SL:
       this->conflict_list_type = COLORING_ATOMIC;
       this->min_reduction_for_conflictlist = 0.35;
       this->min_elements_for_conflictlist = 1000;
@@ -640,6 +651,7 @@ private:
   int get_vb_chunk_size() const{return this->vb_chunk_size;}
   int get_max_number_of_iterations() const{return this->max_number_of_iterations;}
   int get_eb_num_initial_colors() const{return this->eb_num_initial_colors;}
+  unsigned int get_jp_seed() const{return this->jp_seed;}
 
   double get_overall_coloring_time() const { return this->overall_coloring_time;}
   double get_coloring_time() const { return this->coloring_time;}
@@ -657,6 +669,7 @@ private:
   void set_vb_chunk_size(const int &chunksize){this->vb_chunk_size = chunksize;}
   void set_max_number_of_iterations(const int &max_phases){this->max_number_of_iterations = max_phases;}
   void set_eb_num_initial_colors(const int &num_initial_colors){this->eb_num_initial_colors = num_initial_colors;}
+  void set_jp_seed(const unsigned int &seed){this->jp_seed = seed;}
   void add_to_overall_coloring_time(const double &coloring_time_){this->overall_coloring_time += coloring_time_;}
   void set_coloring_time(const double &coloring_time_){this->coloring_time = coloring_time_;}
   void set_num_phases(const double &num_phases_){this->num_phases = num_phases_;}
@@ -98,6 +98,13 @@ void graph_color_symbolic(
     gc = new VBGraphColoring(num_rows, entries.extent(0), row_map, entries, gch);
     break;
 
+  case COLORING_JP:
+  case COLORING_JP_LDF:
+  case COLORING_JP_SL:
+    typedef typename Impl::GraphColor_JP <typename KernelHandle::GraphColoringHandleType, lno_row_view_t_, lno_nnz_view_t_> JPGraphColoring;
+    gc = new JPGraphColoring(num_rows, entries.extent(0), row_map, entries, gch);
+    break;
+
   case COLORING_EB:
     typedef typename Impl::GraphColor_EB <typename KernelHandle::GraphColoringHandleType, lno_row_view_t_, lno_nnz_view_t_> EBGraphColoring;
     gc = new EBGraphColoring(num_rows, entries.extent(0),row_map, entries, gch);
@@ -159,6 +166,57 @@ void graph_color(
 
 
 
+/** \brief Repairs a distance-1 coloring after the adjacencies of a set of vertices
+ * have changed. The changed vertices and their neighbors are uncolored, and only this
+ * frontier is recolored with the speculative vertex-based coloring and its conflict
+ * resolution. The colors of the other vertices are kept, so the result is a valid
+ * coloring if the previous colors were a valid coloring of the graph outside of the frontier.
+ *
+ * The colors are updated in place and are also stored in the coloring handle.
+ *
+ * \param handle: the kernel handle with a graph coloring handle.
+ * \param num_rows: number of vertices in the graph.
+ * \param num_cols: number of columns in the graph.
+ * \param row_map: the row map of the changed graph.
+ * \param entries: the adjacencies of the changed graph.
+ * \param colors: on input the previous colors, e.g. get_vertex_colors() after graph_color.
+ *   On output the repaired colors. Size is num_rows.
+ * \param changed_vertices: the list of vertices whose adjacencies have changed.
+ */
+template <class KernelHandle,typename lno_row_view_t_, typename lno_nnz_view_t_, typename changed_view_t_>
+void graph_color_incremental(
+    KernelHandle *handle,
+    typename KernelHandle::nnz_lno_t num_rows,
+    typename KernelHandle::nnz_lno_t num_cols,
+    lno_row_view_t_ row_map,
+    lno_nnz_view_t_ entries,
+    typename KernelHandle::GraphColoringHandleType::color_view_t colors,
+    changed_view_t_ changed_vertices)
+{
+  Kokkos::Impl::Timer timer;
+
+  typename KernelHandle::GraphColoringHandleType *gch = handle->get_graph_coloring_handle();
+
+  if (typename KernelHandle::nnz_lno_t(colors.extent(0)) != num_rows){
+    Kokkos::Impl::throw_runtime_exception("graph_color_incremental: the size of the previous colors differs from the number of vertices.");
+  }
+
+  typedef typename Impl::GraphColor_VB <typename KernelHandle::GraphColoringHandleType, lno_row_view_t_, lno_nnz_view_t_> VBGraphColoring;
+  VBGraphColoring gc(num_rows, entries.extent(0), row_map, entries, gch);
+
+  int num_phases = 0;
+  typename KernelHandle::nnz_lno_t num_recolored = 0;
+  gc.recolor_graph(colors, changed_vertices, changed_vertices.extent(0), num_phases, num_recolored);
+
+  double coloring_time = timer.seconds();
+  gch->add_to_overall_coloring_time(coloring_time);
+  gch->set_coloring_time(coloring_time);
+  gch->set_num_phases(num_phases);
+  gch->set_vertex_colors(colors);
+}
+
+
+
 // initial distance 2 graph coloring -- serial only (work in progress) - wcmclen
 template <class KernelHandle,
           typename lno_row_view_t_, typename lno_nnz_view_t_,
@@ -92,6 +92,7 @@ void graph_color_d2(KernelHandle *handle,
     }
 
     case COLORING_D2:
+    case COLORING_D2_VB_BIT:
     {
       Impl::GraphColorD2 <KernelHandle, lno_row_view_t_,lno_nnz_view_t_, lno_col_view_t_, lno_colnnz_view_t_>
           gc(num_rows, num_cols, row_entries.extent(0), row_map, row_entries, col_map, col_entries, handle);
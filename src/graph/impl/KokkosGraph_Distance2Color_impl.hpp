@@ -50,6 +50,7 @@
 #include <Kokkos_MemoryTraits.hpp>
 
 #include "KokkosKernels_Handle.hpp"
+#include "KokkosKernels_BitUtils.hpp"
 #include "KokkosGraph_GraphColorHandle.hpp"
 #include "KokkosGraph_graph_color.hpp"
 
@@ -65,7 +66,7 @@ namespace Impl {
 
 #define VB_D2_COLORING_FORBIDDEN_SIZE 64
 // #define VB_D2_COLORING_FORBIDDEN_SIZE 20000
-// #define VBBIT_COLORING_FORBIDDEN_SIZE 64
+#define VBBIT_D2_COLORING_FORBIDDEN_SIZE 64
 
 
 
@@ -271,7 +272,7 @@ private:
   int  _max_num_iterations;
   char _conflictList;              // 0: none, 1: atomic (default), 2: parallel prefix sums (0, 2 not implemented)
   bool _serialConflictResolution;  // true if using serial conflict resolution, false otherwise (default)
-  char _use_color_set;             // The VB Algorithm Type: 0: VB,  1: VBCS,  2: VBBIT  (1, 2 not implemented).
+  char _use_color_set;             // The VB Algorithm Type: 0: VB,  1: VBCS,  2: VBBIT  (1 not implemented).
   bool _ticToc;                    // if true print info in each step
 
 public:
@@ -309,6 +310,10 @@ public:
         _use_color_set(0),
         _ticToc(handle->get_verbose())
   {
+    if(handle->get_graph_coloring_handle()->get_coloring_algo_type() == COLORING_D2_VB_BIT)
+    {
+      this->_use_color_set = 2;
+    }
     //std::cout << ">>> WCMCLEN GraphColorD2() (KokkosGraph_Distance2Color_impl.hpp)" << std::endl
     //          << ">>> WCMCLEN :    coloring_algo_type = " << handle->get_coloring_algo_type() << std::endl
     //          << ">>> WCMCLEN :    conflict_list_type = " << handle->get_conflict_list_type() << std::endl;
@@ -502,18 +507,36 @@ private:
       chunkSize_ = 1;
     }
 
-    functorGreedyColor gc(this->nv,
-                          xadj_,
-                          adj_,
-                          t_xadj_,
-                          t_adj_,
-                          vertex_colors_,
-                          current_vertexList_,
-                          current_vertexListLength_,
-                          chunkSize_
-                          );
-
-    Kokkos::parallel_for(my_exec_space(0, current_vertexListLength_ / chunkSize_ + 1), gc);
+    if(2 == this->_use_color_set)
+    {
+      functorGreedyColor_bit gc(this->nv,
+                                xadj_,
+                                adj_,
+                                t_xadj_,
+                                t_adj_,
+                                vertex_colors_,
+                                current_vertexList_,
+                                current_vertexListLength_,
+                                chunkSize_
+                                );
+
+      Kokkos::parallel_for(my_exec_space(0, current_vertexListLength_ / chunkSize_ + 1), gc);
+    }
+    else
+    {
+      functorGreedyColor gc(this->nv,
+                            xadj_,
+                            adj_,
+                            t_xadj_,
+                            t_adj_,
+                            vertex_colors_,
+                            current_vertexList_,
+                            current_vertexListLength_,
+                            chunkSize_
+                            );
+
+      Kokkos::parallel_for(my_exec_space(0, current_vertexListLength_ / chunkSize_ + 1), gc);
+    }
 
   }  // colorGreedy (end)
 
@@ -562,7 +585,7 @@ private:
     // conflictList mode: ATOMIC
     else if(1 == this->_conflictList)
     {
-      if(0 == this->_use_color_set)
+      if(0 == this->_use_color_set || 2 == this->_use_color_set)
       {
         functorFindConflicts_Atomic<adj_view_t> conf(this->nv,
                                                      xadj_,
@@ -855,6 +878,114 @@ private:
 
 
 
+  /**
+   * Functor for VBBIT algorithm speculative coloring.
+   * The forbidden colors of a window of VBBIT_D2_COLORING_FORBIDDEN_SIZE colors are kept
+   * in the bits of a single integer, so that the first available color is found with a
+   * least_set_bit instead of a scan over a forbidden array.
+   */
+  struct functorGreedyColor_bit
+  {
+    typedef unsigned long long forbidden_bits_t;
+
+    nnz_lno_t                nv;                  // num vertices
+    const_lno_row_view_t     _idx;                // vertex degree list
+    const_lno_nnz_view_t     _adj;                // vertex adjacency list
+    const_clno_row_view_t    _t_idx;              // transpose vertex degree list
+    const_clno_nnz_view_t    _t_adj;              // transpose vertex adjacency list
+    color_view_type          _colors;             // vertex colors
+    nnz_lno_temp_work_view_t _vertexList;         //
+    nnz_lno_t                _vertexListLength;   //
+    nnz_lno_t                _chunkSize;          //
+
+    functorGreedyColor_bit(nnz_lno_t                nv_,
+                           const_lno_row_view_t     xadj_,
+                           const_lno_nnz_view_t     adj_,
+                           const_clno_row_view_t    t_xadj_,
+                           const_clno_nnz_view_t    t_adj_,
+                           color_view_type          colors,
+                           nnz_lno_temp_work_view_t vertexList,
+                           nnz_lno_t                vertexListLength,
+                           nnz_lno_t                chunkSize)
+          : nv(nv_),
+            _idx(xadj_),
+            _adj(adj_),
+            _t_idx(t_xadj_),
+            _t_adj(t_adj_),
+            _colors(colors),
+            _vertexList(vertexList),
+            _vertexListLength(vertexListLength),
+            _chunkSize(chunkSize)
+    {
+    }
+
+
+    // Color vertex i with smallest available color.
+    //
+    // Colors offset+1 ... offset+VBBIT_D2_COLORING_FORBIDDEN_SIZE are mapped to the bits
+    // 0 ... VBBIT_D2_COLORING_FORBIDDEN_SIZE-1 of the forbidden mask.  The window is moved
+    // only if all the colors in the current window are used by the distance-2 neighbors.
+    //
+    // param: vid_ = chunk id
+    //
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t vid_) const
+    {
+      nnz_lno_t vid = 0;
+      for (nnz_lno_t ichunk=0; ichunk < _chunkSize; ichunk++)
+      {
+        if (vid_ * _chunkSize + ichunk < _vertexListLength)
+          vid = _vertexList(vid_ * _chunkSize + ichunk);
+        else
+          continue;
+
+        // Already colored this vertex.
+        if(_colors(vid) > 0) { continue; }
+
+        for(color_t offset = 0; ; offset += VBBIT_D2_COLORING_FORBIDDEN_SIZE)
+        {
+          forbidden_bits_t forbidden = 0;
+
+          // Check neighbors, fill forbidden mask.
+          for(size_type vid_1adj=_idx(vid); vid_1adj < _idx(vid+1) && ~forbidden; vid_1adj++)
+          {
+            nnz_lno_t vid_1idx = _adj(vid_1adj);
+
+            for(size_type vid_2adj=_t_idx(vid_1idx); vid_2adj < _t_idx(vid_1idx+1); vid_2adj++)
+            {
+              nnz_lno_t vid_2idx = _t_adj(vid_2adj);
+
+              // Skip distance-2-self-loops
+              if(vid_2idx == vid || vid_2idx >= nv)
+              {
+                continue;
+              }
+
+              color_t c = _colors(vid_2idx);
+
+              if(c > offset && c - offset <= VBBIT_D2_COLORING_FORBIDDEN_SIZE)
+              {
+                forbidden |= forbidden_bits_t(1) << (c - offset - 1);
+
+                // the window is full, no need to check the rest of the neighbors.
+                if(0 == ~forbidden) break;
+              }
+            }
+          }
+
+          if(~forbidden)
+          {
+            // least_set_bit is 1-based, which matches the colors starting at offset+1.
+            _colors(vid) = offset + KokkosKernels::Impl::least_set_bit(~forbidden);
+            break;
+          }
+        }   // for offset...
+      }   // for ichunk...
+    }   // operator() (end)
+  };  // struct functorGreedyColor_bit (end)
+
+
+
   template <typename adj_view_t>
   struct functorFindConflicts_Atomic
   {
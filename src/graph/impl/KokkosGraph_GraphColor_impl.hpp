@@ -868,6 +868,85 @@ public:
 
 //    std::cout << ">>> WCMCLEN GraphColor_VB::color_graph (KokkosGraph_GraphColor_impl.hpp)" << std::endl;
 
+    //the conflictlist
+    nnz_lno_temp_work_view_t current_vertexList =
+        nnz_lno_temp_work_view_t(Kokkos::ViewAllocateWithoutInitializing("vertexList"), this->nv);
+
+    //init vertexList sequentially.
+    Kokkos::parallel_for("KokkosGraph::GraphColoring::InitList",
+        my_exec_space(0, this->nv), functorInitList<nnz_lno_temp_work_view_t> (current_vertexList));
+
+    this->color_vertex_list(colors, current_vertexList, this->nv, num_loops);
+  }    // color_graph (end)
+
+  /** \brief Function to repair a coloring after a local change in the graph.
+   * Only the changed vertices and their neighbors are uncolored and recolored,
+   * the colors of all the other vertices are kept.
+   * \param colors: on input, a valid coloring of the graph before the change.
+   *   On output, a valid coloring of the current graph. Size is this->nv.
+   * \param changed_vertices: the vertices whose adjacencies have changed.
+   * \param num_changed_vertices: the size of changed_vertices.
+   * \param num_loops: The number of iterations (phases) that algorithm takes to converge.
+   * \param num_recolored: The number of vertices in the recolored frontier.
+   */
+  template <typename changed_view_t>
+  void recolor_graph(
+      color_view_type colors,
+      changed_view_t changed_vertices,
+      nnz_lno_t num_changed_vertices,
+      int &num_loops,
+      nnz_lno_t &num_recolored){
+
+    //the frontier is small and the fixed colors are in the final form,
+    //so VBCS falls back to VB, a conflictlist is always used so that the
+    //conflict detection does not sweep all the vertices, and edge filtering
+    //is skipped as it requires a copy of the whole adjacency array.
+    if (this->_use_color_set == 1) this->_use_color_set = 0;
+    if (this->_conflictlist == 0) this->_conflictlist = 1;
+    this->_edge_filtering = false;
+
+    nnz_lno_temp_work_view_t frontier_marks("frontierMarks", this->nv);
+    Kokkos::parallel_for("KokkosGraph::GraphColoring::MarkFrontier",
+        my_exec_space(0, num_changed_vertices),
+        functorMarkFrontier<changed_view_t>(this->nv, this->xadj, this->adj, changed_vertices, frontier_marks));
+
+    nnz_lno_temp_work_view_t current_vertexList =
+        nnz_lno_temp_work_view_t(Kokkos::ViewAllocateWithoutInitializing("vertexList"), this->nv);
+    single_dim_index_view_type current_vertexListLength("vertexListLength");
+
+    num_recolored = 0;
+    Kokkos::parallel_reduce("KokkosGraph::GraphColoring::UncolorFrontier",
+        my_exec_space(0, this->nv),
+        functorUncolorFrontier(colors, frontier_marks, current_vertexList, current_vertexListLength),
+        num_recolored);
+    MyExecSpace::fence();
+
+    if (this->_ticToc){
+      std::cout << "\tincremental recoloring frontier size:" << num_recolored << std::endl;
+    }
+
+    num_loops = 0;
+    if (num_recolored > 0){
+      this->color_vertex_list(colors, current_vertexList, num_recolored, num_loops);
+    }
+  }    // recolor_graph (end)
+
+protected:
+  /** \brief Colors the uncolored vertices in the given worklist with the speculative
+   *  greedy coloring and conflict resolution iterations.
+   * \param colors: the colors of the vertices. Size is this->nv. Vertices with positive
+   *   colors are not recolored.
+   * \param current_vertexList: the initial worklist. Its size must be this->nv, as it is
+   *   swapped with the conflictlists.
+   * \param current_vertexListLength: the number of vertices in the initial worklist.
+   * \param num_loops: The number of iterations (phases) that algorithm takes to converge.
+   */
+  void color_vertex_list(
+      color_view_type colors,
+      nnz_lno_temp_work_view_t current_vertexList,
+      nnz_lno_t current_vertexListLength,
+      int &num_loops){
+
     if (this->_ticToc) {
       std::cout
           << "\tVB params:" << std::endl
@@ -900,15 +979,6 @@ public:
       vertex_color_set = nnz_lno_temp_work_view_t("colorset", this->nv);
     }
 
-    //the conflictlist
-    nnz_lno_temp_work_view_t current_vertexList =
-        nnz_lno_temp_work_view_t(Kokkos::ViewAllocateWithoutInitializing("vertexList"), this->nv);
-
-    //init vertexList sequentially.
-    Kokkos::parallel_for("KokkosGraph::GraphColoring::InitList",
-        my_exec_space(0, this->nv), functorInitList<nnz_lno_temp_work_view_t> (current_vertexList));
-
-
     // the next iteration's conflict list
     nnz_lno_temp_work_view_t next_iteration_recolorList;
     // the size of the current conflictlist
@@ -929,8 +999,7 @@ public:
       }
     }
 
-    nnz_lno_t numUncolored = this->nv;
-    nnz_lno_t current_vertexListLength = this->nv;
+    nnz_lno_t numUncolored = current_vertexListLength;
 
 
     double t, total=0.0;
@@ -1051,7 +1120,7 @@ public:
     	}
     }
     num_loops = iter;
-  }    // color_graph (end)
+  }    // color_vertex_list (end)
 
 
 private:
@@ -2270,6 +2339,66 @@ public:
   };      // functorFindConflicts_Atomic_IMP (end)
 
   //Helper Functors
+  /**
+   * Functor to mark the changed vertices and their neighbors for recoloring.
+   */
+  template <typename changed_view_t>
+  struct functorMarkFrontier{
+    nnz_lno_t nv;
+    const_lno_row_view_t _idx;
+    const_lno_nnz_view_t _adj;
+    changed_view_t _changed;
+    nnz_lno_temp_work_view_t _marks;
+
+    functorMarkFrontier(
+        nnz_lno_t nv_,
+        const_lno_row_view_t xadj_,
+        const_lno_nnz_view_t adj_,
+        changed_view_t changed,
+        nnz_lno_temp_work_view_t marks):
+          nv(nv_), _idx(xadj_), _adj(adj_), _changed(changed), _marks(marks){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t ii) const {
+      const nnz_lno_t i = _changed(ii);
+      if (i < 0 || i >= nv) return;
+      //concurrent writes store the same value.
+      _marks(i) = 1;
+      for (size_type j = _idx(i); j < _idx(i+1); j++){
+        const nnz_lno_t neighbor = _adj(j);
+        if (neighbor < nv) _marks(neighbor) = 1;
+      }
+    }
+  };
+
+  /**
+   * Functor to uncolor the marked vertices and to add them to the worklist atomically.
+   */
+  struct functorUncolorFrontier{
+    color_view_type _colors;
+    nnz_lno_temp_work_view_t _marks;
+    nnz_lno_temp_work_view_t _vertexList;
+    single_dim_index_view_type _vertexListLength;
+
+    functorUncolorFrontier(
+        color_view_type colors,
+        nnz_lno_temp_work_view_t marks,
+        nnz_lno_temp_work_view_t vertexList,
+        single_dim_index_view_type vertexListLength):
+          _colors(colors), _marks(marks),
+          _vertexList(vertexList), _vertexListLength(vertexListLength){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i, nnz_lno_t &numMarked) const {
+      typedef typename std::remove_reference< decltype( _vertexListLength() ) >::type atomic_incr_type;
+      if (_marks(i) == 0) return;
+      _colors(i) = 0;
+      const nnz_lno_t k = Kokkos::atomic_fetch_add( &_vertexListLength(), atomic_incr_type(1));
+      _vertexList(k) = i;
+      numMarked += 1;
+    }
+  };
+
   /**
    * Functor to init a list sequentialy, that is list[i] = i
    */
@@ -2379,6 +2508,431 @@ public:
 };  // class GraphColor_VB
 
 
+/*! \brief Class for deterministic parallel graph coloring using Kokkos.
+ *  Performs the Jones-Plassmann algorithm: in each round, every uncolored vertex
+ *  with a higher priority than all of its uncolored neighbors is colored with the
+ *  smallest color not used by its neighbors. The vertices colored in a round form
+ *  an independent set, so the coloring depends only on the priorities and is the
+ *  same for any number of threads.
+ *  JP: random priorities, a hash of the vertex id with the seed of the handle.
+ *  JP_LDF: largest-degree-first, ties are broken by the hash.
+ *  JP_SL: smallest-last, the vertices are peeled in rounds of small remaining degree
+ *  and the vertices peeled later have higher priority. Ties are broken by the hash.
+ */
+template <typename HandleType, typename lno_row_view_t_, typename lno_nnz_view_t_>
+class GraphColor_JP:public GraphColor <HandleType,lno_row_view_t_,lno_nnz_view_t_>{
+public:
+
+  typedef lno_row_view_t_ in_lno_row_view_t;
+  typedef lno_nnz_view_t_ in_lno_nnz_view_t;
+  typedef typename HandleType::color_view_t color_view_type;
+
+  typedef typename HandleType::size_type size_type;
+  typedef typename lno_row_view_t_::device_type row_lno_view_device_t;
+
+  typedef typename HandleType::nnz_lno_t nnz_lno_t;
+  typedef typename HandleType::color_t color_t;
+
+  typedef typename HandleType::HandleExecSpace MyExecSpace;
+  typedef typename HandleType::HandleTempMemorySpace MyTempMemorySpace;
+  typedef typename HandleType::HandlePersistentMemorySpace MyPersistentMemorySpace;
+
+  typedef typename Kokkos::View<nnz_lno_t, row_lno_view_device_t> single_dim_index_view_type;
+  typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
+
+  typedef typename HandleType::nnz_lno_temp_work_view_t nnz_lno_temp_work_view_t;
+
+  typedef typename in_lno_row_view_t::const_type const_lno_row_view_t;
+  typedef typename lno_nnz_view_t_::const_type const_lno_nnz_view_t;
+
+protected:
+  bool _ticToc; //if true print info in each step
+  ColoringAlgorithm _priority_type; //COLORING_JP, COLORING_JP_LDF or COLORING_JP_SL
+  unsigned long long _seed; //the seed of the vertex hash.
+
+public:
+  /**
+   * \brief GraphColor_JP constructor.
+   * \param nv_: number of vertices in the graph
+   * \param ne_: number of edges in the graph
+   * \param row_map: the xadj array of the graph. Its size is nv_ +1
+   * \param entries: adjacency array of the graph. Its size is ne_
+   * \param coloring_handle: GraphColoringHandle object that holds the specification about the graph coloring,
+   *    including parameters.
+   */
+  GraphColor_JP(
+      nnz_lno_t nv_, size_type ne_,
+      const_lno_row_view_t row_map, const_lno_nnz_view_t entries,
+      HandleType *coloring_handle):
+    GraphColor<HandleType,lno_row_view_t_,lno_nnz_view_t_>(nv_, ne_, row_map, entries, coloring_handle),
+    _ticToc(coloring_handle->get_tictoc()),
+    _priority_type(coloring_handle->get_coloring_algo_type()),
+    _seed(coloring_handle->get_jp_seed())
+    {}
+
+  /** \brief GraphColor_JP destructor.
+    */
+  virtual ~GraphColor_JP(){}
+
+  /** \brief Function to color the vertices of the graphs with Jones-Plassmann rounds.
+   * \param colors is the output array corresponding the color of each vertex.Size is this->nv.
+   *   Any positive value in the given array, will make the
+   *   algorithm to assume that the color is fixed for the corresponding vertex.
+   * \param num_phases: The number of rounds that algorithm takes to color all vertices.
+   */
+  virtual void color_graph(color_view_type colors, int &num_loops){
+
+    Kokkos::Impl::Timer timer;
+
+    //the primary priority of each vertex, the hash breaks the ties.
+    nnz_lno_temp_work_view_t priorities("JP priorities", this->nv);
+    if (this->_priority_type == COLORING_JP_LDF){
+      Kokkos::parallel_for("KokkosGraph::GraphColoring::JP::DegreePriority",
+          my_exec_space(0, this->nv), functorDegree(this->nv, this->xadj, this->adj, priorities));
+    }
+    else if (this->_priority_type == COLORING_JP_SL){
+      this->smallest_last_priorities(priorities);
+    }
+    MyExecSpace::fence();
+
+    if (this->_ticToc){
+      std::cout << "\tTime JP priorities : " << timer.seconds() << std::endl;
+      timer.reset();
+    }
+
+    nnz_lno_temp_work_view_t current_vertexList =
+        nnz_lno_temp_work_view_t(Kokkos::ViewAllocateWithoutInitializing("vertexList"), this->nv);
+    nnz_lno_temp_work_view_t next_vertexList =
+        nnz_lno_temp_work_view_t(Kokkos::ViewAllocateWithoutInitializing("nextVertexList"), this->nv);
+    nnz_lno_temp_work_view_t selected("JP selected", this->nv);
+
+    //only the uncolored vertices are put in the worklist.
+    single_dim_index_view_type current_vertexListLength_view("vertexListLength");
+    nnz_lno_t current_vertexListLength = 0;
+    Kokkos::parallel_reduce("KokkosGraph::GraphColoring::JP::InitList",
+        my_exec_space(0, this->nv),
+        functorInitUncoloredList(colors, current_vertexList, current_vertexListLength_view),
+        current_vertexListLength);
+
+    int iter = 0;
+    for (; current_vertexListLength > 0; ++iter){
+      Kokkos::parallel_for("KokkosGraph::GraphColoring::JP::Select",
+          my_exec_space(0, current_vertexListLength),
+          functorSelect(this->nv, this->xadj, this->adj, colors, priorities, this->_seed,
+              current_vertexList, selected));
+
+      single_dim_index_view_type next_vertexListLength_view("nextVertexListLength");
+      nnz_lno_t next_vertexListLength = 0;
+      Kokkos::parallel_reduce("KokkosGraph::GraphColoring::JP::Color",
+          my_exec_space(0, current_vertexListLength),
+          functorColorSelected(this->nv, this->xadj, this->adj, colors,
+              current_vertexList, selected, next_vertexList, next_vertexListLength_view),
+          next_vertexListLength);
+      MyExecSpace::fence();
+
+      if (this->_ticToc){
+        std::cout << "\tJP round " << iter << " colored:" << current_vertexListLength - next_vertexListLength
+                  << " time:" << timer.seconds() << std::endl;
+        timer.reset();
+      }
+
+      nnz_lno_temp_work_view_t temp = current_vertexList;
+      current_vertexList = next_vertexList;
+      next_vertexList = temp;
+      current_vertexListLength = next_vertexListLength;
+    }
+    num_loops = iter;
+  }
+
+private:
+
+  /** \brief Computes the smallest-last priorities. In each round, all the remaining vertices
+   *  whose remaining degree is at most twice the minimum remaining degree are removed,
+   *  and the vertices removed in later rounds get higher priorities.
+   *  \param priorities: output, the round in which each vertex is removed, starting from 1.
+   */
+  void smallest_last_priorities(nnz_lno_temp_work_view_t priorities){
+    nnz_lno_temp_work_view_t degrees(Kokkos::ViewAllocateWithoutInitializing("SL degrees"), this->nv);
+    Kokkos::parallel_for("KokkosGraph::GraphColoring::JP::SLDegree",
+        my_exec_space(0, this->nv), functorDegree(this->nv, this->xadj, this->adj, degrees));
+
+    nnz_lno_t num_remaining = this->nv;
+    for (nnz_lno_t round = 1; num_remaining > 0; ++round){
+      nnz_lno_t min_degree = 0;
+      Kokkos::parallel_reduce("KokkosGraph::GraphColoring::JP::SLMinDegree",
+          my_exec_space(0, this->nv), functorMinRemainingDegree(priorities, degrees),
+          Kokkos::Min<nnz_lno_t>(min_degree));
+
+      nnz_lno_t num_removed = 0;
+      Kokkos::parallel_reduce("KokkosGraph::GraphColoring::JP::SLRemove",
+          my_exec_space(0, this->nv), functorRemoveSmallDegree(priorities, degrees, 2 * min_degree, round),
+          num_removed);
+
+      Kokkos::parallel_for("KokkosGraph::GraphColoring::JP::SLUpdateDegree",
+          my_exec_space(0, this->nv),
+          functorUpdateDegree(this->nv, this->xadj, this->adj, priorities, degrees, round));
+      num_remaining -= num_removed;
+    }
+  }
+
+public:
+
+  /**
+   * Hash of a vertex id used as random priority. Independent of the thread count.
+   */
+  KOKKOS_INLINE_FUNCTION
+  static unsigned long long vertex_hash(const nnz_lno_t i, const unsigned long long seed){
+    //splitmix64 finalizer.
+    unsigned long long x = (unsigned long long) (i) + (seed + 1) * 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+  }
+
+  /**
+   * Functor to compute the degree of the vertices, skipping self-loops.
+   */
+  struct functorDegree{
+    nnz_lno_t nv;
+    const_lno_row_view_t _idx;
+    const_lno_nnz_view_t _adj;
+    nnz_lno_temp_work_view_t _degrees;
+
+    functorDegree(
+        nnz_lno_t nv_,
+        const_lno_row_view_t xadj_,
+        const_lno_nnz_view_t adj_,
+        nnz_lno_temp_work_view_t degrees):
+          nv(nv_), _idx(xadj_), _adj(adj_), _degrees(degrees){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i) const {
+      nnz_lno_t degree = 0;
+      for (size_type j = _idx(i); j < _idx(i+1); j++){
+        const nnz_lno_t n = _adj(j);
+        if (n != i && n < nv) ++degree;
+      }
+      _degrees(i) = degree;
+    }
+  };
+
+  /**
+   * Functor to find the minimum degree of the vertices that are not removed yet.
+   */
+  struct functorMinRemainingDegree{
+    nnz_lno_temp_work_view_t _priorities;
+    nnz_lno_temp_work_view_t _degrees;
+
+    functorMinRemainingDegree(
+        nnz_lno_temp_work_view_t priorities,
+        nnz_lno_temp_work_view_t degrees):
+          _priorities(priorities), _degrees(degrees){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i, nnz_lno_t &min_degree) const {
+      if (_priorities(i) == 0 && _degrees(i) < min_degree) min_degree = _degrees(i);
+    }
+  };
+
+  /**
+   * Functor to remove the vertices with small remaining degree in the given round.
+   */
+  struct functorRemoveSmallDegree{
+    nnz_lno_temp_work_view_t _priorities;
+    nnz_lno_temp_work_view_t _degrees;
+    nnz_lno_t _max_degree;
+    nnz_lno_t _round;
+
+    functorRemoveSmallDegree(
+        nnz_lno_temp_work_view_t priorities,
+        nnz_lno_temp_work_view_t degrees,
+        nnz_lno_t max_degree,
+        nnz_lno_t round):
+          _priorities(priorities), _degrees(degrees), _max_degree(max_degree), _round(round){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i, nnz_lno_t &num_removed) const {
+      if (_priorities(i) == 0 && _degrees(i) <= _max_degree){
+        _priorities(i) = _round;
+        num_removed += 1;
+      }
+    }
+  };
+
+  /**
+   * Functor to decrement the remaining degrees of the neighbors of the vertices removed in the given round.
+   */
+  struct functorUpdateDegree{
+    nnz_lno_t nv;
+    const_lno_row_view_t _idx;
+    const_lno_nnz_view_t _adj;
+    nnz_lno_temp_work_view_t _priorities;
+    nnz_lno_temp_work_view_t _degrees;
+    nnz_lno_t _round;
+
+    functorUpdateDegree(
+        nnz_lno_t nv_,
+        const_lno_row_view_t xadj_,
+        const_lno_nnz_view_t adj_,
+        nnz_lno_temp_work_view_t priorities,
+        nnz_lno_temp_work_view_t degrees,
+        nnz_lno_t round):
+          nv(nv_), _idx(xadj_), _adj(adj_), _priorities(priorities), _degrees(degrees), _round(round){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i) const {
+      if (_priorities(i) != _round) return;
+      for (size_type j = _idx(i); j < _idx(i+1); j++){
+        const nnz_lno_t n = _adj(j);
+        if (n != i && n < nv && _priorities(n) == 0){
+          Kokkos::atomic_fetch_add(&_degrees(n), nnz_lno_t(-1));
+        }
+      }
+    }
+  };
+
+  /**
+   * Functor to put the uncolored vertices into the worklist.
+   */
+  struct functorInitUncoloredList{
+    color_view_type _colors;
+    nnz_lno_temp_work_view_t _vertexList;
+    single_dim_index_view_type _vertexListLength;
+
+    functorInitUncoloredList(
+        color_view_type colors,
+        nnz_lno_temp_work_view_t vertexList,
+        single_dim_index_view_type vertexListLength):
+          _colors(colors), _vertexList(vertexList), _vertexListLength(vertexListLength){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t i, nnz_lno_t &numUncolored) const {
+      typedef typename std::remove_reference< decltype( _vertexListLength() ) >::type atomic_incr_type;
+      if (_colors(i) > 0) return;
+      const nnz_lno_t k = Kokkos::atomic_fetch_add( &_vertexListLength(), atomic_incr_type(1));
+      _vertexList(k) = i;
+      numUncolored += 1;
+    }
+  };
+
+  /**
+   * Functor to select the uncolored vertices whose priority is higher than the priorities
+   * of all of their uncolored neighbors. Colors are only read.
+   */
+  struct functorSelect{
+    nnz_lno_t nv;
+    const_lno_row_view_t _idx;
+    const_lno_nnz_view_t _adj;
+    color_view_type _colors;
+    nnz_lno_temp_work_view_t _priorities;
+    unsigned long long _seed;
+    nnz_lno_temp_work_view_t _vertexList;
+    nnz_lno_temp_work_view_t _selected;
+
+    functorSelect(
+        nnz_lno_t nv_,
+        const_lno_row_view_t xadj_,
+        const_lno_nnz_view_t adj_,
+        color_view_type colors,
+        nnz_lno_temp_work_view_t priorities,
+        unsigned long long seed,
+        nnz_lno_temp_work_view_t vertexList,
+        nnz_lno_temp_work_view_t selected):
+          nv(nv_), _idx(xadj_), _adj(adj_), _colors(colors), _priorities(priorities), _seed(seed),
+          _vertexList(vertexList), _selected(selected){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t ii) const {
+      const nnz_lno_t i = _vertexList(ii);
+      const nnz_lno_t my_priority = _priorities(i);
+      const unsigned long long my_hash = vertex_hash(i, _seed);
+
+      nnz_lno_t is_selected = 1;
+      for (size_type j = _idx(i); j < _idx(i+1); j++){
+        const nnz_lno_t n = _adj(j);
+        if (n == i || n >= nv || _colors(n) > 0) continue;
+        const nnz_lno_t n_priority = _priorities(n);
+        if (n_priority < my_priority) continue;
+        if (n_priority == my_priority){
+          const unsigned long long n_hash = vertex_hash(n, _seed);
+          if (n_hash < my_hash || (n_hash == my_hash && n < i)) continue;
+        }
+        is_selected = 0;
+        break;
+      }
+      _selected(i) = is_selected;
+    }
+  };
+
+  /**
+   * Functor to color the selected vertices with the smallest available color,
+   * and to put the others into the next worklist.
+   */
+  struct functorColorSelected{
+    nnz_lno_t nv;
+    const_lno_row_view_t _idx;
+    const_lno_nnz_view_t _adj;
+    color_view_type _colors;
+    nnz_lno_temp_work_view_t _vertexList;
+    nnz_lno_temp_work_view_t _selected;
+    nnz_lno_temp_work_view_t _nextVertexList;
+    single_dim_index_view_type _nextVertexListLength;
+
+    functorColorSelected(
+        nnz_lno_t nv_,
+        const_lno_row_view_t xadj_,
+        const_lno_nnz_view_t adj_,
+        color_view_type colors,
+        nnz_lno_temp_work_view_t vertexList,
+        nnz_lno_temp_work_view_t selected,
+        nnz_lno_temp_work_view_t nextVertexList,
+        single_dim_index_view_type nextVertexListLength):
+          nv(nv_), _idx(xadj_), _adj(adj_), _colors(colors),
+          _vertexList(vertexList), _selected(selected),
+          _nextVertexList(nextVertexList), _nextVertexListLength(nextVertexListLength){}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t ii, nnz_lno_t &numUncolored) const {
+      typedef typename std::remove_reference< decltype( _nextVertexListLength() ) >::type atomic_incr_type;
+      const nnz_lno_t i = _vertexList(ii);
+
+      if (!_selected(i)){
+        const nnz_lno_t k = Kokkos::atomic_fetch_add( &_nextVertexListLength(), atomic_incr_type(1));
+        _nextVertexList(k) = i;
+        numUncolored += 1;
+        return;
+      }
+
+      //the neighbors of a selected vertex are not selected,
+      //so their colors do not change in this round.
+      bool forbidden[VB_COLORING_FORBIDDEN_SIZE];
+      color_t degree = _idx(i+1) - _idx(i);
+      for (color_t offset = 0; offset <= degree + VB_COLORING_FORBIDDEN_SIZE; offset += VB_COLORING_FORBIDDEN_SIZE){
+        for (int j = 0; j < VB_COLORING_FORBIDDEN_SIZE; j++){
+          forbidden[j] = false;
+        }
+        if (offset == 0) forbidden[0] = true; // by convention, start at 1
+
+        for (size_type j = _idx(i); j < _idx(i+1); j++){
+          const nnz_lno_t n = _adj(j);
+          if (n == i || n >= nv) continue;
+          const color_t c = _colors(n);
+          if ((c >= offset) && (c - offset < VB_COLORING_FORBIDDEN_SIZE))
+            forbidden[c - offset] = true;
+        }
+
+        for (int c = 0; c < VB_COLORING_FORBIDDEN_SIZE; c++){
+          if (!forbidden[c]){
+            _colors(i) = offset + c;
+            return;
+          }
+        }
+      }
+    }
+  };
+};  // class GraphColor_JP
+
+
 /*! \brief Class for modular parallel graph coloring using Kokkos.
  *  Performs a edge_base coloring, with the hope of better load balance
  *  as well as better memory accesses on GPUs.
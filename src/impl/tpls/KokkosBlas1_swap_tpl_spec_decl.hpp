@@ -0,0 +1,213 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS1_SWAP_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS1_SWAP_TPL_SPEC_DECL_HPP_
+
+// Generic Host side BLAS (could be MKL or whatever)
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+extern "C" void dswap_( const int* N, double* x, const int* x_inc,
+                        double* y, const int* y_inc);
+extern "C" void sswap_( const int* N, float* x, const int* x_inc,
+                        float* y, const int* y_inc);
+extern "C" void zswap_( const int* N, std::complex<double>* x, const int* x_inc,
+                        std::complex<double>* y, const int* y_inc);
+extern "C" void cswap_( const int* N, std::complex<float>* x, const int* x_inc,
+                        std::complex<float>* y, const int* y_inc);
+
+namespace KokkosBlas {
+namespace Impl {
+
+
+namespace {
+  template<class XV, class YV>
+  inline void swap_print_specialization() {
+      #ifdef KOKKOSKERNELS_ENABLE_CHECK_SPECIALIZATION
+        printf("KokkosBlas1::swap<> TPL Blas specialization for < %s , %s >\n",typeid(XV).name(),typeid(YV).name());
+      #endif
+  }
+}
+
+#define KOKKOSBLAS1_DSWAP_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Swap< \
+Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<double*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void swap (const XV& X, const XV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if (numElems < static_cast<size_type> (INT_MAX) && \
+        X.stride(0) > 0 && Y.stride(0) > 0) { \
+      swap_print_specialization<XV,XV>(); \
+      int N = numElems; \
+      int incx = X.stride(0); \
+      int incy = Y.stride(0); \
+      dswap_(&N,X.data(),&incx,Y.data(),&incy); \
+    } else { \
+      Swap<XV,XV,1,false,ETI_SPEC_AVAIL>::swap(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_SSWAP_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Swap< \
+Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<float*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void swap (const XV& X, const XV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if (numElems < static_cast<size_type> (INT_MAX) && \
+        X.stride(0) > 0 && Y.stride(0) > 0) { \
+      swap_print_specialization<XV,XV>(); \
+      int N = numElems; \
+      int incx = X.stride(0); \
+      int incy = Y.stride(0); \
+      sswap_(&N,X.data(),&incx,Y.data(),&incy); \
+    } else { \
+      Swap<XV,XV,1,false,ETI_SPEC_AVAIL>::swap(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_ZSWAP_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Swap< \
+Kokkos::View<Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<Kokkos::complex<double>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void swap (const XV& X, const XV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if (numElems < static_cast<size_type> (INT_MAX) && \
+        X.stride(0) > 0 && Y.stride(0) > 0) { \
+      swap_print_specialization<XV,XV>(); \
+      int N = numElems; \
+      int incx = X.stride(0); \
+      int incy = Y.stride(0); \
+      zswap_(&N,reinterpret_cast<std::complex<double>*>(X.data()),&incx,reinterpret_cast<std::complex<double>*>(Y.data()),&incy); \
+    } else { \
+      Swap<XV,XV,1,false,ETI_SPEC_AVAIL>::swap(X,Y); \
+    } \
+  } \
+};
+
+#define KOKKOSBLAS1_CSWAP_TPL_SPEC_DECL_BLAS( LAYOUT, MEMSPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct Swap< \
+Kokkos::View<Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+Kokkos::View<Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+             Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+1,true, ETI_SPEC_AVAIL > { \
+  \
+  typedef Kokkos::View<Kokkos::complex<float>*, LAYOUT, Kokkos::Device<ExecSpace, MEMSPACE>, \
+                       Kokkos::MemoryTraits<Kokkos::Unmanaged> > XV; \
+  typedef typename XV::size_type size_type; \
+  \
+  static void swap (const XV& X, const XV& Y) \
+  { \
+    const size_type numElems = X.extent(0); \
+    if (numElems < static_cast<size_type> (INT_MAX) && \
+        X.stride(0) > 0 && Y.stride(0) > 0) { \
+      swap_print_specialization<XV,XV>(); \
+      int N = numElems; \
+      int incx = X.stride(0); \
+      int incy = Y.stride(0); \
+      cswap_(&N,reinterpret_cast<std::complex<float>*>(X.data()),&incx,reinterpret_cast<std::complex<float>*>(Y.data()),&incy); \
+    } else { \
+      Swap<XV,XV,1,false,ETI_SPEC_AVAIL>::swap(X,Y); \
+    } \
+  } \
+};
+
+KOKKOSBLAS1_DSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_DSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS1_DSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, true)
+KOKKOSBLAS1_DSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, false)
+
+KOKKOSBLAS1_SSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_SSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS1_SSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, true)
+KOKKOSBLAS1_SSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, false)
+
+KOKKOSBLAS1_ZSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_ZSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS1_ZSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, true)
+KOKKOSBLAS1_ZSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, false)
+
+KOKKOSBLAS1_CSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS1_CSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS1_CSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, true)
+KOKKOSBLAS1_CSWAP_TPL_SPEC_DECL_BLAS( Kokkos::LayoutStride, Kokkos::HostSpace, false)
+
+}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,300 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#ifndef KOKKOSBLAS3_TRMM_TPL_SPEC_DECL_HPP_
+#define KOKKOSBLAS3_TRMM_TPL_SPEC_DECL_HPP_
+
+#ifdef KOKKOSKERNELS_ENABLE_TPL_BLAS
+extern "C" void dtrmm_( const char* side, const char* uplo,
+                        const char* transA, const char* diag,
+                        const int* M, const int* N,
+                        const double* alpha,
+                        const double* A, const int* LDA,
+                        double* B, const int* LDB);
+extern "C" void strmm_( const char* side, const char* uplo,
+                        const char* transA, const char* diag,
+                        const int* M, const int* N,
+                        const float* alpha,
+                        const float* A, const int* LDA,
+                        float* B, const int* LDB);
+extern "C" void ztrmm_( const char* side, const char* uplo,
+                        const char* transA, const char* diag,
+                        const int* M, const int* N,
+                        const std::complex<double>* alpha,
+                        const std::complex<double>* A, const int* LDA,
+                        std::complex<double>* B, const int* LDB);
+extern "C" void ctrmm_( const char* side, const char* uplo,
+                        const char* transA, const char* diag,
+                        const int* M, const int* N,
+                        const std::complex<float>* alpha,
+                        const std::complex<float>* A, const int* LDA,
+                        std::complex<float>* B, const int* LDB);
+
+namespace KokkosBlas {
+namespace Impl {
+
+#define KOKKOSBLAS3_DTRMM_BLAS( LAYOUTA, LAYOUTB, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct TRMM< \
+     Kokkos::View<const double**, LAYOUTA, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<double**, LAYOUTB, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef double SCALAR; \
+  typedef Kokkos::View<const SCALAR**, LAYOUTA, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+  typedef Kokkos::View<SCALAR**, LAYOUTB, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > BViewType; \
+ \
+  static void \
+  trmm (const char side[], \
+        const char uplo[], \
+        const char trans[], \
+        const char diag[], \
+        typename BViewType::const_value_type& alpha, \
+        const AViewType& A, \
+        const BViewType& B) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::trmm[TPL_BLAS,double]"); \
+    const int M = B.extent(0); \
+    const int N = B.extent(1); \
+    int strides[2]; \
+    \
+    bool A_is_lr = std::is_same<Kokkos::LayoutRight,LAYOUTA>::value; \
+    bool B_is_lr = std::is_same<Kokkos::LayoutRight,LAYOUTB>::value; \
+    \
+    A.stride(strides); \
+    const int LDA = strides[A_is_lr?0:1]; \
+    B.stride(strides); \
+    const int LDB = strides[B_is_lr?0:1]; \
+    \
+    if(!A_is_lr && !B_is_lr) \
+      dtrmm_(side,uplo,trans,diag,&M,&N,&alpha,A.data(),&LDA,B.data(),&LDB); \
+    if(A_is_lr && B_is_lr) { \
+      /* Row-major B is column-major B^T: swap the side and the triangle */ \
+      const char side_r = (side[0]=='L' || side[0]=='l') ? 'R' : 'L'; \
+      const char uplo_r = (uplo[0]=='L' || uplo[0]=='l') ? 'U' : 'L'; \
+      dtrmm_(&side_r,&uplo_r,trans,diag,&N,&M,&alpha,A.data(),&LDA,B.data(),&LDB); \
+    } \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS3_STRMM_BLAS( LAYOUTA, LAYOUTB, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct TRMM< \
+     Kokkos::View<const float**, LAYOUTA, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<float**, LAYOUTB, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef float SCALAR; \
+  typedef Kokkos::View<const SCALAR**, LAYOUTA, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+  typedef Kokkos::View<SCALAR**, LAYOUTB, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > BViewType; \
+ \
+  static void \
+  trmm (const char side[], \
+        const char uplo[], \
+        const char trans[], \
+        const char diag[], \
+        typename BViewType::const_value_type& alpha, \
+        const AViewType& A, \
+        const BViewType& B) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::trmm[TPL_BLAS,float]"); \
+    const int M = B.extent(0); \
+    const int N = B.extent(1); \
+    int strides[2]; \
+    \
+    bool A_is_lr = std::is_same<Kokkos::LayoutRight,LAYOUTA>::value; \
+    bool B_is_lr = std::is_same<Kokkos::LayoutRight,LAYOUTB>::value; \
+    \
+    A.stride(strides); \
+    const int LDA = strides[A_is_lr?0:1]; \
+    B.stride(strides); \
+    const int LDB = strides[B_is_lr?0:1]; \
+    \
+    if(!A_is_lr && !B_is_lr) \
+      strmm_(side,uplo,trans,diag,&M,&N,&alpha,A.data(),&LDA,B.data(),&LDB); \
+    if(A_is_lr && B_is_lr) { \
+      /* Row-major B is column-major B^T: swap the side and the triangle */ \
+      const char side_r = (side[0]=='L' || side[0]=='l') ? 'R' : 'L'; \
+      const char uplo_r = (uplo[0]=='L' || uplo[0]=='l') ? 'U' : 'L'; \
+      strmm_(&side_r,&uplo_r,trans,diag,&N,&M,&alpha,A.data(),&LDA,B.data(),&LDB); \
+    } \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS3_ZTRMM_BLAS( LAYOUTA, LAYOUTB, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct TRMM< \
+     Kokkos::View<const Kokkos::complex<double>**, LAYOUTA, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<Kokkos::complex<double>**, LAYOUTB, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef Kokkos::complex<double> SCALAR; \
+  typedef Kokkos::View<const SCALAR**, LAYOUTA, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+  typedef Kokkos::View<SCALAR**, LAYOUTB, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > BViewType; \
+ \
+  static void \
+  trmm (const char side[], \
+        const char uplo[], \
+        const char trans[], \
+        const char diag[], \
+        typename BViewType::const_value_type& alpha, \
+        const AViewType& A, \
+        const BViewType& B) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::trmm[TPL_BLAS,complex<double>]"); \
+    const int M = B.extent(0); \
+    const int N = B.extent(1); \
+    int strides[2]; \
+    \
+    bool A_is_lr = std::is_same<Kokkos::LayoutRight,LAYOUTA>::value; \
+    bool B_is_lr = std::is_same<Kokkos::LayoutRight,LAYOUTB>::value; \
+    \
+    A.stride(strides); \
+    const int LDA = strides[A_is_lr?0:1]; \
+    B.stride(strides); \
+    const int LDB = strides[B_is_lr?0:1]; \
+    \
+    if(!A_is_lr && !B_is_lr) \
+      ztrmm_(side,uplo,trans,diag,&M,&N, \
+        reinterpret_cast<const std::complex<double>*>(&alpha),reinterpret_cast<const std::complex<double>*>(A.data()),&LDA, \
+        reinterpret_cast<std::complex<double>*>(B.data()),&LDB); \
+    if(A_is_lr && B_is_lr) { \
+      /* Row-major B is column-major B^T: swap the side and the triangle */ \
+      const char side_r = (side[0]=='L' || side[0]=='l') ? 'R' : 'L'; \
+      const char uplo_r = (uplo[0]=='L' || uplo[0]=='l') ? 'U' : 'L'; \
+      ztrmm_(&side_r,&uplo_r,trans,diag,&N,&M, \
+        reinterpret_cast<const std::complex<double>*>(&alpha),reinterpret_cast<const std::complex<double>*>(A.data()),&LDA, \
+        reinterpret_cast<std::complex<double>*>(B.data()),&LDB); \
+    } \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+#define KOKKOSBLAS3_CTRMM_BLAS( LAYOUTA, LAYOUTB, MEM_SPACE, ETI_SPEC_AVAIL ) \
+template<class ExecSpace> \
+struct TRMM< \
+     Kokkos::View<const Kokkos::complex<float>**, LAYOUTA, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     Kokkos::View<Kokkos::complex<float>**, LAYOUTB, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+                  Kokkos::MemoryTraits<Kokkos::Unmanaged> >, \
+     true, ETI_SPEC_AVAIL> { \
+  typedef Kokkos::complex<float> SCALAR; \
+  typedef Kokkos::View<const SCALAR**, LAYOUTA, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > AViewType; \
+  typedef Kokkos::View<SCALAR**, LAYOUTB, Kokkos::Device<ExecSpace, MEM_SPACE>, \
+      Kokkos::MemoryTraits<Kokkos::Unmanaged> > BViewType; \
+ \
+  static void \
+  trmm (const char side[], \
+        const char uplo[], \
+        const char trans[], \
+        const char diag[], \
+        typename BViewType::const_value_type& alpha, \
+        const AViewType& A, \
+        const BViewType& B) { \
+    \
+    Kokkos::Profiling::pushRegion("KokkosBlas::trmm[TPL_BLAS,complex<float>]"); \
+    const int M = B.extent(0); \
+    const int N = B.extent(1); \
+    int strides[2]; \
+    \
+    bool A_is_lr = std::is_same<Kokkos::LayoutRight,LAYOUTA>::value; \
+    bool B_is_lr = std::is_same<Kokkos::LayoutRight,LAYOUTB>::value; \
+    \
+    A.stride(strides); \
+    const int LDA = strides[A_is_lr?0:1]; \
+    B.stride(strides); \
+    const int LDB = strides[B_is_lr?0:1]; \
+    \
+    if(!A_is_lr && !B_is_lr) \
+      ctrmm_(side,uplo,trans,diag,&M,&N, \
+        reinterpret_cast<const std::complex<float>*>(&alpha),reinterpret_cast<const std::complex<float>*>(A.data()),&LDA, \
+        reinterpret_cast<std::complex<float>*>(B.data()),&LDB); \
+    if(A_is_lr && B_is_lr) { \
+      /* Row-major B is column-major B^T: swap the side and the triangle */ \
+      const char side_r = (side[0]=='L' || side[0]=='l') ? 'R' : 'L'; \
+      const char uplo_r = (uplo[0]=='L' || uplo[0]=='l') ? 'U' : 'L'; \
+      ctrmm_(&side_r,&uplo_r,trans,diag,&N,&M, \
+        reinterpret_cast<const std::complex<float>*>(&alpha),reinterpret_cast<const std::complex<float>*>(A.data()),&LDA, \
+        reinterpret_cast<std::complex<float>*>(B.data()),&LDB); \
+    } \
+    Kokkos::Profiling::popRegion(); \
+  } \
+};
+
+KOKKOSBLAS3_DTRMM_BLAS( Kokkos::LayoutLeft, Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DTRMM_BLAS( Kokkos::LayoutLeft, Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_DTRMM_BLAS( Kokkos::LayoutRight, Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_DTRMM_BLAS( Kokkos::LayoutRight, Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_STRMM_BLAS( Kokkos::LayoutLeft, Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_STRMM_BLAS( Kokkos::LayoutLeft, Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_STRMM_BLAS( Kokkos::LayoutRight, Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_STRMM_BLAS( Kokkos::LayoutRight, Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_ZTRMM_BLAS( Kokkos::LayoutLeft, Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZTRMM_BLAS( Kokkos::LayoutLeft, Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_ZTRMM_BLAS( Kokkos::LayoutRight, Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_ZTRMM_BLAS( Kokkos::LayoutRight, Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+KOKKOSBLAS3_CTRMM_BLAS( Kokkos::LayoutLeft, Kokkos::LayoutLeft, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CTRMM_BLAS( Kokkos::LayoutLeft, Kokkos::LayoutLeft, Kokkos::HostSpace, false)
+KOKKOSBLAS3_CTRMM_BLAS( Kokkos::LayoutRight, Kokkos::LayoutRight, Kokkos::HostSpace, true)
+KOKKOSBLAS3_CTRMM_BLAS( Kokkos::LayoutRight, Kokkos::LayoutRight, Kokkos::HostSpace, false)
+
+}
+}
+#endif // KOKKOSKERNELS_ENABLE_TPL_BLAS
+
+#endif
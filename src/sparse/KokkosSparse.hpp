@@ -59,4 +59,5 @@
 #include "KokkosSparse_trsv.hpp"
 #include "KokkosSparse_spgemm.hpp"
 #include "KokkosSparse_gauss_seidel.hpp"
+#include "KokkosSparse_par_ilu.hpp"
 
@@ -46,6 +46,7 @@
 #include "KokkosSparse_gauss_seidel_spec.hpp"
 #include "KokkosKernels_Handle.hpp"
 #include "KokkosKernels_helpers.hpp"
+#include "KokkosKernels_Utils.hpp"
 
 namespace KokkosSparse{
 
@@ -654,6 +655,54 @@ namespace Experimental{
 		      update_y_vector,
 		      numIter);
   }
+
+  /// \brief Permutes a vector from the original order of the rows into the
+  /// order used by Gauss-Seidel. The result can be given to the apply functions
+  /// when the gs handle is set with set_apply_on_permuted_vectors(true).
+  /// gauss_seidel_symbolic must be called before.
+  ///
+  /// \param handle [in] The kernel handle with the gs handle.
+  /// \param num_rows [in] Number of (block) rows of the vectors to permute.
+  /// \param in_vec [in] The vector in the original order.
+  /// \param out_vec [out] The vector in the Gauss-Seidel order.
+  template <typename KernelHandle, typename in_scalar_view_t, typename out_scalar_view_t>
+  void gauss_seidel_permute_vector(KernelHandle *handle,
+      typename KernelHandle::const_nnz_lno_t num_rows,
+      in_scalar_view_t in_vec,
+      out_scalar_view_t out_vec){
+    typedef typename KernelHandle::GaussSeidelHandleType::nnz_lno_persistent_work_view_t lno_view_t;
+    typename KernelHandle::GaussSeidelHandleType *gsHandler = handle->get_gs_handle();
+    if (!gsHandler->is_symbolic_called()){
+      Kokkos::Impl::throw_runtime_exception("gauss_seidel_permute_vector: gauss_seidel_symbolic must be called before.");
+    }
+    lno_view_t old_to_new_map = gsHandler->get_old_to_new_map();
+    KokkosKernels::Impl::permute_block_vector
+      <in_scalar_view_t, out_scalar_view_t, lno_view_t, typename KernelHandle::HandleExecSpace>(
+        num_rows, gsHandler->get_block_size(), old_to_new_map, in_vec, out_vec);
+  }
+
+  /// \brief Permutes a vector from the order used by Gauss-Seidel back into
+  /// the original order of the rows. This is the inverse of gauss_seidel_permute_vector.
+  ///
+  /// \param handle [in] The kernel handle with the gs handle.
+  /// \param num_rows [in] Number of (block) rows of the vectors to permute.
+  /// \param in_vec [in] The vector in the Gauss-Seidel order.
+  /// \param out_vec [out] The vector in the original order.
+  template <typename KernelHandle, typename in_scalar_view_t, typename out_scalar_view_t>
+  void gauss_seidel_unpermute_vector(KernelHandle *handle,
+      typename KernelHandle::const_nnz_lno_t num_rows,
+      in_scalar_view_t in_vec,
+      out_scalar_view_t out_vec){
+    typedef typename KernelHandle::GaussSeidelHandleType::nnz_lno_persistent_work_view_t lno_view_t;
+    typename KernelHandle::GaussSeidelHandleType *gsHandler = handle->get_gs_handle();
+    if (!gsHandler->is_symbolic_called()){
+      Kokkos::Impl::throw_runtime_exception("gauss_seidel_unpermute_vector: gauss_seidel_symbolic must be called before.");
+    }
+    lno_view_t new_to_old_map = gsHandler->get_color_adj();
+    KokkosKernels::Impl::permute_block_vector
+      <in_scalar_view_t, out_scalar_view_t, lno_view_t, typename KernelHandle::HandleExecSpace>(
+        num_rows, gsHandler->get_block_size(), new_to_old_map, in_vec, out_vec);
+  }
 }
 }
 #endif
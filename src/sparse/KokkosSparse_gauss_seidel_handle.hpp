@@ -101,6 +101,9 @@ private:
   bool called_symbolic;
   bool called_numeric;
 
+  //if true, the x and y vectors given to apply are in the permuted (color) order.
+  bool apply_on_permuted_vectors;
+
 
   scalar_persistent_work_view_t permuted_y_vector;
   scalar_persistent_work_view_t permuted_x_vector;
@@ -123,7 +126,8 @@ private:
     algorithm_type(gs),
     color_set_xadj(), color_sets(), numColors(0),
     permuted_xadj(),  permuted_adj(), permuted_adj_vals(), old_to_new_map(),
-    called_symbolic(false), called_numeric(false), permuted_y_vector(), permuted_x_vector(),
+    called_symbolic(false), called_numeric(false), apply_on_permuted_vectors(false),
+    permuted_y_vector(), permuted_x_vector(),
     suggested_vector_size(0), suggested_team_size(0), permuted_diagonals(), block_size(1), max_nnz_input_row(-1),
 	num_values_in_l1(-1), num_values_in_l2(-1),num_big_rows(0), level_1_mem(0), level_2_mem(0)
     {
@@ -217,6 +221,7 @@ private:
 
   bool is_symbolic_called(){return this->called_symbolic;}
   bool is_numeric_called(){return this->called_numeric;}
+  bool get_apply_on_permuted_vectors() const {return this->apply_on_permuted_vectors;}
 
   //setters
   void set_algorithm_type(const GSAlgorithm &sgs_algo){this->algorithm_type = sgs_algo;}
@@ -225,6 +230,14 @@ private:
   void set_call_symbolic(bool call = true){this->called_symbolic = call;}
   void set_call_numeric(bool call = true){this->called_numeric = call;}
 
+  /** \brief If set, the x and y vectors given to the apply functions are in the permuted
+   *  order of the rows, i.e. old_to_new_map was applied to them. The sweeps then work on the
+   *  vectors directly and the permutations of x and y in each apply call are skipped.
+   *  Use gauss_seidel_permute_vector and gauss_seidel_unpermute_vector to move vectors
+   *  between the original and the permuted orders.
+   */
+  void set_apply_on_permuted_vectors(bool permuted = true){this->apply_on_permuted_vectors = permuted;}
+
   void set_color_set_xadj(const nnz_lno_persistent_work_host_view_t &color_set_xadj_) {
     this->color_set_xadj = color_set_xadj_;
   }
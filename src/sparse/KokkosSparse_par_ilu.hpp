@@ -0,0 +1,157 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+#ifndef _KOKKOS_PARILU_HPP
+#define _KOKKOS_PARILU_HPP
+
+#include <sstream>
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosSparse_par_ilu_impl.hpp"
+
+namespace KokkosSparse{
+
+namespace Experimental{
+
+  /**
+   * \brief Computes the sparsity patterns of the incomplete factors of the
+   * fixed-point (Chow-Patel) ILU(0) factorization of A.
+   * L is the strictly lower part of A (its unit diagonal is not stored), U is
+   * the upper part of A including the diagonal. Column indices of L and U are
+   * sorted, so the diagonal is the first entry of every row of U.
+   * A must have a structurally nonzero diagonal and no duplicate entries; its
+   * rows do not need to be sorted.
+   * \param handle: kernel handle; create_par_ilu_handle must have been called.
+   * \param num_rows: number of rows of A.
+   * \param row_map, entries: graph of A.
+   * \param L_row_map, L_entries, U_row_map, U_entries: output, allocated here.
+   */
+  template <typename KernelHandle,
+            typename lno_row_view_t_, typename lno_nnz_view_t_,
+            typename out_row_view_t_, typename out_nnz_view_t_>
+  void par_ilu_symbolic(
+      KernelHandle *handle,
+      typename KernelHandle::const_nnz_lno_t num_rows,
+      lno_row_view_t_ row_map,
+      lno_nnz_view_t_ entries,
+      out_row_view_t_ &L_row_map,
+      out_nnz_view_t_ &L_entries,
+      out_row_view_t_ &U_row_map,
+      out_nnz_view_t_ &U_entries){
+
+    static_assert (std::is_same<typename KernelHandle::const_size_type,
+        typename lno_row_view_t_::const_value_type>::value,
+        "KokkosSparse::par_ilu_symbolic: Size type of the matrix should be same as kernelHandle sizetype.");
+
+    static_assert (std::is_same<typename KernelHandle::const_nnz_lno_t,
+        typename lno_nnz_view_t_::const_value_type>::value,
+        "KokkosSparse::par_ilu_symbolic: lno type of the matrix should be same as kernelHandle lno_t.");
+
+    static_assert (std::is_same<typename out_row_view_t_::non_const_value_type,
+        typename out_row_view_t_::value_type>::value,
+        "KokkosSparse::par_ilu_symbolic: output row map must not be const.");
+
+    static_assert (std::is_same<typename out_nnz_view_t_::non_const_value_type,
+        typename out_nnz_view_t_::value_type>::value,
+        "KokkosSparse::par_ilu_symbolic: output entries must not be const.");
+
+    KokkosSparse::Impl::par_ilu_symbolic(
+        handle, num_rows, row_map, entries,
+        L_row_map, L_entries, U_row_map, U_entries);
+  }
+
+  /**
+   * \brief Computes the values of L and U with a fixed number of fixed-point
+   * sweeps (see ParILUHandle::set_max_sweeps), and stores ||A - LU||_F over
+   * the pattern of A in the handle (ParILUHandle::get_residual_norm).
+   * If a tolerance is set, sweeping stops once the residual drops below it.
+   * \param handle: kernel handle used in par_ilu_symbolic.
+   * \param num_rows: number of rows of A.
+   * \param values: values of A, in the order of the entries given to symbolic.
+   * \param L_row_map, L_entries, U_row_map, U_entries: output of symbolic.
+   * \param L_values, U_values: output, allocated here if their sizes do not
+   * match the number of entries of L and U.
+   */
+  template <typename KernelHandle,
+            typename scalar_nnz_view_t_,
+            typename out_row_view_t_, typename out_nnz_view_t_,
+            typename out_scalar_view_t_>
+  void par_ilu_numeric(
+      KernelHandle *handle,
+      typename KernelHandle::const_nnz_lno_t num_rows,
+      scalar_nnz_view_t_ values,
+      out_row_view_t_ L_row_map,
+      out_nnz_view_t_ L_entries,
+      out_scalar_view_t_ &L_values,
+      out_row_view_t_ U_row_map,
+      out_nnz_view_t_ U_entries,
+      out_scalar_view_t_ &U_values){
+
+    static_assert (std::is_same<typename KernelHandle::const_nnz_scalar_t,
+        typename scalar_nnz_view_t_::const_value_type>::value,
+        "KokkosSparse::par_ilu_numeric: scalar type of the matrix should be same as kernelHandle scalar_t.");
+
+    static_assert (std::is_same<typename out_scalar_view_t_::non_const_value_type,
+        typename out_scalar_view_t_::value_type>::value,
+        "KokkosSparse::par_ilu_numeric: output values must not be const.");
+
+    if (!handle->get_par_ilu_handle()->is_symbolic_called()){
+      std::ostringstream os;
+      os << "KokkosSparse::par_ilu_numeric: par_ilu_symbolic must be called before numeric.";
+      Kokkos::Impl::throw_runtime_exception (os.str ());
+    }
+
+    if (L_values.extent(0) != L_entries.extent(0)){
+      L_values = out_scalar_view_t_(Kokkos::ViewAllocateWithoutInitializing("ParILU L values"), L_entries.extent(0));
+    }
+    if (U_values.extent(0) != U_entries.extent(0)){
+      U_values = out_scalar_view_t_(Kokkos::ViewAllocateWithoutInitializing("ParILU U values"), U_entries.extent(0));
+    }
+
+    KokkosSparse::Impl::par_ilu_numeric(
+        handle, num_rows, values,
+        L_row_map, L_entries, L_values,
+        U_row_map, U_entries, U_values);
+  }
+
+}
+}
+#endif
@@ -0,0 +1,187 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_MemoryTraits.hpp>
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include <iostream>
+#include <string>
+
+#ifndef _PARILUHANDLE_HPP
+#define _PARILUHANDLE_HPP
+
+namespace KokkosSparse{
+
+/**
+ * \brief Update modes of the fixed-point (Chow-Patel) ILU(0) factorization.
+ * PARILU_ASYNC: every sweep updates L and U in place. Nonzeroes read whatever
+ *   value their dependencies currently hold, as in the original asynchronous
+ *   formulation. Converges in fewer sweeps, but the result of a fixed number
+ *   of sweeps depends on the thread schedule.
+ * PARILU_SYNC: Jacobi-style sweeps. Every nonzero of sweep k+1 is computed from
+ *   the values of sweep k only, so results are independent of the schedule at
+ *   the cost of an additional copy of L and U.
+ */
+enum ParILUAlgorithm{PARILU_DEFAULT, PARILU_ASYNC, PARILU_SYNC};
+
+template <class size_type_, class lno_t_, class scalar_t_,
+          class ExecutionSpace,
+          class TemporaryMemorySpace,
+          class PersistentMemorySpace>
+class ParILUHandle{
+public:
+  typedef ExecutionSpace HandleExecSpace;
+  typedef TemporaryMemorySpace HandleTempMemorySpace;
+  typedef PersistentMemorySpace HandlePersistentMemorySpace;
+
+  typedef typename std::remove_const<size_type_>::type  size_type;
+  typedef const size_type const_size_type;
+
+  typedef typename std::remove_const<lno_t_>::type  nnz_lno_t;
+  typedef const nnz_lno_t const_nnz_lno_t;
+
+  typedef typename std::remove_const<scalar_t_>::type  nnz_scalar_t;
+  typedef const nnz_scalar_t const_nnz_scalar_t;
+
+  typedef typename Kokkos::Details::ArithTraits<nnz_scalar_t>::mag_type mag_t;
+
+  typedef typename Kokkos::View<size_type *, HandlePersistentMemorySpace> row_lno_persistent_work_view_t;
+  typedef typename Kokkos::View<nnz_scalar_t *, HandlePersistentMemorySpace> scalar_persistent_work_view_t;
+  typedef typename Kokkos::View<nnz_lno_t *, HandlePersistentMemorySpace> nnz_lno_persistent_work_view_t;
+
+private:
+  ParILUAlgorithm algorithm_type;
+
+  int max_sweeps;
+  mag_t tolerance;
+
+  //number of sweeps run by the last numeric call, and the Frobenius norm of
+  //A - LU restricted to the sparsity pattern of A after the last sweep.
+  int num_sweeps_performed;
+  mag_t residual_norm;
+
+  size_type nnz_L, nnz_U;
+
+  //for each entry of L and U, the position of the corresponding entry in A.
+  //computed in symbolic so numeric can gather the values of A directly.
+  row_lno_persistent_work_view_t L_a_pos;
+  row_lno_persistent_work_view_t U_a_pos;
+
+  bool called_symbolic;
+  bool called_numeric;
+
+public:
+
+  /**
+   * \brief Default constructor.
+   * \param algo: update mode of the sweeps.
+   * \param max_sweeps_: number of fixed-point sweeps run by numeric.
+   */
+  ParILUHandle(ParILUAlgorithm algo = PARILU_DEFAULT, int max_sweeps_ = 5):
+    algorithm_type(algo),
+    max_sweeps(max_sweeps_), tolerance(0),
+    num_sweeps_performed(0), residual_norm(0),
+    nnz_L(0), nnz_U(0),
+    L_a_pos(), U_a_pos(),
+    called_symbolic(false), called_numeric(false)
+    {
+    if (algo == PARILU_DEFAULT){
+      this->algorithm_type = PARILU_ASYNC;
+    }
+  }
+
+  virtual ~ParILUHandle(){};
+
+  //getters
+  ParILUAlgorithm get_algorithm_type() const {return this->algorithm_type;}
+  int get_max_sweeps() const {return this->max_sweeps;}
+  mag_t get_tolerance() const {return this->tolerance;}
+  int get_num_sweeps_performed() const {return this->num_sweeps_performed;}
+
+  /**
+   * \brief Returns ||A - LU||_F over the sparsity pattern of A, as computed
+   * at the end of the last numeric call.
+   */
+  mag_t get_residual_norm() const {return this->residual_norm;}
+
+  size_type get_nnz_L() const {return this->nnz_L;}
+  size_type get_nnz_U() const {return this->nnz_U;}
+
+  row_lno_persistent_work_view_t get_L_a_pos() {return this->L_a_pos;}
+  row_lno_persistent_work_view_t get_U_a_pos() {return this->U_a_pos;}
+
+  bool is_symbolic_called(){return this->called_symbolic;}
+  bool is_numeric_called(){return this->called_numeric;}
+
+  //setters
+  void set_algorithm_type(const ParILUAlgorithm &algo){this->algorithm_type = algo;}
+
+  /**
+   * \brief Sets the number of sweeps run by numeric.
+   */
+  void set_max_sweeps(int max_sweeps_){this->max_sweeps = max_sweeps_;}
+
+  /**
+   * \brief Sets the residual norm below which numeric stops sweeping.
+   * If the tolerance is 0 (default), the residual is computed only once,
+   * after the last sweep, and exactly max_sweeps sweeps are run.
+   * Otherwise, the residual is computed after every sweep.
+   */
+  void set_tolerance(mag_t tolerance_){this->tolerance = tolerance_;}
+
+  void set_num_sweeps_performed(int sweeps){this->num_sweeps_performed = sweeps;}
+  void set_residual_norm(mag_t res){this->residual_norm = res;}
+
+  void set_nnz_L(size_type nnz_L_){this->nnz_L = nnz_L_;}
+  void set_nnz_U(size_type nnz_U_){this->nnz_U = nnz_U_;}
+
+  void set_L_a_pos(const row_lno_persistent_work_view_t &L_a_pos_){this->L_a_pos = L_a_pos_;}
+  void set_U_a_pos(const row_lno_persistent_work_view_t &U_a_pos_){this->U_a_pos = U_a_pos_;}
+
+  void set_call_symbolic(bool call = true){this->called_symbolic = call;}
+  void set_call_numeric(bool call = true){this->called_numeric = call;}
+};
+
+}
+
+#endif
@@ -1165,6 +1165,33 @@ public:
 #endif
   }
 
+  /** \brief Makes the work vector alias the given vector, so that the sweeps work on the
+   *  vector directly. This is possible if the vector is contiguous, it is in the persistent
+   *  memory space and it has the same size as the work vector.
+   *  Returns false if the vector can not be aliased.
+   */
+  template <typename value_array_type>
+  bool alias_permuted_vector(value_array_type vec, scalar_persistent_work_view_t &work_vec){
+    typedef std::integral_constant<bool,
+        std::is_same<typename value_array_type::memory_space,
+                     typename scalar_persistent_work_view_t::memory_space>::value &&
+        std::is_same<typename value_array_type::non_const_value_type, nnz_scalar_t>::value> can_alias_t;
+    return this->alias_permuted_vector(vec, work_vec, can_alias_t());
+  }
+
+  template <typename value_array_type>
+  bool alias_permuted_vector(value_array_type vec, scalar_persistent_work_view_t &work_vec, std::true_type){
+    if (!vec.span_is_contiguous() || vec.extent(0) != work_vec.extent(0)) return false;
+    //the y vector is only read by the sweeps.
+    work_vec = scalar_persistent_work_view_t(const_cast<nnz_scalar_t *>(vec.data()), vec.extent(0));
+    return true;
+  }
+
+  template <typename value_array_type>
+  bool alias_permuted_vector(value_array_type, scalar_persistent_work_view_t &, std::false_type){
+    return false;
+  }
+
   template <typename x_value_array_type, typename y_value_array_type>
   void block_apply(
       x_value_array_type x_lhs_output_vec,
@@ -1198,6 +1225,17 @@ public:
 
 
 
+    //if the vectors are already in the permuted order, the sweeps work on them directly,
+    //and only the vectors that can not be aliased are copied without permutation.
+    const bool permuted_vectors = gsHandler->get_apply_on_permuted_vectors();
+    nnz_lno_persistent_work_view_t y_map = old_to_new_map, x_map = old_to_new_map;
+    bool x_aliased = false;
+    if (permuted_vectors){
+      y_map = x_map = nnz_lno_persistent_work_view_t();
+      x_aliased = this->alias_permuted_vector(x_lhs_output_vec, Permuted_Xvector);
+      if (this->alias_permuted_vector(y_rhs_input_vec, Permuted_Yvector)) update_y_vector = false;
+    }
+
     if (update_y_vector){
 
 
@@ -1206,7 +1244,7 @@ public:
         scalar_persistent_work_view_t,
         nnz_lno_persistent_work_view_t, MyExecSpace>(
           num_rows, block_size,
-          old_to_new_map,
+          y_map,
           y_rhs_input_vec,
           Permuted_Yvector
       );
@@ -1215,11 +1253,11 @@ public:
     if(init_zero_x_vector){
       KokkosKernels::Impl::zero_vector<scalar_persistent_work_view_t, MyExecSpace>(num_cols * block_size, Permuted_Xvector);
     }
-    else{
+    else if (!x_aliased){
       KokkosKernels::Impl::permute_block_vector
         <x_value_array_type, scalar_persistent_work_view_t, nnz_lno_persistent_work_view_t, MyExecSpace>(
           num_cols, block_size,
-          old_to_new_map,
+          x_map,
           x_lhs_output_vec,
           Permuted_Xvector
           );
@@ -1293,13 +1331,16 @@ public:
     //Kokkos::parallel_for( my_exec_space(0,nr), PermuteVector(x_lhs_output_vec, Permuted_Xvector, color_adj));
 
 
-    KokkosKernels::Impl::permute_block_vector
-    <scalar_persistent_work_view_t,x_value_array_type,  nnz_lno_persistent_work_view_t, MyExecSpace>(
-        num_cols, block_size,
-        color_adj,
-        Permuted_Xvector,
-        x_lhs_output_vec
-        );
+    if (!x_aliased){
+      if (permuted_vectors) color_adj = nnz_lno_persistent_work_view_t();
+      KokkosKernels::Impl::permute_block_vector
+      <scalar_persistent_work_view_t,x_value_array_type,  nnz_lno_persistent_work_view_t, MyExecSpace>(
+          num_cols, block_size,
+          color_adj,
+          Permuted_Xvector,
+          x_lhs_output_vec
+          );
+    }
     MyExecSpace::fence();
 
 #if KOKKOSSPARSE_IMPL_PRINTDEBUG
@@ -1338,13 +1379,24 @@ public:
 
 
 
+    //if the vectors are already in the permuted order, the sweeps work on them directly,
+    //and only the vectors that can not be aliased are copied without permutation.
+    const bool permuted_vectors = gsHandler->get_apply_on_permuted_vectors();
+    nnz_lno_persistent_work_view_t y_map = old_to_new_map, x_map = old_to_new_map;
+    bool x_aliased = false;
+    if (permuted_vectors){
+      y_map = x_map = nnz_lno_persistent_work_view_t();
+      x_aliased = this->alias_permuted_vector(x_lhs_output_vec, Permuted_Xvector);
+      if (this->alias_permuted_vector(y_rhs_input_vec, Permuted_Yvector)) update_y_vector = false;
+    }
+
     if (update_y_vector){
       KokkosKernels::Impl::permute_vector
         <y_value_array_type,
         scalar_persistent_work_view_t,
         nnz_lno_persistent_work_view_t, MyExecSpace>(
           num_rows,
-          old_to_new_map,
+          y_map,
           y_rhs_input_vec,
           Permuted_Yvector
       );
@@ -1353,11 +1405,11 @@ public:
     if(init_zero_x_vector){
       KokkosKernels::Impl::zero_vector<scalar_persistent_work_view_t, MyExecSpace>(num_cols, Permuted_Xvector);
     }
-    else{
+    else if (!x_aliased){
       KokkosKernels::Impl::permute_vector
         <x_value_array_type, scalar_persistent_work_view_t, nnz_lno_persistent_work_view_t, MyExecSpace>(
           num_cols,
-          old_to_new_map,
+          x_map,
           x_lhs_output_vec,
           Permuted_Xvector
           );
@@ -1404,13 +1456,16 @@ public:
     //Kokkos::parallel_for( my_exec_space(0,nr), PermuteVector(x_lhs_output_vec, Permuted_Xvector, color_adj));
 
 
-    KokkosKernels::Impl::permute_vector
-    <scalar_persistent_work_view_t,x_value_array_type,  nnz_lno_persistent_work_view_t, MyExecSpace>(
-        num_cols,
-        color_adj,
-        Permuted_Xvector,
-        x_lhs_output_vec
-        );
+    if (!x_aliased){
+      if (permuted_vectors) color_adj = nnz_lno_persistent_work_view_t();
+      KokkosKernels::Impl::permute_vector
+      <scalar_persistent_work_view_t,x_value_array_type,  nnz_lno_persistent_work_view_t, MyExecSpace>(
+          num_cols,
+          color_adj,
+          Permuted_Xvector,
+          x_lhs_output_vec
+          );
+    }
     MyExecSpace::fence();
 #if KOKKOSSPARSE_IMPL_PRINTDEBUG
     std::cout << "--point After X:";
@@ -0,0 +1,429 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+*/
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ArithTraits.hpp>
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosKernels_SparseUtils.hpp"
+#include "KokkosSparse_findRelOffset.hpp"
+#include "KokkosSparse_par_ilu_handle.hpp"
+
+#ifndef _KOKKOSPARILUIMPL_HPP
+#define _KOKKOSPARILUIMPL_HPP
+
+namespace KokkosSparse{
+
+namespace Impl{
+
+/**
+ * \brief Sorts the column indices of every row in increasing order, and
+ * applies the same permutation to the second array (the positions in A).
+ * Rows of L and U are short, so an insertion sort per row is used.
+ */
+template <typename row_view_t, typename nnz_view_t, typename pos_view_t>
+struct ParILUSortRows{
+  typedef typename row_view_t::non_const_value_type size_type;
+  typedef typename nnz_view_t::non_const_value_type lno_t;
+  typedef typename pos_view_t::non_const_value_type pos_t;
+
+  row_view_t rowmap;
+  nnz_view_t entries;
+  pos_view_t pos;
+
+  ParILUSortRows(row_view_t rowmap_, nnz_view_t entries_, pos_view_t pos_):
+    rowmap(rowmap_), entries(entries_), pos(pos_){}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const lno_t &row) const {
+    const size_type begin = rowmap(row);
+    const size_type end = rowmap(row + 1);
+    for (size_type i = begin + 1; i < end; ++i){
+      const lno_t col = entries(i);
+      const pos_t p = pos(i);
+      size_type j = i;
+      while (j > begin && entries(j - 1) > col){
+        entries(j) = entries(j - 1);
+        pos(j) = pos(j - 1);
+        --j;
+      }
+      entries(j) = col;
+      pos(j) = p;
+    }
+  }
+};
+
+/**
+ * \brief Gathers the values of A into the L and U layouts, and sets the initial
+ * guess of the fixed-point iteration: U = triu(A), L = tril(A) D^{-1}, where D
+ * is the diagonal of A.
+ */
+template <typename row_view_t, typename nnz_view_t, typename pos_view_t,
+          typename a_scalar_view_t, typename scalar_view_t>
+struct ParILUInitialize{
+  typedef typename row_view_t::non_const_value_type size_type;
+  typedef typename nnz_view_t::non_const_value_type lno_t;
+
+  row_view_t L_rowmap;
+  nnz_view_t L_entries;
+  pos_view_t L_a_pos;
+  row_view_t U_rowmap;
+  pos_view_t U_a_pos;
+  a_scalar_view_t A_values;
+  scalar_view_t L_a, U_a, L_values, U_values;
+
+  ParILUInitialize(
+      row_view_t L_rowmap_, nnz_view_t L_entries_, pos_view_t L_a_pos_,
+      row_view_t U_rowmap_, pos_view_t U_a_pos_,
+      a_scalar_view_t A_values_,
+      scalar_view_t L_a_, scalar_view_t U_a_,
+      scalar_view_t L_values_, scalar_view_t U_values_):
+        L_rowmap(L_rowmap_), L_entries(L_entries_), L_a_pos(L_a_pos_),
+        U_rowmap(U_rowmap_), U_a_pos(U_a_pos_),
+        A_values(A_values_),
+        L_a(L_a_), U_a(U_a_), L_values(L_values_), U_values(U_values_){}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const lno_t &row) const {
+    for (size_type i = U_rowmap(row); i < U_rowmap(row + 1); ++i){
+      U_a(i) = U_values(i) = A_values(U_a_pos(i));
+    }
+    for (size_type i = L_rowmap(row); i < L_rowmap(row + 1); ++i){
+      const lno_t col = L_entries(i);
+      L_a(i) = A_values(L_a_pos(i));
+      //the diagonal is the first entry of each (sorted) row of U.
+      L_values(i) = L_a(i) / A_values(U_a_pos(U_rowmap(col)));
+    }
+  }
+};
+
+/**
+ * \brief One fixed-point sweep of the Chow-Patel ILU(0) factorization.
+ * L is strictly lower triangular with an implicit unit diagonal, U is upper
+ * triangular with the diagonal stored as the first entry of each row.
+ * For every (i,j) in the pattern of A:
+ *   i >  j: l_ij = (a_ij - sum_{k<j} l_ik u_kj) / u_jj
+ *   i <= j: u_ij =  a_ij - sum_{k<i} l_ik u_kj
+ * Rows are distributed over team threads and the nonzeroes of a row over vector
+ * lanes, so each nonzero is updated independently. The sweep reads from
+ * (L_prev, U_prev) and writes to (L_next, U_next). The asynchronous mode passes
+ * the same views for both.
+ */
+template <typename row_view_t, typename nnz_view_t, typename scalar_view_t, typename ExecutionSpace>
+struct ParILUSweep{
+  typedef typename row_view_t::non_const_value_type size_type;
+  typedef typename nnz_view_t::non_const_value_type lno_t;
+  typedef typename scalar_view_t::non_const_value_type scalar_t;
+
+  typedef Kokkos::TeamPolicy<ExecutionSpace> team_policy_t ;
+  typedef Kokkos::TeamPolicy<ExecutionSpace, Kokkos::Schedule<Kokkos::Dynamic> > dynamic_team_policy_t ;
+  typedef typename team_policy_t::member_type team_member_t ;
+
+  lno_t num_rows;
+  row_view_t L_rowmap;
+  nnz_view_t L_entries;
+  row_view_t U_rowmap;
+  nnz_view_t U_entries;
+  scalar_view_t L_a, U_a;
+  scalar_view_t L_prev, U_prev;
+  scalar_view_t L_next, U_next;
+  lno_t team_work_size;
+
+  ParILUSweep(
+      lno_t num_rows_,
+      row_view_t L_rowmap_, nnz_view_t L_entries_,
+      row_view_t U_rowmap_, nnz_view_t U_entries_,
+      scalar_view_t L_a_, scalar_view_t U_a_,
+      scalar_view_t L_prev_, scalar_view_t U_prev_,
+      scalar_view_t L_next_, scalar_view_t U_next_,
+      lno_t team_work_size_):
+        num_rows(num_rows_),
+        L_rowmap(L_rowmap_), L_entries(L_entries_),
+        U_rowmap(U_rowmap_), U_entries(U_entries_),
+        L_a(L_a_), U_a(U_a_),
+        L_prev(L_prev_), U_prev(U_prev_),
+        L_next(L_next_), U_next(U_next_),
+        team_work_size(team_work_size_){}
+
+  //returns sum_{k < min(row, col)} l_row,k * u_k,col using the previous iterate.
+  KOKKOS_INLINE_FUNCTION
+  scalar_t lu_dot(const lno_t row, const lno_t col) const {
+    scalar_t sum = Kokkos::Details::ArithTraits<scalar_t>::zero();
+    const size_type l_end = L_rowmap(row + 1);
+    for (size_type q = L_rowmap(row); q < l_end; ++q){
+      const lno_t k = L_entries(q);
+      if (k >= col) break;
+      const size_type u_begin = U_rowmap(k);
+      const lno_t u_len = U_rowmap(k + 1) - u_begin;
+      const lno_t offset = KokkosSparse::findRelOffset<lno_t>(
+          U_entries.data() + u_begin, u_len, col, 0, true);
+      if (offset < u_len){
+        sum += L_prev(q) * U_prev(u_begin + offset);
+      }
+    }
+    return sum;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member_t &teamMember) const {
+    const lno_t team_row_begin = teamMember.league_rank() * team_work_size;
+    const lno_t team_row_end = KOKKOSKERNELS_MACRO_MIN(team_row_begin + team_work_size, num_rows);
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(teamMember,team_row_begin,team_row_end), [&] (const lno_t& row) {
+      const size_type l_begin = L_rowmap(row);
+      const lno_t l_size = L_rowmap(row + 1) - l_begin;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(teamMember, l_size), [&] (lno_t i) {
+        const size_type p = l_begin + i;
+        const lno_t col = L_entries(p);
+        L_next(p) = (L_a(p) - lu_dot(row, col)) / U_prev(U_rowmap(col));
+      });
+
+      const size_type u_begin = U_rowmap(row);
+      const lno_t u_size = U_rowmap(row + 1) - u_begin;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(teamMember, u_size), [&] (lno_t i) {
+        const size_type p = u_begin + i;
+        U_next(p) = U_a(p) - lu_dot(row, U_entries(p));
+      });
+    });
+  }
+};
+
+/**
+ * \brief Computes ||A - LU||_F^2 over the sparsity pattern of A.
+ */
+template <typename row_view_t, typename nnz_view_t, typename scalar_view_t, typename ExecutionSpace>
+struct ParILUResidual{
+  typedef typename row_view_t::non_const_value_type size_type;
+  typedef typename nnz_view_t::non_const_value_type lno_t;
+  typedef typename scalar_view_t::non_const_value_type scalar_t;
+  typedef Kokkos::Details::ArithTraits<scalar_t> KAT;
+  typedef typename KAT::mag_type mag_t;
+
+  typedef ParILUSweep<row_view_t, nnz_view_t, scalar_view_t, ExecutionSpace> sweep_t;
+  sweep_t sweep;
+
+  ParILUResidual(const sweep_t &sweep_): sweep(sweep_){}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const lno_t &row, mag_t &res) const {
+    for (size_type p = sweep.L_rowmap(row); p < sweep.L_rowmap(row + 1); ++p){
+      const lno_t col = sweep.L_entries(p);
+      const scalar_t r = sweep.L_a(p) - sweep.lu_dot(row, col)
+          - sweep.L_prev(p) * sweep.U_prev(sweep.U_rowmap(col));
+      const mag_t abs_r = KAT::abs(r);
+      res += abs_r * abs_r;
+    }
+    for (size_type p = sweep.U_rowmap(row); p < sweep.U_rowmap(row + 1); ++p){
+      const scalar_t r = sweep.U_a(p) - sweep.lu_dot(row, sweep.U_entries(p)) - sweep.U_prev(p);
+      const mag_t abs_r = KAT::abs(r);
+      res += abs_r * abs_r;
+    }
+  }
+};
+
+template <typename KernelHandle,
+          typename a_row_view_t, typename a_nnz_view_t,
+          typename row_view_t, typename nnz_view_t>
+void par_ilu_symbolic(
+    KernelHandle *handle,
+    typename KernelHandle::nnz_lno_t num_rows,
+    a_row_view_t A_rowmap,
+    a_nnz_view_t A_entries,
+    row_view_t &L_rowmap,
+    nnz_view_t &L_entries,
+    row_view_t &U_rowmap,
+    nnz_view_t &U_entries){
+
+  typedef typename KernelHandle::HandleExecSpace MyExecSpace;
+  typedef typename KernelHandle::size_type size_type;
+  typedef typename KernelHandle::nnz_lno_t nnz_lno_t;
+  typedef typename KernelHandle::ParILUHandleType::row_lno_persistent_work_view_t pos_view_t;
+
+  typename KernelHandle::ParILUHandleType *ilu_handle = handle->get_par_ilu_handle();
+
+  //positions of the entries of A. Splitting them with the values of A gives,
+  //for every entry of L and U, where to read it from in A.
+  const size_type nnz_A = A_entries.extent(0);
+  pos_view_t A_pos(Kokkos::ViewAllocateWithoutInitializing("ParILU A positions"), nnz_A);
+  KokkosKernels::Impl::linear_init<pos_view_t, MyExecSpace>(nnz_A, A_pos);
+
+  pos_view_t L_a_pos, U_a_pos;
+  Kokkos::View<nnz_lno_t *, MyExecSpace> no_permutation;
+
+  //L: strictly lower part of A.
+  KokkosKernels::Impl::kk_get_lower_triangle
+    <a_row_view_t, a_nnz_view_t, pos_view_t, row_view_t, nnz_view_t, pos_view_t,
+     Kokkos::View<nnz_lno_t *, MyExecSpace>, MyExecSpace>(
+        num_rows, A_rowmap, A_entries, A_pos,
+        L_rowmap, L_entries, L_a_pos, no_permutation,
+        handle->is_dynamic_scheduling(), 4, true, false);
+
+  //U: upper part of A, including the diagonal.
+  KokkosKernels::Impl::kk_get_lower_triangle
+    <a_row_view_t, a_nnz_view_t, pos_view_t, row_view_t, nnz_view_t, pos_view_t,
+     Kokkos::View<nnz_lno_t *, MyExecSpace>, MyExecSpace>(
+        num_rows, A_rowmap, A_entries, A_pos,
+        U_rowmap, U_entries, U_a_pos, no_permutation,
+        handle->is_dynamic_scheduling(), 4, false, true);
+
+  typedef Kokkos::RangePolicy<MyExecSpace, nnz_lno_t> range_t;
+  Kokkos::parallel_for("ParILU::SortL", range_t(0, num_rows),
+      ParILUSortRows<row_view_t, nnz_view_t, pos_view_t>(L_rowmap, L_entries, L_a_pos));
+  Kokkos::parallel_for("ParILU::SortU", range_t(0, num_rows),
+      ParILUSortRows<row_view_t, nnz_view_t, pos_view_t>(U_rowmap, U_entries, U_a_pos));
+  MyExecSpace::fence();
+
+  ilu_handle->set_L_a_pos(L_a_pos);
+  ilu_handle->set_U_a_pos(U_a_pos);
+  ilu_handle->set_nnz_L(L_entries.extent(0));
+  ilu_handle->set_nnz_U(U_entries.extent(0));
+  ilu_handle->set_call_symbolic();
+  ilu_handle->set_call_numeric(false);
+}
+
+template <typename KernelHandle,
+          typename a_scalar_view_t,
+          typename row_view_t, typename nnz_view_t, typename scalar_view_t>
+void par_ilu_numeric(
+    KernelHandle *handle,
+    typename KernelHandle::nnz_lno_t num_rows,
+    a_scalar_view_t A_values,
+    row_view_t L_rowmap,
+    nnz_view_t L_entries,
+    scalar_view_t L_values,
+    row_view_t U_rowmap,
+    nnz_view_t U_entries,
+    scalar_view_t U_values){
+
+  typedef typename KernelHandle::HandleExecSpace MyExecSpace;
+  typedef typename KernelHandle::size_type size_type;
+  typedef typename KernelHandle::nnz_lno_t nnz_lno_t;
+  typedef typename KernelHandle::ParILUHandleType ilu_handle_t;
+  typedef typename KernelHandle::ParILUHandleType::row_lno_persistent_work_view_t pos_view_t;
+  typedef typename ilu_handle_t::mag_t mag_t;
+
+  ilu_handle_t *ilu_handle = handle->get_par_ilu_handle();
+
+  const size_type nnz_L = L_entries.extent(0);
+  const size_type nnz_U = U_entries.extent(0);
+
+  //values of A in the layouts of L and U; kept for the whole iteration.
+  scalar_view_t L_a(Kokkos::ViewAllocateWithoutInitializing("ParILU L_a"), nnz_L);
+  scalar_view_t U_a(Kokkos::ViewAllocateWithoutInitializing("ParILU U_a"), nnz_U);
+
+  typedef Kokkos::RangePolicy<MyExecSpace, nnz_lno_t> range_t;
+  Kokkos::parallel_for("ParILU::Initialize", range_t(0, num_rows),
+      ParILUInitialize<row_view_t, nnz_view_t, pos_view_t, a_scalar_view_t, scalar_view_t>(
+          L_rowmap, L_entries, ilu_handle->get_L_a_pos(),
+          U_rowmap, ilu_handle->get_U_a_pos(),
+          A_values, L_a, U_a, L_values, U_values));
+  MyExecSpace::fence();
+
+  const bool is_sync = ilu_handle->get_algorithm_type() == PARILU_SYNC;
+  scalar_view_t L_other, U_other;
+  if (is_sync){
+    L_other = scalar_view_t(Kokkos::ViewAllocateWithoutInitializing("ParILU L_other"), nnz_L);
+    U_other = scalar_view_t(Kokkos::ViewAllocateWithoutInitializing("ParILU U_other"), nnz_U);
+  }
+
+  typedef ParILUSweep<row_view_t, nnz_view_t, scalar_view_t, MyExecSpace> sweep_t;
+  typedef ParILUResidual<row_view_t, nnz_view_t, scalar_view_t, MyExecSpace> residual_t;
+
+  const int suggested_vector_size = handle->get_suggested_vector_size(num_rows, nnz_L + nnz_U);
+  const int suggested_team_size = handle->get_suggested_team_size(suggested_vector_size);
+  const nnz_lno_t team_row_chunk_size = handle->get_team_work_size(suggested_team_size, MyExecSpace::concurrency(), num_rows);
+  const nnz_lno_t num_teams = num_rows / team_row_chunk_size + 1;
+
+  const int max_sweeps = ilu_handle->get_max_sweeps();
+  const mag_t tolerance = ilu_handle->get_tolerance();
+
+  //(L_values, U_values) always hold the latest iterate.
+  sweep_t sweep(num_rows, L_rowmap, L_entries, U_rowmap, U_entries, L_a, U_a,
+      L_values, U_values, L_values, U_values, team_row_chunk_size);
+
+  int sweep_count = 0;
+  mag_t residual = 0;
+  while (sweep_count < max_sweeps){
+    if (is_sync){
+      Kokkos::deep_copy(L_other, L_values);
+      Kokkos::deep_copy(U_other, U_values);
+      sweep.L_prev = L_other;
+      sweep.U_prev = U_other;
+    }
+    if (handle->is_dynamic_scheduling()){
+      Kokkos::parallel_for("ParILU::Sweep",
+          typename sweep_t::dynamic_team_policy_t(num_teams, suggested_team_size, suggested_vector_size), sweep);
+    }
+    else {
+      Kokkos::parallel_for("ParILU::Sweep",
+          typename sweep_t::team_policy_t(num_teams, suggested_team_size, suggested_vector_size), sweep);
+    }
+    MyExecSpace::fence();
+    ++sweep_count;
+
+    if (tolerance > 0){
+      sweep.L_prev = L_values;
+      sweep.U_prev = U_values;
+      residual = 0;
+      Kokkos::parallel_reduce("ParILU::Residual", range_t(0, num_rows), residual_t(sweep), residual);
+      residual = Kokkos::Details::ArithTraits<mag_t>::sqrt(residual);
+      if (residual < tolerance) break;
+    }
+  }
+
+  if (!(tolerance > 0)){
+    sweep.L_prev = L_values;
+    sweep.U_prev = U_values;
+    residual = 0;
+    Kokkos::parallel_reduce("ParILU::Residual", range_t(0, num_rows), residual_t(sweep), residual);
+    residual = Kokkos::Details::ArithTraits<mag_t>::sqrt(residual);
+  }
+
+  ilu_handle->set_num_sweeps_performed(sweep_count);
+  ilu_handle->set_residual_norm(residual);
+  ilu_handle->set_call_numeric();
+}
+
+}
+}
+
+#endif
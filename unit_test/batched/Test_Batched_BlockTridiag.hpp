@@ -0,0 +1,193 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosSparse_BlockCrsMatrix.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_BlockTridiag_Decl.hpp"
+#include "KokkosBatched_BlockTridiag_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  // block crs matrix of a 3D cross stencil on an ni x nj x nk mesh; k is the fastest index
+  template<typename BlockCrsMatrixType>
+  BlockCrsMatrixType make_block_tridiag_test_matrix(const int ni, const int nj, const int nk, const int bs) {
+    typedef typename BlockCrsMatrixType::StaticCrsGraphType graph_type;
+    typedef typename graph_type::row_map_type::non_const_type row_map_type;
+    typedef typename graph_type::entries_type::non_const_type entries_type;
+    typedef typename BlockCrsMatrixType::values_type::non_const_type values_type;
+    typedef typename BlockCrsMatrixType::value_type value_type;
+
+    const int nrows = ni*nj*nk;
+    std::vector<int> rowptr(nrows+1, 0), colidx;
+    for (int i=0;i<ni;++i)
+      for (int j=0;j<nj;++j)
+        for (int k=0;k<nk;++k) {
+          const int row = (i*nj + j)*nk + k;
+          if (i > 0)    colidx.push_back(row - nj*nk);
+          if (j > 0)    colidx.push_back(row - nk);
+          if (k > 0)    colidx.push_back(row - 1);
+          colidx.push_back(row);
+          if (k+1 < nk) colidx.push_back(row + 1);
+          if (j+1 < nj) colidx.push_back(row + nk);
+          if (i+1 < ni) colidx.push_back(row + nj*nk);
+          rowptr[row+1] = colidx.size();
+        }
+    const int nblocks = colidx.size();
+
+    row_map_type rows("rows", nrows+1);
+    entries_type cols("cols", nblocks);
+    values_type vals("vals", nblocks*bs*bs);
+
+    auto rows_host = Kokkos::create_mirror_view(rows);
+    auto cols_host = Kokkos::create_mirror_view(cols);
+    auto vals_host = Kokkos::create_mirror_view(vals);
+
+    for (int r=0;r<=nrows;++r) rows_host(r) = rowptr[r];
+    for (int c=0;c<nblocks;++c) cols_host(c) = colidx[c];
+
+    // diagonally dominant blocks; block K of row r at (ii,jj) is
+    // vals(start*bs*bs + K*bs + ii*len*bs + jj) with start = rowptr[r]
+    Random<value_type> random;
+    for (int r=0;r<nrows;++r) {
+      const int start = rowptr[r], len = rowptr[r+1] - rowptr[r];
+      for (int K=0;K<len;++K)
+        for (int ii=0;ii<bs;++ii)
+          for (int jj=0;jj<bs;++jj) {
+            value_type val = 0.1*random.value();
+            if (colidx[start+K] == r && ii == jj) val += value_type(2.0*bs*7);
+            vals_host(start*bs*bs + K*bs + ii*len*bs + jj) = val;
+          }
+    }
+    Kokkos::deep_copy(rows, rows_host);
+    Kokkos::deep_copy(cols, cols_host);
+    Kokkos::deep_copy(vals, vals_host);
+
+    return BlockCrsMatrixType("A", nrows, nrows, vals.extent(0), vals, rows, cols, bs);
+  }
+
+  template<typename DeviceType,
+           typename ValueType,
+           typename VectorType>
+  void impl_test_batched_block_tridiag(const int ni, const int nj, const int nk,
+                                       const int bs, const int nrhs, const int mode) {
+    typedef KokkosSparse::Experimental::BlockCrsMatrix<ValueType,int,DeviceType> block_crs_matrix_type;
+    typedef BlockTridiagMatrices<VectorType,DeviceType> block_tridiag_matrices_type;
+    typedef Lane<VectorType> lane_type;
+    typedef Kokkos::Details::ArithTraits<ValueType> ats;
+
+    const int vl = lane_type::vector_length;
+    const int ntridiags = ni*nj, npacks = ntridiags/vl + (ntridiags%vl > 0);
+
+    const block_crs_matrix_type A = make_block_tridiag_test_matrix<block_crs_matrix_type>(ni, nj, nk, bs);
+
+    Kokkos::View<int**,Kokkos::LayoutRight,DeviceType> lines("lines", ntridiags, nk);
+    {
+      auto lines_host = Kokkos::create_mirror_view(lines);
+      for (int t=0;t<ntridiags;++t)
+        for (int k=0;k<nk;++k)
+          lines_host(t,k) = t*nk + k;
+      Kokkos::deep_copy(lines, lines_host);
+    }
+
+    block_tridiag_matrices_type
+      T(ntridiags, nk, bs),
+      T0(ntridiags, nk, bs);
+
+    /// test body
+    BlockTridiag::extract(A, lines, T);
+    BlockTridiag::extract(A, lines, T0);
+
+    Kokkos::View<VectorType****,Kokkos::LayoutRight,DeviceType>
+      x("x", npacks, nrhs, nk, bs),
+      b("b", npacks, nrhs, nk, bs);
+    {
+      auto b_host = Kokkos::create_mirror_view(b);
+      for (int p=0;p<npacks;++p)
+        for (int j=0;j<nrhs;++j)
+          for (int k=0;k<nk;++k)
+            for (int i=0;i<bs;++i)
+              for (int s=0;s<vl;++s)
+                lane_type::get(b_host(p,j,k,i), s) = ValueType(double(((p*vl+s)+j+k+i)%7) - 3.0);
+      Kokkos::deep_copy(b, b_host);
+    }
+
+    EXPECT_EQ(BlockTridiag::factorize(T, mode), 0);
+    EXPECT_EQ(BlockTridiag::solve(T, x, b, mode), 0);
+
+    Kokkos::fence();
+
+    auto TA = Kokkos::create_mirror_view(T0.A()); Kokkos::deep_copy(TA, T0.A());
+    auto TB = Kokkos::create_mirror_view(T0.B()); Kokkos::deep_copy(TB, T0.B());
+    auto TC = Kokkos::create_mirror_view(T0.C()); Kokkos::deep_copy(TC, T0.C());
+    auto x_host = Kokkos::create_mirror_view(x); Kokkos::deep_copy(x_host, x);
+    auto b_host = Kokkos::create_mirror_view(b); Kokkos::deep_copy(b_host, b);
+
+    /// check the extracted diagonal against the block crs matrix
+    typedef typename ats::mag_type mag_type;
+    {
+      auto rows = Kokkos::create_mirror_view(A.graph.row_map); Kokkos::deep_copy(rows, A.graph.row_map);
+      auto cols = Kokkos::create_mirror_view(A.graph.entries); Kokkos::deep_copy(cols, A.graph.entries);
+      auto vals = Kokkos::create_mirror_view(A.values);        Kokkos::deep_copy(vals, A.values);
+
+      mag_type diff(0);
+      for (int t=0;t<ntridiags;++t)
+        for (int k=0;k<nk;++k) {
+          const int r = t*nk + k, start = rows(r), len = rows(r+1) - rows(r);
+          for (int K=0;K<len;++K) {
+            if (cols(start+K) != r) continue;
+            for (int ii=0;ii<bs;++ii)
+              for (int jj=0;jj<bs;++jj)
+                diff += ats::abs(lane_type::get(TA(t/vl,k,ii,jj), t%vl) -
+                                 vals(start*bs*bs + K*bs + ii*len*bs + jj));
+          }
+        }
+      EXPECT_EQ( diff, mag_type(0) );
+    }
+
+    /// check the residual T0 x - b
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int t=0;t<ntridiags;++t) {
+      const int p = t/vl, s = t%vl;
+      for (int j=0;j<nrhs;++j)
+        for (int k=0;k<nk;++k)
+          for (int ii=0;ii<bs;++ii) {
+            ValueType r = -lane_type::get(b_host(p,j,k,ii), s);
+            for (int jj=0;jj<bs;++jj) {
+              r += lane_type::get(TA(p,k,ii,jj), s)*lane_type::get(x_host(p,j,k,jj), s);
+              if (k+1 < nk) r += lane_type::get(TB(p,k,  ii,jj), s)*lane_type::get(x_host(p,j,k+1,jj), s);
+              if (k > 0)    r += lane_type::get(TC(p,k-1,ii,jj), s)*lane_type::get(x_host(p,j,k-1,jj), s);
+            }
+            sum  += ats::abs(lane_type::get(b_host(p,j,k,ii), s));
+            diff += ats::abs(r);
+          }
+    }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+template<typename DeviceType,
+         typename ValueType>
+int test_batched_block_tridiag() {
+  typedef Vector<SIMD<ValueType>,DefaultVectorLength<ValueType,typename DeviceType::memory_space>::value> VectorType;
+
+  const int modes[2] = { BlockTridiagMode::Serial,
+                         BlockTridiagMode::Team };
+  for (int p=0;p<2;++p) {
+    Test::impl_test_batched_block_tridiag<DeviceType,ValueType,VectorType>( 3,  4,  2, 5, 2, modes[p]);
+    Test::impl_test_batched_block_tridiag<DeviceType,ValueType,VectorType>( 2,  2, 15, 3, 3, modes[p]);
+    Test::impl_test_batched_block_tridiag<DeviceType,ValueType,VectorType>( 1,  1,  2, 8, 1, modes[p]);
+    Test::impl_test_batched_block_tridiag<DeviceType,ValueType,VectorType>( 5,  3,  1, 4, 1, modes[p]);
+  }
+  // scalar (non compact) storage
+  Test::impl_test_batched_block_tridiag<DeviceType,ValueType,ValueType>(3, 4, 7, 5, 2, BlockTridiagMode::Auto);
+
+  return 0;
+}
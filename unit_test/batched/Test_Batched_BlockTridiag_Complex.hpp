@@ -0,0 +1,6 @@
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_block_tridiag_dcomplex ) {
+  test_batched_block_tridiag<TestExecSpace,Kokkos::complex<double> >();
+}
+#endif
@@ -0,0 +1,6 @@
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_block_tridiag_double ) {
+  test_batched_block_tridiag<TestExecSpace,double>();
+}
+#endif
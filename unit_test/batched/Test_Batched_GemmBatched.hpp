@@ -0,0 +1,230 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_GemmBatched_Decl.hpp"
+#include "KokkosBatched_GemmBatched_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename TA, typename TB>
+  struct ParamTag { 
+    typedef TA transA;
+    typedef TB transB;
+  };
+
+  // host reference on the leading m x n block of C(k,:,:)
+  template<typename ParamTagType,
+           typename ViewType,
+           typename ScalarType>
+  void reference_gemm_batched(const ScalarType alpha,
+                              const ViewType &a,
+                              const ViewType &b,
+                              const ScalarType beta,
+                              const ViewType &c,
+                              const int k, const int m, const int n, const int kk) {
+    typedef typename ViewType::non_const_value_type value_type;
+    const bool transA = std::is_same<typename ParamTagType::transA,Trans::Transpose>::value;
+    const bool transB = std::is_same<typename ParamTagType::transB,Trans::Transpose>::value;
+    for (int i=0;i<m;++i)
+      for (int j=0;j<n;++j) {
+        value_type tmp(0);
+        for (int l=0;l<kk;++l)
+          tmp += (transA ? a(k,l,i) : a(k,i,l))*(transB ? b(k,j,l) : b(k,l,j));
+        c(k,i,j) = beta*c(k,i,j) + alpha*tmp;
+      }
+  }
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename ScalarType,
+           typename ParamTagType>
+  void impl_test_batched_gemm_batched(const int N, const int m, const int n, const int kk, const int mode) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    const bool transA = std::is_same<typename ParamTagType::transA,Trans::Transpose>::value;
+    const bool transB = std::is_same<typename ParamTagType::transB,Trans::Transpose>::value;
+
+    /// randomized input testing views
+    ScalarType alpha = 1.5, beta = 3.0;
+
+    ViewType
+      a("a", N, transA ? kk : m, transA ? m : kk),
+      b("b", N, transB ? n : kk, transB ? kk : n),
+      c("c", N, m, n);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a, random, value_type(1.0));
+    Kokkos::fill_random(b, random, value_type(1.0));
+    Kokkos::fill_random(c, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a_host = Kokkos::create_mirror_view(a);
+    typename ViewType::HostMirror b_host = Kokkos::create_mirror_view(b);
+    typename ViewType::HostMirror c0_host = Kokkos::create_mirror_view(c);
+    typename ViewType::HostMirror c1_host = Kokkos::create_mirror_view(c);
+
+    Kokkos::deep_copy(a_host, a);
+    Kokkos::deep_copy(b_host, b);
+    Kokkos::deep_copy(c0_host, c);
+
+    /// test body
+    const int r_val = gemm_batched<typename ParamTagType::transA,
+                                   typename ParamTagType::transB>(alpha, a, b, beta, c, mode);
+
+    Kokkos::fence();
+
+    // interleaving is not available on every space and value type
+    if (mode == GemmBatchedMode::SerialSIMD && r_val == -1) return;
+    EXPECT_EQ(r_val, 0);
+
+    for (int k=0;k<N;++k)
+      reference_gemm_batched<ParamTagType>(alpha, a_host, b_host, beta, c0_host, k, m, n, kk);
+
+    Kokkos::deep_copy(c1_host, c);
+
+    /// check c0 = c1 ; this eps is about 10^-14
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k) 
+      for (int i=0;i<m;++i) 
+        for (int j=0;j<n;++j) {
+          sum  += ats::abs(c0_host(k,i,j));
+          diff += ats::abs(c0_host(k,i,j)-c1_host(k,i,j));
+        }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename ScalarType,
+           typename ParamTagType>
+  void impl_test_batched_gemm_batched_variable(const int N, const int BlkSize, const int mode) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    /// randomized input testing views
+    ScalarType alpha = 1.5, beta = 3.0;
+
+    ViewType
+      a("a", N, BlkSize, BlkSize),
+      b("b", N, BlkSize, BlkSize),
+      c("c", N, BlkSize, BlkSize);
+    Kokkos::View<int**,Kokkos::LayoutRight,DeviceType> sizes("sizes", N, 3);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a, random, value_type(1.0));
+    Kokkos::fill_random(b, random, value_type(1.0));
+    Kokkos::fill_random(c, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a_host = Kokkos::create_mirror_view(a);
+    typename ViewType::HostMirror b_host = Kokkos::create_mirror_view(b);
+    typename ViewType::HostMirror c0_host = Kokkos::create_mirror_view(c);
+    typename ViewType::HostMirror c1_host = Kokkos::create_mirror_view(c);
+    auto sizes_host = Kokkos::create_mirror_view(sizes);
+
+    // mixed (m,n,k), including empty entries
+    for (int k=0;k<N;++k) {
+      sizes_host(k,0) = (k    )%(BlkSize+1);
+      sizes_host(k,1) = (k*3+1)%(BlkSize+1);
+      sizes_host(k,2) = (k*7+2)%(BlkSize+1);
+    }
+    Kokkos::deep_copy(sizes, sizes_host);
+
+    Kokkos::deep_copy(a_host, a);
+    Kokkos::deep_copy(b_host, b);
+    Kokkos::deep_copy(c0_host, c);
+
+    /// test body
+    const int r_val = gemm_batched<typename ParamTagType::transA,
+                                   typename ParamTagType::transB>(alpha, a, b, beta, c, sizes, mode);
+
+    Kokkos::fence();
+    EXPECT_EQ(r_val, 0);
+
+    for (int k=0;k<N;++k)
+      reference_gemm_batched<ParamTagType>(alpha, a_host, b_host, beta, c0_host, k,
+                                           sizes_host(k,0), sizes_host(k,1), sizes_host(k,2));
+
+    Kokkos::deep_copy(c1_host, c);
+
+    /// check c0 = c1, including the untouched padding
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k) 
+      for (int i=0;i<BlkSize;++i) 
+        for (int j=0;j<BlkSize;++j) {
+          sum  += ats::abs(c0_host(k,i,j));
+          diff += ats::abs(c0_host(k,i,j)-c1_host(k,i,j));
+        }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+template<typename DeviceType, 
+         typename ValueType, 
+         typename ScalarType,
+         typename ParamTagType>
+int test_batched_gemm_batched() {
+  const int modes[4] = { GemmBatchedMode::Auto,
+                         GemmBatchedMode::Serial,
+                         GemmBatchedMode::Team,
+                         GemmBatchedMode::SerialSIMD };
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) 
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    for (int p=0;p<4;++p) {
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(   0, 10, 10, 10, modes[p]);
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(1023,  3,  5,  4, modes[p]);
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(  37, 16, 16, 16, modes[p]);
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(   3, 70, 65, 66, modes[p]);
+    }
+    Test::impl_test_batched_gemm_batched_variable<DeviceType,ViewType,ScalarType,ParamTagType>(0,   10, GemmBatchedMode::Auto);
+    Test::impl_test_batched_gemm_batched_variable<DeviceType,ViewType,ScalarType,ParamTagType>(257, 10, GemmBatchedMode::Auto);
+    Test::impl_test_batched_gemm_batched_variable<DeviceType,ViewType,ScalarType,ParamTagType>(257, 10, GemmBatchedMode::Serial);
+    Test::impl_test_batched_gemm_batched_variable<DeviceType,ViewType,ScalarType,ParamTagType>(257, 10, GemmBatchedMode::Team);
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) 
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    for (int p=0;p<4;++p) {
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(   0, 10, 10, 10, modes[p]);
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(1023,  3,  5,  4, modes[p]);
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(  37, 16, 16, 16, modes[p]);
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(   3, 70, 65, 66, modes[p]);
+    }
+    Test::impl_test_batched_gemm_batched_variable<DeviceType,ViewType,ScalarType,ParamTagType>(0,   10, GemmBatchedMode::Auto);
+    Test::impl_test_batched_gemm_batched_variable<DeviceType,ViewType,ScalarType,ParamTagType>(257, 10, GemmBatchedMode::Auto);
+    Test::impl_test_batched_gemm_batched_variable<DeviceType,ViewType,ScalarType,ParamTagType>(257, 10, GemmBatchedMode::Serial);
+    Test::impl_test_batched_gemm_batched_variable<DeviceType,ViewType,ScalarType,ParamTagType>(257, 10, GemmBatchedMode::Team);
+
+    // SerialSIMD on every requested instruction set; clamped to the compiled and the host sets
+    for (int isa=InstructionSet::Scalar;isa<=InstructionSet::AVX512;++isa) {
+      const int active = set_instruction_set(isa);
+      EXPECT_GE(active, compiled_instruction_set());
+      EXPECT_LE(active, std::max(isa, compiled_instruction_set()));
+      EXPECT_LE(active, std::max(host_instruction_set(), compiled_instruction_set()));
+      Test::impl_test_batched_gemm_batched<DeviceType,ViewType,ScalarType,ParamTagType>(1023,  3,  5,  4, GemmBatchedMode::SerialSIMD);
+    }
+
+    // by default the widest set of the host
+    EXPECT_EQ(set_instruction_set(InstructionSet::Default),
+              std::max(host_instruction_set(), compiled_instruction_set()));
+  }
+#endif
+  
+  return 0;
+}
@@ -0,0 +1,23 @@
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+
+/// dcomplex, dcomplex
+
+TEST_F( TestCategory, batched_scalar_gemm_batched_nt_nt_dcomplex_dcomplex ) {
+  typedef ::Test::ParamTag<Trans::NoTranspose,Trans::NoTranspose> param_tag_type;
+  test_batched_gemm_batched<TestExecSpace,Kokkos::complex<double>,Kokkos::complex<double>,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_gemm_batched_t_nt_dcomplex_dcomplex ) {
+  typedef ::Test::ParamTag<Trans::Transpose,Trans::NoTranspose> param_tag_type;
+  test_batched_gemm_batched<TestExecSpace,Kokkos::complex<double>,Kokkos::complex<double>,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_gemm_batched_nt_t_dcomplex_dcomplex ) {
+  typedef ::Test::ParamTag<Trans::NoTranspose,Trans::Transpose> param_tag_type;
+  test_batched_gemm_batched<TestExecSpace,Kokkos::complex<double>,Kokkos::complex<double>,param_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_gemm_batched_t_t_dcomplex_dcomplex ) {
+  typedef ::Test::ParamTag<Trans::Transpose,Trans::Transpose> param_tag_type;
+  test_batched_gemm_batched<TestExecSpace,Kokkos::complex<double>,Kokkos::complex<double>,param_tag_type>();
+}
+
+#endif
@@ -0,0 +1,208 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_LU_Serial_Impl.hpp"
+#include "KokkosBatched_LU_Team_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename PivViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedSerialLUPivot {
+    ViewType _a;
+    PivViewType _p;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialLUPivot(const ViewType &a, const PivViewType &p)
+      : _a(a), _p(p) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto pp = Kokkos::subview(_p, k, Kokkos::ALL(), Kokkos::ALL());
+
+      SerialLU<AlgoTagType>::invoke(aa, pp);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename PivViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedTeamLUPivot {
+    ViewType _a;
+    PivViewType _p;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedTeamLUPivot(const ViewType &a, const PivViewType &p)
+      : _a(a), _p(p) {}
+
+    template<typename MemberType>
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &member) const {
+      const int k = member.league_rank();
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto pp = Kokkos::subview(_p, k, Kokkos::ALL(), Kokkos::ALL());
+
+      TeamLU<MemberType,AlgoTagType>::invoke(member, aa, pp);
+    }
+
+    inline
+    void run() {
+      const int league_size = _a.extent(0);
+      Kokkos::TeamPolicy<DeviceType> policy(league_size, Kokkos::AUTO);
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  /// | P A - L U | / | A | where P applies the row interchanges of piv
+  template<typename HostViewType,
+           typename PivAccessorType>
+  typename Kokkos::Details::ArithTraits<typename HostViewType::value_type>::mag_type
+  check_batched_lu_pivot(const HostViewType &a, const HostViewType &lu, const PivAccessorType &piv) {
+    typedef typename HostViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+    typedef typename ats::mag_type mag_type;
+
+    const int N = a.extent(0), m = a.extent(1);
+    mag_type sum(1), diff(0);
+
+    std::vector<value_type> pa(m*m);
+    for (int k=0;k<N;++k) {
+      for (int i=0;i<m;++i)
+        for (int j=0;j<m;++j)
+          pa[i*m+j] = a(k,i,j);
+      for (int i=0;i<m;++i) {
+        const int r = piv(k,i);
+        if (r != i)
+          for (int j=0;j<m;++j)
+            std::swap(pa[i*m+j], pa[r*m+j]);
+      }
+      for (int i=0;i<m;++i)
+        for (int j=0;j<m;++j) {
+          const int lend = i < j ? i : j;
+          value_type s = (i <= j ? lu(k,i,j) : value_type(0));
+          for (int l=0;l<lend;++l)
+            s += lu(k,i,l)*lu(k,l,j);
+          if (i > j)
+            s += lu(k,i,j)*lu(k,j,j);
+          sum  += ats::abs(pa[i*m+j]);
+          diff += ats::abs(pa[i*m+j]-s);
+        }
+    }
+    return diff/sum;
+  }
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_lu_pivot(const int N, const int BlkSize, const bool use_team) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    typedef Vector<SIMD<value_type>,DefaultVectorLength<value_type,typename DeviceType::memory_space>::value> vector_type;
+    typedef Kokkos::View<vector_type***,Kokkos::LayoutRight,DeviceType> PackViewType;
+    typedef Kokkos::View<int***,Kokkos::LayoutRight,DeviceType> PivViewType;
+
+    const int vl = vector_type::vector_length;
+    const int npack = N/vl + (N%vl > 0);
+
+    /// randomized input with a zero diagonal, which requires pivoting
+    ViewType
+      a0("a0", N, BlkSize, BlkSize), a1("a1", N, BlkSize, BlkSize), a2("a2", N, BlkSize, BlkSize);
+    PackViewType ap("ap", npack, BlkSize, BlkSize);
+    PivViewType p1("p1", N, BlkSize, 1), pp("pp", npack, BlkSize, vl);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        a0_host(k,i,i) = value_type(0);
+    Kokkos::deep_copy(a0, a0_host);
+
+    Kokkos::deep_copy(a1, a0);
+    pack_compact(a0, ap);
+
+    if (use_team) {
+      Functor_TestBatchedTeamLUPivot<DeviceType,ViewType,PivViewType,AlgoTagType>(a1, p1).run();
+      Functor_TestBatchedTeamLUPivot<DeviceType,PackViewType,PivViewType,AlgoTagType>(ap, pp).run();
+    } else {
+      Functor_TestBatchedSerialLUPivot<DeviceType,ViewType,PivViewType,AlgoTagType>(a1, p1).run();
+      Functor_TestBatchedSerialLUPivot<DeviceType,PackViewType,PivViewType,AlgoTagType>(ap, pp).run();
+    }
+
+    unpack_compact(ap, a2);
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename ViewType::HostMirror a1_host = Kokkos::create_mirror_view(a1);
+    typename ViewType::HostMirror a2_host = Kokkos::create_mirror_view(a2);
+    typename PivViewType::HostMirror p1_host = Kokkos::create_mirror_view(p1);
+    typename PivViewType::HostMirror pp_host = Kokkos::create_mirror_view(pp);
+
+    Kokkos::deep_copy(a1_host, a1);
+    Kokkos::deep_copy(a2_host, a2);
+    Kokkos::deep_copy(p1_host, p1);
+    Kokkos::deep_copy(pp_host, pp);
+
+    /// check P A = L U for scalar and (unpacked) vector factors
+    typedef typename ats::mag_type mag_type;
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    const mag_type err_scalar =
+      check_batched_lu_pivot(a0_host, a1_host, [&](const int k, const int i) { return p1_host(k,i,0); });
+    const mag_type err_vector =
+      check_batched_lu_pivot(a0_host, a2_host, [&](const int k, const int i) { return pp_host(k/vl,i,k%vl); });
+
+    EXPECT_NEAR_KK( err_scalar, 0, eps);
+    EXPECT_NEAR_KK( err_vector, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_lu_pivot(const bool use_team) {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_lu_pivot<DeviceType,ViewType,AlgoTagType>(  0, 10, use_team);
+    for (int i=0;i<10;++i)
+      Test::impl_test_batched_lu_pivot<DeviceType,ViewType,AlgoTagType>(131,  i, use_team);
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_lu_pivot<DeviceType,ViewType,AlgoTagType>(  0, 10, use_team);
+    for (int i=0;i<10;++i)
+      Test::impl_test_batched_lu_pivot<DeviceType,ViewType,AlgoTagType>(131,  i, use_team);
+  }
+#endif
+
+  return 0;
+}
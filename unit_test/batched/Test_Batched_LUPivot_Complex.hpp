@@ -0,0 +1,10 @@
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_serial_lu_pivot_dcomplex ) {
+  test_batched_lu_pivot<TestExecSpace,Kokkos::complex<double>,Algo::LU::Unblocked>(false);
+  test_batched_lu_pivot<TestExecSpace,Kokkos::complex<double>,Algo::LU::Blocked>(false);
+}
+TEST_F( TestCategory, batched_team_lu_pivot_dcomplex ) {
+  test_batched_lu_pivot<TestExecSpace,Kokkos::complex<double>,Algo::LU::Unblocked>(true);
+  test_batched_lu_pivot<TestExecSpace,Kokkos::complex<double>,Algo::LU::Blocked>(true);
+}
+#endif
@@ -0,0 +1,22 @@
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_serial_lu_pivot_float ) {
+  test_batched_lu_pivot<TestExecSpace,float,Algo::LU::Unblocked>(false);
+  test_batched_lu_pivot<TestExecSpace,float,Algo::LU::Blocked>(false);
+}
+TEST_F( TestCategory, batched_team_lu_pivot_float ) {
+  test_batched_lu_pivot<TestExecSpace,float,Algo::LU::Unblocked>(true);
+  test_batched_lu_pivot<TestExecSpace,float,Algo::LU::Blocked>(true);
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_serial_lu_pivot_double ) {
+  test_batched_lu_pivot<TestExecSpace,double,Algo::LU::Unblocked>(false);
+  test_batched_lu_pivot<TestExecSpace,double,Algo::LU::Blocked>(false);
+}
+TEST_F( TestCategory, batched_team_lu_pivot_double ) {
+  test_batched_lu_pivot<TestExecSpace,double,Algo::LU::Unblocked>(true);
+  test_batched_lu_pivot<TestExecSpace,double,Algo::LU::Blocked>(true);
+}
+#endif
@@ -0,0 +1,146 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename PackViewType>
+  void impl_test_batched_pack(const int N, const int m, const int n) {
+    typedef typename ViewType::value_type value_type;
+    typedef typename PackViewType::value_type vector_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    const int vl = vector_type::vector_length;
+    const int npack = N/vl + (N%vl > 0);
+
+    ViewType a("a", N, m, n), b("b", N, m, n);
+    PackViewType ap("ap", npack, m, n);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a, random, value_type(1.0));
+
+    // tail lanes must be zeroed by pack
+    Kokkos::deep_copy(ap, vector_type(value_type(1)));
+
+    Kokkos::fence();
+
+    /// test body
+    pack_compact(a, ap);
+    unpack_compact(ap, b);
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a_host = Kokkos::create_mirror_view(a);
+    typename ViewType::HostMirror b_host = Kokkos::create_mirror_view(b);
+    typename PackViewType::HostMirror ap_host = Kokkos::create_mirror_view(ap);
+
+    Kokkos::deep_copy(a_host, a);
+    Kokkos::deep_copy(b_host, b);
+    Kokkos::deep_copy(ap_host, ap);
+
+    /// check ap(k/vl,i,j)[k%vl] = a(k,i,j) and b = a; copies are exact
+    typedef typename ats::mag_type mag_type;
+    mag_type diff_pack(0), diff_unpack(0), tail(0);
+
+    for (int k=0;k<npack*vl;++k)
+      for (int i=0;i<m;++i)
+        for (int j=0;j<n;++j) {
+          if (k < N) {
+            diff_pack   += ats::abs(ap_host(k/vl,i,j)[k%vl] - a_host(k,i,j));
+            diff_unpack += ats::abs(b_host(k,i,j) - a_host(k,i,j));
+          } else {
+            tail += ats::abs(ap_host(k/vl,i,j)[k%vl]);
+          }
+        }
+    EXPECT_EQ( diff_pack, mag_type(0) );
+    EXPECT_EQ( diff_unpack, mag_type(0) );
+    EXPECT_EQ( tail, mag_type(0) );
+  }
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename PackViewType>
+  void impl_test_batched_pack_rank2(const int N, const int m) {
+    typedef typename ViewType::value_type value_type;
+    typedef typename PackViewType::value_type vector_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    const int vl = vector_type::vector_length;
+    const int npack = N/vl + (N%vl > 0);
+
+    ViewType a("a", N, m), b("b", N, m);
+    PackViewType ap("ap", npack, m);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    /// test body
+    pack_compact(a, ap);
+    unpack_compact(ap, b);
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a_host = Kokkos::create_mirror_view(a);
+    typename ViewType::HostMirror b_host = Kokkos::create_mirror_view(b);
+    typename PackViewType::HostMirror ap_host = Kokkos::create_mirror_view(ap);
+
+    Kokkos::deep_copy(a_host, a);
+    Kokkos::deep_copy(b_host, b);
+    Kokkos::deep_copy(ap_host, ap);
+
+    typedef typename ats::mag_type mag_type;
+    mag_type diff_pack(0), diff_unpack(0);
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<m;++i) {
+        diff_pack   += ats::abs(ap_host(k/vl,i)[k%vl] - a_host(k,i));
+        diff_unpack += ats::abs(b_host(k,i) - a_host(k,i));
+      }
+    EXPECT_EQ( diff_pack, mag_type(0) );
+    EXPECT_EQ( diff_unpack, mag_type(0) );
+  }
+}
+
+template<typename DeviceType,
+         typename ValueType>
+int test_batched_pack() {
+  typedef Vector<SIMD<ValueType>,DefaultVectorLength<ValueType,typename DeviceType::memory_space>::value> vector_type;
+  typedef Kokkos::View<vector_type***,Kokkos::LayoutRight,DeviceType> PackViewType;
+  typedef Kokkos::View<vector_type**, Kokkos::LayoutRight,DeviceType> PackViewRank2Type;
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) 
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    typedef Kokkos::View<ValueType**, Kokkos::LayoutLeft,DeviceType> ViewRank2Type;
+    Test::impl_test_batched_pack<DeviceType,ViewType,PackViewType>(  0, 10, 10);
+    Test::impl_test_batched_pack<DeviceType,ViewType,PackViewType>(  1,  3,  5);
+    Test::impl_test_batched_pack<DeviceType,ViewType,PackViewType>(131,  5,  3);
+    Test::impl_test_batched_pack<DeviceType,ViewType,PackViewType>( 64, 16, 16);
+    Test::impl_test_batched_pack_rank2<DeviceType,ViewRank2Type,PackViewRank2Type>(131, 17);
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) 
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    typedef Kokkos::View<ValueType**, Kokkos::LayoutRight,DeviceType> ViewRank2Type;
+    Test::impl_test_batched_pack<DeviceType,ViewType,PackViewType>(  0, 10, 10);
+    Test::impl_test_batched_pack<DeviceType,ViewType,PackViewType>(  1,  3,  5);
+    Test::impl_test_batched_pack<DeviceType,ViewType,PackViewType>(131,  5,  3);
+    Test::impl_test_batched_pack<DeviceType,ViewType,PackViewType>( 64, 16, 16);
+    Test::impl_test_batched_pack_rank2<DeviceType,ViewRank2Type,PackViewRank2Type>(131, 17);
+  }
+#endif
+  
+  return 0;
+}
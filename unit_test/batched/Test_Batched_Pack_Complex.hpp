@@ -0,0 +1,6 @@
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_pack_dcomplex ) {
+  test_batched_pack<TestExecSpace,Kokkos::complex<double> >();
+}
+#endif
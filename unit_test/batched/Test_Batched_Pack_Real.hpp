@@ -0,0 +1,12 @@
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_pack_float ) {
+  test_batched_pack<TestExecSpace,float>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_pack_double ) {
+  test_batched_pack<TestExecSpace,double>();
+}
+#endif
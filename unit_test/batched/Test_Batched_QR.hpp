@@ -0,0 +1,257 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+#include "KokkosBatched_QR_Decl.hpp"
+#include "KokkosBatched_QR_Serial_Impl.hpp"
+#include "KokkosBatched_QR_Team_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  /// QR of a, C = Q [R; 0] and the least-squares solution of a x = b in b
+  template<typename DeviceType,
+           typename ViewType,
+           typename TauViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedSerialQR {
+    ViewType _a, _b, _c;
+    TauViewType _t;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialQR(const ViewType &a, const TauViewType &t, const ViewType &b, const ViewType &c)
+      : _a(a), _b(b), _c(c), _t(t) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      typedef typename ViewType::non_const_value_type value_type;
+
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+      auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+      auto tt = Kokkos::subview(_t, k, Kokkos::ALL());
+
+      SerialQR<AlgoTagType>::invoke(aa, tt);
+
+      for (int i=0;i<int(cc.extent(0));++i)
+        for (int j=0;j<int(cc.extent(1));++j)
+          cc(i,j) = i <= j ? aa(i,j) : value_type(0);
+      SerialApplyQ<Side::Left,Trans::NoTranspose,AlgoTagType>::invoke(aa, tt, cc);
+
+      SerialQRSolve<AlgoTagType>::invoke(aa, tt, bb);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename TauViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedTeamQR {
+    ViewType _a, _b, _c;
+    TauViewType _t;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedTeamQR(const ViewType &a, const TauViewType &t, const ViewType &b, const ViewType &c)
+      : _a(a), _b(b), _c(c), _t(t) {}
+
+    template<typename MemberType>
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &member) const {
+      typedef typename ViewType::non_const_value_type value_type;
+
+      const int k = member.league_rank();
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL(), Kokkos::ALL());
+      auto cc = Kokkos::subview(_c, k, Kokkos::ALL(), Kokkos::ALL());
+      auto tt = Kokkos::subview(_t, k, Kokkos::ALL());
+
+      TeamQR<MemberType,AlgoTagType>::invoke(member, aa, tt);
+      member.team_barrier();
+
+      const int m = cc.extent(0), n = cc.extent(1);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(member,0,m*n),[&](const int &ij) {
+          const int i = ij/n, j = ij%n;
+          cc(i,j) = i <= j ? aa(i,j) : value_type(0);
+        });
+      member.team_barrier();
+      TeamApplyQ<MemberType,Side::Left,Trans::NoTranspose,AlgoTagType>::invoke(member, aa, tt, cc);
+
+      TeamQRSolve<MemberType,AlgoTagType>::invoke(member, aa, tt, bb);
+    }
+
+    inline
+    void run() {
+      const int league_size = _a.extent(0);
+      Kokkos::TeamPolicy<DeviceType> policy(league_size, Kokkos::AUTO);
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  /// | Q R - A | / | A | and | A^T (A x - b) | / | A^T b |
+  template<typename HostViewType>
+  std::pair<typename Kokkos::Details::ArithTraits<typename HostViewType::value_type>::mag_type,
+            typename Kokkos::Details::ArithTraits<typename HostViewType::value_type>::mag_type>
+  check_batched_qr(const HostViewType &a, const HostViewType &b, const HostViewType &c, const HostViewType &x) {
+    typedef typename HostViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+    typedef typename ats::mag_type mag_type;
+
+    const int N = a.extent(0), m = a.extent(1), n = a.extent(2), nrhs = b.extent(2);
+    mag_type sum_qr(1), diff_qr(0), sum_ls(1), diff_ls(0);
+
+    std::vector<value_type> r(m);
+    for (int k=0;k<N;++k) {
+      for (int i=0;i<m;++i)
+        for (int j=0;j<n;++j) {
+          sum_qr  += ats::abs(a(k,i,j));
+          diff_qr += ats::abs(a(k,i,j)-c(k,i,j));
+        }
+      for (int l=0;l<nrhs;++l) {
+        for (int i=0;i<m;++i) {
+          value_type s = -b(k,i,l);
+          for (int j=0;j<n;++j)
+            s += a(k,i,j)*x(k,j,l);
+          r[i] = s;
+        }
+        for (int j=0;j<n;++j) {
+          value_type s(0), t(0);
+          for (int i=0;i<m;++i) {
+            s += a(k,i,j)*r[i];
+            t += a(k,i,j)*b(k,i,l);
+          }
+          sum_ls  += ats::abs(t);
+          diff_ls += ats::abs(s);
+        }
+      }
+    }
+    return std::make_pair(diff_qr/sum_qr, diff_ls/sum_ls);
+  }
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_qr(const int N, const int m, const int n, const bool use_team) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    typedef Vector<SIMD<value_type>,DefaultVectorLength<value_type,typename DeviceType::memory_space>::value> vector_type;
+    typedef Kokkos::View<vector_type***,Kokkos::LayoutRight,DeviceType> PackViewType;
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> TauViewType;
+    typedef Kokkos::View<vector_type**,Kokkos::LayoutRight,DeviceType> PackTauViewType;
+
+    const int vl = vector_type::vector_length;
+    const int npack = N/vl + (N%vl > 0);
+    const int nrhs = 2;
+
+    /// randomized overdetermined systems with a dominant diagonal
+    ViewType
+      a0("a0", N, m, n), a1("a1", N, m, n), c1("c1", N, m, n), c2("c2", N, m, n),
+      b0("b0", N, m, nrhs), b1("b1", N, m, nrhs), b2("b2", N, m, nrhs);
+    TauViewType t1("t1", N, n);
+    PackViewType ap("ap", npack, m, n), cp("cp", npack, m, n), bp("bp", npack, m, nrhs);
+    PackTauViewType tp("tp", npack, n);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+    Kokkos::fill_random(b0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+    for (int k=0;k<N;++k)
+      for (int i=0;i<n;++i)
+        a0_host(k,i,i) += value_type(1.0*n);
+    Kokkos::deep_copy(a0, a0_host);
+
+    Kokkos::deep_copy(a1, a0);
+    Kokkos::deep_copy(b1, b0);
+    pack_compact(a0, ap);
+    pack_compact(b0, bp);
+
+    if (use_team) {
+      Functor_TestBatchedTeamQR<DeviceType,ViewType,TauViewType,AlgoTagType>(a1, t1, b1, c1).run();
+      Functor_TestBatchedTeamQR<DeviceType,PackViewType,PackTauViewType,AlgoTagType>(ap, tp, bp, cp).run();
+    } else {
+      Functor_TestBatchedSerialQR<DeviceType,ViewType,TauViewType,AlgoTagType>(a1, t1, b1, c1).run();
+      Functor_TestBatchedSerialQR<DeviceType,PackViewType,PackTauViewType,AlgoTagType>(ap, tp, bp, cp).run();
+    }
+
+    unpack_compact(cp, c2);
+    unpack_compact(bp, b2);
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename ViewType::HostMirror b0_host = Kokkos::create_mirror_view(b0);
+    typename ViewType::HostMirror b1_host = Kokkos::create_mirror_view(b1);
+    typename ViewType::HostMirror b2_host = Kokkos::create_mirror_view(b2);
+    typename ViewType::HostMirror c1_host = Kokkos::create_mirror_view(c1);
+    typename ViewType::HostMirror c2_host = Kokkos::create_mirror_view(c2);
+
+    Kokkos::deep_copy(b0_host, b0);
+    Kokkos::deep_copy(b1_host, b1);
+    Kokkos::deep_copy(b2_host, b2);
+    Kokkos::deep_copy(c1_host, c1);
+    Kokkos::deep_copy(c2_host, c2);
+
+    /// check Q R = A and the normal equations for scalar and (unpacked) vector results
+    typedef typename ats::mag_type mag_type;
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    const auto err_scalar = check_batched_qr(a0_host, b0_host, c1_host, b1_host);
+    const auto err_vector = check_batched_qr(a0_host, b0_host, c2_host, b2_host);
+
+    EXPECT_NEAR_KK( err_scalar.first,  0, eps);
+    EXPECT_NEAR_KK( err_scalar.second, 0, eps);
+    EXPECT_NEAR_KK( err_vector.first,  0, eps);
+    EXPECT_NEAR_KK( err_vector.second, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_qr() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(  0, 10, 10, false);
+    Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(  0, 10, 10, true);
+    for (int i=0;i<10;++i) {
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(131,   i, i, false);
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(131,   i, i, true);
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(131, 2*i, i, false);
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(131, 2*i, i, true);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(  0, 10, 10, false);
+    Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(  0, 10, 10, true);
+    for (int i=0;i<10;++i) {
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(131,   i, i, false);
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(131,   i, i, true);
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(131, 2*i, i, false);
+      Test::impl_test_batched_qr<DeviceType,ViewType,AlgoTagType>(131, 2*i, i, true);
+    }
+  }
+#endif
+
+  return 0;
+}
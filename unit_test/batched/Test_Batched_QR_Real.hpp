@@ -0,0 +1,15 @@
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_qr_float ) {
+  typedef Algo::QR::Blocked algo_tag_type;
+  test_batched_qr<TestExecSpace,float,algo_tag_type>();
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_qr_double ) {
+  typedef Algo::QR::Blocked algo_tag_type;
+  test_batched_qr<TestExecSpace,double,algo_tag_type>();
+}
+#endif
@@ -0,0 +1,183 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+#include "KokkosBatched_Cholesky_Decl.hpp"
+#include "KokkosBatched_Cholesky_Serial_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename RhsViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedSerialCholesky {
+    ViewType _a;
+    RhsViewType _b;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialCholesky(const ViewType &a, const RhsViewType &b)
+      : _a(a), _b(b) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto bb = Kokkos::subview(_b, k, Kokkos::ALL());
+
+      SerialCholesky<AlgoTagType>::invoke(aa);
+      SerialCholeskySolve<AlgoTagType>::invoke(aa, bb);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  /// runs the scalar functor, or packs the batch into Vector<SIMD<T>,VectorLength>, runs and unpacks
+  template<typename DeviceType,
+           typename ViewType,
+           typename RhsViewType,
+           typename AlgoTagType,
+           int VectorLength>
+  struct Run_TestBatchedSerialCholesky {
+    static void run(const ViewType &a, const RhsViewType &b) {
+      typedef typename ViewType::value_type value_type;
+      typedef Vector<SIMD<value_type>,VectorLength> vector_type;
+      typedef Kokkos::View<vector_type***,Kokkos::LayoutRight,DeviceType> PackViewType;
+      typedef Kokkos::View<vector_type**,Kokkos::LayoutRight,DeviceType> PackRhsViewType;
+
+      const int N = a.extent(0), BlkSize = a.extent(1);
+      const int npack = N/VectorLength + (N%VectorLength > 0);
+
+      PackViewType ap("ap", npack, BlkSize, BlkSize);
+      PackRhsViewType bp("bp", npack, BlkSize);
+
+      pack_compact(a, ap);
+      pack_compact(b, bp);
+      Functor_TestBatchedSerialCholesky<DeviceType,PackViewType,PackRhsViewType,AlgoTagType>(ap, bp).run();
+      unpack_compact(ap, a);
+      unpack_compact(bp, b);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename RhsViewType,
+           typename AlgoTagType>
+  struct Run_TestBatchedSerialCholesky<DeviceType,ViewType,RhsViewType,AlgoTagType,0> {
+    static void run(const ViewType &a, const RhsViewType &b) {
+      Functor_TestBatchedSerialCholesky<DeviceType,ViewType,RhsViewType,AlgoTagType>(a, b).run();
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType,
+           int VectorLength>
+  void impl_test_batched_cholesky(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> RhsViewType;
+
+    /// randomized input testing views
+    ViewType
+      a0("a0", N, BlkSize, BlkSize), a1("a1", N, BlkSize, BlkSize);
+    RhsViewType
+      b0("b0", N, BlkSize), x1("x1", N, BlkSize);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a1, random, value_type(1.0));
+    Kokkos::fill_random(b0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    /// spd matrices, a0 = a1 a1^T + BlkSize I
+    typename ViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    typename ViewType::HostMirror a1_host = Kokkos::create_mirror_view(a1);
+    Kokkos::deep_copy(a1_host, a1);
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int j=0;j<BlkSize;++j) {
+          value_type s = (i == j ? value_type(BlkSize) : value_type(0));
+          for (int l=0;l<BlkSize;++l)
+            s += a1_host(k,i,l)*a1_host(k,j,l);
+          a0_host(k,i,j) = s;
+        }
+    Kokkos::deep_copy(a0, a0_host);
+    Kokkos::deep_copy(a1, a0);
+    Kokkos::deep_copy(x1, b0);
+
+    Run_TestBatchedSerialCholesky<DeviceType,ViewType,RhsViewType,AlgoTagType,VectorLength>::run(a1, x1);
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename RhsViewType::HostMirror b0_host = Kokkos::create_mirror_view(b0);
+    typename RhsViewType::HostMirror x1_host = Kokkos::create_mirror_view(x1);
+
+    Kokkos::deep_copy(a1_host, a1);
+    Kokkos::deep_copy(b0_host, b0);
+    Kokkos::deep_copy(x1_host, x1);
+
+    /// check a0 = l l^T and a0 x1 = b0
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0), bsum(1), res(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i) {
+        for (int j=0;j<=i;++j) {
+          value_type s(0);
+          for (int l=0;l<=j;++l)
+            s += a1_host(k,i,l)*a1_host(k,j,l);
+          sum  += ats::abs(a0_host(k,i,j));
+          diff += ats::abs(a0_host(k,i,j)-s);
+        }
+        value_type r = b0_host(k,i);
+        for (int j=0;j<BlkSize;++j)
+          r -= a0_host(k,i,j)*x1_host(k,j);
+        bsum += ats::abs(b0_host(k,i));
+        res  += ats::abs(r);
+      }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+    EXPECT_NEAR_KK( res/bsum, 0, eps);
+  }
+}
+
+
+/// VectorLength > 0 runs the kernels on Vector<SIMD<ValueType>,VectorLength>
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType,
+         int VectorLength = 0>
+int test_batched_cholesky() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_cholesky<DeviceType,ViewType,AlgoTagType,VectorLength>(     0, 10);
+    for (int i=0;i<10;++i) {
+      Test::impl_test_batched_cholesky<DeviceType,ViewType,AlgoTagType,VectorLength>(1024,  i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_cholesky<DeviceType,ViewType,AlgoTagType,VectorLength>(     0, 10);
+    for (int i=0;i<10;++i) {
+      Test::impl_test_batched_cholesky<DeviceType,ViewType,AlgoTagType,VectorLength>(1024,  i);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Inverse_Decl.hpp"
+#include "KokkosBatched_Inverse_Serial_Impl.hpp"
+#include "KokkosBatched_Inverse_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedSerialInverse {
+    ViewType _a, _ainv;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialInverse(const ViewType &a, const ViewType &ainv)
+      : _a(a), _ainv(ainv) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a,    k, Kokkos::ALL(), Kokkos::ALL());
+      auto ai = Kokkos::subview(_ainv, k, Kokkos::ALL(), Kokkos::ALL());
+
+      SerialInverse<AlgoTagType>::invoke(aa, ai);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_inverse(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> VectorViewType;
+
+    /// randomized input testing views
+    ViewType
+      a0("a0", N, BlkSize, BlkSize), a1("a1", N, BlkSize, BlkSize),
+      ainv1("ainv1", N, BlkSize, BlkSize), ainv2("ainv2", N, BlkSize, BlkSize);
+    VectorViewType
+      x("x", N, BlkSize), y("y", N, BlkSize);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+    Kokkos::fill_random(x,  random, value_type(1.0));
+
+    Kokkos::fence();
+
+    /// diagonally dominant blocks
+    typename ViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        a0_host(k,i,i) += value_type(1.0*BlkSize);
+    Kokkos::deep_copy(a0, a0_host);
+
+    Kokkos::deep_copy(a1, a0);
+    Functor_TestBatchedSerialInverse<DeviceType,ViewType,AlgoTagType>(a1, ainv1).run();
+
+    /// block diagonal inverse and apply, y = ainv2 x
+    Kokkos::deep_copy(a1, a0);
+    BlockDiagInverse::compute(a1, ainv2);
+    BlockDiagInverse::apply(1.0, ainv2, x, 0.0, y);
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename ViewType::HostMirror ainv1_host = Kokkos::create_mirror_view(ainv1);
+    typename ViewType::HostMirror ainv2_host = Kokkos::create_mirror_view(ainv2);
+    typename VectorViewType::HostMirror x_host = Kokkos::create_mirror_view(x);
+    typename VectorViewType::HostMirror y_host = Kokkos::create_mirror_view(y);
+
+    Kokkos::deep_copy(ainv1_host, ainv1);
+    Kokkos::deep_copy(ainv2_host, ainv2);
+    Kokkos::deep_copy(x_host, x);
+    Kokkos::deep_copy(y_host, y);
+
+    /// check a0 ainv = I, ainv1 = ainv2 and a0 y = x
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0), diff_inv(0), xsum(1), res(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i) {
+        for (int j=0;j<BlkSize;++j) {
+          value_type s(0);
+          for (int l=0;l<BlkSize;++l)
+            s += a0_host(k,i,l)*ainv1_host(k,l,j);
+          sum      += ats::abs(i == j ? value_type(1) : value_type(0));
+          diff     += ats::abs((i == j ? value_type(1) : value_type(0)) - s);
+          diff_inv += ats::abs(ainv1_host(k,i,j) - ainv2_host(k,i,j));
+        }
+        value_type r = x_host(k,i);
+        for (int j=0;j<BlkSize;++j)
+          r -= a0_host(k,i,j)*y_host(k,j);
+        xsum += ats::abs(x_host(k,i));
+        res  += ats::abs(r);
+      }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+    EXPECT_NEAR_KK( diff_inv/sum, 0, eps);
+    EXPECT_NEAR_KK( res/xsum, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_inverse() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_inverse<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<12;++i) {
+      Test::impl_test_batched_inverse<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_inverse<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<12;++i) {
+      Test::impl_test_batched_inverse<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+
+  return 0;
+}
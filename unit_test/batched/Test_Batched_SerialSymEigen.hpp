@@ -0,0 +1,171 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Pack_Decl.hpp"
+#include "KokkosBatched_Pack_Impl.hpp"
+#include "KokkosBatched_SymEigen_Decl.hpp"
+#include "KokkosBatched_SymEigen_Serial_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename EViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedSerialSymEigen {
+    ViewType _a, _v;
+    EViewType _e;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedSerialSymEigen(const ViewType &a, const EViewType &e, const ViewType &v)
+      : _a(a), _v(v), _e(e) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int k) const {
+      auto aa = Kokkos::subview(_a, k, Kokkos::ALL(), Kokkos::ALL());
+      auto ee = Kokkos::subview(_e, k, Kokkos::ALL());
+      auto vv = Kokkos::subview(_v, k, Kokkos::ALL(), Kokkos::ALL());
+
+      SerialSymEigen<AlgoTagType>::invoke(aa, ee, vv);
+    }
+
+    inline
+    void run() {
+      Kokkos::RangePolicy<DeviceType> policy(0, _a.extent(0));
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  /// | A V - V diag(e) | / | A |, | V^T V - I | / m and the number of unsorted eigenvalues
+  template<typename HostViewType,
+           typename HostEViewType>
+  typename Kokkos::Details::ArithTraits<typename HostViewType::value_type>::mag_type
+  check_batched_sym_eigen(const HostViewType &a, const HostEViewType &e, const HostViewType &v) {
+    typedef typename HostViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+    typedef typename ats::mag_type mag_type;
+
+    const int N = a.extent(0), m = a.extent(1);
+    mag_type sum(1), diff(0), orth(0), unsorted(0);
+
+    for (int k=0;k<N;++k) {
+      for (int i=0;i<m;++i)
+        for (int j=0;j<m;++j) {
+          value_type av(0), vv(0);
+          for (int l=0;l<m;++l) {
+            av += a(k,i,l)*v(k,l,j);
+            vv += v(k,l,i)*v(k,l,j);
+          }
+          sum  += ats::abs(a(k,i,j));
+          diff += ats::abs(av - v(k,i,j)*e(k,j));
+          orth += ats::abs(vv - value_type(i == j ? 1 : 0));
+        }
+      for (int i=1;i<m;++i)
+        unsorted += (e(k,i) < e(k,i-1));
+    }
+    return diff/sum + orth/(N*m+1) + unsorted;
+  }
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_sym_eigen(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    typedef Vector<SIMD<value_type>,DefaultVectorLength<value_type,typename DeviceType::memory_space>::value> vector_type;
+    typedef Kokkos::View<vector_type***,Kokkos::LayoutRight,DeviceType> PackViewType;
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> EViewType;
+    typedef Kokkos::View<vector_type**,Kokkos::LayoutRight,DeviceType> PackEViewType;
+
+    const int vl = vector_type::vector_length;
+    const int npack = N/vl + (N%vl > 0);
+
+    /// randomized symmetric input; every fifth matrix is a multiple of the identity
+    ViewType
+      a0("a0", N, BlkSize, BlkSize), a1("a1", N, BlkSize, BlkSize),
+      v1("v1", N, BlkSize, BlkSize), v2("v2", N, BlkSize, BlkSize);
+    EViewType e1("e1", N, BlkSize), e2("e2", N, BlkSize);
+    PackViewType ap("ap", npack, BlkSize, BlkSize), vp("vp", npack, BlkSize, BlkSize);
+    PackEViewType ep("ep", npack, BlkSize);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int j=0;j<i;++j)
+          if (k%5 == 4)
+            a0_host(k,i,j) = a0_host(k,j,i) = value_type(0);
+          else
+            a0_host(k,i,j) = a0_host(k,j,i);
+    for (int k=4;k<N;k+=5)
+      for (int i=0;i<BlkSize;++i)
+        a0_host(k,i,i) = value_type(2.0);
+    Kokkos::deep_copy(a0, a0_host);
+
+    Kokkos::deep_copy(a1, a0);
+    pack_compact(a0, ap);
+
+    Functor_TestBatchedSerialSymEigen<DeviceType,ViewType,EViewType,AlgoTagType>(a1, e1, v1).run();
+    Functor_TestBatchedSerialSymEigen<DeviceType,PackViewType,PackEViewType,AlgoTagType>(ap, ep, vp).run();
+
+    unpack_compact(ep, e2);
+    unpack_compact(vp, v2);
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename EViewType::HostMirror e1_host = Kokkos::create_mirror_view(e1);
+    typename EViewType::HostMirror e2_host = Kokkos::create_mirror_view(e2);
+    typename ViewType::HostMirror v1_host = Kokkos::create_mirror_view(v1);
+    typename ViewType::HostMirror v2_host = Kokkos::create_mirror_view(v2);
+
+    Kokkos::deep_copy(e1_host, e1);
+    Kokkos::deep_copy(e2_host, e2);
+    Kokkos::deep_copy(v1_host, v1);
+    Kokkos::deep_copy(v2_host, v2);
+
+    /// check the decomposition for scalar and (unpacked) vector results
+    typedef typename ats::mag_type mag_type;
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    EXPECT_NEAR_KK( check_batched_sym_eigen(a0_host, e1_host, v1_host), 0, eps);
+    EXPECT_NEAR_KK( check_batched_sym_eigen(a0_host, e2_host, v2_host), 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_sym_eigen() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_sym_eigen<DeviceType,ViewType,AlgoTagType>(  0, 3);
+    for (int i=0;i<10;++i)
+      Test::impl_test_batched_sym_eigen<DeviceType,ViewType,AlgoTagType>(131, i);
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_sym_eigen<DeviceType,ViewType,AlgoTagType>(  0, 3);
+    for (int i=0;i<10;++i)
+      Test::impl_test_batched_sym_eigen<DeviceType,ViewType,AlgoTagType>(131, i);
+  }
+#endif
+
+  return 0;
+}
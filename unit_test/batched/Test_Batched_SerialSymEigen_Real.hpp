@@ -0,0 +1,23 @@
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_serial_sym_eigen_closed_form_float ) {
+  typedef Algo::SymEigen::ClosedForm algo_tag_type;
+  test_batched_sym_eigen<TestExecSpace,float,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_sym_eigen_jacobi_float ) {
+  typedef Algo::SymEigen::Jacobi algo_tag_type;
+  test_batched_sym_eigen<TestExecSpace,float,algo_tag_type>();
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_serial_sym_eigen_closed_form_double ) {
+  typedef Algo::SymEigen::ClosedForm algo_tag_type;
+  test_batched_sym_eigen<TestExecSpace,double,algo_tag_type>();
+}
+TEST_F( TestCategory, batched_scalar_serial_sym_eigen_jacobi_double ) {
+  typedef Algo::SymEigen::Jacobi algo_tag_type;
+  test_batched_sym_eigen<TestExecSpace,double,algo_tag_type>();
+}
+#endif
@@ -0,0 +1,24 @@
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_team_cholesky_float ) {
+  typedef Algo::Cholesky::Blocked algo_tag_type;
+  test_batched_cholesky<TestExecSpace,float,algo_tag_type>();
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_team_cholesky_double ) {
+  typedef Algo::Cholesky::Blocked algo_tag_type;
+  test_batched_cholesky<TestExecSpace,double,algo_tag_type>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_vector_team_cholesky_double ) {
+  typedef Algo::Cholesky::Blocked algo_tag_type;
+  enum : int { vector_length = DefaultVectorLength<double,TestExecSpace::memory_space>::value };
+  test_batched_cholesky<TestExecSpace,double,algo_tag_type,vector_length>();
+  test_batched_cholesky<TestExecSpace,double,algo_tag_type,3>();
+}
+#endif
@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_Inverse_Decl.hpp"
+#include "KokkosBatched_Inverse_Team_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  struct Functor_TestBatchedTeamInverse {
+    ViewType _a, _ainv;
+
+    KOKKOS_INLINE_FUNCTION
+    Functor_TestBatchedTeamInverse(const ViewType &a, const ViewType &ainv)
+      : _a(a), _ainv(ainv) {}
+
+    template<typename MemberType>
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const MemberType &member) const {
+      const int k = member.league_rank();
+      auto aa = Kokkos::subview(_a,    k, Kokkos::ALL(), Kokkos::ALL());
+      auto ai = Kokkos::subview(_ainv, k, Kokkos::ALL(), Kokkos::ALL());
+
+      TeamInverse<MemberType,AlgoTagType>::invoke(member, aa, ai);
+    }
+
+    inline
+    void run() {
+      const int league_size = _a.extent(0);
+      Kokkos::TeamPolicy<DeviceType> policy(league_size, Kokkos::AUTO);
+      Kokkos::parallel_for(policy, *this);
+    }
+  };
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename AlgoTagType>
+  void impl_test_batched_inverse(const int N, const int BlkSize) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+
+    /// randomized input testing views
+    ViewType
+      a0("a0", N, BlkSize, BlkSize), a1("a1", N, BlkSize, BlkSize),
+      ainv1("ainv1", N, BlkSize, BlkSize);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a0, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    /// diagonally dominant blocks
+    typename ViewType::HostMirror a0_host = Kokkos::create_mirror_view(a0);
+    Kokkos::deep_copy(a0_host, a0);
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        a0_host(k,i,i) += value_type(1.0*BlkSize);
+    Kokkos::deep_copy(a0, a0_host);
+
+    Kokkos::deep_copy(a1, a0);
+    Functor_TestBatchedTeamInverse<DeviceType,ViewType,AlgoTagType>(a1, ainv1).run();
+
+    Kokkos::fence();
+
+    /// for comparison send it to host
+    typename ViewType::HostMirror ainv1_host = Kokkos::create_mirror_view(ainv1);
+
+    Kokkos::deep_copy(ainv1_host, ainv1);
+
+    /// check a0 ainv = I
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int j=0;j<BlkSize;++j) {
+          value_type s(0);
+          for (int l=0;l<BlkSize;++l)
+            s += a0_host(k,i,l)*ainv1_host(k,l,j);
+          sum  += ats::abs(i == j ? value_type(1) : value_type(0));
+          diff += ats::abs((i == j ? value_type(1) : value_type(0)) - s);
+        }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+
+template<typename DeviceType,
+         typename ValueType,
+         typename AlgoTagType>
+int test_batched_inverse() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    Test::impl_test_batched_inverse<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<12;++i) {
+      Test::impl_test_batched_inverse<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    Test::impl_test_batched_inverse<DeviceType,ViewType,AlgoTagType>(     0, 10);
+    for (int i=0;i<12;++i) {
+      Test::impl_test_batched_inverse<DeviceType,ViewType,AlgoTagType>(1024,  i);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,7 @@
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE)
+TEST_F( TestCategory, batched_scalar_team_inverse_dcomplex ) {
+  typedef Algo::Inverse::Blocked algo_tag_type;
+  test_batched_inverse<TestExecSpace,Kokkos::complex<double>,algo_tag_type>();
+}
+#endif
@@ -0,0 +1,15 @@
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_team_inverse_float ) {
+  typedef Algo::Inverse::Blocked algo_tag_type;
+  test_batched_inverse<TestExecSpace,float,algo_tag_type>();
+}
+#endif
+
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_team_inverse_double ) {
+  typedef Algo::Inverse::Blocked algo_tag_type;
+  test_batched_inverse<TestExecSpace,double,algo_tag_type>();
+}
+#endif
@@ -0,0 +1,198 @@
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_VariableBatched_Decl.hpp"
+#include "KokkosBatched_VariableBatched_Impl.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched::Experimental;
+
+namespace Test {
+
+  template<typename DeviceType,
+           typename ViewType,
+           typename ScalarType>
+  void impl_test_batched_variable_batched(const int N, const int BlkSize, const int mode) {
+    typedef typename ViewType::value_type value_type;
+    typedef Kokkos::Details::ArithTraits<value_type> ats;
+    typedef Kokkos::View<value_type**,typename ViewType::array_layout,DeviceType> VectorViewType;
+
+    /// randomized input testing views
+    ScalarType alpha = 1.5, beta = 3.0;
+
+    ViewType
+      a("a", N, BlkSize, BlkSize),
+      b("b", N, BlkSize, BlkSize),
+      c("c", N, BlkSize, BlkSize),
+      lu("lu", N, BlkSize, BlkSize);
+    VectorViewType
+      x("x", N, BlkSize),
+      y("y", N, BlkSize),
+      z("z", N, BlkSize);
+    Kokkos::View<int**,Kokkos::LayoutRight,DeviceType> sizes("sizes", N, 3);
+
+    Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(13718);
+    Kokkos::fill_random(a, random, value_type(1.0));
+    Kokkos::fill_random(b, random, value_type(1.0));
+    Kokkos::fill_random(c, random, value_type(1.0));
+    Kokkos::fill_random(x, random, value_type(1.0));
+    Kokkos::fill_random(y, random, value_type(1.0));
+
+    Kokkos::fence();
+
+    typename ViewType::HostMirror a_host = Kokkos::create_mirror_view(a);
+    typename ViewType::HostMirror b_host = Kokkos::create_mirror_view(b);
+    typename ViewType::HostMirror c0_host = Kokkos::create_mirror_view(c);
+    typename ViewType::HostMirror c1_host = Kokkos::create_mirror_view(c);
+    typename ViewType::HostMirror lu_host = Kokkos::create_mirror_view(lu);
+    typename VectorViewType::HostMirror x_host = Kokkos::create_mirror_view(x);
+    typename VectorViewType::HostMirror y0_host = Kokkos::create_mirror_view(y);
+    typename VectorViewType::HostMirror y1_host = Kokkos::create_mirror_view(y);
+    typename VectorViewType::HostMirror z_host = Kokkos::create_mirror_view(z);
+    auto sizes_host = Kokkos::create_mirror_view(sizes);
+
+    // a few recurring (m,n,k) so that buckets have full packs and ragged tails, including empty entries
+    for (int k=0;k<N;++k) {
+      const int s = (k%3 == 0 ? 1 : k);
+      sizes_host(k,0) = (s*5  )%(BlkSize+1);
+      sizes_host(k,1) = (s*3+1)%(BlkSize+1);
+      sizes_host(k,2) = (s*7+2)%(BlkSize+1);
+    }
+    Kokkos::deep_copy(sizes, sizes_host);
+
+    Kokkos::deep_copy(a_host, a);
+    Kokkos::deep_copy(b_host, b);
+    Kokkos::deep_copy(c0_host, c);
+    Kokkos::deep_copy(x_host, x);
+    Kokkos::deep_copy(y0_host, y);
+
+    // diagonally dominant matrices for lu and trsv
+    for (int k=0;k<N;++k)
+      for (int i=0;i<BlkSize;++i)
+        for (int j=0;j<BlkSize;++j)
+          lu_host(k,i,j) = a_host(k,i,j) + value_type(i == j ? 4.0*BlkSize : 0.0);
+    Kokkos::deep_copy(lu, lu_host);
+    Kokkos::deep_copy(z, x);
+
+    /// test body
+    VariableBatch<DeviceType> batch(sizes);
+    EXPECT_EQ(batch.NumEntries(), N);
+
+    const int r_gemm = gemm_variable_batched<Trans::NoTranspose,Trans::Transpose>(batch, alpha, a, b, beta, c, mode);
+    const int r_gemv = gemv_variable_batched<Trans::Transpose>(batch, alpha, a, x, beta, y, mode);
+    const int r_lu   = lu_variable_batched(batch, lu, mode);
+    const int r_l    = trsv_variable_batched<Uplo::Lower,Trans::NoTranspose,Diag::Unit>(batch, ScalarType(1), lu, z, mode);
+    const int r_u    = trsv_variable_batched<Uplo::Upper,Trans::NoTranspose,Diag::NonUnit>(batch, ScalarType(1), lu, z, mode);
+
+    Kokkos::fence();
+
+    // interleaving is not available on every space and value type
+    if (mode == VariableBatchedMode::SerialSIMD && r_gemm == -1) return;
+    EXPECT_EQ(r_gemm, 0);
+    EXPECT_EQ(r_gemv, 0);
+    EXPECT_EQ(r_lu, 0);
+    EXPECT_EQ(r_l, 0);
+    EXPECT_EQ(r_u, 0);
+
+    Kokkos::deep_copy(c1_host, c);
+    Kokkos::deep_copy(y1_host, y);
+    Kokkos::deep_copy(lu_host, lu);
+    Kokkos::deep_copy(z_host, z);
+
+    /// check against host references on the leading blocks; the padding is untouched
+    typedef typename ats::mag_type mag_type;
+    mag_type sum(1), diff(0);
+    const mag_type eps = 1.0e3 * ats::epsilon();
+
+    for (int k=0;k<N;++k) {
+      const int m = sizes_host(k,0), n = sizes_host(k,1), kk = sizes_host(k,2);
+
+      // C = beta C + alpha A B^T
+      for (int i=0;i<BlkSize;++i)
+        for (int j=0;j<BlkSize;++j) {
+          value_type c0 = c0_host(k,i,j);
+          if (i < m && j < n) {
+            value_type tmp(0);
+            for (int l=0;l<kk;++l)
+              tmp += a_host(k,i,l)*b_host(k,j,l);
+            c0 = beta*c0 + alpha*tmp;
+          }
+          sum  += ats::abs(c0);
+          diff += ats::abs(c0 - c1_host(k,i,j));
+        }
+
+      // y = beta y + alpha A^T x
+      for (int j=0;j<BlkSize;++j) {
+        value_type y0 = y0_host(k,j);
+        if (j < n) {
+          value_type tmp(0);
+          for (int i=0;i<m;++i)
+            tmp += a_host(k,i,j)*x_host(k,i);
+          y0 = beta*y0 + alpha*tmp;
+        }
+        sum  += ats::abs(y0);
+        diff += ats::abs(y0 - y1_host(k,j));
+      }
+
+      // A z = x with A = L U
+      for (int i=0;i<BlkSize;++i) {
+        value_type az = z_host(k,i);
+        if (i < m) {
+          az = 0;
+          for (int j=0;j<m;++j)
+            az += (a_host(k,i,j) + value_type(i == j ? 4.0*BlkSize : 0.0))*z_host(k,j);
+        }
+        sum  += ats::abs(x_host(k,i));
+        diff += ats::abs(x_host(k,i) - az);
+      }
+    }
+    EXPECT_NEAR_KK( diff/sum, 0, eps);
+  }
+}
+
+template<typename DeviceType,
+         typename ValueType,
+         typename ScalarType>
+int test_batched_variable_batched() {
+  const int modes[3] = { VariableBatchedMode::Auto,
+                         VariableBatchedMode::Serial,
+                         VariableBatchedMode::SerialSIMD };
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutLeft,DeviceType> ViewType;
+    for (int p=0;p<3;++p) {
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>(  0, 10, modes[p]);
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>(257,  5, modes[p]);
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>(131, 10, modes[p]);
+      // sizes above 16 leave Auto with both Serial and SerialSIMD groups
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>( 97, 20, modes[p]);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType***,Kokkos::LayoutRight,DeviceType> ViewType;
+    for (int p=0;p<3;++p) {
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>(  0, 10, modes[p]);
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>(257,  5, modes[p]);
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>(131, 10, modes[p]);
+      // sizes above 16 leave Auto with both Serial and SerialSIMD groups
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>( 97, 20, modes[p]);
+    }
+
+    // SerialSIMD on every requested instruction set; clamped to the compiled and the host sets
+    for (int isa=InstructionSet::Scalar;isa<=InstructionSet::AVX512;++isa) {
+      const int active = set_instruction_set(isa);
+      EXPECT_GE(active, compiled_instruction_set());
+      EXPECT_LE(active, std::max(isa, compiled_instruction_set()));
+      EXPECT_LE(active, std::max(host_instruction_set(), compiled_instruction_set()));
+      Test::impl_test_batched_variable_batched<DeviceType,ViewType,ScalarType>(131, 10, VariableBatchedMode::SerialSIMD);
+    }
+    set_instruction_set(InstructionSet::Default);
+  }
+#endif
+
+  return 0;
+}
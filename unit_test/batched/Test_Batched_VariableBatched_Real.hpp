@@ -0,0 +1,12 @@
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F( TestCategory, batched_scalar_variable_batched_float_float ) {
+  test_batched_variable_batched<TestExecSpace,float,float>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F( TestCategory, batched_scalar_variable_batched_double_double ) {
+  test_batched_variable_batched<TestExecSpace,double,double>();
+}
+#endif
@@ -176,6 +176,38 @@ namespace Test {
         for (int k=0;k<vector_length;++k) 
           EXPECT_NEAR( ats::abs(c[k]), ats::abs(-a[k]), eps*ats::abs(c[k]));      
       }
+      {
+        /// test : partial vectors, lanes [n,l) keep d or are not stored
+        value_type buf[vector_length];
+        for (int n=0;n<=vector_length;++n) {
+          const vector_type d = c;
+
+          c = mask_add(d, n, a, b);
+          for (int k=0;k<vector_length;++k)
+            EXPECT_NEAR( ats::abs(c[k]), ats::abs(k < n ? a[k]+b[k] : d[k]), eps*ats::abs(c[k]));
+
+          c = mask_sub(d, n, a, b);
+          for (int k=0;k<vector_length;++k)
+            EXPECT_NEAR( ats::abs(c[k]), ats::abs(k < n ? a[k]-b[k] : d[k]), eps*ats::abs(c[k]));
+
+          c = mask_mul(d, n, a, b);
+          for (int k=0;k<vector_length;++k)
+            EXPECT_NEAR( ats::abs(c[k]), ats::abs(k < n ? a[k]*b[k] : d[k]), eps*ats::abs(c[k]));
+
+          c = mask_div(d, n, a, b);
+          for (int k=0;k<vector_length;++k)
+            EXPECT_NEAR( ats::abs(c[k]), ats::abs(k < n ? a[k]/b[k] : d[k]), eps*ats::abs(c[k]));
+
+          for (int k=0;k<vector_length;++k)
+            buf[k] = alpha;
+          a.storeMasked(buf, n);
+          c.loadMasked(buf, n);
+          for (int k=0;k<vector_length;++k) {
+            EXPECT_EQ( buf[k], k < n ? a[k] : alpha );
+            EXPECT_EQ( c[k], k < n ? a[k] : zero );
+          }
+        }
+      }
 #if defined(__DO_NOT_TEST__)
       {
         /// test : add radial
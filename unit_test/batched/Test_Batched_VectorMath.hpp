@@ -134,6 +134,10 @@ TEST_F( TestCategory, batched_vector_math_simd_float3 ) {
 TEST_F( TestCategory, batched_vector_math_simd_float8 ) {
   test_batched_vector_math<TestExecSpace,SIMD<float>,8>();
 }
+// avx 512
+TEST_F( TestCategory, batched_vector_math_simd_float16 ) {
+  test_batched_vector_math<TestExecSpace,SIMD<float>,16>();
+}
 #endif
 
 #if defined(KOKKOSKERNELS_INST_DOUBLE)
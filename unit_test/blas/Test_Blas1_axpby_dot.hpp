@@ -0,0 +1,256 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBlas1_axpby_dot.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  template<class ViewTypeA, class Device>
+  void impl_test_axpby_dot(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+
+    ScalarA a = 3;
+    ScalarA b = -2;
+    double eps = std::is_same<ScalarA,float>::value?2*1e-5:1e-7;
+
+    BaseTypeA b_x("X",N);
+    BaseTypeA b_y("Y",N);
+    BaseTypeA b_w("W",N);
+    BaseTypeA b_org_y("Org_Y",N);
+
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+    ViewTypeA y = Kokkos::subview(b_y,Kokkos::ALL(),0);
+    ViewTypeA w = Kokkos::subview(b_w,Kokkos::ALL(),0);
+    typename ViewTypeA::const_type c_x = x;
+    typename ViewTypeA::const_type c_w = w;
+
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror_view(b_x);
+    typename BaseTypeA::HostMirror h_b_y = Kokkos::create_mirror_view(b_y);
+    typename BaseTypeA::HostMirror h_b_w = Kokkos::create_mirror_view(b_w);
+
+    typename ViewTypeA::HostMirror h_x = Kokkos::subview(h_b_x,Kokkos::ALL(),0);
+    typename ViewTypeA::HostMirror h_y = Kokkos::subview(h_b_y,Kokkos::ALL(),0);
+    typename ViewTypeA::HostMirror h_w = Kokkos::subview(h_b_w,Kokkos::ALL(),0);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_w,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(b_org_y,b_y);
+
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    Kokkos::deep_copy(h_b_w,b_w);
+
+    std::vector<ScalarA> expected_y(N);
+    ScalarA expected_wy = 0;
+    ScalarA expected_yy = 0;
+    ScalarA expected_b0 = 0;
+    double scale_wy = 0, scale_yy = 0, scale_b0 = 0;
+    for(int i=0;i<N;i++) {
+      expected_y[i] = a*h_x(i) + b*h_y(i);
+      expected_wy += AT::conj(h_w(i))*expected_y[i];
+      expected_yy += AT::conj(expected_y[i])*expected_y[i];
+      expected_b0 += AT::conj(h_w(i))*a*h_x(i);
+      scale_wy += AT::abs(h_w(i))*AT::abs(expected_y[i]);
+      scale_yy += AT::abs(expected_y[i])*AT::abs(expected_y[i]);
+      scale_b0 += AT::abs(h_w(i))*AT::abs(a*h_x(i));
+    }
+
+    ScalarA nonconst_result = KokkosBlas::axpby_dot(a,x,b,y,w);
+    EXPECT_NEAR_KK( nonconst_result, expected_wy, eps*scale_wy);
+    Kokkos::deep_copy(h_b_y,b_y);
+    for(int i=0;i<N;i++)
+      EXPECT_NEAR_KK( h_y(i), expected_y[i], eps*AT::abs(expected_y[i]));
+
+    Kokkos::deep_copy(b_y,b_org_y);
+    ScalarA const_result = KokkosBlas::axpby_dot(a,c_x,b,y,c_w);
+    EXPECT_NEAR_KK( const_result, expected_wy, eps*scale_wy);
+
+    // w aliases y: the dot product must see the updated y.
+    Kokkos::deep_copy(b_y,b_org_y);
+    ScalarA alias_result = KokkosBlas::axpby_dot(a,x,b,y,y);
+    EXPECT_NEAR_KK( alias_result, expected_yy, eps*scale_yy);
+
+    // b == 0 must not read y, even if it holds NaN.
+    Kokkos::deep_copy(b_y,AT::nan());
+    ScalarA b0_result = KokkosBlas::axpby_dot(a,x,ScalarA(0),y,w);
+    EXPECT_NEAR_KK( b0_result, expected_b0, eps*scale_b0);
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_axpby_dot_mv(int N, int K) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_x("X",N,K);
+    typename vfA_type::BaseType b_y("Y",N,K);
+    typename vfA_type::BaseType b_w("W",N,K);
+    typename vfA_type::BaseType b_org_y("Org_Y",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeA y = vfA_type::view(b_y);
+    ViewTypeA w = vfA_type::view(b_w);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror_view(b_x);
+    typename h_vfA_type::BaseType h_b_y = Kokkos::create_mirror_view(b_y);
+    typename h_vfA_type::BaseType h_b_w = Kokkos::create_mirror_view(b_w);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+    typename ViewTypeA::HostMirror h_y = h_vfA_type::view(h_b_y);
+    typename ViewTypeA::HostMirror h_w = h_vfA_type::view(h_b_w);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_w,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(b_org_y,b_y);
+
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    Kokkos::deep_copy(h_b_w,b_w);
+
+    ScalarA a = 3;
+    ScalarA b = -2;
+    typename ViewTypeA::const_type c_x = x;
+
+    std::vector<ScalarA> expected_wy(K,ScalarA(0)), expected_yy(K,ScalarA(0));
+    std::vector<double> scale_wy(K,0.0), scale_yy(K,0.0);
+    for(int j=0;j<K;j++) {
+      for(int i=0;i<N;i++) {
+        const ScalarA y_ij = a*h_x(i,j) + b*h_y(i,j);
+        expected_wy[j] += AT::conj(h_w(i,j))*y_ij;
+        expected_yy[j] += AT::conj(y_ij)*y_ij;
+        scale_wy[j] += AT::abs(h_w(i,j))*AT::abs(y_ij);
+        scale_yy[j] += AT::abs(y_ij)*AT::abs(y_ij);
+      }
+    }
+
+    double eps = std::is_same<ScalarA,float>::value?2*1e-5:1e-7;
+
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r("AxpbyDot::Result",K);
+
+    KokkosBlas::axpby_dot(r,a,x,b,y,w);
+    for(int k=0;k<K;k++) {
+      ScalarA nonconst_result = r(k);
+      EXPECT_NEAR_KK( nonconst_result, expected_wy[k], eps*scale_wy[k]);
+    }
+
+    Kokkos::deep_copy(b_y,b_org_y);
+    KokkosBlas::axpby_dot(r,a,c_x,b,y,y);
+    for(int k=0;k<K;k++) {
+      ScalarA alias_result = r(k);
+      EXPECT_NEAR_KK( alias_result, expected_yy[k], eps*scale_yy[k]);
+    }
+  }
+}
+
+
+
+template<class ScalarA, class Device>
+int test_axpby_dot() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_axpby_dot<view_type_a_ll, Device>(0);
+  Test::impl_test_axpby_dot<view_type_a_ll, Device>(13);
+  Test::impl_test_axpby_dot<view_type_a_ll, Device>(1024);
+  Test::impl_test_axpby_dot<view_type_a_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_axpby_dot<view_type_a_lr, Device>(0);
+  Test::impl_test_axpby_dot<view_type_a_lr, Device>(13);
+  Test::impl_test_axpby_dot<view_type_a_lr, Device>(1024);
+  Test::impl_test_axpby_dot<view_type_a_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_axpby_dot<view_type_a_ls, Device>(0);
+  Test::impl_test_axpby_dot<view_type_a_ls, Device>(13);
+  Test::impl_test_axpby_dot<view_type_a_ls, Device>(1024);
+  Test::impl_test_axpby_dot<view_type_a_ls, Device>(132231);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class Device>
+int test_axpby_dot_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_axpby_dot_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_ll, Device>(1024,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_axpby_dot_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_lr, Device>(1024,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_lr, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_axpby_dot_mv<view_type_a_ls, Device>(0,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_ls, Device>(13,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_ls, Device>(1024,5);
+  Test::impl_test_axpby_dot_mv<view_type_a_ls, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, axpby_dot_float ) {
+    test_axpby_dot<float,TestExecSpace> ();
+}
+TEST_F( TestCategory, axpby_dot_mv_float ) {
+    test_axpby_dot_mv<float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, axpby_dot_double ) {
+    test_axpby_dot<double,TestExecSpace> ();
+}
+TEST_F( TestCategory, axpby_dot_mv_double ) {
+    test_axpby_dot_mv<double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, axpby_dot_complex_double ) {
+    test_axpby_dot<Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, axpby_dot_mv_complex_double ) {
+    test_axpby_dot_mv<Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
@@ -1,6 +1,7 @@
 #include<gtest/gtest.h>
 #include<Kokkos_Core.hpp>
 #include<Kokkos_Random.hpp>
+#include<Kokkos_ArithTraits.hpp>
 #include<KokkosBlas1_dot.hpp>
 #include<KokkosKernels_TestUtils.hpp>
 
@@ -137,6 +138,66 @@ namespace Test {
 
     delete [] expected_result;
   }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_dot_multi(int N, int KX, int KY) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_x("X",N,KX);
+    typename vfA_type::BaseType b_y("Y",N,KY);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeA y = vfA_type::view(b_y);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror_view(b_x);
+    typename h_vfA_type::BaseType h_b_y = Kokkos::create_mirror_view(b_y);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+    typename ViewTypeA::HostMirror h_y = h_vfA_type::view(h_b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+
+    typename ViewTypeA::const_type c_x = x;
+    typename ViewTypeA::const_type c_y = y;
+
+    double eps = std::is_same<ScalarA,float>::value?2*1e-5:1e-7;
+
+    // Check the all-pairs result against the column-wise dot, which
+    // is the same computation one column of Y at a time.
+    Kokkos::View<ScalarA**,Kokkos::LayoutLeft,Kokkos::HostSpace> r("Dot::Result",KX,KY);
+    Kokkos::View<ScalarA**,Kokkos::LayoutRight,Kokkos::HostSpace> r_lr("Dot::Result",KX,KY);
+
+    KokkosBlas::dot(r,x,y);
+    KokkosBlas::dot(r_lr,c_x,c_y);
+    for(int j=0;j<KY;j++) {
+      for(int i=0;i<KX;i++) {
+        ScalarA expected_result = ScalarA();
+        double scale = 0;
+        for(int l=0;l<N;l++) {
+          expected_result += AT::conj(h_x(l,i))*h_y(l,j);
+          scale += AT::abs(h_x(l,i))*AT::abs(h_y(l,j));
+        }
+        ScalarA nonconst_nonconst_result = r(i,j);
+        EXPECT_NEAR_KK( nonconst_nonconst_result, expected_result, eps*scale);
+        ScalarA const_const_result = r_lr(i,j);
+        EXPECT_NEAR_KK( const_const_result, expected_result, eps*scale);
+      }
+    }
+  }
 }
 
 template<class ScalarA, class ScalarB, class Device>
@@ -215,6 +276,36 @@ int test_dot_mv() {
   return 1;
 }
 
+template<class ScalarA, class Device>
+int test_dot_multi() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_dot_multi<view_type_a_ll, Device>(0,3,4);
+  Test::impl_test_dot_multi<view_type_a_ll, Device>(13,3,4);
+  Test::impl_test_dot_multi<view_type_a_ll, Device>(1024,1,5);
+  Test::impl_test_dot_multi<view_type_a_ll, Device>(132231,4,4);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_dot_multi<view_type_a_lr, Device>(0,3,4);
+  Test::impl_test_dot_multi<view_type_a_lr, Device>(13,3,4);
+  Test::impl_test_dot_multi<view_type_a_lr, Device>(1024,1,5);
+  Test::impl_test_dot_multi<view_type_a_lr, Device>(132231,4,4);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_dot_multi<view_type_a_ls, Device>(0,3,4);
+  Test::impl_test_dot_multi<view_type_a_ls, Device>(13,3,4);
+  Test::impl_test_dot_multi<view_type_a_ls, Device>(1024,1,5);
+  Test::impl_test_dot_multi<view_type_a_ls, Device>(132231,4,4);
+#endif
+
+  return 1;
+}
+
 #if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, dot_float ) {
     test_dot<float,float,TestExecSpace> ();
@@ -222,6 +313,9 @@ TEST_F( TestCategory, dot_float ) {
 TEST_F( TestCategory, dot_mv_float ) {
     test_dot_mv<float,float,TestExecSpace> ();
 }
+TEST_F( TestCategory, dot_multi_float ) {
+    test_dot_multi<float,TestExecSpace> ();
+}
 #endif
 
 #if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -231,6 +325,9 @@ TEST_F( TestCategory, dot_double ) {
 TEST_F( TestCategory, dot_mv_double ) {
     test_dot_mv<double,double,TestExecSpace> ();
 }
+TEST_F( TestCategory, dot_multi_double ) {
+    test_dot_multi<double,TestExecSpace> ();
+}
 #endif
 
 #if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -240,6 +337,9 @@ TEST_F( TestCategory, dot_complex_double ) {
 TEST_F( TestCategory, dot_mv_complex_double ) {
     test_dot_mv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
 }
+TEST_F( TestCategory, dot_multi_complex_double ) {
+    test_dot_multi<Kokkos::complex<double>,TestExecSpace> ();
+}
 #endif
 
 #if defined(KOKKOSKERNELS_INST_INT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
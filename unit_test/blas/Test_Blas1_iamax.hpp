@@ -0,0 +1,195 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_iamax.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  // Reference i?amax on the host: 1-based index of the first entry
+  // with the largest |Re| + |Im|, or 0 for an empty vector.
+  template<class ViewType>
+  int reference_iamax(const ViewType& h_x) {
+    typedef typename ViewType::non_const_value_type Scalar;
+    typedef Kokkos::Details::ArithTraits<Scalar> AT;
+    typedef Kokkos::Details::ArithTraits<typename AT::mag_type> MAT;
+    const int N = h_x.extent(0);
+    int idx = 0;
+    typename AT::mag_type vmax = 0;
+    for(int i=0;i<N;i++) {
+      const Scalar x = h_x(i);
+      const typename AT::mag_type val = MAT::abs(AT::real(x)) + MAT::abs(AT::imag(x));
+      if(idx == 0 || val > vmax) { vmax = val; idx = i+1; }
+    }
+    return idx;
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_iamax(int N) {
+
+    typedef typename ViewTypeA::non_const_value_type ScalarA;
+    typedef typename ViewTypeA::size_type size_type;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+
+
+    BaseTypeA b_a("A",N);
+
+    ViewTypeA a = Kokkos::subview(b_a,Kokkos::ALL(),0);
+
+    typename BaseTypeA::HostMirror h_b_a = Kokkos::create_mirror_view(b_a);
+
+    typename ViewTypeA::HostMirror h_a = Kokkos::subview(h_b_a,Kokkos::ALL(),0);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_a,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(h_b_a,b_a);
+
+    typename ViewTypeA::const_type c_a = a;
+
+    size_type expected_result = reference_iamax(h_a);
+
+    size_type nonconst_result = KokkosBlas::iamax(a);
+    EXPECT_EQ( nonconst_result, expected_result);
+
+    size_type const_result = KokkosBlas::iamax(c_a);
+    EXPECT_EQ( const_result, expected_result);
+
+    // Ties must go to the first index, whatever the reduction order.
+    if(N > 2) {
+      h_a(N/3) = ScalarA(-20);
+      h_a(2*N/3) = ScalarA(20);
+      Kokkos::deep_copy(b_a,h_b_a);
+      size_type tie_result = KokkosBlas::iamax(a);
+      EXPECT_EQ( tie_result, size_type(N/3+1));
+    }
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_iamax_mv(int N, int K) {
+
+    typedef typename ViewTypeA::non_const_value_type ScalarA;
+    typedef typename ViewTypeA::size_type size_type;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_a("A",N,K);
+
+    ViewTypeA a = vfA_type::view(b_a);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+
+    typename h_vfA_type::BaseType h_b_a = Kokkos::create_mirror_view(b_a);
+
+    typename ViewTypeA::HostMirror h_a = h_vfA_type::view(h_b_a);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_a,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(h_b_a,b_a);
+
+    Kokkos::View<size_type*,Kokkos::HostSpace> r("Iamax::Result",K);
+
+    KokkosBlas::iamax(r,a);
+    for(int k=0;k<K;k++) {
+      size_type expected_result = reference_iamax(Kokkos::subview(h_a,Kokkos::ALL(),k));
+      EXPECT_EQ( r(k), expected_result);
+    }
+  }
+}
+
+template<class ScalarA, class Device>
+int test_iamax() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_iamax<view_type_a_ll, Device>(0);
+  Test::impl_test_iamax<view_type_a_ll, Device>(13);
+  Test::impl_test_iamax<view_type_a_ll, Device>(1024);
+  Test::impl_test_iamax<view_type_a_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_iamax<view_type_a_lr, Device>(0);
+  Test::impl_test_iamax<view_type_a_lr, Device>(13);
+  Test::impl_test_iamax<view_type_a_lr, Device>(1024);
+  Test::impl_test_iamax<view_type_a_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_iamax<view_type_a_ls, Device>(0);
+  Test::impl_test_iamax<view_type_a_ls, Device>(13);
+  Test::impl_test_iamax<view_type_a_ls, Device>(1024);
+  Test::impl_test_iamax<view_type_a_ls, Device>(132231);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class Device>
+int test_iamax_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_iamax_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_iamax_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_iamax_mv<view_type_a_ll, Device>(1024,5);
+  Test::impl_test_iamax_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_iamax_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_iamax_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_iamax_mv<view_type_a_lr, Device>(1024,5);
+  Test::impl_test_iamax_mv<view_type_a_lr, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_iamax_mv<view_type_a_ls, Device>(0,5);
+  Test::impl_test_iamax_mv<view_type_a_ls, Device>(13,5);
+  Test::impl_test_iamax_mv<view_type_a_ls, Device>(1024,5);
+  Test::impl_test_iamax_mv<view_type_a_ls, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, iamax_float ) {
+    test_iamax<float,TestExecSpace> ();
+}
+TEST_F( TestCategory, iamax_mv_float ) {
+    test_iamax_mv<float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, iamax_double ) {
+    test_iamax<double,TestExecSpace> ();
+}
+TEST_F( TestCategory, iamax_mv_double ) {
+    test_iamax_mv<double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, iamax_complex_double ) {
+    test_iamax<Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, iamax_mv_complex_double ) {
+    test_iamax_mv<Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
@@ -0,0 +1,198 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBlas1_reproducible.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  // Reverse the order of the entries of x into y.
+  template<class ViewType>
+  void reproducible_reverse(const ViewType& x, const ViewType& y) {
+    typename ViewType::HostMirror h_x = Kokkos::create_mirror_view(x);
+    typename ViewType::HostMirror h_y = Kokkos::create_mirror_view(y);
+    Kokkos::deep_copy(h_x,x);
+    const int N = x.extent(0);
+    for(int i=0;i<N;i++)
+      h_y(i) = h_x(N-1-i);
+    Kokkos::deep_copy(y,h_y);
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_reproducible(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type MagnitudeA;
+
+    ViewTypeA x("X",N);
+    ViewTypeA y("Y",N);
+    ViewTypeA rx("RX",N);
+    ViewTypeA ry("RY",N);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(y,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    reproducible_reverse(x,rx);
+    reproducible_reverse(y,ry);
+
+    typename ViewTypeA::HostMirror h_x = Kokkos::create_mirror_view(x);
+    typename ViewTypeA::HostMirror h_y = Kokkos::create_mirror_view(y);
+    Kokkos::deep_copy(h_x,x);
+    Kokkos::deep_copy(h_y,y);
+
+    ScalarA expected_dot = 0;
+    ScalarA expected_sum = 0;
+    MagnitudeA expected_nrm2 = 0;
+    double scale_dot = 0, scale_sum = 0;
+    for(int i=0;i<N;i++) {
+      expected_dot += AT::conj(h_x(i))*h_y(i);
+      expected_sum += h_x(i);
+      expected_nrm2 += AT::abs(h_x(i))*AT::abs(h_x(i));
+      scale_dot += AT::abs(h_x(i))*AT::abs(h_y(i));
+      scale_sum += AT::abs(h_x(i));
+    }
+    expected_nrm2 = Kokkos::Details::ArithTraits<MagnitudeA>::sqrt(expected_nrm2);
+
+    double eps = std::is_same<MagnitudeA,float>::value?2*1e-5:1e-7;
+
+    const ScalarA dot_result = KokkosBlas::Experimental::reproducible_dot(x,y);
+    const ScalarA sum_result = KokkosBlas::Experimental::reproducible_sum(x);
+    const MagnitudeA nrm2_result = KokkosBlas::Experimental::reproducible_nrm2(x);
+    EXPECT_NEAR_KK( dot_result, expected_dot, eps*scale_dot);
+    EXPECT_NEAR_KK( sum_result, expected_sum, eps*scale_sum);
+    EXPECT_NEAR_KK( nrm2_result, expected_nrm2, eps*expected_nrm2);
+
+    // The results must not depend on the order of the terms, so
+    // reversing the input must give bitwise the same results.
+    typename ViewTypeA::const_type c_rx = rx;
+    EXPECT_TRUE( KokkosBlas::Experimental::reproducible_dot(c_rx,ry) == dot_result );
+    EXPECT_TRUE( KokkosBlas::Experimental::reproducible_sum(c_rx) == sum_result );
+    EXPECT_TRUE( KokkosBlas::Experimental::reproducible_nrm2(c_rx) == nrm2_result );
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_reproducible_mv(int N, int K) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type MagnitudeA;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_x("X",N,K);
+    typename vfA_type::BaseType b_y("Y",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeA y = vfA_type::view(b_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r_dot("Dot::Result",K);
+    Kokkos::View<ScalarA*,Kokkos::HostSpace> r_sum("Sum::Result",K);
+    Kokkos::View<MagnitudeA*,Kokkos::HostSpace> r_nrm2("Nrm2::Result",K);
+
+    KokkosBlas::Experimental::reproducible_dot(r_dot,x,y);
+    KokkosBlas::Experimental::reproducible_sum(r_sum,x);
+    KokkosBlas::Experimental::reproducible_nrm2(r_nrm2,x);
+
+    // Each column must match, bitwise, the single-vector result on a
+    // contiguous copy of that column.
+    typedef Kokkos::View<ScalarA*,Device> vector_type;
+    vector_type x_j("X_j",N);
+    vector_type y_j("Y_j",N);
+    for(int j=0;j<K;j++) {
+      Kokkos::deep_copy(x_j,Kokkos::subview(x,Kokkos::ALL(),j));
+      Kokkos::deep_copy(y_j,Kokkos::subview(y,Kokkos::ALL(),j));
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_dot(x_j,y_j) == r_dot(j) );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_sum(x_j) == r_sum(j) );
+      EXPECT_TRUE( KokkosBlas::Experimental::reproducible_nrm2(x_j) == r_nrm2(j) );
+    }
+  }
+}
+
+
+
+template<class ScalarA, class Device>
+int test_reproducible() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_reproducible<view_type_a_ll, Device>(0);
+  Test::impl_test_reproducible<view_type_a_ll, Device>(13);
+  Test::impl_test_reproducible<view_type_a_ll, Device>(1024);
+  Test::impl_test_reproducible<view_type_a_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_reproducible<view_type_a_lr, Device>(0);
+  Test::impl_test_reproducible<view_type_a_lr, Device>(13);
+  Test::impl_test_reproducible<view_type_a_lr, Device>(1024);
+  Test::impl_test_reproducible<view_type_a_lr, Device>(132231);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class Device>
+int test_reproducible_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_reproducible_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_reproducible_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_reproducible_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_reproducible_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_reproducible_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_reproducible_mv<view_type_a_lr, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_reproducible_mv<view_type_a_ls, Device>(13,5);
+  Test::impl_test_reproducible_mv<view_type_a_ls, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, reproducible_float ) {
+    test_reproducible<float,TestExecSpace> ();
+}
+TEST_F( TestCategory, reproducible_mv_float ) {
+    test_reproducible_mv<float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, reproducible_double ) {
+    test_reproducible<double,TestExecSpace> ();
+}
+TEST_F( TestCategory, reproducible_mv_double ) {
+    test_reproducible_mv<double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, reproducible_complex_double ) {
+    test_reproducible<Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, reproducible_mv_complex_double ) {
+    test_reproducible_mv<Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
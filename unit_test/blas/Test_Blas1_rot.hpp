@@ -0,0 +1,141 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_rot.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  // A real sine goes to BLAS xROT when it is enabled; a complex one
+  // exercises the native kernel.
+  template<class Scalar>
+  Scalar rot_test_sine(const Scalar&) { return Scalar(0.8); }
+
+  template<class Scalar>
+  Kokkos::complex<Scalar> rot_test_sine(const Kokkos::complex<Scalar>&) {
+    return Kokkos::complex<Scalar>(0.48,0.64);
+  }
+
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_rot(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+    typedef Kokkos::View<ScalarB*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeB::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeB;
+
+
+    BaseTypeA b_x("X",N);
+    BaseTypeB b_y("Y",N);
+    BaseTypeA b_org_x("Org_X",N);
+    BaseTypeB b_org_y("Org_Y",N);
+
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+    ViewTypeB y = Kokkos::subview(b_y,Kokkos::ALL(),0);
+
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror_view(b_x);
+    typename BaseTypeB::HostMirror h_b_y = Kokkos::create_mirror_view(b_y);
+    typename BaseTypeA::HostMirror h_b_org_x = Kokkos::create_mirror_view(b_org_x);
+    typename BaseTypeB::HostMirror h_b_org_y = Kokkos::create_mirror_view(b_org_y);
+
+    typename ViewTypeA::HostMirror h_x = Kokkos::subview(h_b_x,Kokkos::ALL(),0);
+    typename ViewTypeB::HostMirror h_y = Kokkos::subview(h_b_y,Kokkos::ALL(),0);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarB(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(b_org_x,b_x);
+    Kokkos::deep_copy(b_org_y,b_y);
+    Kokkos::deep_copy(h_b_org_x,b_org_x);
+    Kokkos::deep_copy(h_b_org_y,b_org_y);
+
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+    const mag_type c = 0.6;
+    const ScalarA s = rot_test_sine(ScalarA());
+    const ScalarA conj_s = AT::conj(s);
+    double eps = std::is_same<mag_type,float>::value?2*1e-5:1e-7;
+
+    KokkosBlas::rot(x,y,c,s);
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+
+    // The second columns of the base views must be untouched.
+    int num_errors = 0;
+    for(int i=0;i<N;i++) {
+      const ScalarA x0 = h_b_org_x(i,0), y0 = h_b_org_y(i,0);
+      const ScalarA expected_x = ScalarA(c)*x0 + s*y0;
+      const ScalarA expected_y = ScalarA(c)*y0 - conj_s*x0;
+      if(AT::abs(h_x(i) - expected_x) > eps*20) num_errors++;
+      if(AT::abs(h_y(i) - expected_y) > eps*20) num_errors++;
+      if(h_b_x(i,1) != h_b_org_x(i,1) || h_b_y(i,1) != h_b_org_y(i,1)) num_errors++;
+    }
+    EXPECT_EQ(num_errors,0);
+  }
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_rot() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ll, Device>(0);
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ll, Device>(13);
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ll, Device>(1024);
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_rot<view_type_a_lr, view_type_b_lr, Device>(0);
+  Test::impl_test_rot<view_type_a_lr, view_type_b_lr, Device>(13);
+  Test::impl_test_rot<view_type_a_lr, view_type_b_lr, Device>(1024);
+  Test::impl_test_rot<view_type_a_lr, view_type_b_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  typedef Kokkos::View<ScalarB*, Kokkos::LayoutStride, Device> view_type_b_ls;
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ls, Device>(0);
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ls, Device>(13);
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ls, Device>(1024);
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ls, Device>(132231);
+#endif
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS)
+  Test::impl_test_rot<view_type_a_ls, view_type_b_ll, Device>(1024);
+  Test::impl_test_rot<view_type_a_ll, view_type_b_ls, Device>(1024);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, rot_float ) {
+    test_rot<float,float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, rot_double ) {
+    test_rot<double,double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, rot_complex_double ) {
+    test_rot<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
@@ -0,0 +1,135 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_team_iamax.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  template<class ViewTypeA, class Device>
+  void impl_test_team_iamax_mv(int N, int K) {
+
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+
+    //Launch K teams of the maximum number of threads per team
+    const team_policy policy( K, Kokkos::AUTO );
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeA::size_type size_type;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+    typedef Kokkos::Details::ArithTraits<mag_type> MAT;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_a("A",N,K);
+
+    ViewTypeA a = vfA_type::view(b_a);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+
+    typename h_vfA_type::BaseType h_b_a = Kokkos::create_mirror_view(b_a);
+
+    typename ViewTypeA::HostMirror h_a = h_vfA_type::view(h_b_a);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_a,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(h_b_a,b_a);
+
+    // Plant a tie in the first column: the lower index has to win.
+    if(N>2 && K>0) {
+      h_a(N/3,0) = ScalarA(-20);
+      h_a(2*N/3,0) = ScalarA(20);
+      Kokkos::deep_copy(b_a,h_b_a);
+    }
+
+    typename ViewTypeA::const_type c_a = a;
+
+    size_type* expected_result = new size_type[K];
+    for(int j=0;j<K;j++) {
+      expected_result[j] = 0;
+      mag_type vmax = 0;
+      for(int i=0;i<N;i++) {
+        const mag_type val = MAT::abs(AT::real(h_a(i,j))) + MAT::abs(AT::imag(h_a(i,j)));
+        if(expected_result[j] == 0 || val > vmax) { vmax = val; expected_result[j] = i+1; }
+      }
+    }
+
+    Kokkos::View<size_type*,Kokkos::HostSpace> r("Iamax::Result",K);
+    Kokkos::View<size_type*,Device> d_r("Iamax::Result",K);
+
+    //KokkosBlas::iamax(r,a);
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+       const int teamId = teamMember.league_rank();
+       const size_type idx = KokkosBlas::Experimental::iamax(teamMember, Kokkos::subview(a,Kokkos::ALL(),teamId));
+       Kokkos::single(Kokkos::PerTeam(teamMember), [&] () { d_r(teamId) = idx; });
+    } );
+    Kokkos::deep_copy(r,d_r);
+    for(int k=0;k<K;k++)
+      EXPECT_EQ( r(k), expected_result[k]);
+
+    //KokkosBlas::iamax(r,c_a);
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+       const int teamId = teamMember.league_rank();
+       const size_type idx = KokkosBlas::Experimental::iamax(teamMember, Kokkos::subview(c_a,Kokkos::ALL(),teamId));
+       Kokkos::single(Kokkos::PerTeam(teamMember), [&] () { d_r(teamId) = idx; });
+    } );
+    Kokkos::deep_copy(r,d_r);
+    for(int k=0;k<K;k++)
+      EXPECT_EQ( r(k), expected_result[k]);
+
+    delete [] expected_result;
+  }
+}
+
+template<class ScalarA, class Device>
+int test_team_iamax_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_team_iamax_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ll, Device>(1024,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_team_iamax_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_team_iamax_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_team_iamax_mv<view_type_a_lr, Device>(1024,5);
+  Test::impl_test_team_iamax_mv<view_type_a_lr, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_team_iamax_mv<view_type_a_ls, Device>(0,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ls, Device>(13,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ls, Device>(1024,5);
+  Test::impl_test_team_iamax_mv<view_type_a_ls, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_iamax_mv_float ) {
+    test_team_iamax_mv<float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_iamax_mv_double ) {
+    test_team_iamax_mv<double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_iamax_mv_complex_double ) {
+    test_team_iamax_mv<Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
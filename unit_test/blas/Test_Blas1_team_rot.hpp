@@ -0,0 +1,146 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas1_team_rot.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  template<class Scalar>
+  Scalar team_rot_test_sine(const Scalar&) { return Scalar(0.8); }
+
+  template<class Scalar>
+  Kokkos::complex<Scalar> team_rot_test_sine(const Kokkos::complex<Scalar>&) {
+    return Kokkos::complex<Scalar>(0.48,0.64);
+  }
+
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_team_rot_mv(int N, int K) {
+
+    typedef Kokkos::TeamPolicy<Device>        team_policy ;
+    typedef typename team_policy::member_type team_member ;
+
+    //Launch K teams of the maximum number of threads per team
+    const team_policy policy( K, Kokkos::AUTO );
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type mag_type;
+
+    const mag_type c = 0.6;
+    const ScalarA s = team_rot_test_sine(ScalarA());
+    const ScalarA conj_s = AT::conj(s);
+    double eps = std::is_same<mag_type,float>::value?2*1e-5:1e-7;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+    typedef multivector_layout_adapter<ViewTypeB> vfB_type;
+
+    typename vfA_type::BaseType b_x("X",N,K);
+    typename vfB_type::BaseType b_y("Y",N,K);
+    typename vfA_type::BaseType b_org_x("Org_X",N,K);
+    typename vfB_type::BaseType b_org_y("Org_Y",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeB y = vfB_type::view(b_y);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+    typedef multivector_layout_adapter<typename ViewTypeB::HostMirror> h_vfB_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror_view(b_x);
+    typename h_vfB_type::BaseType h_b_y = Kokkos::create_mirror_view(b_y);
+    typename h_vfA_type::BaseType h_b_org_x = Kokkos::create_mirror_view(b_org_x);
+    typename h_vfB_type::BaseType h_b_org_y = Kokkos::create_mirror_view(b_org_y);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+    typename ViewTypeB::HostMirror h_y = h_vfB_type::view(h_b_y);
+    typename ViewTypeA::HostMirror h_org_x = h_vfA_type::view(h_b_org_x);
+    typename ViewTypeB::HostMirror h_org_y = h_vfB_type::view(h_b_org_y);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarB(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(b_org_x,b_x);
+    Kokkos::deep_copy(b_org_y,b_y);
+    Kokkos::deep_copy(h_b_org_x,b_org_x);
+    Kokkos::deep_copy(h_b_org_y,b_org_y);
+
+    //KokkosBlas::rot(x,y,c,s);
+    Kokkos::parallel_for( policy, KOKKOS_LAMBDA ( const team_member &teamMember ) {
+       const int teamId = teamMember.league_rank();
+       KokkosBlas::Experimental::rot(teamMember, Kokkos::subview(x,Kokkos::ALL(),teamId), Kokkos::subview(y,Kokkos::ALL(),teamId), c, s);
+    } );
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+
+    int num_errors = 0;
+    for(int j=0;j<K;j++)
+      for(int i=0;i<N;i++) {
+        const ScalarA x0 = h_org_x(i,j), y0 = h_org_y(i,j);
+        const ScalarA expected_x = ScalarA(c)*x0 + s*y0;
+        const ScalarA expected_y = ScalarA(c)*y0 - conj_s*x0;
+        if(AT::abs(h_x(i,j) - expected_x) > eps*20 ||
+           AT::abs(h_y(i,j) - expected_y) > eps*20) num_errors++;
+      }
+    EXPECT_EQ( num_errors, 0);
+  }
+}
+
+template<class ScalarA, class ScalarB, class Device>
+int test_team_rot_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ll, Device>(0,5);
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ll, Device>(13,5);
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ll, Device>(1024,5);
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_team_rot_mv<view_type_a_lr, view_type_b_lr, Device>(0,5);
+  Test::impl_test_team_rot_mv<view_type_a_lr, view_type_b_lr, Device>(13,5);
+  Test::impl_test_team_rot_mv<view_type_a_lr, view_type_b_lr, Device>(1024,5);
+  Test::impl_test_team_rot_mv<view_type_a_lr, view_type_b_lr, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutStride, Device> view_type_a_ls;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutStride, Device> view_type_b_ls;
+  Test::impl_test_team_rot_mv<view_type_a_ls, view_type_b_ls, Device>(0,5);
+  Test::impl_test_team_rot_mv<view_type_a_ls, view_type_b_ls, Device>(13,5);
+  Test::impl_test_team_rot_mv<view_type_a_ls, view_type_b_ls, Device>(1024,5);
+  Test::impl_test_team_rot_mv<view_type_a_ls, view_type_b_ls, Device>(132231,5);
+#endif
+
+#if !defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS)
+  Test::impl_test_team_rot_mv<view_type_a_ls, view_type_b_ll, Device>(1024,5);
+  Test::impl_test_team_rot_mv<view_type_a_ll, view_type_b_ls, Device>(1024,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_rot_mv_float ) {
+    test_team_rot_mv<float,float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_rot_mv_double ) {
+    test_team_rot_mv<double,double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, team_rot_mv_complex_double ) {
+    test_team_rot_mv<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
@@ -0,0 +1,239 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<Kokkos_ArithTraits.hpp>
+#include<KokkosBlas1_update_nrm2.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+  template<class ViewTypeA, class Device>
+  void impl_test_update_nrm2(int N) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type MagnitudeA;
+
+    typedef Kokkos::View<ScalarA*[2],
+       typename std::conditional<
+                std::is_same<typename ViewTypeA::array_layout,Kokkos::LayoutStride>::value,
+                Kokkos::LayoutRight, Kokkos::LayoutLeft>::type,Device> BaseTypeA;
+
+    ScalarA a = 3;
+    ScalarA b = 5;
+    ScalarA c = -2;
+    double eps = std::is_same<MagnitudeA,float>::value?2*1e-5:1e-7;
+
+    BaseTypeA b_x("X",N);
+    BaseTypeA b_y("Y",N);
+    BaseTypeA b_z("Z",N);
+    BaseTypeA b_org_z("Org_Z",N);
+
+    ViewTypeA x = Kokkos::subview(b_x,Kokkos::ALL(),0);
+    ViewTypeA y = Kokkos::subview(b_y,Kokkos::ALL(),0);
+    ViewTypeA z = Kokkos::subview(b_z,Kokkos::ALL(),0);
+    typename ViewTypeA::const_type c_x = x;
+    typename ViewTypeA::const_type c_y = y;
+
+    typename BaseTypeA::HostMirror h_b_x = Kokkos::create_mirror_view(b_x);
+    typename BaseTypeA::HostMirror h_b_y = Kokkos::create_mirror_view(b_y);
+    typename BaseTypeA::HostMirror h_b_z = Kokkos::create_mirror_view(b_z);
+
+    typename ViewTypeA::HostMirror h_x = Kokkos::subview(h_b_x,Kokkos::ALL(),0);
+    typename ViewTypeA::HostMirror h_y = Kokkos::subview(h_b_y,Kokkos::ALL(),0);
+    typename ViewTypeA::HostMirror h_z = Kokkos::subview(h_b_z,Kokkos::ALL(),0);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_z,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(b_org_z,b_z);
+
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    Kokkos::deep_copy(h_b_z,b_z);
+
+    std::vector<ScalarA> expected_z(N);
+    MagnitudeA expected_result = 0;
+    MagnitudeA expected_c0 = 0;
+    for(int i=0;i<N;i++) {
+      expected_z[i] = a*h_x(i) + b*h_y(i) + c*h_z(i);
+      expected_result += AT::abs(expected_z[i])*AT::abs(expected_z[i]);
+      const ScalarA z_c0 = a*h_x(i) + b*h_y(i);
+      expected_c0 += AT::abs(z_c0)*AT::abs(z_c0);
+    }
+    expected_result = Kokkos::Details::ArithTraits<MagnitudeA>::sqrt(expected_result);
+    expected_c0 = Kokkos::Details::ArithTraits<MagnitudeA>::sqrt(expected_c0);
+
+    MagnitudeA nonconst_result = KokkosBlas::update_nrm2(a,x,b,y,c,z);
+    EXPECT_NEAR_KK( nonconst_result, expected_result, eps*expected_result);
+    Kokkos::deep_copy(h_b_z,b_z);
+    for(int i=0;i<N;i++)
+      EXPECT_NEAR_KK( h_z(i), expected_z[i], eps*AT::abs(expected_z[i]));
+
+    Kokkos::deep_copy(b_z,b_org_z);
+    MagnitudeA const_result = KokkosBlas::update_nrm2(a,c_x,b,c_y,c,z);
+    EXPECT_NEAR_KK( const_result, expected_result, eps*expected_result);
+
+    // gamma == 0 must not read z, even if it holds NaN.
+    Kokkos::deep_copy(b_z,AT::nan());
+    MagnitudeA c0_result = KokkosBlas::update_nrm2(a,x,b,y,ScalarA(0),z);
+    EXPECT_NEAR_KK( c0_result, expected_c0, eps*expected_c0);
+  }
+
+  template<class ViewTypeA, class Device>
+  void impl_test_update_nrm2_mv(int N, int K) {
+
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> AT;
+    typedef typename AT::mag_type MagnitudeA;
+
+    typedef multivector_layout_adapter<ViewTypeA> vfA_type;
+
+    typename vfA_type::BaseType b_x("X",N,K);
+    typename vfA_type::BaseType b_y("Y",N,K);
+    typename vfA_type::BaseType b_z("Z",N,K);
+
+    ViewTypeA x = vfA_type::view(b_x);
+    ViewTypeA y = vfA_type::view(b_y);
+    ViewTypeA z = vfA_type::view(b_z);
+
+    typedef multivector_layout_adapter<typename ViewTypeA::HostMirror> h_vfA_type;
+
+    typename h_vfA_type::BaseType h_b_x = Kokkos::create_mirror_view(b_x);
+    typename h_vfA_type::BaseType h_b_y = Kokkos::create_mirror_view(b_y);
+    typename h_vfA_type::BaseType h_b_z = Kokkos::create_mirror_view(b_z);
+
+    typename ViewTypeA::HostMirror h_x = h_vfA_type::view(h_b_x);
+    typename ViewTypeA::HostMirror h_y = h_vfA_type::view(h_b_y);
+    typename ViewTypeA::HostMirror h_z = h_vfA_type::view(h_b_z);
+
+    Kokkos::Random_XorShift64_Pool<typename Device::execution_space> rand_pool(13718);
+
+    Kokkos::fill_random(b_x,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_y,rand_pool,ScalarA(10));
+    Kokkos::fill_random(b_z,rand_pool,ScalarA(10));
+
+    Kokkos::fence();
+
+    Kokkos::deep_copy(h_b_x,b_x);
+    Kokkos::deep_copy(h_b_y,b_y);
+    Kokkos::deep_copy(h_b_z,b_z);
+
+    ScalarA a = 3;
+    ScalarA b = 5;
+    ScalarA c = -2;
+
+    std::vector<MagnitudeA> expected_result(K,MagnitudeA(0));
+    for(int j=0;j<K;j++) {
+      for(int i=0;i<N;i++) {
+        const ScalarA z_ij = a*h_x(i,j) + b*h_y(i,j) + c*h_z(i,j);
+        expected_result[j] += AT::abs(z_ij)*AT::abs(z_ij);
+      }
+      expected_result[j] = Kokkos::Details::ArithTraits<MagnitudeA>::sqrt(expected_result[j]);
+    }
+
+    double eps = std::is_same<MagnitudeA,float>::value?2*1e-5:1e-7;
+
+    Kokkos::View<MagnitudeA*,Kokkos::HostSpace> r("UpdateNrm2::Result",K);
+
+    typename ViewTypeA::const_type c_x = x;
+    KokkosBlas::update_nrm2(r,a,c_x,b,y,c,z);
+    for(int k=0;k<K;k++) {
+      MagnitudeA nonconst_result = r(k);
+      EXPECT_NEAR_KK( nonconst_result, expected_result[k], eps*expected_result[k]);
+    }
+  }
+}
+
+
+
+template<class ScalarA, class Device>
+int test_update_nrm2() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_update_nrm2<view_type_a_ll, Device>(0);
+  Test::impl_test_update_nrm2<view_type_a_ll, Device>(13);
+  Test::impl_test_update_nrm2<view_type_a_ll, Device>(1024);
+  Test::impl_test_update_nrm2<view_type_a_ll, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_update_nrm2<view_type_a_lr, Device>(0);
+  Test::impl_test_update_nrm2<view_type_a_lr, Device>(13);
+  Test::impl_test_update_nrm2<view_type_a_lr, Device>(1024);
+  Test::impl_test_update_nrm2<view_type_a_lr, Device>(132231);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA*, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_update_nrm2<view_type_a_ls, Device>(0);
+  Test::impl_test_update_nrm2<view_type_a_ls, Device>(13);
+  Test::impl_test_update_nrm2<view_type_a_ls, Device>(1024);
+  Test::impl_test_update_nrm2<view_type_a_ls, Device>(132231);
+#endif
+
+  return 1;
+}
+
+template<class ScalarA, class Device>
+int test_update_nrm2_mv() {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_update_nrm2_mv<view_type_a_ll, Device>(0,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_ll, Device>(13,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_ll, Device>(1024,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_ll, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_update_nrm2_mv<view_type_a_lr, Device>(0,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_lr, Device>(13,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_lr, Device>(1024,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_lr, Device>(132231,5);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTSTRIDE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutStride, Device> view_type_a_ls;
+  Test::impl_test_update_nrm2_mv<view_type_a_ls, Device>(0,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_ls, Device>(13,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_ls, Device>(1024,5);
+  Test::impl_test_update_nrm2_mv<view_type_a_ls, Device>(132231,5);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, update_nrm2_float ) {
+    test_update_nrm2<float,TestExecSpace> ();
+}
+TEST_F( TestCategory, update_nrm2_mv_float ) {
+    test_update_nrm2_mv<float,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, update_nrm2_double ) {
+    test_update_nrm2<double,TestExecSpace> ();
+}
+TEST_F( TestCategory, update_nrm2_mv_double ) {
+    test_update_nrm2_mv<double,TestExecSpace> ();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, update_nrm2_complex_double ) {
+    test_update_nrm2<Kokkos::complex<double>,TestExecSpace> ();
+}
+TEST_F( TestCategory, update_nrm2_mv_complex_double ) {
+    test_update_nrm2_mv<Kokkos::complex<double>,TestExecSpace> ();
+}
+#endif
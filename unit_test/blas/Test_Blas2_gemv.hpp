@@ -28,10 +28,15 @@ namespace Test {
     ScalarX b = 5;
     double eps = std::is_same<ScalarY,float>::value?2*1e-5:1e-7;
 
+    // x has one entry per column of op(A), y one per row of op(A).
+    const bool transposed = (mode[0] != 'N');
+    const int ldx = transposed ? N : M;
+    const int ldy = transposed ? M : N;
+
     typename vfA_type::BaseType b_A("A",N,M);
-    BaseTypeX b_x("X",M);
-    BaseTypeY b_y("Y",N);
-    BaseTypeY b_org_y("Org_Y",N);
+    BaseTypeX b_x("X",ldx);
+    BaseTypeY b_y("Y",ldy);
+    BaseTypeY b_org_y("Org_Y",ldy);
     
 
     ViewTypeA A = vfA_type::view(b_A);
@@ -75,6 +80,17 @@ namespace Test {
         expected_result += (b*h_y(i) + a * y_i) * (b*h_y(i) + a * y_i) ;
       }
     }
+    else {
+      typedef Kokkos::Details::ArithTraits<ScalarA> KAT;
+      for(int j=0;j<M;j++) {
+        ScalarY y_j = ScalarY();
+        for(int i=0; i<N; i++) {
+           y_j += (mode[0]=='C' ? KAT::conj(h_A(i,j)) : h_A(i,j))*h_x(i);
+        }
+        const ScalarY r_j = b*h_y(j) + a * y_j;
+        expected_result += Kokkos::Details::ArithTraits<ScalarY>::conj(r_j) * r_j;
+      }
+    }
 
     KokkosBlas::gemv(mode,a,A,x,b,y);
     ScalarY nonconst_nonconst_result = KokkosBlas::dot(y,y);
@@ -105,6 +121,9 @@ int test_gemv(const char* mode) {
   Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,13,1024);
   Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,1024,1024);
   Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,132231,1024);
+  // Tall-skinny and short-wide shapes
+  Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,200000,32);
+  Test::impl_test_gemv<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(mode,32,200000);
 #endif
 
 #if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
@@ -147,10 +166,19 @@ TEST_F( TestCategory, gemv_double ) {
 }
 #endif
 
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, gemv_double_trans ) {
+    test_gemv<double,double,double,TestExecSpace> ("T");
+}
+#endif
+
 #if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, gemv_complex_double ) {
     test_gemv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("N");
 }
+TEST_F( TestCategory, gemv_complex_double_conj_trans ) {
+    test_gemv<Kokkos::complex<double>,Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("C");
+}
 #endif
 
 #if defined(KOKKOSKERNELS_INST_INT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
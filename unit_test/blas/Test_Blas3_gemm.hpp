@@ -2,6 +2,7 @@
 #include<Kokkos_Core.hpp>
 #include<Kokkos_Random.hpp>
 #include<KokkosBlas3_gemm.hpp>
+#include<KokkosBlas3_gemm_packed_impl.hpp>
 #include<KokkosKernels_TestUtils.hpp>
 
 namespace Test {
@@ -194,6 +195,37 @@ int test_gemm(const char* mode, ScalarA alpha, ScalarB beta) {
   return 1;
 }
 
+// Sizes around the register and cache blocking of the packed host
+// path: partial MR x NR tiles, several MC and KC blocks, and more
+// than one NC block of columns.
+template<class ScalarA, class ScalarB, class ScalarC, class Device>
+int test_gemm_packed(const char* mode, ScalarA alpha, ScalarB beta) {
+  typedef KokkosBlas::Impl::GemmPackedBlocking<ScalarC> blocking_type;
+  const int MR = blocking_type::MR, NR = blocking_type::NR;
+  const int MC = blocking_type::MC, KC = blocking_type::KC, NC = blocking_type::NC;
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  typedef Kokkos::View<ScalarC**, Kokkos::LayoutLeft, Device> view_type_c_ll;
+  Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],MR+1,NR-1,KC-1,alpha,beta);
+  Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],MC+MR+3,2*NR+5,KC+7,alpha,beta);
+  Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],2*MC+1,NR+1,2*KC+1,alpha,beta);
+  Test::impl_test_gemm<view_type_a_ll, view_type_b_ll, view_type_c_ll, Device>(&mode[0],&mode[1],MR-1,NC+NR+1,KC+1,alpha,beta);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutRight, Device> view_type_b_lr;
+  typedef Kokkos::View<ScalarC**, Kokkos::LayoutRight, Device> view_type_c_lr;
+  Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],MR+1,NR-1,KC-1,alpha,beta);
+  Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],MC+MR+3,2*NR+5,KC+7,alpha,beta);
+  Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],2*MC+1,NR+1,2*KC+1,alpha,beta);
+  Test::impl_test_gemm<view_type_a_lr, view_type_b_lr, view_type_c_lr, Device>(&mode[0],&mode[1],MR-1,NC+NR+1,KC+1,alpha,beta);
+#endif
+  return 1;
+}
+
 #if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, gemm_float ) {
   Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_float");
@@ -234,6 +266,26 @@ TEST_F( TestCategory, gemm_double ) {
 }
 #endif
 
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, gemm_double_packed ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_double_packed");
+    double alpha = 5.0;
+    double beta = 3.0;
+    test_gemm_packed<double,double,double,TestExecSpace> ("NN",alpha,beta);
+    test_gemm_packed<double,double,double,TestExecSpace> ("TN",alpha,beta);
+    test_gemm_packed<double,double,double,TestExecSpace> ("NT",alpha,beta);
+    test_gemm_packed<double,double,double,TestExecSpace> ("TT",alpha,beta);
+
+    alpha = 4.5;
+    beta = 0.0;
+    test_gemm_packed<double,double,double,TestExecSpace> ("NN",alpha,beta);
+    test_gemm_packed<double,double,double,TestExecSpace> ("TN",alpha,beta);
+    test_gemm_packed<double,double,double,TestExecSpace> ("NT",alpha,beta);
+    test_gemm_packed<double,double,double,TestExecSpace> ("TT",alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
 #if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 TEST_F( TestCategory, gemm_complex_double ) {
   Kokkos::Profiling::pushRegion("KokkosBlas::Test::gemm_complex_double");
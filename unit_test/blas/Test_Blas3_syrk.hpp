@@ -0,0 +1,181 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas3_syrk.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  // mode[0] is uplo, mode[1] is trans.  For herk, trans "C" is A^H*A
+  // and "N" is A*A^H; for syrk, "T" is A^T*A and "N" is A*A^T.
+  template<class ViewTypeA, class ViewTypeC, class Device>
+  void impl_test_syrk(const char* mode, const bool herm, int N, int K,
+                      typename ViewTypeC::value_type alpha,
+                      typename ViewTypeC::value_type beta) {
+
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeC::value_type ScalarC;
+    typedef Kokkos::Details::ArithTraits<ScalarC> APT;
+    typedef typename APT::mag_type mag_type;
+
+    const bool upper = (mode[0] == 'U') || (mode[0] == 'u');
+    const bool A_t = (mode[1] != 'N') && (mode[1] != 'n');
+    double machine_eps = APT::epsilon();
+
+    ViewTypeA A("A",A_t?K:N,A_t?N:K);
+    ViewTypeC C("C",N,N);
+
+    uint64_t seed = Kokkos::Impl::clock_tic();
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(seed);
+
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::fill_random(C,rand_pool,ScalarC(10));
+
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename ViewTypeC::HostMirror h_C = Kokkos::create_mirror_view(C);
+    typename ViewTypeC::HostMirror h_C0("C0",N,N);
+    Kokkos::deep_copy(h_A,A);
+    Kokkos::deep_copy(h_C0,C);
+
+    if(herm)
+      KokkosBlas::herk(&mode[0],&mode[1],APT::real(alpha),A,APT::real(beta),C);
+    else
+      KokkosBlas::syrk(&mode[0],&mode[1],alpha,A,beta,C);
+
+    Kokkos::fence();
+    Kokkos::deep_copy(h_C,C);
+
+    mag_type diff = 0, norm = 0;
+    int untouched = 0, imag_diag = 0;
+    for(int i = 0; i < N; i++) {
+      for(int j = 0; j < N; j++) {
+        if(upper ? (i > j) : (i < j)) {
+          // The other triangle must not be referenced.
+          untouched += (h_C(i,j) == h_C0(i,j)) ? 0 : 1;
+          continue;
+        }
+        ScalarC sum = APT::zero();
+        for(int k = 0; k < K; k++) {
+          const ScalarC a_ik = A_t ? h_A(k,i) : h_A(i,k);
+          const ScalarC a_jk = A_t ? h_A(k,j) : h_A(j,k);
+          const ScalarC left = (herm && A_t) ? APT::conj(a_ik) : a_ik;
+          const ScalarC right = (herm && !A_t) ? APT::conj(a_jk) : a_jk;
+          sum += left*right;
+        }
+        ScalarC expected = alpha*sum + beta*h_C0(i,j);
+        if(herm && i == j) {
+          // herk ignores the imaginary part of the diagonal and sets it to zero.
+          expected = APT::real(expected);
+          imag_diag += (APT::imag(h_C(i,i)) == 0) ? 0 : 1;
+        }
+        diff += APT::abs(h_C(i,j) - expected);
+        norm += APT::abs(expected);
+      }
+    }
+
+    EXPECT_EQ( untouched, 0 );
+    EXPECT_EQ( imag_diag, 0 );
+    if( N!=0 ) {
+      EXPECT_TRUE( (diff <= 10*(K+1)*machine_eps*norm) );
+    }
+  }
+}
+
+
+
+template<class ScalarA, class ScalarC, class Device>
+int test_syrk(const char* mode, const bool herm, ScalarC alpha, ScalarC beta) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarC**, Kokkos::LayoutLeft, Device> view_type_c_ll;
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(mode,herm,0,0,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(mode,herm,13,0,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(mode,herm,13,15,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(mode,herm,64,1000,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(mode,herm,8,100000,alpha,beta);
+  Test::impl_test_syrk<view_type_a_ll, view_type_c_ll, Device>(mode,herm,179,211,alpha,beta);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarC**, Kokkos::LayoutRight, Device> view_type_c_lr;
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(mode,herm,0,0,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(mode,herm,13,0,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(mode,herm,13,15,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(mode,herm,64,1000,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(mode,herm,8,100000,alpha,beta);
+  Test::impl_test_syrk<view_type_a_lr, view_type_c_lr, Device>(mode,herm,179,211,alpha,beta);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syrk_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_float");
+    float alpha = 5.0f;
+    float beta = 3.0f;
+    test_syrk<float,float,TestExecSpace> ("UT",false,alpha,beta);
+    test_syrk<float,float,TestExecSpace> ("LT",false,alpha,beta);
+    test_syrk<float,float,TestExecSpace> ("UN",false,alpha,beta);
+    test_syrk<float,float,TestExecSpace> ("LN",false,alpha,beta);
+
+    beta = 0.0f;
+    test_syrk<float,float,TestExecSpace> ("UT",false,alpha,beta);
+    test_syrk<float,float,TestExecSpace> ("LN",false,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syrk_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_double");
+    double alpha = 5.0;
+    double beta = 3.0;
+    test_syrk<double,double,TestExecSpace> ("UT",false,alpha,beta);
+    test_syrk<double,double,TestExecSpace> ("LT",false,alpha,beta);
+    test_syrk<double,double,TestExecSpace> ("UN",false,alpha,beta);
+    test_syrk<double,double,TestExecSpace> ("LN",false,alpha,beta);
+
+    beta = 0.0;
+    test_syrk<double,double,TestExecSpace> ("UT",false,alpha,beta);
+    test_syrk<double,double,TestExecSpace> ("LN",false,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syrk_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_complex_double");
+    Kokkos::complex<double> alpha = Kokkos::complex<double>(5.0,-1.0);
+    Kokkos::complex<double> beta = Kokkos::complex<double>(3.0,2.0);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("UT",false,alpha,beta);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LN",false,alpha,beta);
+
+    alpha = 5.0;
+    beta = 3.0;
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("UC",true,alpha,beta);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LC",true,alpha,beta);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("UN",true,alpha,beta);
+    test_syrk<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LN",true,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, syrk_complex_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::syrk_complex_float");
+    Kokkos::complex<float> alpha = Kokkos::complex<float>(5.0f,-1.0f);
+    Kokkos::complex<float> beta = Kokkos::complex<float>(3.0f,2.0f);
+    test_syrk<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("UT",false,alpha,beta);
+    test_syrk<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LN",false,alpha,beta);
+
+    alpha = 5.0f;
+    beta = 3.0f;
+    test_syrk<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("UC",true,alpha,beta);
+    test_syrk<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LN",true,alpha,beta);
+  Kokkos::Profiling::popRegion();
+}
+#endif
@@ -0,0 +1,227 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas3_trsm.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  // Host reference for op(A)*X (left) or X*op(A) (right), reading only
+  // the triangle of A selected by uplo and honoring an implicit unit
+  // diagonal.
+  template<class HostViewTypeA, class HostViewTypeB>
+  void vanilla_trsm_product(const char* mode,
+                            const HostViewTypeA& A, const HostViewTypeB& X,
+                            const HostViewTypeB& Y) {
+    typedef typename HostViewTypeB::non_const_value_type ScalarB;
+    typedef Kokkos::Details::ArithTraits<ScalarB> APT;
+
+    const bool left  = (mode[0] == 'L') || (mode[0] == 'l');
+    const bool lower = (mode[1] == 'L') || (mode[1] == 'l');
+    const bool A_t   = (mode[2] != 'N') && (mode[2] != 'n');
+    const bool A_c   = (mode[2] == 'C') || (mode[2] == 'c');
+    const bool unit  = (mode[3] == 'U') || (mode[3] == 'u');
+
+    const int M = X.extent(0);
+    const int N = X.extent(1);
+    const int K = A.extent(0);
+
+    auto opA = [&] (const int i, const int j) -> ScalarB {
+      const int r = A_t ? j : i;
+      const int c = A_t ? i : j;
+      if(r == c && unit) return APT::one();
+      if(lower ? (r < c) : (r > c)) return APT::zero();
+      return A_c ? APT::conj(A(r,c)) : ScalarB(A(r,c));
+    };
+
+    for(int i = 0; i < M; i++) {
+      for(int j = 0; j < N; j++) {
+        ScalarB sum = APT::zero();
+        for(int k = 0; k < K; k++)
+          sum += left ? opA(i,k)*X(k,j) : X(i,k)*opA(k,j);
+        Y(i,j) = sum;
+      }
+    }
+  }
+
+  template<class ViewTypeA, class ViewTypeB, class Device>
+  void impl_test_trsm(const char* mode, int M, int N,
+                      typename ViewTypeB::value_type alpha) {
+
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef typename ViewTypeB::value_type ScalarB;
+    typedef Kokkos::Details::ArithTraits<ScalarB> APT;
+    typedef typename APT::mag_type mag_type;
+
+    const bool left = (mode[0] == 'L') || (mode[0] == 'l');
+    const int K = left ? M : N;
+    double machine_eps = APT::epsilon();
+
+    ViewTypeA A("A",K,K);
+    ViewTypeB B("B",M,N);
+    ViewTypeB X("X",M,N);
+
+    uint64_t seed = Kokkos::Impl::clock_tic();
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(seed);
+
+    Kokkos::fill_random(A,rand_pool,ScalarA(1));
+    Kokkos::fill_random(X,rand_pool,ScalarB(10));
+
+    typename ViewTypeA::HostMirror h_A = Kokkos::create_mirror_view(A);
+    typename ViewTypeB::HostMirror h_X = Kokkos::create_mirror_view(X);
+    typename ViewTypeB::HostMirror h_B = Kokkos::create_mirror_view(B);
+    typename ViewTypeB::HostMirror h_Bref("Bref",M,N);
+    Kokkos::deep_copy(h_A,A);
+    Kokkos::deep_copy(h_X,X);
+
+    // Keep op(A) well conditioned: small off-diagonal entries and a
+    // diagonal bounded away from zero.
+    for(int i = 0; i < K; i++)
+      for(int j = 0; j < K; j++)
+        h_A(i,j) = (i == j) ? ScalarA(1) + h_A(i,j) : h_A(i,j)/ScalarA(K);
+    Kokkos::deep_copy(A,h_A);
+
+    // B = op(A)*X (or X*op(A)) is built on the host, so the solve must
+    // return alpha*X.
+    vanilla_trsm_product(mode,h_A,h_X,h_Bref);
+    Kokkos::deep_copy(h_B,h_Bref);
+    Kokkos::deep_copy(B,h_B);
+
+    KokkosBlas::trsm(&mode[0],&mode[1],&mode[2],&mode[3],alpha,A,B);
+
+    Kokkos::fence();
+    Kokkos::deep_copy(h_B,B);
+
+    mag_type diff = 0, norm = 0;
+    for(int i = 0; i < M; i++) {
+      for(int j = 0; j < N; j++) {
+        const ScalarB expected = alpha*h_X(i,j);
+        diff += APT::abs(h_B(i,j) - expected);
+        norm += APT::abs(expected);
+      }
+    }
+
+    if( M!=0 && N!=0 ) {
+      // The error of a well conditioned triangular trsm grows at most
+      // linearly with the size of A.
+      EXPECT_TRUE( (diff <= 100*K*machine_eps*norm) );
+    }
+  }
+}
+
+
+
+template<class ScalarA, class ScalarB, class Device>
+int test_trsm(const char* mode, ScalarB alpha) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutLeft, Device> view_type_b_ll;
+  Test::impl_test_trsm<view_type_a_ll, view_type_b_ll, Device>(mode,0,0,alpha);
+  Test::impl_test_trsm<view_type_a_ll, view_type_b_ll, Device>(mode,13,15,alpha);
+  Test::impl_test_trsm<view_type_a_ll, view_type_b_ll, Device>(mode,179,15,alpha);
+  Test::impl_test_trsm<view_type_a_ll, view_type_b_ll, Device>(mode,15,179,alpha);
+  Test::impl_test_trsm<view_type_a_ll, view_type_b_ll, Device>(mode,200,300,alpha);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  typedef Kokkos::View<ScalarB**, Kokkos::LayoutRight, Device> view_type_b_lr;
+  Test::impl_test_trsm<view_type_a_lr, view_type_b_lr, Device>(mode,0,0,alpha);
+  Test::impl_test_trsm<view_type_a_lr, view_type_b_lr, Device>(mode,13,15,alpha);
+  Test::impl_test_trsm<view_type_a_lr, view_type_b_lr, Device>(mode,179,15,alpha);
+  Test::impl_test_trsm<view_type_a_lr, view_type_b_lr, Device>(mode,15,179,alpha);
+  Test::impl_test_trsm<view_type_a_lr, view_type_b_lr, Device>(mode,200,300,alpha);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trsm_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trsm_float");
+    float alpha = 4.5f;
+    test_trsm<float,float,TestExecSpace> ("LLNN",alpha);
+    test_trsm<float,float,TestExecSpace> ("LUNN",alpha);
+    test_trsm<float,float,TestExecSpace> ("LLTN",alpha);
+    test_trsm<float,float,TestExecSpace> ("LUTN",alpha);
+    test_trsm<float,float,TestExecSpace> ("RLNN",alpha);
+    test_trsm<float,float,TestExecSpace> ("RUNN",alpha);
+    test_trsm<float,float,TestExecSpace> ("RLTN",alpha);
+    test_trsm<float,float,TestExecSpace> ("RUTN",alpha);
+    test_trsm<float,float,TestExecSpace> ("LLNU",alpha);
+    test_trsm<float,float,TestExecSpace> ("RUTU",alpha);
+
+    alpha = 1.0f;
+    test_trsm<float,float,TestExecSpace> ("LLNN",alpha);
+    test_trsm<float,float,TestExecSpace> ("RUNN",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trsm_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trsm_double");
+    double alpha = 4.5;
+    test_trsm<double,double,TestExecSpace> ("LLNN",alpha);
+    test_trsm<double,double,TestExecSpace> ("LUNN",alpha);
+    test_trsm<double,double,TestExecSpace> ("LLTN",alpha);
+    test_trsm<double,double,TestExecSpace> ("LUTN",alpha);
+    test_trsm<double,double,TestExecSpace> ("RLNN",alpha);
+    test_trsm<double,double,TestExecSpace> ("RUNN",alpha);
+    test_trsm<double,double,TestExecSpace> ("RLTN",alpha);
+    test_trsm<double,double,TestExecSpace> ("RUTN",alpha);
+    test_trsm<double,double,TestExecSpace> ("LLNU",alpha);
+    test_trsm<double,double,TestExecSpace> ("RUTU",alpha);
+
+    alpha = 1.0;
+    test_trsm<double,double,TestExecSpace> ("LLNN",alpha);
+    test_trsm<double,double,TestExecSpace> ("RUNN",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trsm_complex_double ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trsm_complex_double");
+    Kokkos::complex<double> alpha = Kokkos::complex<double>(4.5,-1.0);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LLNN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LUNN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LLCN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LUCN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("RLNN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("RUNN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("RLCN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("RUCN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LLNU",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("RUCU",alpha);
+
+    alpha = Kokkos::complex<double>(1);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("LLNN",alpha);
+    test_trsm<Kokkos::complex<double>,Kokkos::complex<double>,TestExecSpace> ("RUNN",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, trsm_complex_float ) {
+  Kokkos::Profiling::pushRegion("KokkosBlas::Test::trsm_complex_float");
+    Kokkos::complex<float> alpha = Kokkos::complex<float>(4.5f,-1.0f);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LLNN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LUNN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LLCN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LUCN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("RLNN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("RUNN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("RLCN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("RUCN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LLNU",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("RUCU",alpha);
+
+    alpha = Kokkos::complex<float>(1);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("LLNN",alpha);
+    test_trsm<Kokkos::complex<float>,Kokkos::complex<float>,TestExecSpace> ("RUNN",alpha);
+  Kokkos::Profiling::popRegion();
+}
+#endif
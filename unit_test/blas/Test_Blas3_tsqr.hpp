@@ -0,0 +1,145 @@
+#include<gtest/gtest.h>
+#include<Kokkos_Core.hpp>
+#include<Kokkos_Random.hpp>
+#include<KokkosBlas3_tsqr.hpp>
+#include<KokkosBlas3_cholqr2.hpp>
+#include<KokkosKernels_TestUtils.hpp>
+
+namespace Test {
+
+  // Factor A = Q*R with tsqr (cholqr = false) or cholqr2 (cholqr =
+  // true), and check that Q^H Q = I, Q R = A and R is upper
+  // triangular.
+  template<class ViewTypeA, class Device>
+  void impl_test_tsqr(const bool cholqr, int M, int N) {
+
+    typedef typename ViewTypeA::device_type::execution_space execution_space;
+    typedef typename ViewTypeA::value_type ScalarA;
+    typedef Kokkos::Details::ArithTraits<ScalarA> APT;
+    typedef typename APT::mag_type mag_type;
+
+    const double tol = 1000.0*APT::epsilon()*(N+1);
+
+    ViewTypeA A("A",M,N);
+    ViewTypeA R("R",N,N);
+
+    // A fixed seed and a well-conditioned A: cholqr2 gives up once
+    // cond(A) exceeds about 1/sqrt(eps), which random all-positive
+    // entries can reach in single precision.
+    Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+
+    ViewTypeA A1("A1",M,N);
+    Kokkos::fill_random(A,rand_pool,ScalarA(10));
+    Kokkos::fill_random(A1,rand_pool,ScalarA(10));
+    Kokkos::fill_random(R,rand_pool,ScalarA(10));
+
+    // Zero-mean entries, with the leading N x N block made strictly
+    // diagonally dominant.
+    typename ViewTypeA::HostMirror h_A0("A0",M,N);
+    typename ViewTypeA::HostMirror h_A1 = Kokkos::create_mirror_view(A1);
+    Kokkos::deep_copy(h_A0,A);
+    Kokkos::deep_copy(h_A1,A1);
+    for(int i=0; i<M; i++)
+      for(int j=0; j<N; j++)
+        h_A0(i,j) = h_A0(i,j) - h_A1(i,j) + (i == j ? ScalarA(20*N) : APT::zero());
+    Kokkos::deep_copy(A,h_A0);
+
+    if(cholqr)
+      KokkosBlas::cholqr2(A,R);
+    else
+      KokkosBlas::tsqr(A,R);
+
+    typename ViewTypeA::HostMirror h_Q = Kokkos::create_mirror_view(A);
+    typename ViewTypeA::HostMirror h_R = Kokkos::create_mirror_view(R);
+    Kokkos::deep_copy(h_Q,A);
+    Kokkos::deep_copy(h_R,R);
+
+    mag_type a_max = 0;
+    for(int i=0; i<M; i++)
+      for(int j=0; j<N; j++)
+        if(APT::abs(h_A0(i,j)) > a_max) a_max = APT::abs(h_A0(i,j));
+
+    int num_errors = 0;
+    for(int i=0; i<N; i++)
+      for(int j=0; j<i; j++)
+        if(h_R(i,j) != APT::zero()) num_errors++;
+    if(cholqr)
+      for(int i=0; i<N; i++)
+        if(!(APT::real(h_R(i,i)) > 0)) num_errors++;
+
+    for(int i=0; i<N; i++) {
+      for(int j=0; j<N; j++) {
+        ScalarA s = APT::zero();
+        for(int k=0; k<M; k++)
+          s += APT::conj(h_Q(k,i))*h_Q(k,j);
+        if(APT::abs(s - (i == j ? APT::one() : APT::zero())) > tol) num_errors++;
+      }
+    }
+
+    for(int i=0; i<M; i++) {
+      for(int j=0; j<N; j++) {
+        ScalarA s = APT::zero();
+        for(int k=0; k<=j; k++)
+          s += h_Q(i,k)*h_R(k,j);
+        if(APT::abs(s - h_A0(i,j)) > tol*a_max) num_errors++;
+      }
+    }
+
+    EXPECT_EQ(num_errors,0) << (cholqr ? "cholqr2" : "tsqr") << " M: " << M << " N: " << N;
+  }
+}
+
+
+
+template<class ScalarA, class Device>
+int test_tsqr(const bool cholqr) {
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutLeft, Device> view_type_a_ll;
+  Test::impl_test_tsqr<view_type_a_ll, Device>(cholqr,0,0);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(cholqr,13,0);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(cholqr,16,16);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(cholqr,13,3);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(cholqr,2000,33);
+  Test::impl_test_tsqr<view_type_a_ll, Device>(cholqr,100000,8);
+#endif
+
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+  typedef Kokkos::View<ScalarA**, Kokkos::LayoutRight, Device> view_type_a_lr;
+  Test::impl_test_tsqr<view_type_a_lr, Device>(cholqr,0,0);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(cholqr,13,0);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(cholqr,16,16);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(cholqr,13,3);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(cholqr,2000,33);
+  Test::impl_test_tsqr<view_type_a_lr, Device>(cholqr,100000,8);
+#endif
+
+  return 1;
+}
+
+#if defined(KOKKOSKERNELS_INST_FLOAT) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, tsqr_float ) {
+    test_tsqr<float,TestExecSpace> (false);
+}
+TEST_F( TestCategory, cholqr2_float ) {
+    test_tsqr<float,TestExecSpace> (true);
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, tsqr_double ) {
+    test_tsqr<double,TestExecSpace> (false);
+}
+TEST_F( TestCategory, cholqr2_double ) {
+    test_tsqr<double,TestExecSpace> (true);
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_COMPLEX_DOUBLE) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+TEST_F( TestCategory, tsqr_complex_double ) {
+    test_tsqr<Kokkos::complex<double>,TestExecSpace> (false);
+}
+TEST_F( TestCategory, cholqr2_complex_double ) {
+    test_tsqr<Kokkos::complex<double>,TestExecSpace> (true);
+}
+#endif
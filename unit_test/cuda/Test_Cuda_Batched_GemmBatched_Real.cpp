@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_GemmBatched.hpp"
+#include "Test_Batched_GemmBatched_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_LUPivot.hpp"
+#include "Test_Batched_LUPivot_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_TeamInverse.hpp"
+#include "Test_Batched_TeamInverse_Real.hpp"
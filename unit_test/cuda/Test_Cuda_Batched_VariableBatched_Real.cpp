@@ -0,0 +1,3 @@
+#include "Test_Cuda.hpp"
+#include "Test_Batched_VariableBatched.hpp"
+#include "Test_Batched_VariableBatched_Real.hpp"
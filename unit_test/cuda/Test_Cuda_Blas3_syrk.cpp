@@ -0,0 +1,2 @@
+#include<Test_Cuda.hpp>
+#include<Test_Blas3_syrk.hpp>
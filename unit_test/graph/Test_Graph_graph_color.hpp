@@ -43,6 +43,8 @@
 
 #include <gtest/gtest.h>
 #include <Kokkos_Core.hpp>
+#include <vector>
+#include <cstdlib>
 
 #include "KokkosGraph_graph_color.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
@@ -124,9 +126,10 @@ void test_coloring(lno_t numRows,size_type nnz, lno_t bandwidth, lno_t row_size_
   graph_t static_graph (sym_adj, sym_xadj);
   input_mat = crsMat_t("CrsMatrix", numCols, newValues, static_graph);
 
-  ColoringAlgorithm coloring_algorithms[] = {COLORING_DEFAULT, COLORING_SERIAL, COLORING_VB, COLORING_VBBIT, COLORING_VBCS, COLORING_EB};
+  ColoringAlgorithm coloring_algorithms[] = {COLORING_DEFAULT, COLORING_SERIAL, COLORING_VB, COLORING_VBBIT, COLORING_VBCS, COLORING_EB,
+                                             COLORING_JP, COLORING_JP_LDF, COLORING_JP_SL};
 
-  for (int ii = 0; ii < 6; ++ii){
+  for (int ii = 0; ii < 9; ++ii){
     ColoringAlgorithm coloring_algorithm = coloring_algorithms[ii];
     color_view_t vector_colors;
     size_t num_colors;
@@ -171,15 +174,135 @@ void test_coloring(lno_t numRows,size_type nnz, lno_t bandwidth, lno_t row_size_
     EXPECT_TRUE( (num_conflict == conf));
 
     EXPECT_TRUE( (num_conflict == 0));
+
+    //Jones-Plassmann colorings must be the same in every run.
+    if (coloring_algorithm == COLORING_JP || coloring_algorithm == COLORING_JP_LDF || coloring_algorithm == COLORING_JP_SL){
+      color_view_t vector_colors2;
+      size_t num_colors2;
+      run_graphcolor<crsMat_t, device>(input_mat, coloring_algorithm, num_colors2, vector_colors2);
+      EXPECT_TRUE( (num_colors == num_colors2));
+
+      typename color_view_t::HostMirror hcolor = Kokkos::create_mirror_view (vector_colors);
+      typename color_view_t::HostMirror hcolor2 = Kokkos::create_mirror_view (vector_colors2);
+      Kokkos::deep_copy (hcolor , vector_colors);
+      Kokkos::deep_copy (hcolor2 , vector_colors2);
+      lno_t num_diff = 0;
+      for (lno_t i = 0; i < num_rows_1; ++i){
+        if (hcolor(i) != hcolor2(i)) num_diff++;
+      }
+      EXPECT_TRUE( (num_diff == 0));
+    }
   }
   //device::execution_space::finalize();
 
 }
 
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_coloring_incremental(lno_t numRows,size_type nnz, lno_t bandwidth, lno_t row_size_variance) {
+  typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type lno_view_t;
+  typedef typename graph_t::entries_type lno_nnz_view_t;
+  typedef typename lno_view_t::non_const_type row_map_t;
+  typedef typename lno_nnz_view_t::non_const_type entries_t;
+  typedef typename graph_t::entries_type::non_const_type color_view_t;
+
+  typedef KokkosKernelsHandle
+      <size_type,lno_t, scalar_t,
+      typename device::execution_space, typename device::memory_space,typename device::memory_space > KernelHandle;
+
+  lno_t numCols = numRows;
+  crsMat_t input_mat = KokkosKernels::Impl::kk_generate_sparse_matrix<crsMat_t>(numRows,numCols,nnz,row_size_variance, bandwidth);
+
+  row_map_t sym_xadj;
+  entries_t sym_adj;
+  KokkosKernels::Impl::symmetrize_graph_symbolic_hashmap<lno_view_t, lno_nnz_view_t, row_map_t, entries_t, device>
+    (numRows, input_mat.graph.row_map, input_mat.graph.entries, sym_xadj, sym_adj);
+
+  ColoringAlgorithm coloring_algorithms[] = {COLORING_VB, COLORING_VBBIT, COLORING_VBCS};
+
+  for (int ii = 0; ii < 3; ++ii){
+    KernelHandle kh;
+    kh.create_graph_coloring_handle(coloring_algorithms[ii]);
+    graph_color<KernelHandle, row_map_t, entries_t>(&kh, numRows, numCols, sym_xadj, sym_adj);
+
+    color_view_t colors = kh.get_graph_coloring_handle()->get_vertex_colors();
+    typename color_view_t::HostMirror hcolors = Kokkos::create_mirror_view (colors);
+    typename row_map_t::HostMirror hrm = Kokkos::create_mirror_view (sym_xadj);
+    typename entries_t::HostMirror hentries = Kokkos::create_mirror_view (sym_adj);
+    Kokkos::deep_copy (hcolors, colors);
+    Kokkos::deep_copy (hrm, sym_xadj);
+    Kokkos::deep_copy (hentries, sym_adj);
+
+    //connect pairs of vertices with the same color, so that the previous coloring becomes invalid.
+    std::vector<std::vector<lno_t> > new_adj(numRows);
+    std::vector<lno_t> changed;
+    srand(ii + 1);
+    for (lno_t k = 0; k < numRows / 100 + 1; ++k){
+      const lno_t u = rand() % numRows;
+      lno_t v = rand() % numRows;
+      for (lno_t t = 0; t < numRows && (v == u || hcolors(v) != hcolors(u)); ++t) v = (v + 1) % numRows;
+      if (v == u) continue;
+      new_adj[u].push_back(v);
+      new_adj[v].push_back(u);
+      changed.push_back(u);
+      changed.push_back(v);
+    }
+
+    const size_type new_nnz = hrm(numRows) + changed.size();
+    row_map_t new_xadj("new rowmap", numRows + 1);
+    entries_t new_entries("new entries", new_nnz);
+    typename row_map_t::HostMirror hnew_xadj = Kokkos::create_mirror_view (new_xadj);
+    typename entries_t::HostMirror hnew_entries = Kokkos::create_mirror_view (new_entries);
+    size_type pos = 0;
+    for (lno_t i = 0; i < numRows; ++i){
+      hnew_xadj(i) = pos;
+      for (size_type j = hrm(i); j < hrm(i + 1); ++j) hnew_entries(pos++) = hentries(j);
+      for (size_t j = 0; j < new_adj[i].size(); ++j) hnew_entries(pos++) = new_adj[i][j];
+    }
+    hnew_xadj(numRows) = pos;
+    EXPECT_TRUE( (pos == new_nnz));
+    Kokkos::deep_copy (new_xadj, hnew_xadj);
+    Kokkos::deep_copy (new_entries, hnew_entries);
+
+    entries_t changed_vertices("changed vertices", changed.size());
+    typename entries_t::HostMirror hchanged = Kokkos::create_mirror_view (changed_vertices);
+    for (size_t k = 0; k < changed.size(); ++k) hchanged(k) = changed[k];
+    Kokkos::deep_copy (changed_vertices, hchanged);
+
+    graph_color_incremental<KernelHandle, row_map_t, entries_t, entries_t>
+      (&kh, numRows, numCols, new_xadj, new_entries, colors, changed_vertices);
+
+    color_view_t new_colors = kh.get_graph_coloring_handle()->get_vertex_colors();
+    lno_t num_conflict = KokkosKernels::Impl::kk_is_d1_coloring_valid
+        <row_map_t, entries_t, color_view_t, typename device::execution_space>
+    (numRows, numCols, new_xadj, new_entries, new_colors);
+    EXPECT_TRUE( (num_conflict == 0));
+
+    //vertices outside of the frontier keep their colors.
+    typename color_view_t::HostMirror hnew_colors = Kokkos::create_mirror_view (new_colors);
+    Kokkos::deep_copy (hnew_colors, new_colors);
+    std::vector<char> in_frontier(numRows, 0);
+    for (size_t k = 0; k < changed.size(); ++k){
+      const lno_t u = changed[k];
+      in_frontier[u] = 1;
+      for (size_type j = hnew_xadj(u); j < hnew_xadj(u + 1); ++j) in_frontier[hnew_entries(j)] = 1;
+    }
+    lno_t num_changed_colors = 0;
+    for (lno_t i = 0; i < numRows; ++i){
+      if (!in_frontier[i] && hnew_colors(i) != hcolors(i)) num_changed_colors++;
+      if (hnew_colors(i) <= 0) num_changed_colors++;
+    }
+    EXPECT_TRUE( (num_changed_colors == 0));
+    kh.destroy_graph_coloring_handle();
+  }
+}
+
 #define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
 TEST_F( TestCategory, graph ## _ ## graph_color ## _ ## SCALAR ## _ ## ORDINAL ## _ ## OFFSET ## _ ## DEVICE ) { \
   test_coloring<SCALAR,ORDINAL,OFFSET,DEVICE>(50000, 50000 * 30, 200, 10); \
   test_coloring<SCALAR,ORDINAL,OFFSET,DEVICE>(50000, 50000 * 30, 100, 10); \
+  test_coloring_incremental<SCALAR,ORDINAL,OFFSET,DEVICE>(10000, 10000 * 20, 100, 10); \
 }
 
 #if (defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
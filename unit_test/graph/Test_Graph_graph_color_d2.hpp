@@ -126,7 +126,7 @@ void test_coloring_d2(lno_t numRows,size_type nnz, lno_t bandwidth, lno_t row_si
   graph_t static_graph (sym_adj, sym_xadj);
   input_mat = crsMat_t("CrsMatrix", numCols, newValues, static_graph);
 
-  ColoringAlgorithm coloring_algorithms[] = {COLORING_SPGEMM, COLORING_D2};
+  ColoringAlgorithm coloring_algorithms[] = {COLORING_SPGEMM, COLORING_D2, COLORING_D2_VB_BIT};
 
 
   typedef KokkosKernelsHandle
@@ -154,7 +154,7 @@ void test_coloring_d2(lno_t numRows,size_type nnz, lno_t bandwidth, lno_t row_si
    // done with spgemm 
    cp.destroy_spgemm_handle();
 
-  int num_algorithms = 2;
+  int num_algorithms = 3;
 
   for (int ii = 0; ii < num_algorithms; ++ii){
 
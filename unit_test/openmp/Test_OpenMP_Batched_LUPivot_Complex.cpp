@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_LUPivot.hpp"
+#include "Test_Batched_LUPivot_Complex.hpp"
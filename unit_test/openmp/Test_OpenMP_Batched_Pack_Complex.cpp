@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_Pack.hpp"
+#include "Test_Batched_Pack_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_SerialSymEigen.hpp"
+#include "Test_Batched_SerialSymEigen_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_OpenMP.hpp"
+#include "Test_Batched_TeamInverse.hpp"
+#include "Test_Batched_TeamInverse_Complex.hpp"
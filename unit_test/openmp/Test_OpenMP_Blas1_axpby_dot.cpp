@@ -0,0 +1,2 @@
+#include<Test_OpenMP.hpp>
+#include<Test_Blas1_axpby_dot.hpp>
@@ -0,0 +1,2 @@
+#include<Test_OpenMP.hpp>
+#include<Test_Blas1_update_nrm2.hpp>
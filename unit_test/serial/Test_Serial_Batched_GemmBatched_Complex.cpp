@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_GemmBatched.hpp"
+#include "Test_Batched_GemmBatched_Complex.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_Pack.hpp"
+#include "Test_Batched_Pack_Real.hpp"
@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_QR.hpp"
+#include "Test_Batched_QR_Real.hpp"
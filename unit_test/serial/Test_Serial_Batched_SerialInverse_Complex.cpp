@@ -0,0 +1,3 @@
+#include "Test_Serial.hpp"
+#include "Test_Batched_SerialInverse.hpp"
+#include "Test_Batched_SerialInverse_Complex.hpp"
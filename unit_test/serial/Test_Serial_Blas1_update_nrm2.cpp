@@ -0,0 +1,2 @@
+#include<Test_Serial.hpp>
+#include<Test_Blas1_update_nrm2.hpp>
@@ -51,6 +51,7 @@
 #include <KokkosSparse_spmv.hpp>
 #include <KokkosBlas1_dot.hpp>
 #include <KokkosBlas1_axpby.hpp>
+#include <KokkosBlas1_nrm2.hpp>
 #include <cstdlib>
 #include <iostream>
 #include <complex>
@@ -139,6 +140,59 @@ int run_gauss_seidel_1(
   return 0;
 }
 
+//runs symmetric gauss seidel once with the vectors in the original order,
+//and once with the vectors in the permuted order, and returns the difference of the results.
+template <typename crsMat_t, typename device>
+typename Kokkos::Details::ArithTraits<typename crsMat_t::value_type>::mag_type
+run_gauss_seidel_permuted_vectors(
+    crsMat_t input_mat,
+    KokkosSparse::GSAlgorithm gs_algorithm,
+    typename crsMat_t::values_type::const_type y_vector){
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type lno_view_t;
+  typedef typename graph_t::entries_type   lno_nnz_view_t;
+  typedef typename crsMat_t::values_type::non_const_type scalar_view_t;
+
+  typedef typename lno_view_t::value_type size_type;
+  typedef typename lno_nnz_view_t::value_type lno_t;
+  typedef typename scalar_view_t::value_type scalar_t;
+
+  typedef KokkosKernelsHandle
+      <size_type,lno_t, scalar_t,
+      typename device::execution_space, typename device::memory_space,typename device::memory_space > KernelHandle;
+
+  KernelHandle kh;
+  kh.create_gs_handle(gs_algorithm);
+
+  const lno_t num_rows_1 = input_mat.numRows();
+  const lno_t num_cols_1 = input_mat.numCols();
+  const int apply_count = 10;
+
+  gauss_seidel_symbolic
+    (&kh, num_rows_1, num_cols_1, input_mat.graph.row_map, input_mat.graph.entries, true);
+  gauss_seidel_numeric
+    (&kh, num_rows_1, num_cols_1, input_mat.graph.row_map, input_mat.graph.entries, input_mat.values, true);
+
+  scalar_view_t x_vector ("x vector", num_cols_1);
+  symmetric_gauss_seidel_apply
+    (&kh, num_rows_1, num_cols_1, input_mat.graph.row_map, input_mat.graph.entries, input_mat.values, x_vector, y_vector, true, true, apply_count);
+
+  //same sweeps on the permuted vectors.
+  scalar_view_t permuted_x ("permuted x", num_cols_1);
+  scalar_view_t permuted_y ("permuted y", num_rows_1);
+  gauss_seidel_permute_vector(&kh, num_rows_1, y_vector, permuted_y);
+  kh.get_gs_handle()->set_apply_on_permuted_vectors(true);
+  symmetric_gauss_seidel_apply
+    (&kh, num_rows_1, num_cols_1, input_mat.graph.row_map, input_mat.graph.entries, input_mat.values, permuted_x, permuted_y, true, true, apply_count);
+
+  scalar_view_t x_vector2 ("x vector 2", num_cols_1);
+  gauss_seidel_unpermute_vector(&kh, num_cols_1, permuted_x, x_vector2);
+  kh.destroy_gs_handle();
+
+  KokkosBlas::axpby(scalar_t(1.0), x_vector, scalar_t(-1.0), x_vector2);
+  return KokkosBlas::nrm2(x_vector2);
+}
+
 template<typename scalar_view_t>
 scalar_view_t create_x_vector(size_t nv, double max_value = 10.0){
   scalar_view_t kok_x ("X", nv);
@@ -244,6 +298,10 @@ void test_gauss_seidel(lno_t numRows, size_type nnz, lno_t bandwidth, lno_t row_
         }
       }
     }
+    //the sweeps on the permuted vectors must give the same result.
+    typename Kokkos::Details::ArithTraits<scalar_t>::mag_type permuted_diff =
+        run_gauss_seidel_permuted_vectors<crsMat_t, device>(input_mat, gs_algorithm, y_vector);
+    EXPECT_TRUE( (permuted_diff <= 1e-4 * initial_norm_res));
   }
   //device::execution_space::finalize();
 }
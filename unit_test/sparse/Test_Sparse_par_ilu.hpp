@@ -0,0 +1,333 @@
+/*
+//@HEADER
+// ************************************************************************
+//
+//               KokkosKernels 0.9: Linear Algebra and Graph Kernels
+//                 Copyright 2017 Sandia Corporation
+//
+// Under the terms of Contract DE-AC04-94AL85000 with Sandia Corporation,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact Siva Rajamanickam (srajama@sandia.gov)
+//
+// ************************************************************************
+//@HEADER
+
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_par_ilu.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <complex>
+#include <cmath>
+#include <vector>
+
+#ifndef kokkos_complex_double
+#define kokkos_complex_double Kokkos::complex<double>
+#define kokkos_complex_float Kokkos::complex<float>
+#endif
+
+using namespace KokkosKernels;
+using namespace KokkosKernels::Experimental;
+using namespace KokkosSparse;
+using namespace KokkosSparse::Experimental;
+namespace Test {
+
+//5-point convection-diffusion stencil on a grid_size x grid_size grid.
+//Rows are written with the diagonal last, so they are not sorted.
+template <typename crsMat_t>
+crsMat_t create_convection_diffusion_matrix(typename crsMat_t::ordinal_type grid_size){
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type row_map_view_t;
+  typedef typename graph_t::entries_type::non_const_type cols_view_t;
+  typedef typename crsMat_t::values_type::non_const_type values_view_t;
+  typedef typename row_map_view_t::non_const_value_type size_type;
+  typedef typename cols_view_t::non_const_value_type lno_t;
+  typedef typename values_view_t::non_const_value_type scalar_t;
+
+  const lno_t nrows = grid_size * grid_size;
+  std::vector<size_type> xadj(nrows + 1, 0);
+  std::vector<lno_t> adj;
+  std::vector<scalar_t> vals;
+  for (lno_t gi = 0; gi < grid_size; ++gi){
+    for (lno_t gj = 0; gj < grid_size; ++gj){
+      const lno_t row = gi * grid_size + gj;
+      if (gi > 0)             { adj.push_back(row - grid_size); vals.push_back(scalar_t(-1.3)); }
+      if (gj > 0)             { adj.push_back(row - 1);         vals.push_back(scalar_t(-1.2)); }
+      if (gj < grid_size - 1) { adj.push_back(row + 1);         vals.push_back(scalar_t(-0.8)); }
+      if (gi < grid_size - 1) { adj.push_back(row + grid_size); vals.push_back(scalar_t(-0.7)); }
+      adj.push_back(row); vals.push_back(scalar_t(4.5));
+      xadj[row + 1] = adj.size();
+    }
+  }
+
+  row_map_view_t rowmap_view("rowmap_view", nrows + 1);
+  cols_view_t columns_view("colsmap_view", adj.size());
+  values_view_t values_view("values_view", adj.size());
+  typename row_map_view_t::HostMirror hr = Kokkos::create_mirror_view (rowmap_view);
+  typename cols_view_t::HostMirror hc = Kokkos::create_mirror_view (columns_view);
+  typename values_view_t::HostMirror hv = Kokkos::create_mirror_view (values_view);
+  for (lno_t i = 0; i <= nrows; ++i) hr(i) = xadj[i];
+  for (size_t i = 0; i < adj.size(); ++i){
+    hc(i) = adj[i];
+    hv(i) = vals[i];
+  }
+  Kokkos::deep_copy (rowmap_view , hr);
+  Kokkos::deep_copy (columns_view , hc);
+  Kokkos::deep_copy (values_view , hv);
+
+  graph_t static_graph (columns_view, rowmap_view);
+  return crsMat_t("CrsMatrix", nrows, values_view, static_graph);
+}
+
+//Computes ||A - LU||_F over the pattern of A on the host, independently of the kernel.
+template <typename crsMat_t, typename row_view_t, typename nnz_view_t, typename scalar_view_t>
+double check_par_ilu_residual(
+    crsMat_t A,
+    row_view_t L_rowmap, nnz_view_t L_entries, scalar_view_t L_values,
+    row_view_t U_rowmap, nnz_view_t U_entries, scalar_view_t U_values){
+  typedef typename crsMat_t::ordinal_type lno_t;
+  typedef typename crsMat_t::size_type size_type;
+  typedef typename crsMat_t::value_type scalar_t;
+  typedef Kokkos::Details::ArithTraits<scalar_t> KAT;
+
+  auto hAr = Kokkos::create_mirror_view(A.graph.row_map); Kokkos::deep_copy(hAr, A.graph.row_map);
+  auto hAe = Kokkos::create_mirror_view(A.graph.entries); Kokkos::deep_copy(hAe, A.graph.entries);
+  auto hAv = Kokkos::create_mirror_view(A.values); Kokkos::deep_copy(hAv, A.values);
+  auto hLr = Kokkos::create_mirror_view(L_rowmap); Kokkos::deep_copy(hLr, L_rowmap);
+  auto hLe = Kokkos::create_mirror_view(L_entries); Kokkos::deep_copy(hLe, L_entries);
+  auto hLv = Kokkos::create_mirror_view(L_values); Kokkos::deep_copy(hLv, L_values);
+  auto hUr = Kokkos::create_mirror_view(U_rowmap); Kokkos::deep_copy(hUr, U_rowmap);
+  auto hUe = Kokkos::create_mirror_view(U_entries); Kokkos::deep_copy(hUe, U_entries);
+  auto hUv = Kokkos::create_mirror_view(U_values); Kokkos::deep_copy(hUv, U_values);
+
+  const lno_t nrows = A.numRows();
+  double residual = 0;
+  for (lno_t i = 0; i < nrows; ++i){
+    for (size_type p = hAr(i); p < hAr(i + 1); ++p){
+      const lno_t j = hAe(p);
+      scalar_t lu = KAT::zero();
+      //(LU)_ij = sum_k l_ik u_kj, with l_ii = 1.
+      for (size_type q = hLr(i); q < hLr(i + 1); ++q){
+        const lno_t k = hLe(q);
+        for (size_type r = hUr(k); r < hUr(k + 1); ++r){
+          if (hUe(r) == j) lu += hLv(q) * hUv(r);
+        }
+      }
+      for (size_type r = hUr(i); r < hUr(i + 1); ++r){
+        if (hUe(r) == j) lu += hUv(r);
+      }
+      const double abs_r = KAT::abs(hAv(p) - lu);
+      residual += abs_r * abs_r;
+    }
+  }
+  return std::sqrt(residual);
+}
+
+template <typename crsMat_t, typename device>
+double run_par_ilu(
+    crsMat_t input_mat,
+    KokkosSparse::ParILUAlgorithm algo,
+    int sweeps,
+    double &reported_residual){
+  typedef typename crsMat_t::StaticCrsGraphType graph_t;
+  typedef typename graph_t::row_map_type::non_const_type lno_view_t;
+  typedef typename graph_t::entries_type::non_const_type lno_nnz_view_t;
+  typedef typename crsMat_t::values_type::non_const_type scalar_view_t;
+
+  typedef typename lno_view_t::value_type size_type;
+  typedef typename lno_nnz_view_t::value_type lno_t;
+  typedef typename scalar_view_t::value_type scalar_t;
+
+  typedef KokkosKernelsHandle
+      <size_type,lno_t, scalar_t,
+      typename device::execution_space, typename device::memory_space,typename device::memory_space > KernelHandle;
+
+  KernelHandle kh;
+  kh.create_par_ilu_handle(algo, sweeps);
+
+  const lno_t num_rows = input_mat.numRows();
+  lno_view_t L_rowmap, U_rowmap;
+  lno_nnz_view_t L_entries, U_entries;
+  scalar_view_t L_values, U_values;
+
+  par_ilu_symbolic(&kh, num_rows, input_mat.graph.row_map, input_mat.graph.entries,
+      L_rowmap, L_entries, U_rowmap, U_entries);
+
+  EXPECT_EQ(size_t(input_mat.nnz()), size_t(L_entries.extent(0) + U_entries.extent(0)));
+
+  par_ilu_numeric(&kh, num_rows, input_mat.values,
+      L_rowmap, L_entries, L_values, U_rowmap, U_entries, U_values);
+
+  EXPECT_EQ(sweeps, kh.get_par_ilu_handle()->get_num_sweeps_performed());
+  reported_residual = kh.get_par_ilu_handle()->get_residual_norm();
+
+  kh.destroy_par_ilu_handle();
+  return check_par_ilu_residual(input_mat, L_rowmap, L_entries, L_values, U_rowmap, U_entries, U_values);
+}
+}
+
+template <typename scalar_t, typename lno_t, typename size_type, typename device>
+void test_par_ilu(lno_t grid_size) {
+
+  using namespace Test;
+  typedef typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+  typedef typename Kokkos::Details::ArithTraits<scalar_t>::mag_type mag_t;
+  const double eps = std::is_same<mag_t, float>::value ? 1e-3 : 1e-9;
+
+  crsMat_t input_mat = create_convection_diffusion_matrix<crsMat_t>(grid_size);
+
+  KokkosSparse::ParILUAlgorithm algos[] = {PARILU_SYNC, PARILU_ASYNC};
+  for (int ii = 0; ii < 2; ++ii){
+    double reported_1 = 0, reported_3 = 0, reported_all = 0;
+    double residual_1 = run_par_ilu<crsMat_t, device>(input_mat, algos[ii], 1, reported_1);
+    double residual_3 = run_par_ilu<crsMat_t, device>(input_mat, algos[ii], 3, reported_3);
+    //the factors are exact on the pattern after as many sweeps as the depth of the
+    //dependency graph, which is at most twice the number of rows.
+    double residual_all = run_par_ilu<crsMat_t, device>(input_mat, algos[ii], 4 * grid_size, reported_all);
+
+    EXPECT_NEAR(residual_1, reported_1, eps * (1 + residual_1));
+    EXPECT_NEAR(residual_3, reported_3, eps * (1 + residual_3));
+    EXPECT_TRUE(residual_3 <= residual_1 + eps);
+    EXPECT_TRUE(residual_all < 10 * eps);
+    EXPECT_TRUE(reported_all < 10 * eps);
+  }
+}
+
+
+#define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
+TEST_F( TestCategory, sparse ## _ ## par_ilu ## _ ## SCALAR ## _ ## ORDINAL ## _ ## OFFSET ## _ ## DEVICE ) { \
+  test_par_ilu<SCALAR,ORDINAL,OFFSET,DEVICE>(20); \
+}
+
+#if (defined (KOKKOSKERNELS_INST_DOUBLE) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(double, int, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_DOUBLE) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(double, int64_t, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_DOUBLE) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(double, int, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_DOUBLE) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(double, int64_t, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_FLOAT) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(float, int, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_FLOAT) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(float, int64_t, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_FLOAT) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(float, int, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_FLOAT) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(float, int64_t, size_t, TestExecSpace)
+#endif
+
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_DOUBLE_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_double, int, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_DOUBLE_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_double, int64_t, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_DOUBLE_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_double, int, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_DOUBLE_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_double, int64_t, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_FLOAT_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_float, int, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_FLOAT_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_INT) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_float, int64_t, int, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_FLOAT_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_float, int, size_t, TestExecSpace)
+#endif
+
+#if (defined (KOKKOSKERNELS_INST_KOKKOS_COMPLEX_FLOAT_) \
+ && defined (KOKKOSKERNELS_INST_ORDINAL_INT64_T) \
+ && defined (KOKKOSKERNELS_INST_OFFSET_SIZE_T) ) || (!defined(KOKKOSKERNELS_ETI_ONLY) && !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
+ EXECUTE_TEST(kokkos_complex_float, int64_t, size_t, TestExecSpace)
+#endif
+
+
+
+